@@ -86,6 +86,18 @@ namespace etl
   template <typename TIterator, typename TCompare>
   ETL_CONSTEXPR14 void insertion_sort(TIterator first, TIterator last, TCompare compare);
 
+  template <typename TIterator>
+  void intro_sort(TIterator first, TIterator last);
+
+  template <typename TIterator, typename TCompare>
+  void intro_sort(TIterator first, TIterator last, TCompare compare);
+
+  template <typename TIterator>
+  void merge_sort(TIterator first, TIterator last);
+
+  template <typename TIterator, typename TCompare>
+  void merge_sort(TIterator first, TIterator last, TCompare compare);
+
   class algorithm_exception : public etl::exception
   {
   public:
@@ -2136,15 +2148,51 @@ namespace etl
   }
 
 #if ETL_NOT_USING_STL
+  namespace private_algorithm
+  {
+    //*********************************
+    template <typename TIterator, typename TCompare>
+    typename etl::enable_if<etl::is_random_access_iterator<TIterator>::value, void>::type
+      sort_dispatch(TIterator first, TIterator last, TCompare compare)
+    {
+      etl::intro_sort(first, last, compare);
+    }
+
+    //*********************************
+    template <typename TIterator, typename TCompare>
+    typename etl::enable_if<!etl::is_random_access_iterator<TIterator>::value, void>::type
+      sort_dispatch(TIterator first, TIterator last, TCompare compare)
+    {
+      etl::shell_sort(first, last, compare);
+    }
+
+    //*********************************
+    template <typename TIterator, typename TCompare>
+    typename etl::enable_if<etl::is_random_access_iterator<TIterator>::value, void>::type
+      stable_sort_dispatch(TIterator first, TIterator last, TCompare compare)
+    {
+      etl::merge_sort(first, last, compare);
+    }
+
+    //*********************************
+    template <typename TIterator, typename TCompare>
+    typename etl::enable_if<!etl::is_random_access_iterator<TIterator>::value, void>::type
+      stable_sort_dispatch(TIterator first, TIterator last, TCompare compare)
+    {
+      etl::insertion_sort(first, last, compare);
+    }
+  }
+
   //***************************************************************************
   /// Sorts the elements.
+  /// Uses introsort for random access iterators, otherwise shell sort.
   /// Uses user defined comparison.
   ///\ingroup algorithm
   //***************************************************************************
   template <typename TIterator, typename TCompare>
   void sort(TIterator first, TIterator last, TCompare compare)
   {
-    etl::shell_sort(first, last, compare);
+    private_algorithm::sort_dispatch(first, last, compare);
   }
 
   //***************************************************************************
@@ -2154,19 +2202,20 @@ namespace etl
   template <typename TIterator>
   void sort(TIterator first, TIterator last)
   {
-    etl::shell_sort(first, last, etl::less<typename etl::iterator_traits<TIterator>::value_type>());
+    etl::sort(first, last, etl::less<typename etl::iterator_traits<TIterator>::value_type>());
   }
 
   //***************************************************************************
   /// Sorts the elements.
   /// Stable.
+  /// Uses an in-place merge sort for random access iterators, otherwise insertion sort.
   /// Uses user defined comparison.
   ///\ingroup algorithm
   //***************************************************************************
   template <typename TIterator, typename TCompare>
   void stable_sort(TIterator first, TIterator last, TCompare compare)
   {
-    etl::insertion_sort(first, last, compare);
+    private_algorithm::stable_sort_dispatch(first, last, compare);
   }
 
   //***************************************************************************
@@ -2177,7 +2226,7 @@ namespace etl
   template <typename TIterator>
   void stable_sort(TIterator first, TIterator last)
   {
-    etl::insertion_sort(first, last, etl::less<typename etl::iterator_traits<TIterator>::value_type>());
+    etl::stable_sort(first, last, etl::less<typename etl::iterator_traits<TIterator>::value_type>());
   }
 #else
   //***************************************************************************
@@ -3206,6 +3255,444 @@ namespace etl
     etl::sort_heap(first, last);
   }
 
+  //***************************************************************************
+  namespace private_algorithm
+  {
+    // Ranges at or below this size are left for the final insertion sort pass.
+    static ETL_CONSTANT ptrdiff_t intro_sort_threshold = 16;
+
+    //*********************************
+    // Insertion sort for random access iterators.
+    // Moves elements rather than rotating, so is faster for small ranges. Stable.
+    template <typename TIterator, typename TCompare>
+    void move_insertion_sort(TIterator first, TIterator last, TCompare compare)
+    {
+      typedef typename etl::iterator_traits<TIterator>::value_type value_t;
+
+      if (first == last)
+      {
+        return;
+      }
+
+      for (TIterator itr = first + 1; itr != last; ++itr)
+      {
+        value_t   value = ETL_MOVE(*itr);
+        TIterator hole  = itr;
+
+        if (compare(value, *first))
+        {
+          // The new smallest item. Shift the whole sorted range up by one.
+          etl::move_backward(first, itr, itr + 1);
+          hole = first;
+        }
+        else
+        {
+          // The first item acts as a sentinel, so no bounds check is needed.
+          TIterator previous = hole - 1;
+
+          while (compare(value, *previous))
+          {
+            *hole = ETL_MOVE(*previous);
+            hole  = previous;
+            --previous;
+          }
+        }
+
+        *hole = ETL_MOVE(value);
+      }
+    }
+
+    //*********************************
+    // Orders the items at a, b and c and then swaps the median into 'result'.
+    template <typename TIterator, typename TCompare>
+    void intro_sort_median_to(TIterator result, TIterator a, TIterator b, TIterator c, TCompare compare)
+    {
+      if (compare(*b, *a))
+      {
+        etl::iter_swap(a, b);
+      }
+
+      if (compare(*c, *b))
+      {
+        etl::iter_swap(b, c);
+
+        if (compare(*b, *a))
+        {
+          etl::iter_swap(a, b);
+        }
+      }
+
+      if (result != b)
+      {
+        etl::iter_swap(result, b);
+      }
+    }
+
+    //*********************************
+    // Selects a pivot and moves it to 'first'.
+    // Uses median of three, or Tukey's ninther for larger ranges.
+    template <typename TIterator, typename TCompare>
+    void intro_sort_select_pivot(TIterator first, TIterator last, TCompare compare)
+    {
+      typedef typename etl::iterator_traits<TIterator>::difference_type difference_t;
+
+      const difference_t length = last - first;
+      const TIterator    middle = first + (length / 2);
+      const TIterator    back   = last - 1;
+
+      if (length > 128)
+      {
+        const difference_t eighth = length / 8;
+
+        intro_sort_median_to(first + 1,  first + 1,  first + eighth,  first + (2 * eighth), compare);
+        intro_sort_median_to(middle,     middle - eighth, middle, middle + eighth, compare);
+        intro_sort_median_to(back - 1,   back - (2 * eighth), back - eighth, back - 1, compare);
+        intro_sort_median_to(first,      first + 1,  middle,  back - 1, compare);
+      }
+      else
+      {
+        intro_sort_median_to(first, first + 1, middle, back, compare);
+      }
+    }
+
+    //*********************************
+    // Hoare partition around the pivot at 'first'.
+    // Stops on items equal to the pivot, so ranges with few unique values stay balanced.
+    // Returns the start of the right hand partition.
+    template <typename TIterator, typename TCompare>
+    TIterator intro_sort_partition(TIterator first, TIterator last, TCompare compare)
+    {
+      TIterator pivot = first;
+      TIterator left  = first + 1;
+      TIterator right = last;
+
+      while (true)
+      {
+        while (compare(*left, *pivot))
+        {
+          ++left;
+        }
+
+        --right;
+
+        while (compare(*pivot, *right))
+        {
+          --right;
+        }
+
+        if (!(left < right))
+        {
+          return left;
+        }
+
+        etl::iter_swap(left, right);
+        ++left;
+      }
+    }
+
+    //*********************************
+    template <typename TIterator, typename TCompare>
+    void intro_sort_loop(TIterator first, TIterator last, int depth_limit, TCompare compare)
+    {
+      while ((last - first) > intro_sort_threshold)
+      {
+        if (depth_limit == 0)
+        {
+          // Too many poor partitions. Fall back to heap sort to guarantee O(N log N).
+          etl::make_heap(first, last, compare);
+          etl::sort_heap(first, last, compare);
+          return;
+        }
+
+        --depth_limit;
+
+        intro_sort_select_pivot(first, last, compare);
+        TIterator cut = intro_sort_partition(first, last, compare);
+
+        // Recurse into the smaller partition and loop on the larger, to bound the stack depth.
+        if ((cut - first) < (last - cut))
+        {
+          intro_sort_loop(first, cut, depth_limit, compare);
+          first = cut;
+        }
+        else
+        {
+          intro_sort_loop(cut, last, depth_limit, compare);
+          last = cut;
+        }
+      }
+    }
+  }
+
+  //***************************************************************************
+  /// Sorts the elements using introsort.
+  /// Quicksort with median of three/ninther pivots, switching to heap sort
+  /// if the recursion depth exceeds 2 log2(N), and a final insertion sort
+  /// pass over the nearly sorted result. O(N log N) worst case. Does not allocate.
+  /// Requires random access iterators.
+  /// Uses user defined comparison.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator, typename TCompare>
+  void intro_sort(TIterator first, TIterator last, TCompare compare)
+  {
+    ETL_STATIC_ASSERT(etl::is_random_access_iterator<TIterator>::value, "intro_sort requires random access iterators");
+
+    if ((last - first) < 2)
+    {
+      return;
+    }
+
+    int depth_limit = 0;
+
+    for (typename etl::iterator_traits<TIterator>::difference_type n = last - first; n > 1; n >>= 1)
+    {
+      depth_limit += 2;
+    }
+
+    private_algorithm::intro_sort_loop(first, last, depth_limit, compare);
+    private_algorithm::move_insertion_sort(first, last, compare);
+  }
+
+  //***************************************************************************
+  /// Sorts the elements using introsort.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator>
+  void intro_sort(TIterator first, TIterator last)
+  {
+    etl::intro_sort(first, last, etl::less<typename etl::iterator_traits<TIterator>::value_type>());
+  }
+
+  //***************************************************************************
+  namespace private_algorithm
+  {
+    // Runs of this size are insertion sorted before merging starts.
+    static ETL_CONSTANT ptrdiff_t merge_sort_run_length = 20;
+
+    //*********************************
+    // Merges [first, middle) and [middle, last), moving the left run into the buffer first.
+    template <typename TIterator, typename TBufferIterator, typename TCompare>
+    void merge_with_buffer_forward(TIterator first, TIterator middle, TIterator last, TBufferIterator buffer, TCompare compare)
+    {
+      TBufferIterator buffer_end = etl::move(first, middle, buffer);
+
+      while ((buffer != buffer_end) && (middle != last))
+      {
+        // Only take from the right run when strictly less, to keep the merge stable.
+        if (compare(*middle, *buffer))
+        {
+          *first = ETL_MOVE(*middle);
+          ++middle;
+        }
+        else
+        {
+          *first = ETL_MOVE(*buffer);
+          ++buffer;
+        }
+
+        ++first;
+      }
+
+      etl::move(buffer, buffer_end, first);
+    }
+
+    //*********************************
+    // Merges [first, middle) and [middle, last), moving the right run into the buffer first.
+    template <typename TIterator, typename TBufferIterator, typename TCompare>
+    void merge_with_buffer_backward(TIterator first, TIterator middle, TIterator last, TBufferIterator buffer, TCompare compare)
+    {
+      TBufferIterator buffer_end = etl::move(middle, last, buffer);
+
+      while ((buffer != buffer_end) && (first != middle))
+      {
+        // Only take from the left run when strictly greater, to keep the merge stable.
+        if (compare(*(buffer_end - 1), *(middle - 1)))
+        {
+          --middle;
+          --last;
+          *last = ETL_MOVE(*middle);
+        }
+        else
+        {
+          --buffer_end;
+          --last;
+          *last = ETL_MOVE(*buffer_end);
+        }
+      }
+
+      etl::move_backward(buffer, buffer_end, last);
+    }
+
+    //*********************************
+    // Stable merge of [first, middle) and [middle, last).
+    // Uses the buffer if either run fits, otherwise falls back to the
+    // rotation based SymMerge algorithm (Kim & Kutzner), which needs no extra memory.
+    template <typename TIterator, typename TBufferIterator, typename TCompare>
+    void merge_adaptive(TIterator first, TIterator middle, TIterator last,
+                        TBufferIterator buffer, typename etl::iterator_traits<TIterator>::difference_type buffer_size,
+                        TCompare compare)
+    {
+      typedef typename etl::iterator_traits<TIterator>::difference_type difference_t;
+
+      const difference_t length1 = middle - first;
+      const difference_t length2 = last - middle;
+
+      if ((length1 == 0) || (length2 == 0) || !compare(*middle, *(middle - 1)))
+      {
+        // Already in order.
+        return;
+      }
+
+      if ((length1 <= length2) && (length1 <= buffer_size))
+      {
+        merge_with_buffer_forward(first, middle, last, buffer, compare);
+        return;
+      }
+
+      if (length2 <= buffer_size)
+      {
+        merge_with_buffer_backward(first, middle, last, buffer, compare);
+        return;
+      }
+
+      if (length1 == 1)
+      {
+        // Move the single left item to after all right items that are less than it.
+        etl::rotate(first, middle, etl::lower_bound(middle, last, *first, compare));
+        return;
+      }
+
+      if (length2 == 1)
+      {
+        // Move the single right item to before all left items that are greater than it.
+        etl::rotate(etl::upper_bound(first, middle, *middle, compare), middle, last);
+        return;
+      }
+
+      // Find the split points so that rotating [start, middle, end) leaves
+      // two independent merges either side of the centre.
+      const difference_t half   = (last - first) / 2;
+      const difference_t n      = half + length1;
+      difference_t       start  = (length1 > half) ? n - (last - first) : 0;
+      difference_t       r      = (length1 > half) ? half : length1;
+      const difference_t p      = n - 1;
+
+      while (start < r)
+      {
+        const difference_t c = start + ((r - start) / 2);
+
+        if (!compare(*(first + (p - c)), *(first + c)))
+        {
+          start = c + 1;
+        }
+        else
+        {
+          r = c;
+        }
+      }
+
+      const difference_t end = n - start;
+
+      if ((start < length1) && (length1 < end))
+      {
+        etl::rotate(first + start, middle, first + end);
+      }
+
+      merge_adaptive(first,        first + start, first + half, buffer, buffer_size, compare);
+      merge_adaptive(first + half, first + end,   last,         buffer, buffer_size, compare);
+    }
+
+    //*********************************
+    template <typename TIterator, typename TBufferIterator, typename TCompare>
+    void merge_sort(TIterator first, TIterator last,
+                    TBufferIterator buffer, typename etl::iterator_traits<TIterator>::difference_type buffer_size,
+                    TCompare compare)
+    {
+      typedef typename etl::iterator_traits<TIterator>::difference_type difference_t;
+
+      const difference_t length = last - first;
+
+      // Sort short runs.
+      for (difference_t i = 0; i < length; i += merge_sort_run_length)
+      {
+        const difference_t run_end = etl::min(i + difference_t(merge_sort_run_length), length);
+
+        private_algorithm::move_insertion_sort(first + i, first + run_end, compare);
+      }
+
+      // Merge pairs of runs, doubling the run width each pass.
+      for (difference_t width = merge_sort_run_length; width < length; width *= 2)
+      {
+        for (difference_t i = 0; (i + width) < length; i += 2 * width)
+        {
+          const difference_t merge_end = (length - i) > (2 * width) ? i + (2 * width) : length;
+
+          merge_adaptive(first + i, first + i + width, first + merge_end, buffer, buffer_size, compare);
+        }
+      }
+    }
+  }
+
+  //***************************************************************************
+  /// Sorts the elements using an in-place merge sort.
+  /// Stable. Does not allocate.
+  /// Short runs are insertion sorted, then merged bottom up using the
+  /// rotation based SymMerge algorithm.
+  /// O(N log N) comparisons, O(N log² N) moves.
+  /// Requires random access iterators.
+  /// Uses user defined comparison.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator, typename TCompare>
+  void merge_sort(TIterator first, TIterator last, TCompare compare)
+  {
+    ETL_STATIC_ASSERT(etl::is_random_access_iterator<TIterator>::value, "merge_sort requires random access iterators");
+
+    typedef typename etl::iterator_traits<TIterator>::value_type value_t;
+
+    private_algorithm::merge_sort(first, last, static_cast<value_t*>(ETL_NULLPTR), 0, compare);
+  }
+
+  //***************************************************************************
+  /// Sorts the elements using an in-place merge sort.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator>
+  void merge_sort(TIterator first, TIterator last)
+  {
+    etl::merge_sort(first, last, etl::less<typename etl::iterator_traits<TIterator>::value_type>());
+  }
+
+  //***************************************************************************
+  /// Sorts the elements using a merge sort, using the supplied scratch buffer
+  /// for any merge where one of the runs fits in to it.
+  /// Stable. Does not allocate.
+  /// A buffer of at least half the range length gives O(N log N) moves.
+  /// Smaller buffers, or none, fall back to the in-place merge.
+  /// Requires random access iterators.
+  /// Uses user defined comparison.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator, typename TBufferIterator, typename TCompare>
+  void merge_sort(TIterator first, TIterator last, TBufferIterator buffer_first, TBufferIterator buffer_last, TCompare compare)
+  {
+    ETL_STATIC_ASSERT(etl::is_random_access_iterator<TIterator>::value, "merge_sort requires random access iterators");
+    ETL_STATIC_ASSERT(etl::is_random_access_iterator<TBufferIterator>::value, "merge_sort requires a random access buffer");
+
+    private_algorithm::merge_sort(first, last, buffer_first, buffer_last - buffer_first, compare);
+  }
+
+  //***************************************************************************
+  /// Sorts the elements using a merge sort, using the supplied scratch buffer.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator, typename TBufferIterator>
+  void merge_sort(TIterator first, TIterator last, TBufferIterator buffer_first, TBufferIterator buffer_last)
+  {
+    etl::merge_sort(first, last, buffer_first, buffer_last, etl::less<typename etl::iterator_traits<TIterator>::value_type>());
+  }
+
   //***************************************************************************
   /// Returns the maximum value.
   //***************************************************************************
@@ -41,6 +41,7 @@ SOFTWARE.
 #include "span.h"
 
 #include "base64.h"
+#include "private/base64_block.h"
 
 #include <stdint.h>
 
@@ -106,15 +107,7 @@ namespace etl
     {
       ETL_STATIC_ASSERT(ETL_IS_ITERATOR_TYPE_8_BIT_INTEGRAL(TInputIterator), "Input type must be an 8 bit integral");
 
-      while (input_begin != input_end)
-      {
-        if (!decode(*input_begin++))
-        {
-          return false;
-        }
-      }
-
-      return true;
+      return decode_range(input_begin, input_end, is_contiguous_input<TInputIterator>());
     }
 
     //*************************************************************************
@@ -126,15 +119,17 @@ namespace etl
     {
       ETL_STATIC_ASSERT(ETL_IS_ITERATOR_TYPE_8_BIT_INTEGRAL(TInputIterator), "Input type must be an 8 bit integral");
 
-      while (input_length-- != 0)
-      {
-        if (!decode(*input_begin++))
-        {
-          return false;
-        }
-      }
+      return decode_range(input_begin, input_length, is_contiguous_input<TInputIterator>());
+    }
 
-      return true;
+    //*************************************************************************
+    /// Decode from Base64
+    //*************************************************************************
+    template <typename T, size_t Extent>
+    ETL_CONSTEXPR14
+    bool decode(const etl::span<T, Extent>& input)
+    {
+      return decode(input.data(), input.size());
     }
 
     //*************************************************************************
@@ -157,6 +152,16 @@ namespace etl
       return decode(input_begin, input_length) && flush();
     }
 
+    //*************************************************************************
+    /// Decode from Base64
+    //*************************************************************************
+    template <typename T, size_t Extent>
+    ETL_CONSTEXPR14
+    bool decode_final(const etl::span<T, Extent>& input)
+    {
+      return decode(input.data(), input.size()) && flush();
+    }
+
     //*************************************************************************
     /// Flush any remaining data to the output.
     //*************************************************************************
@@ -343,18 +348,122 @@ namespace etl
   private:
 
     //*************************************************************************
-    // Translates a sextet into an index 
+    // Pointers to non-volatile data may be decoded a block at a time.
+    //*************************************************************************
+    template <typename TInputIterator>
+    struct is_contiguous_input : public etl::integral_constant<bool, etl::is_pointer<TInputIterator>::value &&
+                                                                    !etl::is_volatile<typename etl::remove_pointer<TInputIterator>::type>::value>
+    {
+    };
+
+    //*************************************************************************
+    // Decode from an iterator, one character at a time.
+    //*************************************************************************
+    template <typename TInputIterator>
+    ETL_CONSTEXPR14
+    bool decode_range(TInputIterator input_begin, size_t input_length, etl::false_type)
+    {
+      while (input_length-- != 0)
+      {
+        if (!decode(*input_begin++))
+        {
+          return false;
+        }
+      }
+
+      return true;
+    }
+
+    //*************************************************************************
+    // Decode from an iterator range, one character at a time.
+    //*************************************************************************
+    template <typename TInputIterator>
+    ETL_CONSTEXPR14
+    bool decode_range(TInputIterator input_begin, TInputIterator input_end, etl::false_type)
+    {
+      while (input_begin != input_end)
+      {
+        if (!decode(*input_begin++))
+        {
+          return false;
+        }
+      }
+
+      return true;
+    }
+
+    //*************************************************************************
+    // Decode from a pointer range.
+    //*************************************************************************
+    template <typename T>
+    ETL_CONSTEXPR14
+    bool decode_range(const T* input_begin, const T* input_end, etl::true_type)
+    {
+      return decode_range(input_begin, static_cast<size_t>(input_end - input_begin), etl::true_type());
+    }
+
+    //*************************************************************************
+    // Decode from contiguous data.
+    // Whole groups of four valid characters are decoded directly to the output
+    // buffer, as many as will fit, before calling the callback.
+    // Partial groups, padding, invalid characters and a full output buffer
+    // go through decode(T), so that errors are reported in the same way.
+    //*************************************************************************
+    template <typename T>
+    ETL_CONSTEXPR14
+    bool decode_range(const T* input, size_t input_length, etl::true_type)
+    {
+      while (input_length != 0U)
+      {
+        if ((input_buffer_length == 0U) && (input_length >= 4U) && !padding_received && !error())
+        {
+          const size_t groups  = etl::min(input_length / 4U, (output_buffer_max_size - output_buffer_length) / 3U);
+          const size_t decoded = etl::private_base64::decode_groups(input, groups, p_output_buffer + output_buffer_length, encoder_table[62], encoder_table[63]);
+
+          if (decoded != 0U)
+          {
+            input                += decoded * 4U;
+            input_length         -= decoded * 4U;
+            output_buffer_length += decoded * 3U;
+
+            if (callback.is_valid())
+            {
+              if (output_buffer_is_full())
+              {
+                callback(span());
+                reset_output_buffer();
+              }
+            }
+
+            continue;
+          }
+        }
+
+        if (!decode(*input++))
+        {
+          return false;
+        }
+
+        --input_length;
+      }
+
+      return true;
+    }
+
+    //*************************************************************************
+    // Translates a sextet into an index
     //*************************************************************************
     template <typename T>
     ETL_CONSTEXPR14
     uint32_t get_index_from_sextet(T sextet)
     {
-      const char* encoder_table_end = encoder_table + 64;
-      const char* p_sextet = etl::find(encoder_table, encoder_table_end, static_cast<char>(sextet));
+      const uint32_t index = etl::private_base64::decode_sextet(static_cast<uint8_t>(sextet),
+                                                                static_cast<uint8_t>(encoder_table[62]),
+                                                                static_cast<uint8_t>(encoder_table[63]));
 
-      if (p_sextet != encoder_table_end)
+      if (index != etl::private_base64::Invalid_Sextet)
       {
-        return static_cast<uint32_t>(etl::distance(encoder_table, p_sextet));
+        return index;
       }
       else
       {
@@ -41,6 +41,7 @@ SOFTWARE.
 #include "span.h"
 
 #include "base64.h"
+#include "private/base64_block.h"
 
 #include <stdint.h>
 
@@ -104,15 +105,7 @@ namespace etl
     {
       ETL_STATIC_ASSERT(ETL_IS_ITERATOR_TYPE_8_BIT_INTEGRAL(TInputIterator), "Input type must be an 8 bit integral");
 
-      while (input_length-- != 0)
-      {
-        if (!encode(*input_begin++))
-        {
-          return false;
-        }
-      }
-
-      return true;
+      return encode_range(input_begin, input_length, is_contiguous_input<TInputIterator>());
     }
 
     //*************************************************************************
@@ -124,15 +117,17 @@ namespace etl
     {
       ETL_STATIC_ASSERT(ETL_IS_ITERATOR_TYPE_8_BIT_INTEGRAL(TInputIterator), "Input type must be an 8 bit integral");
 
-      while (input_begin != input_end)
-      {
-        if (!encode(*input_begin++))
-        {
-          return false;
-        }
-      }
+      return encode_range(input_begin, input_end, is_contiguous_input<TInputIterator>());
+    }
 
-      return true;
+    //*************************************************************************
+    /// Encode to Base64
+    //*************************************************************************
+    template <typename T, size_t Extent>
+    ETL_CONSTEXPR14
+    bool encode(const etl::span<T, Extent>& input)
+    {
+      return encode(input.data(), input.size());
     }
 
     //*************************************************************************
@@ -155,6 +150,16 @@ namespace etl
       return encode(input_begin, input_end) && flush();
     }
 
+    //*************************************************************************
+    /// Encode to Base64
+    //*************************************************************************
+    template <typename T, size_t Extent>
+    ETL_CONSTEXPR14
+    bool encode_final(const etl::span<T, Extent>& input)
+    {
+      return encode(input.data(), input.size()) && flush();
+    }
+
     //*************************************************************************
     /// Flush any remaining data to the output.
     //*************************************************************************
@@ -417,6 +422,109 @@ namespace etl
 
   private:
 
+    //*************************************************************************
+    // Pointers to non-volatile data may be encoded a block at a time.
+    //*************************************************************************
+    template <typename TInputIterator>
+    struct is_contiguous_input : public etl::integral_constant<bool, etl::is_pointer<TInputIterator>::value &&
+                                                                    !etl::is_volatile<typename etl::remove_pointer<TInputIterator>::type>::value>
+    {
+    };
+
+    //*************************************************************************
+    // Encode from an iterator, one octet at a time.
+    //*************************************************************************
+    template <typename TInputIterator>
+    ETL_CONSTEXPR14
+    bool encode_range(TInputIterator input_begin, size_t input_length, etl::false_type)
+    {
+      while (input_length-- != 0)
+      {
+        if (!encode(*input_begin++))
+        {
+          return false;
+        }
+      }
+
+      return true;
+    }
+
+    //*************************************************************************
+    // Encode from an iterator range, one octet at a time.
+    //*************************************************************************
+    template <typename TInputIterator>
+    ETL_CONSTEXPR14
+    bool encode_range(TInputIterator input_begin, TInputIterator input_end, etl::false_type)
+    {
+      while (input_begin != input_end)
+      {
+        if (!encode(*input_begin++))
+        {
+          return false;
+        }
+      }
+
+      return true;
+    }
+
+    //*************************************************************************
+    // Encode from a pointer range.
+    //*************************************************************************
+    template <typename T>
+    ETL_CONSTEXPR14
+    bool encode_range(const T* input_begin, const T* input_end, etl::true_type)
+    {
+      return encode_range(input_begin, static_cast<size_t>(input_end - input_begin), etl::true_type());
+    }
+
+    //*************************************************************************
+    // Encode from contiguous data.
+    // Whole groups of three octets are encoded directly to the output buffer,
+    // as many as will fit, before calling the callback.
+    // Partial groups and a full output buffer go through encode(T).
+    //*************************************************************************
+    template <typename T>
+    ETL_CONSTEXPR14
+    bool encode_range(const T* input, size_t input_length, etl::true_type)
+    {
+      while (input_length != 0U)
+      {
+        if ((input_buffer_length == 0U) && (input_length >= 3U))
+        {
+          const size_t groups = etl::min(input_length / 3U, (output_buffer_max_size - output_buffer_length) / 4U);
+
+          if (groups != 0U)
+          {
+            etl::private_base64::encode_groups(input, groups, p_output_buffer + output_buffer_length, encoder_table);
+
+            input                += groups * 3U;
+            input_length         -= groups * 3U;
+            output_buffer_length += groups * 4U;
+
+            if (callback.is_valid())
+            {
+              if (output_buffer_is_full())
+              {
+                callback(span());
+                reset_output_buffer();
+              }
+            }
+
+            continue;
+          }
+        }
+
+        if (!encode(*input++))
+        {
+          return false;
+        }
+
+        --input_length;
+      }
+
+      return true;
+    }
+
     //*************************************************************************
     // Push to the output buffer.
     //*************************************************************************
@@ -121,6 +121,17 @@ namespace etl
       const bool show_base;
     };
 
+    //*********************************
+    struct shortest_spec
+    {
+      ETL_CONSTEXPR shortest_spec(bool shortest_)
+        : shortest(shortest_)
+      {
+      }
+
+      const bool shortest;
+    };
+
     //*********************************
     struct left_spec
     {
@@ -195,6 +206,12 @@ namespace etl
   //*********************************
   static ETL_CONSTANT private_basic_format_spec::showbase_spec noshowbase(false);
 
+  //*********************************
+  static ETL_CONSTANT private_basic_format_spec::shortest_spec shortest(true);
+
+  //*********************************
+  static ETL_CONSTANT private_basic_format_spec::shortest_spec noshortest(false);
+
   //***************************************************************************
   /// basic_format_spec
   //***************************************************************************
@@ -215,6 +232,7 @@ namespace etl
       , boolalpha_(false)
       , show_base_(false)
       , fill_(typename TString::value_type(' '))
+      , shortest_(false)
     {
     }
 
@@ -228,7 +246,8 @@ namespace etl
                                     bool left_justified__,
                                     bool boolalpha__,
                                     bool show_base__,
-                                    typename TString::value_type fill__)
+                                    typename TString::value_type fill__,
+                                    bool shortest__ = false)
       : base_(base__)
       , width_(width__)
       , precision_(precision__)
@@ -237,6 +256,7 @@ namespace etl
       , boolalpha_(boolalpha__)
       , show_base_(show_base__)
       , fill_(fill__)
+      , shortest_(shortest__)
     {
     }
 
@@ -253,6 +273,7 @@ namespace etl
       boolalpha_      = false;
       show_base_      = false;
       fill_           = typename TString::value_type(' ');
+      shortest_       = false;
     }
 
     //***************************************************************************
@@ -457,6 +478,26 @@ namespace etl
       return boolalpha_;
     }
 
+    //***************************************************************************
+    /// Sets the shortest flag.
+    /// Floating point values are formatted with the fewest digits that
+    /// convert back to the same value.
+    /// \return A reference to the basic_format_spec.
+    //***************************************************************************
+    ETL_CONSTEXPR14 basic_format_spec& shortest(bool b)
+    {
+      shortest_ = b;
+      return *this;
+    }
+
+    //***************************************************************************
+    /// Gets the shortest flag.
+    //***************************************************************************
+    ETL_CONSTEXPR bool is_shortest() const
+    {
+      return shortest_;
+    }
+
     //***************************************************************************
     /// Equality operator.
     //***************************************************************************
@@ -469,7 +510,8 @@ namespace etl
              (lhs.left_justified_ == rhs.left_justified_) &&
              (lhs.boolalpha_ == rhs.boolalpha_) &&
              (lhs.show_base_ == rhs.show_base_) &&
-             (lhs.fill_ == rhs.fill_);
+             (lhs.fill_ == rhs.fill_) &&
+             (lhs.shortest_ == rhs.shortest_);
     }
 
     //***************************************************************************
@@ -490,6 +532,7 @@ namespace etl
     bool boolalpha_;
     bool show_base_;
     typename TString::value_type fill_;
+    bool shortest_;
   };
 }
 
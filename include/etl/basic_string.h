@@ -45,6 +45,7 @@ SOFTWARE.
 #include "binary.h"
 #include "flags.h"
 #include "string_utilities.h"
+#include "private/string_search.h"
 
 #include <stddef.h>
 #include <stdint.h>
@@ -1436,7 +1437,7 @@ namespace etl
     //*********************************************************************
     size_type find(const ibasic_string<T>& str, size_type pos = 0) const
     {
-      return find_impl(str.begin(), str.end(), str.size(), pos);
+      return find_impl(str.data(), str.size(), pos);
     }
 
     //*********************************************************************
@@ -1447,7 +1448,7 @@ namespace etl
     template <typename TOtherTraits>
     size_type find(const etl::basic_string_view<T, TOtherTraits>& view, size_type pos = 0) const
     {
-      return find_impl(view.begin(), view.end(), view.size(), pos);
+      return find_impl(view.data(), view.size(), pos);
     }
 
     //*********************************************************************
@@ -1457,9 +1458,7 @@ namespace etl
     //*********************************************************************
     size_type find(const_pointer s, size_type pos = 0) const
     {
-      size_t sz = etl::strlen(s);
-
-      return find_impl(s, s + sz, sz, pos);
+      return find_impl(s, etl::strlen(s), pos);
     }
 
     //*********************************************************************
@@ -1470,9 +1469,7 @@ namespace etl
     //*********************************************************************
     size_type find(const_pointer s, size_type pos, size_type n) const
     {
-      size_t sz = etl::strlen(s);
-
-      return find_impl(s, s + n, sz, pos);
+      return find_impl(s, n, pos);
     }
 
     //*********************************************************************
@@ -1482,11 +1479,16 @@ namespace etl
     //*********************************************************************
     size_type find(T c, size_type position = 0) const
     {
-      const_iterator i = etl::find(begin() + position, end(), c);
+      if (position >= size())
+      {
+        return npos;
+      }
+
+      const_pointer i = private_string_search::scan_forward<true>(p_buffer + position, p_buffer + size(), c);
 
-      if (i != end())
+      if (i != p_buffer + size())
       {
-        return etl::distance(begin(), i);
+        return static_cast<size_type>(i - p_buffer);
       }
       else
       {
@@ -1501,7 +1503,7 @@ namespace etl
     //*********************************************************************
     size_type rfind(const ibasic_string<T>& str, size_type position = npos) const
     {
-      return rfind_impl(str.rbegin(), str.rend(), str.size(), position);
+      return rfind_impl(str.data(), str.size(), position);
     }
 
     //*********************************************************************
@@ -1512,7 +1514,7 @@ namespace etl
     template <typename TOtherTraits>
     size_type rfind(const etl::basic_string_view<T, TOtherTraits>& view, size_type pos = 0) const
     {
-      return rfind_impl(view.rbegin(), view.rend(), view.size(), pos);
+      return rfind_impl(view.data(), view.size(), pos);
     }
 
     //*********************************************************************
@@ -1522,12 +1524,7 @@ namespace etl
     //*********************************************************************
     size_type rfind(const_pointer s, size_type position = npos) const
     {
-      size_type len = etl::strlen(s);
-
-      const_reverse_iterator srbegin(s + len);
-      const_reverse_iterator srend(s);
-
-      return rfind_impl(srbegin, srend, len, position);
+      return rfind_impl(s, etl::strlen(s), position);
     }
 
     //*********************************************************************
@@ -1537,10 +1534,7 @@ namespace etl
     //*********************************************************************
     size_type rfind(const_pointer s, size_type position, size_type length_) const
     {
-      const_reverse_iterator srbegin(s + length_);
-      const_reverse_iterator srend(s);
-
-      return rfind_impl(srbegin, srend, length_, position);
+      return rfind_impl(s, length_, position);
     }
 
     //*********************************************************************
@@ -1555,13 +1549,11 @@ namespace etl
         position = size();
       }
 
-      position = size() - position;
+      const_pointer i = private_string_search::scan_backward<true>(p_buffer, p_buffer + position, c);
 
-      const_reverse_iterator i = etl::find(rbegin() + position, rend(), c);
-
-      if (i != rend())
+      if (i != p_buffer + position)
       {
-        return size() - etl::distance(rbegin(), i) - 1;
+        return static_cast<size_type>(i - p_buffer);
       }
       else
       {
@@ -2049,21 +2041,21 @@ namespace etl
     //*********************************************************************
     size_type find_first_of(const_pointer s, size_type position, size_type n) const
     {
-      if (position < size())
+      if (position >= size())
       {
-        for (size_type i = position; i < size(); ++i)
-        {
-          for (size_type j = 0; j < n; ++j)
-          {
-            if (p_buffer[i] == s[j])
-            {
-              return i;
-            }
-          }
-        }
+        return npos;
       }
 
-      return npos;
+      const_pointer i = private_string_search::find_of<true>(p_buffer + position, p_buffer + size(), s, n);
+
+      if (i != p_buffer + size())
+      {
+        return static_cast<size_type>(i - p_buffer);
+      }
+      else
+      {
+        return npos;
+      }
     }
 
     //*********************************************************************
@@ -2073,18 +2065,21 @@ namespace etl
     //*********************************************************************
     size_type find_first_of(value_type c, size_type position = 0) const
     {
-      if (position < size())
+      if (position >= size())
       {
-        for (size_type i = position; i < size(); ++i)
-        {
-          if (p_buffer[i] == c)
-          {
-            return i;
-          }
-        }
+        return npos;
       }
 
-      return npos;
+      const_pointer i = private_string_search::scan_forward<true>(p_buffer + position, p_buffer + size(), c);
+
+      if (i != p_buffer + size())
+      {
+        return static_cast<size_type>(i - p_buffer);
+      }
+      else
+      {
+        return npos;
+      }
     }
 
     //*********************************************************************
@@ -2133,23 +2128,16 @@ namespace etl
 
       position = etl::min(position, size() - 1);
 
-      const_reverse_iterator it = rbegin() + size() - position - 1;
+      const_pointer i = private_string_search::rfind_of<true>(p_buffer, p_buffer + position + 1U, s, n);
 
-      while (it != rend())
+      if (i != p_buffer + position + 1U)
       {
-        for (size_type j = 0; j < n; ++j)
-        {
-          if (p_buffer[position] == s[j])
-          {
-            return position;
-          }
-        }
-
-        ++it;
-        --position;
+        return static_cast<size_type>(i - p_buffer);
+      }
+      else
+      {
+        return npos;
       }
-
-      return npos;
     }
 
     //*********************************************************************
@@ -2166,20 +2154,16 @@ namespace etl
 
       position = etl::min(position, size() - 1);
 
-      const_reverse_iterator it = rbegin() + size() - position - 1;
+      const_pointer i = private_string_search::scan_backward<true>(p_buffer, p_buffer + position + 1U, c);
 
-      while (it != rend())
+      if (i != p_buffer + position + 1U)
       {
-        if (p_buffer[position] == c)
-        {
-          return position;
-        }
-
-        ++it;
-        --position;
+        return static_cast<size_type>(i - p_buffer);
+      }
+      else
+      {
+        return npos;
       }
-
-      return npos;
     }
 
     //*********************************************************************
@@ -2221,28 +2205,21 @@ namespace etl
     //*********************************************************************
     size_type find_first_not_of(const_pointer s, size_type position, size_type n) const
     {
-      if (position < size())
+      if (position >= size())
       {
-        for (size_type i = position; i < size(); ++i)
-        {
-          bool found = false;
-
-          for (size_type j = 0; j < n; ++j)
-          {
-            if (p_buffer[i] == s[j])
-            {
-              found = true;
-            }
-          }
-
-          if (!found)
-          {
-            return i;
-          }
-        }
+        return npos;
       }
 
-      return npos;
+      const_pointer i = private_string_search::find_of<false>(p_buffer + position, p_buffer + size(), s, n);
+
+      if (i != p_buffer + size())
+      {
+        return static_cast<size_type>(i - p_buffer);
+      }
+      else
+      {
+        return npos;
+      }
     }
 
     //*********************************************************************
@@ -2252,18 +2229,21 @@ namespace etl
     //*********************************************************************
     size_type find_first_not_of(value_type c, size_type position = 0) const
     {
-      if (position < size())
+      if (position >= size())
       {
-        for (size_type i = position; i < size(); ++i)
-        {
-          if (*(p_buffer + i) != c)
-          {
-            return i;
-          }
-        }
+        return npos;
       }
 
-      return npos;
+      const_pointer i = private_string_search::scan_forward<false>(p_buffer + position, p_buffer + size(), c);
+
+      if (i != p_buffer + size())
+      {
+        return static_cast<size_type>(i - p_buffer);
+      }
+      else
+      {
+        return npos;
+      }
     }
 
     //*********************************************************************
@@ -2312,30 +2292,16 @@ namespace etl
 
       position = etl::min(position, size() - 1);
 
-      const_reverse_iterator it = rbegin() + size() - position - 1;
+      const_pointer i = private_string_search::rfind_of<false>(p_buffer, p_buffer + position + 1U, s, n);
 
-      while (it != rend())
+      if (i != p_buffer + position + 1U)
       {
-        bool found = false;
-
-        for (size_type j = 0; j < n; ++j)
-        {
-          if (p_buffer[position] == s[j])
-          {
-            found = true;
-          }
-        }
-
-        if (!found)
-        {
-          return position;
-        }
-
-        ++it;
-        --position;
+        return static_cast<size_type>(i - p_buffer);
+      }
+      else
+      {
+        return npos;
       }
-
-      return npos;
     }
 
     //*********************************************************************
@@ -2350,20 +2316,16 @@ namespace etl
 
       position = etl::min(position, size() - 1);
 
-      const_reverse_iterator it = rbegin() + size() - position - 1;
+      const_pointer i = private_string_search::scan_backward<false>(p_buffer, p_buffer + position + 1U, c);
 
-      while (it != rend())
+      if (i != p_buffer + position + 1U)
       {
-        if (p_buffer[position] != c)
-        {
-          return position;
-        }
-
-        ++it;
-        --position;
+        return static_cast<size_type>(i - p_buffer);
+      }
+      else
+      {
+        return npos;
       }
-
-      return npos;
     }
 
     //*************************************************************************
@@ -2845,31 +2807,35 @@ namespace etl
     //*************************************************************************
     /// Common implementation for 'find'.
     //*************************************************************************
-    template <typename TIterator>
-    size_type find_impl(TIterator first, TIterator last, size_type sz, size_type pos = 0) const
+    size_type find_impl(const_pointer s, size_type sz, size_type pos = 0) const
     {
-      if ((pos + sz) > size())
+      if ((pos > size()) || (sz > (size() - pos)))
       {
         return npos;
       }
 
-      const_iterator iposition = etl::search(begin() + pos, end(), first, last);
+      if (sz == 0U)
+      {
+        return pos;
+      }
+
+      const_pointer i = private_string_search::find_substring(p_buffer + pos, p_buffer + size(), s, sz);
 
-      if (iposition == end())
+      if (i != p_buffer + size())
       {
-        return npos;
+        return static_cast<size_type>(i - p_buffer);
       }
       else
       {
-        return etl::distance(begin(), iposition);
+        return npos;
       }
     }
 
     //*************************************************************************
     /// Common implementation for 'rfind'.
+    /// Finds the last match that lies entirely before 'pos'.
     //*************************************************************************
-    template <typename TIterator>
-    size_type rfind_impl(TIterator rfirst, TIterator rlast, size_type sz, size_type pos = 0) const
+    size_type rfind_impl(const_pointer s, size_type sz, size_type pos = 0) const
     {
       if (sz > size())
       {
@@ -2881,17 +2847,20 @@ namespace etl
         pos = size();
       }
 
-      pos = size() - pos;
+      if (sz == 0U)
+      {
+        return pos;
+      }
 
-      const_reverse_iterator iposition = etl::search(rbegin() + pos, rend(), rfirst, rlast);
+      const_pointer i = private_string_search::rfind_substring(p_buffer, p_buffer + pos, s, sz);
 
-      if (iposition == rend())
+      if (i != p_buffer + pos)
       {
-        return npos;
+        return static_cast<size_type>(i - p_buffer);
       }
       else
       {
-        return size() - sz - etl::distance(rbegin(), iposition);
+        return npos;
       }
     }
 
@@ -43,6 +43,7 @@ SOFTWARE.
 
 #include <stdint.h>
 #include <limits.h>
+#include <string.h>
 
 #include "private/minmax_push.h"
 
@@ -520,6 +521,48 @@ namespace etl
     size_t        bits_available;         ///< The number of bits still available in the bitstream buffer.
   };
 
+  namespace private_bit_stream
+  {
+    //*************************************************************************
+    /// The accumulator used by the writer and reader to move whole words.
+    //*************************************************************************
+#if ETL_USING_64BIT_TYPES
+    typedef uint64_t word_t;
+#else
+    typedef uint32_t word_t;
+#endif
+
+    static ETL_CONSTANT size_t Word_Bits = CHAR_BIT * sizeof(word_t);
+
+    //*************************************************************************
+    /// A mask of the lowest 'nbits' bits. 'nbits' may be 0 to Word_Bits.
+    //*************************************************************************
+    inline word_t low_bits_mask(size_t nbits)
+    {
+      return (nbits >= Word_Bits) ? etl::integral_limits<word_t>::max : ((word_t(1U) << nbits) - 1U);
+    }
+
+    //*************************************************************************
+    /// Stores a word to the stream, most significant byte first.
+    //*************************************************************************
+    inline void store_word(char* destination, word_t word)
+    {
+      word = etl::hton(word);
+      memcpy(destination, &word, sizeof(word));
+    }
+
+    //*************************************************************************
+    /// Loads a word from the stream, most significant byte first.
+    //*************************************************************************
+    inline word_t load_word(const char* source)
+    {
+      word_t word;
+      memcpy(&word, source, sizeof(word));
+
+      return etl::ntoh(word);
+    }
+  }
+
   //***************************************************************************
   /// Writes bits streams.
   //***************************************************************************
@@ -678,6 +721,62 @@ namespace etl
       return success;
     }
 
+    //***************************************************************************
+    /// Writes a range of integral values, each of 'nbits' bits.
+    /// For integral types only (but not bool).
+    //***************************************************************************
+    template <typename T>
+    typename etl::enable_if<etl::is_integral<T>::value && !etl::is_same<bool, typename etl::remove_cv<T>::type>::value, void>::type
+      write_unchecked(const etl::span<T>& range, uint_least8_t nbits = CHAR_BIT * sizeof(T))
+    {
+      typedef typename etl::unsigned_type<typename etl::remove_cv<T>::type>::type unsigned_t;
+
+      const T* p     = range.data();
+      size_t   count = range.size();
+
+      if (!callback.is_valid())
+      {
+        write_data<unsigned_t>(p, count, nbits);
+      }
+      else
+      {
+        // Write as many as will fit in the buffer before each flush.
+        const size_t width = etl::min(static_cast<size_t>(nbits), CHAR_BIT * sizeof(T));
+
+        while (count != 0U)
+        {
+          size_t batch = (width == 0U) ? count : etl::min(count, available(width));
+          batch = (batch == 0U) ? count : batch;
+
+          write_data<unsigned_t>(p, batch, nbits);
+
+          p     += batch;
+          count -= batch;
+        }
+      }
+    }
+
+    //***************************************************************************
+    /// Writes a range of integral values, each of 'nbits' bits.
+    /// For integral types only (but not bool).
+    /// Returns <b>false</b>, and writes nothing, if there is not enough space.
+    //***************************************************************************
+    template <typename T>
+    typename etl::enable_if<etl::is_integral<T>::value && !etl::is_same<bool, typename etl::remove_cv<T>::type>::value, bool>::type
+      write(const etl::span<T>& range, uint_least8_t nbits = CHAR_BIT * sizeof(T))
+    {
+      const size_t width = etl::min(static_cast<size_t>(nbits), CHAR_BIT * sizeof(T));
+
+      bool success = (width == 0U) || (available(width) >= range.size());
+
+      if (success)
+      {
+        write_unchecked(range, nbits);
+      }
+
+      return success;
+    }
+
     //***************************************************************************
     /// Skip n bits, up to the maximum space available.
     /// Returns <b>true</b> if the skip was possible.
@@ -852,7 +951,7 @@ namespace etl
     {
       if (callback.is_valid())
       {
-        if (bits_available_in_char != 0U)
+        if (bits_available_in_char != CHAR_BIT)
         {
           char_index = 1U; // Indicate that the first char is actually 'full'.
           flush_full_bytes();
@@ -887,48 +986,89 @@ namespace etl
     template <typename T>
     void write_data(T value, uint_least8_t nbits)
     {
+      write_data<T>(&value, 1U, nbits);
+    }
+
+    //***************************************************************************
+    /// Write 'count' values to the stream.
+    /// The bits are gathered in a word sized accumulator and stored a whole
+    /// word at a time. Only the trailing bytes are written individually.
+    /// 'T' is the unsigned type that each value is converted to.
+    //***************************************************************************
+    template <typename T, typename TValue>
+    void write_data(const TValue* values, size_t count, uint_least8_t nbits)
+    {
+      typedef private_bit_stream::word_t word_t;
+      const size_t Word_Bits = private_bit_stream::Word_Bits;
+
       // Make sure that we are not writing more bits than should be available.
       nbits = (nbits > (CHAR_BIT * sizeof(T))) ? (CHAR_BIT * sizeof(T)) : nbits;
 
-      if (stream_endianness == etl::endian::little)
+      if ((nbits == 0U) || (count == 0U))
       {
-        value = etl::reverse_bits(value);
-        value = value >> ((CHAR_BIT * sizeof(T)) - nbits);
+        return;
       }
 
-      // Send the bits to the stream.
-      while (nbits != 0)
+      const word_t mask   = private_bit_stream::low_bits_mask(nbits);
+      const bool   little = (stream_endianness == etl::endian::little);
+
+      // Pick up any bits already written to the current char.
+      size_t index    = char_index;
+      size_t acc_bits = CHAR_BIT - bits_available_in_char;
+      word_t acc      = (acc_bits == 0U) ? 0U : (static_cast<unsigned char>(pdata[index]) >> bits_available_in_char);
+
+      for (size_t i = 0U; i < count; ++i)
       {
-        unsigned char mask_width = static_cast<unsigned char>(etl::min(nbits, bits_available_in_char));
-        nbits -= mask_width;
-        T mask = ((T(1U) << mask_width) - 1U) << nbits;
+        T field = static_cast<T>(values[i]);
+
+        if (little)
+        {
+          field = static_cast<T>(etl::reverse_bits(field) >> ((CHAR_BIT * sizeof(T)) - nbits));
+        }
+
+        const word_t value = static_cast<word_t>(field) & mask;
+
+        if (nbits < (Word_Bits - acc_bits))
+        {
+          acc = (acc << nbits) | value;
+          acc_bits += nbits;
+        }
+        else
+        {
+          // The accumulator is full; store it and keep the remainder.
+          const size_t free_bits = Word_Bits - acc_bits;
+          const size_t remainder = nbits - free_bits;
 
-        // Move chunk to lowest char bits.
-        // Chunks are never larger than one char.
-        T chunk = ((value & mask) >> nbits) << (bits_available_in_char - mask_width);
+          word_t word = (free_bits == Word_Bits) ? value : ((acc << free_bits) | (value >> remainder));
+          private_bit_stream::store_word(pdata + index, word);
+          index += sizeof(word_t);
 
-        write_chunk(static_cast<char>(chunk), mask_width);
+          acc      = value & private_bit_stream::low_bits_mask(remainder);
+          acc_bits = remainder;
+        }
       }
 
-      if (callback.is_valid())
+      // Store the remaining whole chars.
+      while (acc_bits >= CHAR_BIT)
       {
-        flush_full_bytes();
+        acc_bits -= CHAR_BIT;
+        pdata[index++] = static_cast<char>(acc >> acc_bits);
       }
-    }
 
-    //***************************************************************************
-    /// Write a data chunk to the stream
-    //***************************************************************************
-    void write_chunk(char chunk, unsigned char nbits)
-    {
-      // Clear if new byte.
-      if (bits_available_in_char == CHAR_BIT)
+      // Store the partially filled char.
+      if (acc_bits != 0U)
       {
-        pdata[char_index] = 0U;
+        pdata[index] = static_cast<char>(acc << (CHAR_BIT - acc_bits));
       }
 
-      pdata[char_index] |= chunk;
-      step(nbits);
+      char_index             = index;
+      bits_available_in_char = static_cast<unsigned char>(CHAR_BIT - acc_bits);
+      bits_available        -= count * nbits;
+
+      if (callback.is_valid())
+      {
+        flush_full_bytes();
+      }
     }
 
     //***************************************************************************
@@ -944,7 +1084,7 @@ namespace etl
 
         bits_available = CHAR_BIT * length_chars;
 
-        if (bits_available_in_char != 0U)
+        if (bits_available_in_char != CHAR_BIT)
         {
           // Move a partially filled last byte to the start of the buffer.
           pdata[0] = pdata[char_index];
@@ -1149,9 +1289,10 @@ namespace etl
     {
       typedef typename etl::unsigned_type<T>::type unsigned_t;
 
-      T value = read_value<unsigned_t>(nbits, etl::is_signed<T>::value);
+      T value;
+      read_values<unsigned_t>(&value, 1U, nbits);
 
-      return static_cast<T>(value);
+      return value;
     }
 
     //***************************************************************************
@@ -1172,6 +1313,45 @@ namespace etl
       return result;
     }
 
+    //***************************************************************************
+    /// Reads a range of integral values, each of 'nbits' bits.
+    /// For integral types only (but not bool).
+    /// Returns a span of the values read.
+    //***************************************************************************
+    template <typename T>
+    typename etl::enable_if<etl::is_integral<T>::value && !etl::is_same<bool, T>::value, etl::span<const T> >::type
+      read_unchecked(etl::span<T> range, uint_least8_t nbits = CHAR_BIT * sizeof(T))
+    {
+      typedef typename etl::unsigned_type<T>::type unsigned_t;
+
+      read_values<unsigned_t>(range.data(), range.size(), nbits);
+
+      return etl::span<const T>(range.data(), range.size());
+    }
+
+    //***************************************************************************
+    /// Reads a range of integral values, each of 'nbits' bits.
+    /// For integral types only (but not bool).
+    /// Returns a span of the values read, or an empty optional, and reads
+    /// nothing, if there are not enough bits in the stream.
+    //***************************************************************************
+    template <typename T>
+    typename etl::enable_if<etl::is_integral<T>::value && !etl::is_same<bool, T>::value, etl::optional<etl::span<const T> > >::type
+      read(etl::span<T> range, uint_least8_t nbits = CHAR_BIT * sizeof(T))
+    {
+      etl::optional<etl::span<const T> > result;
+
+      const size_t width = etl::min(static_cast<size_t>(nbits), CHAR_BIT * sizeof(T));
+
+      // Do we have enough bits?
+      if ((width == 0U) || ((bits_available / width) >= range.size()))
+      {
+        result = read_unchecked<T>(range, nbits);
+      }
+
+      return result;
+    }
+
     //***************************************************************************
     /// Returns the number of bytes in the stream buffer.
     //***************************************************************************
@@ -1257,67 +1437,76 @@ namespace etl
   private:
 
     //***************************************************************************
-    /// Read a value from the stream.
-    /// It will be passed one of five unsigned types.
+    /// Read 'count' values from the stream.
+    /// Each value is extracted from a word loaded at its first char, so the
+    /// bits are gathered a whole word at a time rather than a char at a time.
+    /// 'T' is the unsigned type of each value.
     //***************************************************************************
-    template <typename T>
-    T read_value(uint_least8_t nbits, bool is_signed)
+    template <typename T, typename TValue>
+    void read_values(TValue* values, size_t count, uint_least8_t nbits)
     {
+      typedef private_bit_stream::word_t word_t;
+      const size_t Word_Bits = private_bit_stream::Word_Bits;
+
       // Make sure that we are not reading more bits than should be available.
       nbits = (nbits > (CHAR_BIT * sizeof(T))) ? (CHAR_BIT * sizeof(T)) : nbits;
 
-      T value = 0;
-      uint_least8_t bits = nbits;
-
-      // Get the bits from the stream.
-      while (nbits != 0)
+      if (nbits == 0U)
       {
-        unsigned char mask_width = static_cast<unsigned char>(etl::min(nbits, bits_available_in_char));
+        etl::fill_n(values, count, TValue(0));
+        return;
+      }
 
-        T chunk = get_chunk(mask_width);
+      const bool little    = (stream_endianness == etl::endian::little);
+      const bool do_extend = etl::is_signed<TValue>::value && (nbits != (CHAR_BIT * sizeof(T)));
 
-        nbits -= mask_width;
-        value |= static_cast<T>(chunk << nbits);
-      }
+      size_t bit_index = (char_index * CHAR_BIT) + (CHAR_BIT - bits_available_in_char);
 
-      if (stream_endianness == etl::endian::little)
+      for (size_t i = 0U; i < count; ++i)
       {
-        value = value << ((CHAR_BIT * sizeof(T)) - bits);
-        value = etl::reverse_bits(value);
-      }
+        const size_t index = bit_index / CHAR_BIT;
+        const size_t shift = bit_index % CHAR_BIT;
 
-      if (is_signed && (bits != (CHAR_BIT * sizeof(T))))
-      {
-        value = etl::sign_extend<T, T>(value, bits);
-      }
+        // A value may span one more char than the word.
+        char buffer[sizeof(word_t) + 1U];
+        const char* p = pdata + index;
 
-      return value;
-    }
+        if ((index + sizeof(buffer)) > length_chars)
+        {
+          // Near the end of the stream; pad the remaining chars with zeros.
+          const size_t remaining = (index < length_chars) ? (length_chars - index) : 0U;
+          memset(buffer, 0, sizeof(buffer));
+          memcpy(buffer, p, etl::min(remaining, sizeof(buffer)));
+          p = buffer;
+        }
 
-    //***************************************************************************
-    /// Get a data chunk from the stream
-    //***************************************************************************
-    unsigned char get_chunk(unsigned char nbits)
-    {
-      unsigned char value = pdata[char_index];
-      value >>= (bits_available_in_char - nbits);
+        word_t word = private_bit_stream::load_word(p);
 
-      unsigned char mask;
+        if (shift != 0U)
+        {
+          word = (word << shift) | (static_cast<unsigned char>(p[sizeof(word_t)]) >> (CHAR_BIT - shift));
+        }
 
-      if (nbits == CHAR_BIT)
-      {
-        mask = etl::integral_limits<unsigned char>::max;
-      }
-      else
-      {
-        mask = (1U << nbits) - 1;
-      }
+        T result = static_cast<T>(word >> (Word_Bits - nbits));
 
-      value &= mask;
+        if (little)
+        {
+          result = static_cast<T>(etl::reverse_bits(result) >> ((CHAR_BIT * sizeof(T)) - nbits));
+        }
 
-      step(nbits);
+        if (do_extend)
+        {
+          result = etl::sign_extend<T, T>(result, nbits);
+        }
 
-      return value;
+        values[i] = static_cast<TValue>(result);
+
+        bit_index += nbits;
+      }
+
+      char_index              = bit_index / CHAR_BIT;
+      bits_available_in_char  = static_cast<unsigned char>(CHAR_BIT - (bit_index % CHAR_BIT));
+      bits_available         -= count * nbits;
     }
 
     //***************************************************************************
@@ -38,6 +38,11 @@ SOFTWARE.
 #include "binary.h"
 #include "log.h"
 #include "power.h"
+#include "alignment.h"
+#include "algorithm.h"
+#include "span.h"
+
+#include <stdint.h>
 
 ///\defgroup bloom_filter bloom_filter
 /// A Bloom filter
@@ -56,6 +61,36 @@ namespace etl
         return 0;
       }
     };
+
+#if ETL_USING_64BIT_TYPES
+    //*************************************************************************
+    /// Spreads a hash over 64 bits.
+    /// This is the MurmurHash3 finaliser, which is a bijection, so full width
+    /// 64 bit hashes lose nothing and 32 bit hashes fill the upper bits.
+    //*************************************************************************
+    inline uint64_t mix_hash(uint64_t hash)
+    {
+      hash ^= hash >> 33U;
+      hash *= 0xFF51AFD7ED558CCDULL;
+      hash ^= hash >> 33U;
+      hash *= 0xC4CEB9FE1A85EC53ULL;
+      hash ^= hash >> 33U;
+
+      return hash;
+    }
+
+    //*************************************************************************
+    /// Hints that the memory will be accessed soon.
+    //*************************************************************************
+    inline void prefetch(const void* p)
+    {
+  #if defined(ETL_COMPILER_GCC) || defined(ETL_COMPILER_CLANG)
+      __builtin_prefetch(p);
+  #else
+      (void)p;
+  #endif
+    }
+#endif
   }
 
   //***************************************************************************
@@ -184,6 +219,314 @@ namespace etl
     /// The Bloom filter flags.
     etl::bitset<WIDTH> flags;
   };
+
+#if ETL_USING_64BIT_TYPES
+  //***************************************************************************
+  /// A blocked Bloom filter.
+  /// The bits for a key are all within one 64 byte block, so that adding or
+  /// testing a key touches a single cache line.
+  /// The block and the bits within it are derived from one 64 bit hash, using
+  /// double hashing for the bits, so any number of probes may be used.
+  ///	param Desired_Width    The desired number of bits. Rounded up to a whole number of blocks.
+  ///	param THash            The hash generator class. 64 bit results are preferred.
+  ///	param Number_Of_Probes The number of bits set for each key. Default = 6.
+  /// The hash class must define <b>argument_type</b>.
+  ///\ingroup bloom_filter
+  //***************************************************************************
+  template <size_t   Desired_Width,
+            typename THash,
+            size_t   Number_Of_Probes = 6U>
+  class blocked_bloom_filter
+  {
+  private:
+
+    typedef typename etl::parameter_type<typename THash::argument_type>::type parameter_t;
+
+    static ETL_CONSTANT size_t Block_Bits      = 512U;
+    static ETL_CONSTANT size_t Words_Per_Block = Block_Bits / 64U;
+    static ETL_CONSTANT size_t Batch_Size      = 8U;
+
+  public:
+
+    ETL_STATIC_ASSERT((Number_Of_Probes > 0U) && (Number_Of_Probes <= Block_Bits), "Number of probes must be in the range 1 to 512");
+
+    enum
+    {
+      // A whole number of blocks, at least one.
+      BLOCKS = (Desired_Width == 0U) ? 1U : ((Desired_Width + Block_Bits - 1U) / Block_Bits),
+      WIDTH  = BLOCKS * Block_Bits,
+      PROBES = Number_Of_Probes
+    };
+
+    //***************************************************************************
+    /// Constructor.
+    //***************************************************************************
+    blocked_bloom_filter()
+    {
+      clear();
+    }
+
+    //***************************************************************************
+    /// Clears the bloom filter of all entries.
+    //***************************************************************************
+    void clear()
+    {
+      etl::fill_n(words(), size_t(BLOCKS) * Words_Per_Block, uint64_t(0U));
+    }
+
+    //***************************************************************************
+    /// Adds a key to the filter.
+    ///\param key The key to add.
+    //***************************************************************************
+    void add(parameter_t key)
+    {
+      add_hash(get_hash(key));
+    }
+
+    //***************************************************************************
+    /// Adds a range of keys to the filter.
+    /// The blocks for each batch of keys are fetched before they are updated.
+    ///\param begin The start of the keys.
+    ///\param end   The end of the keys.
+    //***************************************************************************
+    template <typename TIterator>
+    void add(TIterator begin, TIterator end)
+    {
+      uint64_t hashes[Batch_Size];
+
+      while (begin != end)
+      {
+        const size_t n = get_batch(begin, end, hashes);
+
+        for (size_t i = 0U; i < n; ++i)
+        {
+          add_hash(hashes[i]);
+        }
+      }
+    }
+
+    //***************************************************************************
+    /// Adds a span of keys to the filter.
+    ///\param keys The keys to add.
+    //***************************************************************************
+    template <typename T, size_t Extent>
+    void add(const etl::span<T, Extent>& keys)
+    {
+      add(keys.begin(), keys.end());
+    }
+
+    //***************************************************************************
+    /// Tests a key to see if it exists in the filter.
+    ///\param  key The key to test.
+    ///\return <b>true</b> if the key exists in the filter.
+    //***************************************************************************
+    bool exists(parameter_t key) const
+    {
+      return exists_hash(get_hash(key));
+    }
+
+    //***************************************************************************
+    /// Tests a range of keys to see if they exist in the filter.
+    /// The blocks for each batch of keys are fetched before they are tested.
+    ///\param  begin  The start of the keys.
+    ///\param  end    The end of the keys.
+    ///\param  result The output for the results, one <b>bool</b> per key.
+    ///\return The output iterator after the last result.
+    //***************************************************************************
+    template <typename TIterator, typename TOutputIterator>
+    TOutputIterator exists(TIterator begin, TIterator end, TOutputIterator result) const
+    {
+      uint64_t hashes[Batch_Size];
+
+      while (begin != end)
+      {
+        const size_t n = get_batch(begin, end, hashes);
+
+        for (size_t i = 0U; i < n; ++i)
+        {
+          *result = exists_hash(hashes[i]);
+          ++result;
+        }
+      }
+
+      return result;
+    }
+
+    //***************************************************************************
+    /// Tests a span of keys to see if they exist in the filter.
+    /// Tests as many keys as there are results.
+    ///\param  keys    The keys to test.
+    ///\param  results The results, one per key.
+    ///\return The number of keys that exist in the filter.
+    //***************************************************************************
+    template <typename T, size_t Extent, size_t Result_Extent>
+    size_t exists(const etl::span<T, Extent>& keys, const etl::span<bool, Result_Extent>& results) const
+    {
+      const size_t n = etl::min(keys.size(), results.size());
+
+      exists(keys.begin(), keys.begin() + n, results.begin());
+
+      return static_cast<size_t>(etl::count(results.begin(), results.begin() + n, true));
+    }
+
+    //***************************************************************************
+    /// Returns the width of the Bloom filter.
+    //***************************************************************************
+    size_t width() const
+    {
+      return WIDTH;
+    }
+
+    //***************************************************************************
+    /// Returns the percentage of usage. Range 0 to 100.
+    //***************************************************************************
+    size_t usage() const
+    {
+      return (100 * count()) / WIDTH;
+    }
+
+    //***************************************************************************
+    /// Returns the number of filter flags set.
+    //***************************************************************************
+    size_t count() const
+    {
+      const uint64_t* p = words();
+
+      size_t total = 0U;
+
+      for (size_t i = 0U; i < (size_t(BLOCKS) * Words_Per_Block); ++i)
+      {
+        total += etl::count_bits(p[i]);
+      }
+
+      return total;
+    }
+
+  private:
+
+    //***************************************************************************
+    /// Gets the 64 bit hash for the key.
+    //***************************************************************************
+    static uint64_t get_hash(parameter_t key)
+    {
+      return private_bloom_filter::mix_hash(static_cast<uint64_t>(THash()(key)));
+    }
+
+    //***************************************************************************
+    /// Hashes up to Batch_Size keys and prefetches their blocks.
+    /// Returns the number of keys hashed.
+    //***************************************************************************
+    template <typename TIterator>
+    size_t get_batch(TIterator& begin, TIterator end, uint64_t (&hashes)[Batch_Size]) const
+    {
+      size_t n = 0U;
+
+      while ((n < Batch_Size) && (begin != end))
+      {
+        hashes[n] = get_hash(*begin);
+        private_bloom_filter::prefetch(block(hashes[n]));
+        ++begin;
+        ++n;
+      }
+
+      return n;
+    }
+
+    //***************************************************************************
+    /// Gets the block for a hash.
+    /// The upper 32 bits select the block by multiply and shift, which avoids
+    /// a division and needs no power of two block count.
+    //***************************************************************************
+    const uint64_t* block(uint64_t hash) const
+    {
+      const size_t index = static_cast<size_t>(((hash >> 32U) * uint64_t(BLOCKS)) >> 32U);
+
+      return words() + (index * Words_Per_Block);
+    }
+
+    //***************************************************************************
+    uint64_t* block(uint64_t hash)
+    {
+      return const_cast<uint64_t*>(static_cast<const blocked_bloom_filter&>(*this).block(hash));
+    }
+
+    //***************************************************************************
+    /// Bit i of the block for a hash is (h1 + (i * h2)) modulo the block size,
+    /// where h2 is odd, so the bits are all different.
+    //***************************************************************************
+    void add_hash(uint64_t hash)
+    {
+      uint64_t* p = block(hash);
+
+      uint32_t       bit  = static_cast<uint32_t>(hash);
+      const uint32_t step = static_cast<uint32_t>(hash >> 32U) | 1U;
+
+      for (size_t i = 0U; i < Number_Of_Probes; ++i)
+      {
+        const uint32_t index = bit % Block_Bits;
+
+        p[index / 64U] |= uint64_t(1U) << (index % 64U);
+        bit += step;
+      }
+    }
+
+    //***************************************************************************
+    bool exists_hash(uint64_t hash) const
+    {
+      const uint64_t* p = block(hash);
+
+      uint32_t       bit  = static_cast<uint32_t>(hash);
+      const uint32_t step = static_cast<uint32_t>(hash >> 32U) | 1U;
+
+      for (size_t i = 0U; i < Number_Of_Probes; ++i)
+      {
+        const uint32_t index = bit % Block_Bits;
+
+        if ((p[index / 64U] & (uint64_t(1U) << (index % 64U))) == 0U)
+        {
+          return false;
+        }
+
+        bit += step;
+      }
+
+      return true;
+    }
+
+    //***************************************************************************
+    uint64_t* words()
+    {
+      return storage.template get_address<uint64_t>();
+    }
+
+    //***************************************************************************
+    const uint64_t* words() const
+    {
+      return storage.template get_address<uint64_t>();
+    }
+
+#if ETL_USING_CPP11
+    static ETL_CONSTANT size_t Block_Alignment = Block_Bits / 8U;
+#else
+    static ETL_CONSTANT size_t Block_Alignment = etl::alignment_of<uint64_t>::value;
+#endif
+
+    /// The Bloom filter blocks.
+    typename etl::aligned_storage<size_t(BLOCKS) * (Block_Bits / 8U), Block_Alignment>::type storage;
+  };
+
+  template <size_t Desired_Width, typename THash, size_t Number_Of_Probes>
+  ETL_CONSTANT size_t blocked_bloom_filter<Desired_Width, THash, Number_Of_Probes>::Block_Bits;
+
+  template <size_t Desired_Width, typename THash, size_t Number_Of_Probes>
+  ETL_CONSTANT size_t blocked_bloom_filter<Desired_Width, THash, Number_Of_Probes>::Words_Per_Block;
+
+  template <size_t Desired_Width, typename THash, size_t Number_Of_Probes>
+  ETL_CONSTANT size_t blocked_bloom_filter<Desired_Width, THash, Number_Of_Probes>::Batch_Size;
+
+  template <size_t Desired_Width, typename THash, size_t Number_Of_Probes>
+  ETL_CONSTANT size_t blocked_bloom_filter<Desired_Width, THash, Number_Of_Probes>::Block_Alignment;
+#endif
 }
 
 #endif
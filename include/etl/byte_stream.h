@@ -45,6 +45,7 @@ SOFTWARE.
 #include "delegate.h"
 #include "exception.h"
 #include "error_handler.h"
+#include "private/byte_stream_block.h"
 
 #include <stdint.h>
 #include <limits.h>
@@ -176,18 +177,13 @@ namespace etl
 
     //***************************************************************************
     /// Write a range of T to the stream.
+    /// The range is written as one block and the callback is called once.
     //***************************************************************************
     template <typename T>
     typename etl::enable_if<etl::is_integral<T>::value || etl::is_floating_point<T>::value, void>::type
       write_unchecked(const etl::span<T>& range)
     {
-      typename etl::span<T>::iterator itr = range.begin();
-
-      while (itr != range.end())
-      {
-        to_bytes(*itr);
-        ++itr;
-      }
+      write_unchecked(range.data(), range.size());
     }
 
     //***************************************************************************
@@ -209,16 +205,13 @@ namespace etl
 
     //***************************************************************************
     /// Write a range of T to the stream.
+    /// The range is written as one block and the callback is called once.
     //***************************************************************************
     template <typename T>
     typename etl::enable_if<etl::is_integral<T>::value || etl::is_floating_point<T>::value, void>::type
       write_unchecked(const T* start, size_t length)
     {
-      while (length-- != 0U)
-      {
-        to_bytes(*start);
-        ++start;
-      }
+      to_bytes_block(start, length);
     }
 
     //***************************************************************************
@@ -256,6 +249,35 @@ namespace etl
       return success;
     }
 
+    //***************************************************************************
+    /// Reserves n bytes at the current position for the caller to write to
+    /// directly, such as a fixed size header.
+    /// The stream position does not change until commit is called.
+    /// Returns an empty span if fewer than n bytes are available.
+    //***************************************************************************
+    etl::span<char> reserve(size_t n)
+    {
+      if (available_bytes() >= n)
+      {
+        return etl::span<char>(pcurrent, pcurrent + n);
+      }
+      else
+      {
+        return etl::span<char>();
+      }
+    }
+
+    //***************************************************************************
+    /// Commits n bytes written to a reserved span, moving the stream position
+    /// past them and calling the callback.
+    /// Returns <b>true</b> if the commit was possible.
+    /// Returns <b>false</b> if fewer than n bytes are available.
+    //***************************************************************************
+    bool commit(size_t n)
+    {
+      return skip<char>(n);
+    }
+
     //***************************************************************************
     /// Sets the index back to the position in the stream. Default = 0.
     //***************************************************************************
@@ -456,6 +478,24 @@ namespace etl
       step(sizeof(T));
     }
 
+    //*********************************
+    template <typename T>
+    void to_bytes_block(const T* start, size_t length)
+    {
+      const char* source = reinterpret_cast<const char*>(start);
+
+      if ((sizeof(T) == 1U) || (stream_endianness == etl::endianness::value()))
+      {
+        etl::private_byte_stream::copy_elements(source, pcurrent, length * sizeof(T));
+      }
+      else
+      {
+        etl::private_byte_stream::reverse_copy_elements<sizeof(T)>(source, pcurrent, length);
+      }
+
+      step(length * sizeof(T));
+    }
+
     //*********************************
     void step(size_t n)
     {
@@ -635,12 +675,7 @@ namespace etl
     typename etl::enable_if<etl::is_integral<T>::value || etl::is_floating_point<T>::value, etl::span<const T> >::type
       read_unchecked(etl::span<T> range)
     {
-      typename etl::span<T>::iterator destination = range.begin();
-
-      while (destination != range.end())
-      {
-        *destination++ = from_bytes<T>();
-      }
+      from_bytes_block(range.data(), range.size());
 
       return etl::span<const T>(range.begin(), range.end());
     }
@@ -668,12 +703,7 @@ namespace etl
     typename etl::enable_if<etl::is_integral<T>::value || etl::is_floating_point<T>::value, etl::span<const T> >::type
       read_unchecked(T* start,  size_t length)
     {
-      T* destination = start;
-
-      for (size_t i = 0; i < length; ++i)
-      {
-        *destination++ = from_bytes<T>();
-      }
+      from_bytes_block(start, length);
 
       return etl::span<const T>(start, length);
     }
@@ -838,6 +868,35 @@ namespace etl
       return value;
     }
 
+    //*********************************
+    template <typename T>
+    void from_bytes_block(T* start, size_t length)
+    {
+      if (etl::is_same<T, bool>::value)
+      {
+        // Each byte must be converted to a valid bool.
+        for (size_t i = 0U; i < length; ++i)
+        {
+          start[i] = from_bytes<T>();
+        }
+      }
+      else
+      {
+        char* destination = reinterpret_cast<char*>(start);
+
+        if ((sizeof(T) == 1U) || (stream_endianness == etl::endianness::value()))
+        {
+          etl::private_byte_stream::copy_elements(pcurrent, destination, length * sizeof(T));
+        }
+        else
+        {
+          etl::private_byte_stream::reverse_copy_elements<sizeof(T)>(pcurrent, destination, length);
+        }
+
+        pcurrent += length * sizeof(T);
+      }
+    }
+
     //*********************************
     void copy_value(const char* source, char* destination, size_t length) const
     {
@@ -0,0 +1,302 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_CALLBACK_TIMER_WHEEL_INCLUDED
+#define ETL_CALLBACK_TIMER_WHEEL_INCLUDED
+
+#include "platform.h"
+#include "nullptr.h"
+#include "function.h"
+#include "static_assert.h"
+#include "timer.h"
+#include "private/timer_wheel.h"
+#include "atomic.h"
+#include "placement_new.h"
+#include "delegate.h"
+
+#include <stdint.h>
+
+#if defined(ETL_IN_UNIT_TEST) && ETL_NOT_USING_STL
+  #undef ETL_CALLBACK_TIMER_USE_ATOMIC_LOCK
+  #undef ETL_CALLBACK_TIMER_USE_INTERRUPT_LOCK
+#else
+  #if !defined(ETL_CALLBACK_TIMER_USE_ATOMIC_LOCK) && !defined(ETL_CALLBACK_TIMER_USE_INTERRUPT_LOCK)
+    #error ETL_CALLBACK_TIMER_USE_ATOMIC_LOCK or ETL_CALLBACK_TIMER_USE_INTERRUPT_LOCK not defined
+  #endif
+
+  #if defined(ETL_CALLBACK_TIMER_USE_ATOMIC_LOCK) && defined(ETL_CALLBACK_TIMER_USE_INTERRUPT_LOCK)
+    #error Only define one of ETL_CALLBACK_TIMER_USE_ATOMIC_LOCK or ETL_CALLBACK_TIMER_USE_INTERRUPT_LOCK
+  #endif
+#endif
+
+#if defined(ETL_CALLBACK_TIMER_USE_INTERRUPT_LOCK)
+  #if !defined(ETL_CALLBACK_TIMER_DISABLE_INTERRUPTS) || !defined(ETL_CALLBACK_TIMER_ENABLE_INTERRUPTS)
+    #error ETL_CALLBACK_TIMER_DISABLE_INTERRUPTS and/or ETL_CALLBACK_TIMER_ENABLE_INTERRUPTS not defined
+  #endif
+#endif
+
+namespace etl
+{
+  namespace private_timer
+  {
+#if defined(ETL_CALLBACK_TIMER_USE_ATOMIC_LOCK)
+  #if !defined(ETL_TIMER_SEMAPHORE_TYPE) && !ETL_HAS_ATOMIC
+    #error No atomic type available
+  #endif
+
+    typedef etl::private_timer::timer_wheel_semaphore_lock<etl::timer_semaphore_t> callback_timer_wheel_lock;
+#elif defined(ETL_CALLBACK_TIMER_USE_INTERRUPT_LOCK)
+    //*************************************************************************
+    /// Disables interrupts for the duration of each update.
+    //*************************************************************************
+    class callback_timer_wheel_lock
+    {
+    public:
+
+      class scoped_lock
+      {
+      public:
+
+        explicit scoped_lock(const callback_timer_wheel_lock&)
+        {
+          ETL_CALLBACK_TIMER_DISABLE_INTERRUPTS;
+        }
+
+        ~scoped_lock()
+        {
+          ETL_CALLBACK_TIMER_ENABLE_INTERRUPTS;
+        }
+      };
+
+      bool try_lock_tick() const
+      {
+        return true;
+      }
+
+      void unlock_tick() const
+      {
+      }
+    };
+#else
+    typedef etl::private_timer::timer_wheel_no_lock callback_timer_wheel_lock;
+#endif
+
+    //*************************************************************************
+    /// A timer that calls a C function, an etl::ifunction or a delegate.
+    //*************************************************************************
+    struct callback_timer_wheel_data : public etl::private_timer::timer_wheel_node
+    {
+      typedef etl::delegate<void(void)> callback_type;
+
+      enum callback_type_id
+      {
+        C_CALLBACK,
+        IFUNCTION,
+        DELEGATE
+      };
+
+      //*******************************************
+      callback_timer_wheel_data()
+        : timer_wheel_node()
+        , p_callback(ETL_NULLPTR)
+        , cbk_type(IFUNCTION)
+      {
+      }
+
+      //*******************************************
+      /// C function callback
+      //*******************************************
+      callback_timer_wheel_data(etl::timer::id::type id_,
+                                void                 (*p_callback_)(),
+                                uint32_t             period_,
+                                bool                 repeating_)
+        : timer_wheel_node(id_, period_, repeating_)
+        , p_callback(reinterpret_cast<void*>(p_callback_))
+        , cbk_type(C_CALLBACK)
+      {
+      }
+
+      //*******************************************
+      /// ETL function callback
+      //*******************************************
+      callback_timer_wheel_data(etl::timer::id::type  id_,
+                                etl::ifunction<void>& callback_,
+                                uint32_t              period_,
+                                bool                  repeating_)
+        : timer_wheel_node(id_, period_, repeating_)
+        , p_callback(reinterpret_cast<void*>(&callback_))
+        , cbk_type(IFUNCTION)
+      {
+      }
+
+      //*******************************************
+      /// ETL delegate callback
+      //*******************************************
+      callback_timer_wheel_data(etl::timer::id::type id_,
+                                callback_type&       callback_,
+                                uint32_t             period_,
+                                bool                 repeating_)
+        : timer_wheel_node(id_, period_, repeating_)
+        , p_callback(reinterpret_cast<void*>(&callback_))
+        , cbk_type(DELEGATE)
+      {
+      }
+
+      //*******************************************
+      void dispatch() const
+      {
+        if (p_callback != ETL_NULLPTR)
+        {
+          if (cbk_type == C_CALLBACK)
+          {
+            // Call the C callback.
+            reinterpret_cast<void(*)()>(p_callback)();
+          }
+          else if (cbk_type == IFUNCTION)
+          {
+            // Call the function wrapper callback.
+            (*reinterpret_cast<etl::ifunction<void>*>(p_callback))();
+          }
+          else if (cbk_type == DELEGATE)
+          {
+            // Call the delegate callback.
+            (*reinterpret_cast<callback_type*>(p_callback))();
+          }
+        }
+      }
+
+      void*            p_callback;
+      callback_type_id cbk_type;
+    };
+  }
+
+  //***************************************************************************
+  /// Interface for callback timer, with the active timers held in a timing wheel.
+  //***************************************************************************
+  class icallback_timer_wheel : public etl::private_timer::timer_wheel_engine<etl::private_timer::callback_timer_wheel_data,
+                                                                              etl::private_timer::callback_timer_wheel_lock>
+  {
+  public:
+
+    typedef etl::delegate<void(void)> callback_type;
+
+    //*******************************************
+    /// Register a timer.
+    //*******************************************
+    etl::timer::id::type register_timer(void     (*p_callback_)(),
+                                        uint32_t period_,
+                                        bool     repeating_)
+    {
+      etl::timer::id::type id = allocate_timer();
+
+      if (id != etl::timer::id::NO_TIMER)
+      {
+        // Create in-place.
+        ::new (&get_timer(id)) timer_data(id, p_callback_, period_, repeating_);
+      }
+
+      return id;
+    }
+
+    //*******************************************
+    /// Register a timer.
+    //*******************************************
+    etl::timer::id::type register_timer(etl::ifunction<void>& callback_,
+                                        uint32_t              period_,
+                                        bool                  repeating_)
+    {
+      etl::timer::id::type id = allocate_timer();
+
+      if (id != etl::timer::id::NO_TIMER)
+      {
+        // Create in-place.
+        ::new (&get_timer(id)) timer_data(id, callback_, period_, repeating_);
+      }
+
+      return id;
+    }
+
+#if ETL_USING_CPP11
+    //*******************************************
+    /// Register a timer.
+    //*******************************************
+    etl::timer::id::type register_timer(callback_type& callback_,
+                                        uint32_t       period_,
+                                        bool           repeating_)
+    {
+      etl::timer::id::type id = allocate_timer();
+
+      if (id != etl::timer::id::NO_TIMER)
+      {
+        // Create in-place.
+        ::new (&get_timer(id)) timer_data(id, callback_, period_, repeating_);
+      }
+
+      return id;
+    }
+#endif
+
+  protected:
+
+    typedef etl::private_timer::callback_timer_wheel_data timer_data;
+
+    //*******************************************
+    /// Constructor.
+    //*******************************************
+    icallback_timer_wheel(timer_data* const timer_array_, const uint_least8_t Max_Timers_)
+      : timer_wheel_engine(timer_array_, Max_Timers_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The callback timer, using a hierarchical timing wheel.
+  /// Start and stop are O(1), whatever the number of active timers.
+  //***************************************************************************
+  template <const uint_least8_t Max_Timers_>
+  class callback_timer_wheel : public etl::icallback_timer_wheel
+  {
+  public:
+
+    ETL_STATIC_ASSERT(Max_Timers_ <= 254, "No more than 254 timers are allowed");
+
+    //*******************************************
+    /// Constructor.
+    //*******************************************
+    callback_timer_wheel()
+      : icallback_timer_wheel(timer_array, Max_Timers_)
+    {
+    }
+
+  private:
+
+    timer_data timer_array[Max_Timers_];
+  };
+}
+
+#endif
@@ -0,0 +1,134 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_CALLBACK_TIMER_WHEEL_LOCKED_INCLUDED
+#define ETL_CALLBACK_TIMER_WHEEL_LOCKED_INCLUDED
+
+#include "platform.h"
+#include "nullptr.h"
+#include "static_assert.h"
+#include "timer.h"
+#include "private/timer_wheel.h"
+#include "placement_new.h"
+#include "delegate.h"
+
+#include <stdint.h>
+
+namespace etl
+{
+  //***************************************************************************
+  /// Interface for callback timer, with the active timers held in a timing wheel.
+  //***************************************************************************
+  class icallback_timer_wheel_locked : public etl::private_timer::timer_wheel_engine<etl::private_timer::delegate_timer_wheel_data,
+                                                                                     etl::private_timer::timer_wheel_delegate_lock>
+  {
+  private:
+
+    typedef etl::private_timer::timer_wheel_engine<etl::private_timer::delegate_timer_wheel_data,
+                                                   etl::private_timer::timer_wheel_delegate_lock> base_t;
+
+  public:
+
+    typedef etl::delegate<void(void)> callback_type;
+    typedef etl::private_timer::timer_wheel_delegate_lock::try_lock_type try_lock_type;
+    typedef etl::private_timer::timer_wheel_delegate_lock::lock_type     lock_type;
+    typedef etl::private_timer::timer_wheel_delegate_lock::unlock_type   unlock_type;
+
+    using etl::private_timer::timer_wheel_delegate_lock::set_locks;
+
+    //*******************************************
+    /// Register a timer.
+    //*******************************************
+    etl::timer::id::type register_timer(const callback_type& callback_,
+                                        uint32_t             period_,
+                                        bool                 repeating_)
+    {
+      etl::timer::id::type id = allocate_timer();
+
+      if (id != etl::timer::id::NO_TIMER)
+      {
+        // Create in-place.
+        ::new (&get_timer(id)) timer_data(id, callback_, period_, repeating_);
+      }
+
+      return id;
+    }
+
+  protected:
+
+    typedef etl::private_timer::delegate_timer_wheel_data timer_data;
+
+    //*******************************************
+    /// Constructor.
+    //*******************************************
+    icallback_timer_wheel_locked(timer_data* const timer_array_, const uint_least8_t Max_Timers_)
+      : base_t(timer_array_, Max_Timers_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The callback timer, using a hierarchical timing wheel.
+  /// Start and stop are O(1), whatever the number of active timers.
+  //***************************************************************************
+  template <uint_least8_t Max_Timers_>
+  class callback_timer_wheel_locked : public etl::icallback_timer_wheel_locked
+  {
+  public:
+
+    ETL_STATIC_ASSERT(Max_Timers_ <= 254U, "No more than 254 timers are allowed");
+
+    typedef icallback_timer_wheel_locked::callback_type callback_type;
+    typedef icallback_timer_wheel_locked::try_lock_type try_lock_type;
+    typedef icallback_timer_wheel_locked::lock_type     lock_type;
+    typedef icallback_timer_wheel_locked::unlock_type   unlock_type;
+
+    //*******************************************
+    /// Constructor.
+    //*******************************************
+    callback_timer_wheel_locked()
+      : icallback_timer_wheel_locked(timer_array, Max_Timers_)
+    {
+    }
+
+    //*******************************************
+    /// Constructor.
+    //*******************************************
+    callback_timer_wheel_locked(try_lock_type try_lock_, lock_type lock_, unlock_type unlock_)
+      : icallback_timer_wheel_locked(timer_array, Max_Timers_)
+    {
+      this->set_locks(try_lock_, lock_, unlock_);
+    }
+
+  private:
+
+    timer_data timer_array[Max_Timers_];
+  };
+}
+
+#endif
@@ -109,4 +109,7 @@ SOFTWARE.
 #define ETL_ALGORITHM_FILE_ID "76"
 #define ETL_NOT_NULL_FILE_ID "77"
 #define ETL_SIGNAL_FILE_ID "78"
+#define ETL_UNORDERED_FLAT_MAP_FILE_ID "79"
+#define ETL_STATE_CHART_FILE_ID "80"
+#define ETL_MONOTONIC_ARENA_FILE_ID "81"
 #endif
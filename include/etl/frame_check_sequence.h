@@ -86,8 +86,51 @@ namespace etl
 
       TFrame_Check_Sequence* p_fcs;
     };
+
+    //***************************************************
+    /// Reads 4 octets, least significant first.
+    /// Written as one expression so that compilers can merge it in to a single load.
+    //***************************************************
+    template <typename TIterator>
+    ETL_CONSTEXPR14 uint32_t read_uint32_le(TIterator data)
+    {
+      return (uint32_t(static_cast<uint8_t>(data[0])))        |
+             (uint32_t(static_cast<uint8_t>(data[1])) << 8U)  |
+             (uint32_t(static_cast<uint8_t>(data[2])) << 16U) |
+             (uint32_t(static_cast<uint8_t>(data[3])) << 24U);
+    }
+
+#if ETL_USING_64BIT_TYPES
+    //***************************************************
+    /// Reads 8 octets, least significant first.
+    //***************************************************
+    template <typename TIterator>
+    ETL_CONSTEXPR14 uint64_t read_uint64_le(TIterator data)
+    {
+      return (uint64_t(static_cast<uint8_t>(data[0])))        |
+             (uint64_t(static_cast<uint8_t>(data[1])) << 8U)  |
+             (uint64_t(static_cast<uint8_t>(data[2])) << 16U) |
+             (uint64_t(static_cast<uint8_t>(data[3])) << 24U) |
+             (uint64_t(static_cast<uint8_t>(data[4])) << 32U) |
+             (uint64_t(static_cast<uint8_t>(data[5])) << 40U) |
+             (uint64_t(static_cast<uint8_t>(data[6])) << 48U) |
+             (uint64_t(static_cast<uint8_t>(data[7])) << 56U);
+    }
+#endif
   }
 
+  //***************************************************************************
+  /// The number of bytes that a policy can process in one call to add_block.
+  /// Specialise for policies that define
+  /// value_type add_block(value_type, TIterator) const
+  /// where the iterator addresses at least 'value' bytes.
+  ///\ingroup frame_check_sequence
+  //***************************************************************************
+  template <typename TPolicy>
+  struct frame_check_sequence_block_size : public etl::integral_constant<size_t, 1U>
+  {
+  };
+
   //***************************************************************************
   /// Calculates a frame check sequence according to the specified policy.
   ///\tparam TPolicy The type used to enact the policy.
@@ -145,11 +188,9 @@ namespace etl
     {
       ETL_STATIC_ASSERT(sizeof(typename etl::iterator_traits<TIterator>::value_type) == 1, "Type not supported");
 
-      while (begin != end)
-      {
-        frame_check = policy.add(frame_check, *begin);
-        ++begin;
-      }
+      typedef etl::integral_constant<bool, (Block_Size > 1U) && etl::is_random_access_iterator<TIterator>::value> use_blocks;
+
+      add_range(begin, end, use_blocks());
     }
 
     //*************************************************************************
@@ -184,11 +225,57 @@ namespace etl
       return add_insert_iterator(*this);
     }
 
+  protected:
+
+    //*************************************************************************
+    /// Constructor from a policy.
+    /// For policies that have parameters, such as a seed.
+    //*************************************************************************
+    ETL_CONSTEXPR14 explicit frame_check_sequence(const policy_type& policy_)
+      : frame_check()
+      , policy(policy_)
+    {
+      reset();
+    }
+
   private:
 
+    static ETL_CONSTANT size_t Block_Size = etl::frame_check_sequence_block_size<TPolicy>::value;
+
+    //*************************************************************************
+    /// Adds a range, one value at a time.
+    //*************************************************************************
+    template<typename TIterator>
+    ETL_CONSTEXPR14 void add_range(TIterator begin, const TIterator end, etl::false_type)
+    {
+      while (begin != end)
+      {
+        frame_check = policy.add(frame_check, *begin);
+        ++begin;
+      }
+    }
+
+    //*************************************************************************
+    /// Adds a range, a block at a time, followed by any remaining values.
+    //*************************************************************************
+    template<typename TIterator>
+    ETL_CONSTEXPR14 void add_range(TIterator begin, const TIterator end, etl::true_type)
+    {
+      while ((end - begin) >= static_cast<typename etl::iterator_traits<TIterator>::difference_type>(Block_Size))
+      {
+        frame_check = policy.add_block(frame_check, begin);
+        begin += Block_Size;
+      }
+
+      add_range(begin, end, etl::false_type());
+    }
+
     value_type  frame_check;
     policy_type policy;
   };
+
+  template <typename TPolicy>
+  ETL_CONSTANT size_t frame_check_sequence<TPolicy>::Block_Size;
 }
 
 #endif
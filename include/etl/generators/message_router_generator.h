@@ -414,6 +414,103 @@ namespace etl
 // For C++17 and above.
 //*************************************************************************************************
 #if ETL_USING_CPP17 && !defined(ETL_MESSAGE_ROUTER_FORCE_CPP03_IMPLEMENTATION)
+  namespace private_message_router
+  {
+    //*************************************************************************
+    /// The smallest message id in the list.
+    //*************************************************************************
+    template <typename... TMessageTypes>
+    constexpr size_t min_message_id()
+    {
+      constexpr size_t ids[] = { size_t(TMessageTypes::ID)..., 0U };
+
+      size_t result = ids[0];
+
+      for (size_t i = 1U; i < sizeof...(TMessageTypes); ++i)
+      {
+        result = (ids[i] < result) ? ids[i] : result;
+      }
+
+      return result;
+    }
+
+    //*************************************************************************
+    /// The largest message id in the list.
+    //*************************************************************************
+    template <typename... TMessageTypes>
+    constexpr size_t max_message_id()
+    {
+      constexpr size_t ids[] = { size_t(TMessageTypes::ID)..., 0U };
+
+      size_t result = ids[0];
+
+      for (size_t i = 1U; i < sizeof...(TMessageTypes); ++i)
+      {
+        result = (ids[i] > result) ? ids[i] : result;
+      }
+
+      return result;
+    }
+
+    //*************************************************************************
+    /// The smallest table size, up to Max_Size, for which
+    /// '(id - Min_Id) % size' maps every id to a unique slot.
+    /// Zero if there is none, such as when the id list contains duplicates.
+    //*************************************************************************
+    template <size_t Min_Id, size_t Max_Size, typename... TMessageTypes>
+    constexpr size_t perfect_hash_table_size()
+    {
+      constexpr size_t Count = sizeof...(TMessageTypes);
+      constexpr size_t ids[] = { size_t(TMessageTypes::ID)..., 0U };
+
+      for (size_t size = Count; (size != 0U) && (size <= Max_Size); ++size)
+      {
+        bool used[Max_Size + 1U] = {};
+        bool collision = false;
+
+        for (size_t i = 0U; !collision && (i < Count); ++i)
+        {
+          const size_t slot = (ids[i] - Min_Id) % size;
+
+          collision  = used[slot];
+          used[slot] = true;
+        }
+
+        if (!collision)
+        {
+          return size;
+        }
+      }
+
+      return 0U;
+    }
+
+    //*************************************************************************
+    /// Compile time perfect hash of a set of message ids.
+    /// Table_Size is zero if no perfect hash could be found.
+    //*************************************************************************
+    template <typename... TMessageTypes>
+    struct message_id_hash
+    {
+      static constexpr size_t Count      = sizeof...(TMessageTypes);
+      static constexpr size_t Min_Id     = min_message_id<TMessageTypes...>();
+      static constexpr size_t Max_Id     = max_message_id<TMessageTypes...>();
+      static constexpr size_t Range      = (Count == 0U) ? 0U : (Max_Id - Min_Id + 1U);
+      static constexpr size_t Search_Max = (4U * Count) + 16U;
+      static constexpr size_t Table_Size = perfect_hash_table_size<Min_Id, (Range < Search_Max) ? Range : Search_Max, TMessageTypes...>();
+
+      //*******************************************
+      /// Returns the slot for the id, or Table_Size if the id is out of range.
+      //*******************************************
+      static constexpr size_t slot(etl::message_id_t id)
+      {
+        const size_t offset = size_t(id) - Min_Id;
+
+        return (offset < Range) ? (offset % Table_Size) : Table_Size;
+      }
+    };
+  }
+
   //***************************************************************************
   // The definition for all message types.
   //***************************************************************************
@@ -455,7 +552,27 @@ namespace etl
 
     void receive(const etl::imessage& msg) ETL_OVERRIDE
     {
-      const bool was_handled = (receive_message_type<TMessageTypes>(msg) || ...);
+      bool was_handled;
+
+      if constexpr (hash_t::Table_Size != 0U)
+      {
+        // Constant time dispatch through the perfect hash table.
+        const etl::message_id_t id   = msg.get_message_id();
+        const size_t            slot = hash_t::slot(id);
+
+        was_handled = (slot < hash_t::Table_Size) &&
+                      (get_dispatch_table().entries[slot].handler != ETL_NULLPTR) &&
+                      (get_dispatch_table().entries[slot].id == id);
+
+        if (was_handled)
+        {
+          get_dispatch_table().entries[slot].handler(*this, msg);
+        }
+      }
+      else
+      {
+        was_handled = (receive_message_type<TMessageTypes>(msg) || ...);
+      }
 
       if (!was_handled)
       {
@@ -495,7 +612,25 @@ namespace etl
 
     bool accepts(etl::message_id_t id) const ETL_OVERRIDE
     {
-      return (accepts_type<TMessageTypes>(id) || ...);
+      if constexpr (hash_t::Table_Size != 0U)
+      {
+        const size_t slot = hash_t::slot(id);
+
+        if ((slot < hash_t::Table_Size) &&
+            (get_dispatch_table().entries[slot].handler != ETL_NULLPTR) &&
+            (get_dispatch_table().entries[slot].id == id))
+        {
+          return true;
+        }
+        else
+        {
+          return has_successor() && get_successor().accepts(id);
+        }
+      }
+      else
+      {
+        return (accepts_type<TMessageTypes>(id) || ...);
+      }
     }
 
     //********************************************
@@ -518,6 +653,51 @@ namespace etl
 
   private:
 
+    typedef private_message_router::message_id_hash<TMessageTypes...> hash_t;
+
+    typedef void (*handler_t)(message_router&, const etl::imessage&);
+
+    //********************************************
+    /// An entry in the dispatch table.
+    /// Unused slots have a null handler.
+    //********************************************
+    struct dispatch_entry
+    {
+      etl::message_id_t id;
+      handler_t         handler;
+    };
+
+    //********************************************
+    struct dispatch_table
+    {
+      dispatch_entry entries[(hash_t::Table_Size != 0U) ? hash_t::Table_Size : 1U];
+    };
+
+    //********************************************
+    template <typename TMessage>
+    static void dispatch_message(message_router& router, const etl::imessage& msg)
+    {
+      static_cast<TDerived&>(router).on_receive(static_cast<const TMessage&>(msg));
+    }
+
+    //********************************************
+    static constexpr dispatch_table make_dispatch_table()
+    {
+      dispatch_table table = {};
+
+      ((table.entries[hash_t::slot(TMessageTypes::ID)] = dispatch_entry{ TMessageTypes::ID, &message_router::template dispatch_message<TMessageTypes> }), ...);
+
+      return table;
+    }
+
+    //********************************************
+    static const dispatch_table& get_dispatch_table()
+    {
+      static constexpr dispatch_table table = make_dispatch_table();
+
+      return table;
+    }
+
     //********************************************
     template <typename TMessage>
     bool receive_message_type(const etl::imessage& msg)
@@ -32,6 +32,10 @@ SOFTWARE.
 #include "platform.h"
 #include "algorithm.h"
 #include "vector.h"
+#include "span.h"
+#include "binary.h"
+#include "integral_limits.h"
+#include "static_assert.h"
 #include "nullptr.h"
 #include "error_handler.h"
 #include "exception.h"
@@ -39,6 +43,7 @@ SOFTWARE.
 #include "message.h"
 #include "message_router.h"
 
+#include <stddef.h>
 #include <stdint.h>
 
 namespace etl
@@ -71,6 +76,13 @@ namespace etl
 
   //***************************************************************************
   /// Interface for message bus
+  /// The bus may keep an index, for a range of message ids, of the subscribed
+  /// routers that accept each id. Broadcasts of indexed ids then call only the
+  /// routers that consume them, without asking every router if it accepts.
+  /// Routers with ids above MAX_MESSAGE_ROUTER, such as other message buses,
+  /// are not indexed, as the messages that they accept may change.
+  /// The index is held by the derived bus. An unindexed bus only adds a null
+  /// pointer to it.
   //***************************************************************************
   class imessage_bus : public etl::imessage_router
   {
@@ -104,6 +116,8 @@ namespace etl
                                                              compare_router_id());
 
           router_list.insert(irouter, &router);
+
+          rebuild_index();
         }
       }
 
@@ -127,6 +141,8 @@ namespace etl
                                                                                                     compare_router_id());
 
         router_list.erase(range.first, range.second);
+
+        rebuild_index();
       }
     }
 
@@ -140,6 +156,8 @@ namespace etl
       if (irouter != router_list.end())
       {
         router_list.erase(irouter);
+
+        rebuild_index();
       }
     }
 
@@ -165,21 +183,7 @@ namespace etl
         // Broadcast to all routers.
         case etl::imessage_router::ALL_MESSAGE_ROUTERS:
         {
-          router_list_t::iterator irouter = router_list.begin();
-
-          // Broadcast to everyone.
-          while (irouter != router_list.end())
-          {
-            etl::imessage_router& router = **irouter;
-
-            if (router.accepts(message.get_message_id()))
-            {
-              router.receive(message);
-            }
-
-            ++irouter;
-          }
-
+          broadcast<const etl::imessage&>(message.get_message_id(), message);
           break;
         }
 
@@ -244,21 +248,7 @@ namespace etl
         // Broadcast to all routers.
       case etl::imessage_router::ALL_MESSAGE_ROUTERS:
       {
-        router_list_t::iterator irouter = router_list.begin();
-
-        // Broadcast to everyone.
-        while (irouter != router_list.end())
-        {
-          etl::imessage_router& router = **irouter;
-
-          if (router.accepts(shared_msg.get_message().get_message_id()))
-          {
-            router.receive(shared_msg);
-          }
-
-          ++irouter;
-        }
-
+        broadcast<etl::shared_message>(shared_msg.get_message().get_message_id(), shared_msg);
         break;
       }
 
@@ -311,6 +301,29 @@ namespace etl
       }
     }
 
+    //*******************************************
+    /// Broadcast a batch of messages, in order, to all routers and any successor.
+    /// Messages are passed directly to the subscribers and do not go
+    /// through this bus's own virtual receive.
+    //*******************************************
+    void receive(etl::span<const etl::imessage* const> messages)
+    {
+      for (size_t i = 0U; i < messages.size(); ++i)
+      {
+        const etl::imessage& message = *messages[i];
+
+        broadcast<const etl::imessage&>(message.get_message_id(), message);
+
+        if (has_successor())
+        {
+          if (get_successor().accepts(message.get_message_id()))
+          {
+            get_successor().receive(etl::imessage_router::ALL_MESSAGE_ROUTERS, message);
+          }
+        }
+      }
+    }
+
     using imessage_router::accepts;
 
     //*******************************************
@@ -322,6 +335,23 @@ namespace etl
       // Check the list of subscribed routers.
       router_list_t::iterator irouter = router_list.begin();
 
+      if (is_indexed(id))
+      {
+        const size_t    index_words = p_index->index_words;
+        const uint32_t* p_bits      = p_index->p_bits + (size_t(id) * index_words);
+
+        for (size_t word = 0U; word < index_words; ++word)
+        {
+          if (p_bits[word] != 0U)
+          {
+            return true;
+          }
+        }
+
+        // Only the unindexed routers are left to check.
+        irouter += p_index->first_unindexed;
+      }
+
       while (irouter != router_list.end())
       {
         etl::imessage_router& router = **irouter;
@@ -356,6 +386,55 @@ namespace etl
     void clear()
     {
       router_list.clear();
+
+      rebuild_index();
+    }
+
+    //*******************************************
+    /// Rebuilds the subscriber index.
+    /// Called automatically on subscribe and unsubscribe. Call it if the
+    /// messages accepted by a subscribed router change, for example when
+    /// its successor is changed.
+    //*******************************************
+    void rebuild_index()
+    {
+      if (p_index != ETL_NULLPTR)
+      {
+        const size_t first_unindexed = size_t(etl::upper_bound(router_list.begin(),
+                                                               router_list.end(),
+                                                               etl::message_router_id_t(etl::imessage_router::MAX_MESSAGE_ROUTER),
+                                                               compare_router_id()) - router_list.begin());
+
+        const size_t index_words = p_index->index_words;
+
+        for (size_t id = 0U; id < p_index->indexed_ids; ++id)
+        {
+          uint32_t* p_bits = p_index->p_bits + (id * index_words);
+
+          for (size_t word = 0U; word < index_words; ++word)
+          {
+            p_bits[word] = 0U;
+          }
+
+          for (size_t position = 0U; position < first_unindexed; ++position)
+          {
+            if (router_list[position]->accepts(etl::message_id_t(id)))
+            {
+              p_bits[position / 32U] |= uint32_t(1U) << (position % 32U);
+            }
+          }
+        }
+
+        p_index->first_unindexed = first_unindexed;
+      }
+    }
+
+    //*******************************************
+    /// Returns the number of message ids, from 0, that are indexed.
+    //*******************************************
+    size_t indexed_message_ids() const
+    {
+      return (p_index != ETL_NULLPTR) ? p_index->indexed_ids : 0U;
     }
 
     //********************************************
@@ -378,12 +457,32 @@ namespace etl
 
   protected:
 
+    //*******************************************
+    /// The subscriber index, held by an indexed bus.
+    //*******************************************
+    struct subscriber_index
+    {
+      subscriber_index(uint32_t* p_bits_, size_t indexed_ids_, size_t index_words_)
+        : p_bits(p_bits_),
+          indexed_ids(indexed_ids_),
+          index_words(index_words_),
+          first_unindexed(0U)
+      {
+      }
+
+      uint32_t* p_bits;          ///< One bit per router position, for each indexed message id. Zeroed.
+      size_t    indexed_ids;     ///< The number of indexed message ids.
+      size_t    index_words;     ///< The number of words per message id.
+      size_t    first_unindexed; ///< The position of the first router that is not indexed.
+    };
+
     //*******************************************
     /// Constructor.
     //*******************************************
     imessage_bus(router_list_t& list)
       : imessage_router(etl::imessage_router::MESSAGE_BUS),
-        router_list(list)
+        router_list(list),
+        p_index(ETL_NULLPTR)
     {
     }
 
@@ -392,7 +491,28 @@ namespace etl
     //*******************************************
     imessage_bus(router_list_t& router_list_, etl::imessage_router& successor_)
       : imessage_router(etl::imessage_router::MESSAGE_BUS, successor_),
-      router_list(router_list_)
+      router_list(router_list_),
+      p_index(ETL_NULLPTR)
+    {
+    }
+
+    //*******************************************
+    /// Constructor, with a subscriber index.
+    //*******************************************
+    imessage_bus(router_list_t& list, subscriber_index& index_)
+      : imessage_router(etl::imessage_router::MESSAGE_BUS),
+        router_list(list),
+        p_index(&index_)
+    {
+    }
+
+    //*******************************************
+    /// Constructor, with a subscriber index.
+    //*******************************************
+    imessage_bus(router_list_t& router_list_, subscriber_index& index_, etl::imessage_router& successor_)
+      : imessage_router(etl::imessage_router::MESSAGE_BUS, successor_),
+        router_list(router_list_),
+        p_index(&index_)
     {
     }
 
@@ -414,15 +534,113 @@ namespace etl
       }
     };
 
-    router_list_t& router_list;
+    //*******************************************
+    // Is the message id in the index?
+    //*******************************************
+    bool is_indexed(etl::message_id_t id) const
+    {
+      return (p_index != ETL_NULLPTR) && (size_t(id) < p_index->indexed_ids);
+    }
+
+    //*******************************************
+    // Broadcast to all routers that accept the id.
+    //*******************************************
+    template <typename TMessage>
+    void broadcast(etl::message_id_t id, TMessage message)
+    {
+      router_list_t::iterator irouter = router_list.begin();
+
+      if (is_indexed(id))
+      {
+        const size_t    index_words = p_index->index_words;
+        const uint32_t* p_bits      = p_index->p_bits + (size_t(id) * index_words);
+
+        // Only the routers that accept the id.
+        for (size_t word = 0U; word < index_words; ++word)
+        {
+          uint32_t bits = p_bits[word];
+
+          while (bits != 0U)
+          {
+            router_list[(word * 32U) + etl::count_trailing_zeros(bits)]->receive(message);
+            bits &= (bits - 1U);
+          }
+        }
+
+        // The unindexed routers are always at the end of the list.
+        irouter += p_index->first_unindexed;
+      }
+
+      // Broadcast to everyone else.
+      while (irouter != router_list.end())
+      {
+        etl::imessage_router& router = **irouter;
+
+        if (router.accepts(id))
+        {
+          router.receive(message);
+        }
+
+        ++irouter;
+      }
+    }
+
+    router_list_t&    router_list;
+    subscriber_index* p_index; ///< The subscriber index, or null if the bus is not indexed.
   };
 
   //***************************************************************************
   /// The message bus
+  ///\tparam MAX_ROUTERS_         The maximum number of subscribers.
+  ///\tparam INDEXED_MESSAGE_IDS_ The subscribers for message ids 0 to INDEXED_MESSAGE_IDS_ - 1
+  /// are indexed, using (MAX_ROUTERS_ + 31) / 32 words per id. Default 0, no index.
   //***************************************************************************
-  template <uint_least8_t MAX_ROUTERS_>
+  template <uint_least8_t MAX_ROUTERS_, size_t INDEXED_MESSAGE_IDS_ = 0U>
   class message_bus : public etl::imessage_bus
   {
+  public:
+
+    ETL_STATIC_ASSERT((INDEXED_MESSAGE_IDS_ - 1U) <= size_t(etl::integral_limits<etl::message_id_t>::max), "Indexed message ids out of range");
+
+    //*******************************************
+    /// Constructor.
+    //*******************************************
+    message_bus()
+      : imessage_bus(router_list, index)
+      , index(subscriber_bits, INDEXED_MESSAGE_IDS_, Index_Words)
+      , subscriber_bits()
+    {
+    }
+
+    //*******************************************
+    /// Constructor.
+    //*******************************************
+    message_bus(etl::imessage_router& successor_)
+      : imessage_bus(router_list, index, successor_)
+      , index(subscriber_bits, INDEXED_MESSAGE_IDS_, Index_Words)
+      , subscriber_bits()
+    {
+    }
+
+  private:
+
+    static ETL_CONSTANT size_t Index_Words = (MAX_ROUTERS_ + 31U) / 32U;
+
+    etl::vector<etl::imessage_router*, MAX_ROUTERS_> router_list;
+    subscriber_index index;
+    uint32_t subscriber_bits[INDEXED_MESSAGE_IDS_ * Index_Words];
+  };
+
+  template <uint_least8_t MAX_ROUTERS_, size_t INDEXED_MESSAGE_IDS_>
+  ETL_CONSTANT size_t message_bus<MAX_ROUTERS_, INDEXED_MESSAGE_IDS_>::Index_Words;
+
+  //***************************************************************************
+  /// The message bus, without an index.
+  ///\tparam MAX_ROUTERS_ The maximum number of subscribers.
+  //***************************************************************************
+  template <uint_least8_t MAX_ROUTERS_>
+  class message_bus<MAX_ROUTERS_, 0U> : public etl::imessage_bus
+  {
   public:
 
     //*******************************************
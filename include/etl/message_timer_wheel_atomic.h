@@ -0,0 +1,132 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_MESSAGE_TIMER_WHEEL_ATOMIC_INCLUDED
+#define ETL_MESSAGE_TIMER_WHEEL_ATOMIC_INCLUDED
+
+#include "platform.h"
+#include "nullptr.h"
+#include "message_types.h"
+#include "message.h"
+#include "message_router.h"
+#include "message_bus.h"
+#include "static_assert.h"
+#include "timer.h"
+#include "private/timer_wheel.h"
+#include "private/message_timer_wheel_data.h"
+#include "placement_new.h"
+#include "delegate.h"
+#include "atomic.h"
+
+#include <stdint.h>
+
+#if ETL_HAS_ATOMIC
+
+namespace etl
+{
+  //***************************************************************************
+  /// Interface for message timer, with the active timers held in a timing wheel.
+  //***************************************************************************
+  template <typename TSemaphore>
+  class imessage_timer_wheel_atomic : public etl::private_timer::timer_wheel_engine<etl::private_timer::message_timer_wheel_data,
+                                                                                    etl::private_timer::timer_wheel_semaphore_lock<TSemaphore> >
+  {
+  private:
+
+    typedef etl::private_timer::timer_wheel_engine<etl::private_timer::message_timer_wheel_data,
+                                                   etl::private_timer::timer_wheel_semaphore_lock<TSemaphore> > base_t;
+
+  public:
+
+    //*******************************************
+    /// Register a timer.
+    //*******************************************
+    etl::timer::id::type register_timer(const etl::imessage&     message_,
+                                        etl::imessage_router&    router_,
+                                        uint32_t                 period_,
+                                        bool                     repeating_,
+                                        etl::message_router_id_t destination_router_id_ = etl::imessage_router::ALL_MESSAGE_ROUTERS)
+    {
+      etl::timer::id::type id = etl::timer::id::NO_TIMER;
+
+      // There's no point adding null message routers.
+      if (!router_.is_null_router())
+      {
+        id = this->allocate_timer();
+
+        if (id != etl::timer::id::NO_TIMER)
+        {
+          // Create in-place.
+          ::new (&this->get_timer(id)) timer_data(id, message_, router_, period_, repeating_, destination_router_id_);
+        }
+      }
+
+      return id;
+    }
+
+  protected:
+
+    typedef etl::private_timer::message_timer_wheel_data timer_data;
+
+    //*******************************************
+    /// Constructor.
+    //*******************************************
+    imessage_timer_wheel_atomic(timer_data* const timer_array_, const uint_least8_t Max_Timers_)
+      : base_t(timer_array_, Max_Timers_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The message timer, using a hierarchical timing wheel.
+  /// Start and stop are O(1), whatever the number of active timers.
+  //***************************************************************************
+  template <uint_least8_t Max_Timers_, typename TSemaphore>
+  class message_timer_wheel_atomic : public etl::imessage_timer_wheel_atomic<TSemaphore>
+  {
+  public:
+
+    ETL_STATIC_ASSERT(Max_Timers_ <= 254U, "No more than 254 timers are allowed");
+
+    //*******************************************
+    /// Constructor.
+    //*******************************************
+    message_timer_wheel_atomic()
+      : imessage_timer_wheel_atomic<TSemaphore>(timer_array, Max_Timers_)
+    {
+    }
+
+  private:
+
+    typename etl::imessage_timer_wheel_atomic<TSemaphore>::timer_data timer_array[Max_Timers_];
+  };
+}
+
+#endif
+
+#endif
@@ -0,0 +1,602 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_MONOTONIC_ARENA_INCLUDED
+#define ETL_MONOTONIC_ARENA_INCLUDED
+
+#include "platform.h"
+#include "alignment.h"
+#include "largest.h"
+#include "utility.h"
+#include "placement_new.h"
+#include "error_handler.h"
+#include "exception.h"
+#include "file_error_numbers.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define ETL_MONOTONIC_ARENA_CPP03_CODE 0
+
+//*****************************************************************************
+///\defgroup monotonic_arena monotonic_arena
+/// A fixed capacity bump pointer arena.
+///\ingroup memory
+//*****************************************************************************
+
+namespace etl
+{
+  template <typename T> class vector_ext;
+  template <typename T> class circular_buffer_ext;
+  template <typename T> class pool_ext;
+  template <typename T> class list_ext;
+
+  //***************************************************************************
+  /// The base class for monotonic_arena exceptions.
+  ///\ingroup monotonic_arena
+  //***************************************************************************
+  class monotonic_arena_exception : public etl::exception
+  {
+  public:
+
+    monotonic_arena_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The exception thrown when the arena does not have enough space.
+  ///\ingroup monotonic_arena
+  //***************************************************************************
+  class monotonic_arena_full : public etl::monotonic_arena_exception
+  {
+  public:
+
+    monotonic_arena_full(string_type file_name_, numeric_type line_number_)
+      : monotonic_arena_exception(ETL_ERROR_TEXT("monotonic_arena:full", ETL_MONOTONIC_ARENA_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The exception thrown when rewinding to a checkpoint that is no longer valid.
+  ///\ingroup monotonic_arena
+  //***************************************************************************
+  class monotonic_arena_invalid_checkpoint : public etl::monotonic_arena_exception
+  {
+  public:
+
+    monotonic_arena_invalid_checkpoint(string_type file_name_, numeric_type line_number_)
+      : monotonic_arena_exception(ETL_ERROR_TEXT("monotonic_arena:checkpoint", ETL_MONOTONIC_ARENA_FILE_ID"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The exception thrown when an alignment is not a power of 2.
+  ///\ingroup monotonic_arena
+  //***************************************************************************
+  class monotonic_arena_invalid_alignment : public etl::monotonic_arena_exception
+  {
+  public:
+
+    monotonic_arena_invalid_alignment(string_type file_name_, numeric_type line_number_)
+      : monotonic_arena_exception(ETL_ERROR_TEXT("monotonic_arena:alignment", ETL_MONOTONIC_ARENA_FILE_ID"C"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The interface to a monotonic arena.
+  /// Memory is handed out by advancing a pointer through a fixed buffer.
+  /// There is no per-allocation release. Instead, the arena is rewound to a
+  /// checkpoint, or reset, which frees everything allocated since in O(1).
+  /// Rewinding does not call destructors. Objects with non-trivial
+  /// destructors should be destroyed with destroy() before their memory is
+  /// rewound.
+  ///\ingroup monotonic_arena
+  //***************************************************************************
+  class imonotonic_arena
+  {
+  public:
+
+    typedef size_t size_type;
+
+    /// The position of the arena, as returned by checkpoint().
+    typedef size_t checkpoint_type;
+
+    //*************************************************************************
+    /// Rewinds the arena to the point at which it was constructed when it goes
+    /// out of scope.
+    //*************************************************************************
+    class scope
+    {
+    public:
+
+      //***********************************
+      explicit scope(imonotonic_arena& arena_)
+        : arena(arena_)
+        , position(arena_.checkpoint())
+      {
+      }
+
+      //***********************************
+      ~scope()
+      {
+        arena.rewind(position);
+      }
+
+    private:
+
+      // Should not be copied.
+      scope(const scope&) ETL_DELETE;
+      scope& operator =(const scope&) ETL_DELETE;
+
+      imonotonic_arena&     arena;
+      const checkpoint_type position;
+    };
+
+    //*************************************************************************
+    /// Allocate memory from the arena.
+    /// \param n         The number of bytes.
+    /// \param alignment The alignment. Must be a power of 2.
+    /// If asserts or exceptions are enabled and there is not enough space an
+    /// etl::monotonic_arena_full is thrown, and if the alignment is not a power
+    /// of 2 an etl::monotonic_arena_invalid_alignment is thrown. Otherwise a
+    /// null pointer is returned.
+    //*************************************************************************
+    void* allocate(size_t n, size_t alignment)
+    {
+      ETL_ASSERT_OR_RETURN_VALUE((alignment != 0U) && ((alignment & (alignment - 1U)) == 0U), ETL_ERROR(monotonic_arena_invalid_alignment), ETL_NULLPTR);
+
+      const uintptr_t address   = uintptr_t(p_buffer + used);
+      const size_t    padding   = size_t((alignment - (address & (alignment - 1U))) & (alignment - 1U));
+      const size_t    remaining = Capacity - used;
+
+      if ((padding > remaining) || (n > (remaining - padding)))
+      {
+        ETL_ASSERT_FAIL(ETL_ERROR(monotonic_arena_full));
+        return ETL_NULLPTR;
+      }
+
+      char* p = p_buffer + used + padding;
+
+      used += padding + n;
+
+      if (used > peak)
+      {
+        peak = used;
+      }
+
+      return p;
+    }
+
+    //*************************************************************************
+    /// Allocate uninitialised storage for n objects of type T.
+    /// If asserts or exceptions are enabled and there is not enough space an
+    /// etl::monotonic_arena_full is thrown, otherwise a null pointer is returned.
+    //*************************************************************************
+    template <typename T>
+    T* allocate(size_t n = 1U)
+    {
+      if (n > (Capacity / sizeof(T)))
+      {
+        ETL_ASSERT_FAIL(ETL_ERROR(monotonic_arena_full));
+        return ETL_NULLPTR;
+      }
+
+      return static_cast<T*>(allocate(n * sizeof(T), etl::alignment_of<T>::value));
+    }
+
+#if ETL_CPP11_NOT_SUPPORTED || ETL_MONOTONIC_ARENA_CPP03_CODE || ETL_USING_STLPORT
+    //*************************************************************************
+    /// Allocate storage for an object from the arena and create with default.
+    /// If asserts or exceptions are enabled and there is not enough space an
+    /// etl::monotonic_arena_full is thrown, otherwise a null pointer is returned.
+    //*************************************************************************
+    template <typename T>
+    T* create()
+    {
+      T* p = allocate<T>();
+
+      if (p)
+      {
+        ::new (p) T();
+      }
+
+      return p;
+    }
+
+    //*************************************************************************
+    /// Allocate storage for an object from the arena and create with 1 parameter.
+    /// If asserts or exceptions are enabled and there is not enough space an
+    /// etl::monotonic_arena_full is thrown, otherwise a null pointer is returned.
+    //*************************************************************************
+    template <typename T, typename T1>
+    T* create(const T1& value1)
+    {
+      T* p = allocate<T>();
+
+      if (p)
+      {
+        ::new (p) T(value1);
+      }
+
+      return p;
+    }
+
+    //*************************************************************************
+    /// Allocate storage for an object from the arena and create with 2 parameters.
+    /// If asserts or exceptions are enabled and there is not enough space an
+    /// etl::monotonic_arena_full is thrown, otherwise a null pointer is returned.
+    //*************************************************************************
+    template <typename T, typename T1, typename T2>
+    T* create(const T1& value1, const T2& value2)
+    {
+      T* p = allocate<T>();
+
+      if (p)
+      {
+        ::new (p) T(value1, value2);
+      }
+
+      return p;
+    }
+
+    //*************************************************************************
+    /// Allocate storage for an object from the arena and create with 3 parameters.
+    /// If asserts or exceptions are enabled and there is not enough space an
+    /// etl::monotonic_arena_full is thrown, otherwise a null pointer is returned.
+    //*************************************************************************
+    template <typename T, typename T1, typename T2, typename T3>
+    T* create(const T1& value1, const T2& value2, const T3& value3)
+    {
+      T* p = allocate<T>();
+
+      if (p)
+      {
+        ::new (p) T(value1, value2, value3);
+      }
+
+      return p;
+    }
+
+    //*************************************************************************
+    /// Allocate storage for an object from the arena and create with 4 parameters.
+    /// If asserts or exceptions are enabled and there is not enough space an
+    /// etl::monotonic_arena_full is thrown, otherwise a null pointer is returned.
+    //*************************************************************************
+    template <typename T, typename T1, typename T2, typename T3, typename T4>
+    T* create(const T1& value1, const T2& value2, const T3& value3, const T4& value4)
+    {
+      T* p = allocate<T>();
+
+      if (p)
+      {
+        ::new (p) T(value1, value2, value3, value4);
+      }
+
+      return p;
+    }
+#else
+    //*************************************************************************
+    /// Allocate storage for an object from the arena and create with variadic parameters.
+    /// If asserts or exceptions are enabled and there is not enough space an
+    /// etl::monotonic_arena_full is thrown, otherwise a null pointer is returned.
+    //*************************************************************************
+    template <typename T, typename... TArgs>
+    T* create(TArgs&&... args)
+    {
+      T* p = allocate<T>();
+
+      if (p)
+      {
+        ::new (p) T(etl::forward<TArgs>(args)...);
+      }
+
+      return p;
+    }
+#endif
+
+    //*************************************************************************
+    /// Destroys an object created in the arena.
+    /// The memory is not reclaimed until the arena is rewound or reset.
+    //*************************************************************************
+    template <typename T>
+    void destroy(const T* const p_object)
+    {
+      if (p_object != ETL_NULLPTR)
+      {
+        p_object->~T();
+      }
+    }
+
+    //*************************************************************************
+    /// Creates an etl::vector_ext and its buffer in the arena.
+    /// Requires etl/vector.h.
+    //*************************************************************************
+    template <typename T>
+    etl::vector_ext<T>* create_vector_ext(size_t max_size)
+    {
+      void* p_storage = allocate<T>(max_size);
+
+      return (p_storage != ETL_NULLPTR) ? create<etl::vector_ext<T> >(p_storage, max_size) : ETL_NULLPTR;
+    }
+
+    //*************************************************************************
+    /// Creates an etl::circular_buffer_ext and its buffer in the arena.
+    /// Requires etl/circular_buffer.h.
+    //*************************************************************************
+    template <typename T>
+    etl::circular_buffer_ext<T>* create_circular_buffer_ext(size_t max_size)
+    {
+      // The circular buffer uses one more element than its capacity.
+      void* p_storage = allocate<T>(max_size + 1U);
+
+      return (p_storage != ETL_NULLPTR) ? create<etl::circular_buffer_ext<T> >(p_storage, max_size) : ETL_NULLPTR;
+    }
+
+    //*************************************************************************
+    /// Creates an etl::pool_ext and its buffer in the arena.
+    /// Requires etl/pool.h.
+    //*************************************************************************
+    template <typename T>
+    etl::pool_ext<T>* create_pool_ext(size_t max_size)
+    {
+      typedef typename etl::pool_ext<T>::element element_t;
+
+      element_t* p_storage = allocate<element_t>(max_size);
+
+      return (p_storage != ETL_NULLPTR) ? create<etl::pool_ext<T> >(p_storage, max_size) : ETL_NULLPTR;
+    }
+
+    //*************************************************************************
+    /// Creates an etl::list_ext, with a node pool and its buffer, in the arena.
+    /// Requires etl/list.h and etl/pool.h.
+    //*************************************************************************
+    template <typename T>
+    etl::list_ext<T>* create_list_ext(size_t max_size)
+    {
+      etl::pool_ext<typename etl::list_ext<T>::pool_type>* p_pool = create_pool_ext<typename etl::list_ext<T>::pool_type>(max_size);
+
+      etl::list_ext<T>* p_list = (p_pool != ETL_NULLPTR) ? allocate<etl::list_ext<T> >() : ETL_NULLPTR;
+
+      // The list takes the pool by non-const reference, so cannot go through the C++03 create().
+      if (p_list != ETL_NULLPTR)
+      {
+        ::new (p_list) etl::list_ext<T>(*p_pool);
+      }
+
+      return p_list;
+    }
+
+    //*************************************************************************
+    /// Creates a string_ext type, such as etl::string_ext or etl::u16string_ext, and its buffer in the arena.
+    /// Requires the header for the string type.
+    //*************************************************************************
+    template <typename TString>
+    TString* create_string_ext(size_t max_length)
+    {
+      typedef typename TString::value_type value_type;
+
+      // Room for the terminator.
+      value_type* p_storage = allocate<value_type>(max_length + 1U);
+
+      return (p_storage != ETL_NULLPTR) ? create<TString>(p_storage, max_length + 1U) : ETL_NULLPTR;
+    }
+
+    //*************************************************************************
+    /// Returns the current position of the arena, for a later rewind().
+    //*************************************************************************
+    checkpoint_type checkpoint() const
+    {
+      return used;
+    }
+
+    //*************************************************************************
+    /// Frees everything allocated since the checkpoint was taken.
+    /// If asserts or exceptions are enabled and the arena has already been
+    /// rewound past the checkpoint, an etl::monotonic_arena_invalid_checkpoint is thrown.
+    //*************************************************************************
+    void rewind(checkpoint_type position)
+    {
+      ETL_ASSERT_OR_RETURN(position <= used, ETL_ERROR(monotonic_arena_invalid_checkpoint));
+
+      used = position;
+    }
+
+    //*************************************************************************
+    /// Frees everything.
+    //*************************************************************************
+    void reset()
+    {
+      used = 0U;
+    }
+
+    //*************************************************************************
+    /// Returns the number of bytes in use, including alignment padding.
+    //*************************************************************************
+    size_t size() const
+    {
+      return used;
+    }
+
+    //*************************************************************************
+    /// Returns the size of the arena in bytes.
+    //*************************************************************************
+    size_t capacity() const
+    {
+      return Capacity;
+    }
+
+    //*************************************************************************
+    /// Returns the size of the arena in bytes.
+    //*************************************************************************
+    size_t max_size() const
+    {
+      return Capacity;
+    }
+
+    //*************************************************************************
+    /// Returns the number of free bytes, before any alignment padding.
+    //*************************************************************************
+    size_t available() const
+    {
+      return Capacity - used;
+    }
+
+    //*************************************************************************
+    /// Returns the largest number of bytes that have been in use at one time.
+    //*************************************************************************
+    size_t peak_size() const
+    {
+      return peak;
+    }
+
+    //*************************************************************************
+    /// Resets the peak statistic to the number of bytes currently in use.
+    //*************************************************************************
+    void reset_peak_size()
+    {
+      peak = used;
+    }
+
+    //*************************************************************************
+    /// Checks to see if nothing is allocated.
+    //*************************************************************************
+    bool empty() const
+    {
+      return used == 0U;
+    }
+
+    //*************************************************************************
+    /// Checks to see if the memory is in the arena.
+    //*************************************************************************
+    bool is_in_arena(const void* const p) const
+    {
+      const char* pc = static_cast<const char*>(p);
+
+      return (pc >= p_buffer) && (pc < (p_buffer + Capacity));
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// Constructor
+    //*************************************************************************
+    imonotonic_arena(char* p_buffer_, size_t capacity_)
+      : p_buffer(p_buffer_)
+      , Capacity(capacity_)
+      , used(0U)
+      , peak(0U)
+    {
+    }
+
+  private:
+
+    // Should not be copied.
+    imonotonic_arena(const imonotonic_arena&) ETL_DELETE;
+    imonotonic_arena& operator =(const imonotonic_arena&) ETL_DELETE;
+
+    char* const  p_buffer; ///< The memory for the arena.
+    const size_t Capacity; ///< The size of the buffer.
+    size_t       used;     ///< The number of bytes in use.
+    size_t       peak;     ///< The largest value of 'used'.
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+#if defined(ETL_POLYMORPHIC_MONOTONIC_ARENA) || defined(ETL_POLYMORPHIC_CONTAINERS)
+  public:
+    virtual ~imonotonic_arena()
+    {
+    }
+#else
+  protected:
+    ~imonotonic_arena()
+    {
+    }
+#endif
+  };
+
+  //***************************************************************************
+  /// A monotonic arena with internal storage.
+  ///\tparam VSize      The size of the arena in bytes.
+  ///\tparam VAlignment The alignment of the start of the arena.
+  ///\ingroup monotonic_arena
+  //***************************************************************************
+  template <size_t VSize, size_t VAlignment = etl::largest_alignment<void*, long long, double>::value>
+  class monotonic_arena : public etl::imonotonic_arena
+  {
+  public:
+
+    static ETL_CONSTANT size_t SIZE      = VSize;
+    static ETL_CONSTANT size_t ALIGNMENT = VAlignment;
+
+    //*************************************************************************
+    /// Constructor
+    //*************************************************************************
+    monotonic_arena()
+      : imonotonic_arena(reinterpret_cast<char*>(&buffer), VSize)
+    {
+    }
+
+  private:
+
+    /// The memory for the arena.
+    typename etl::aligned_storage<VSize, VAlignment>::type buffer;
+  };
+
+  template <size_t VSize, size_t VAlignment>
+  ETL_CONSTANT size_t monotonic_arena<VSize, VAlignment>::SIZE;
+
+  template <size_t VSize, size_t VAlignment>
+  ETL_CONSTANT size_t monotonic_arena<VSize, VAlignment>::ALIGNMENT;
+
+  //***************************************************************************
+  /// A monotonic arena with external storage.
+  ///\ingroup monotonic_arena
+  //***************************************************************************
+  class monotonic_arena_ext : public etl::imonotonic_arena
+  {
+  public:
+
+    //*************************************************************************
+    /// Constructor
+    //*************************************************************************
+    monotonic_arena_ext(void* buffer, size_t size)
+      : imonotonic_arena(static_cast<char*>(buffer), size)
+    {
+    }
+  };
+}
+
+#endif
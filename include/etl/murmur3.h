@@ -36,6 +36,8 @@ SOFTWARE.
 #include "iterator.h"
 #include "binary.h"
 #include "error_handler.h"
+#include "type_traits.h"
+#include "frame_check_sequence.h"
 
 #include <stdint.h>
 
@@ -89,20 +91,7 @@ namespace etl
       ETL_STATIC_ASSERT(sizeof(typename etl::iterator_traits<TIterator>::value_type) == 1, "Incompatible type");
 
       reset();
-      while (begin != end)
-      {
-        block |= (*begin) << (block_fill_count * 8U);
-        ++begin;
-
-        if (++block_fill_count == FULL_BLOCK)
-        {
-          add_block();
-          block_fill_count = 0;
-          block = 0;
-        }
-
-        ++char_count;
-      }
+      add(begin, end);
     }
 
     //*************************************************************************
@@ -128,20 +117,7 @@ namespace etl
       ETL_STATIC_ASSERT(sizeof(typename etl::iterator_traits<TIterator>::value_type) == 1, "Incompatible type");
       ETL_ASSERT(!is_finalised, ETL_ERROR(hash_finalised));
 
-      while (begin != end)
-      {
-        block |= (*begin) << (block_fill_count * 8U);
-        ++begin;
-
-        if (++block_fill_count == FULL_BLOCK)
-        {
-          add_block();
-          block_fill_count = 0;
-          block = 0;
-        }
-
-        ++char_count;
-      }
+      add_range(begin, end, etl::integral_constant<bool, etl::is_random_access_iterator<TIterator>::value>());
     }
 
     //*************************************************************************
@@ -154,7 +130,7 @@ namespace etl
       // We can't add to a finalised hash!
       ETL_ASSERT(!is_finalised, ETL_ERROR(hash_finalised));
 
-      block |= value_ << (block_fill_count * 8U);
+      block |= value_type(value_) << (block_fill_count * 8U);
 
       if (++block_fill_count == FULL_BLOCK)
       {
@@ -185,6 +161,55 @@ namespace etl
 
   private:
 
+    //*************************************************************************
+    /// Adds a range, one value at a time.
+    //*************************************************************************
+    template<typename TIterator>
+    void add_range(TIterator begin, const TIterator end, etl::false_type)
+    {
+      while (begin != end)
+      {
+        block |= value_type(static_cast<uint8_t>(*begin)) << (block_fill_count * 8U);
+        ++begin;
+
+        if (++block_fill_count == FULL_BLOCK)
+        {
+          add_block();
+          block_fill_count = 0;
+          block = 0;
+        }
+
+        ++char_count;
+      }
+    }
+
+    //*************************************************************************
+    /// Adds a range, completing any partial block first, then a block at a
+    /// time, followed by any remaining values.
+    //*************************************************************************
+    template<typename TIterator>
+    void add_range(TIterator begin, const TIterator end, etl::true_type)
+    {
+      while ((block_fill_count != 0U) && (begin != end))
+      {
+        add(static_cast<uint8_t>(*begin));
+        ++begin;
+      }
+
+      while ((end - begin) >= static_cast<typename etl::iterator_traits<TIterator>::difference_type>(FULL_BLOCK))
+      {
+        block = etl::private_frame_check_sequence::read_uint32_le(begin);
+
+        add_block();
+        block = 0;
+
+        begin      += FULL_BLOCK;
+        char_count += FULL_BLOCK;
+      }
+
+      add_range(begin, end, etl::false_type());
+    }
+
     //*************************************************************************
     /// Adds a filled block to the hash.
     //*************************************************************************
@@ -138,6 +138,13 @@ SOFTWARE.
   #define ETL_NOT_USING_64BIT_TYPES 0
 #endif
 
+//*************************************
+// The size of a cache line.
+// Used to keep data written by different threads on separate cache lines.
+#if !defined(ETL_CACHE_LINE_SIZE)
+  #define ETL_CACHE_LINE_SIZE 64
+#endif
+
 //*************************************
 // For when the runtime library is compiled without wchar_t support.
 #if defined(ETL_NO_WIDE_CHARACTERS)
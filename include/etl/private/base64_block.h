@@ -0,0 +1,394 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_BASE64_BLOCK_INCLUDED
+#define ETL_BASE64_BLOCK_INCLUDED
+
+#include "../platform.h"
+#include "../type_traits.h"
+
+#include <stdint.h>
+#include <stddef.h>
+
+//*****************************************************************************
+// Base64 encodes and decodes whole runs of 3 octet / 4 sextet groups with
+// SSSE3 or AVX2 instructions, when they are available for the target.
+// Define ETL_BASE64_NO_SIMD to always use the portable code.
+//*****************************************************************************
+#if !defined(ETL_BASE64_NO_SIMD) && (ETL_USING_CPP20 || (ETL_USING_BUILTIN_IS_CONSTANT_EVALUATED == 1) || !ETL_USING_CPP14)
+  #if (defined(__AVX2__) || defined(__SSSE3__)) && (defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86))
+    #include <immintrin.h>
+    #define ETL_USING_BASE64_SIMD 1
+  #endif
+#endif
+
+#if !defined(ETL_USING_BASE64_SIMD)
+  #define ETL_USING_BASE64_SIMD 0
+#endif
+
+namespace etl
+{
+  namespace private_base64
+  {
+    /// Returned by decode_sextet for a character that is not in the encoding.
+    static ETL_CONSTANT uint32_t Invalid_Sextet = 0x100U;
+
+    //*************************************************************************
+    /// Gets the sextet for a character.
+    /// All of the character sets share 'A'-'Z', 'a'-'z' and '0'-'9' as the
+    /// first 62 characters. 'c62' and 'c63' are the last two.
+    /// Returns Invalid_Sextet if the character is not in the set.
+    /// Branch free, as encoded data is effectively random.
+    //*************************************************************************
+    ETL_CONSTEXPR14
+    inline uint32_t decode_sextet(uint8_t c, uint8_t c62, uint8_t c63)
+    {
+      const uint32_t value = c;
+
+      const uint32_t is_upper = 0U - uint32_t(uint8_t(c - uint8_t('A')) < 26U);
+      const uint32_t is_lower = 0U - uint32_t(uint8_t(c - uint8_t('a')) < 26U);
+      const uint32_t is_digit = 0U - uint32_t(uint8_t(c - uint8_t('0')) < 10U);
+      const uint32_t is_62    = 0U - uint32_t(c == c62);
+      const uint32_t is_63    = 0U - uint32_t(c == c63);
+
+      return (is_upper & (value - uint32_t('A')))        |
+             (is_lower & (value - uint32_t('a') + 26U))  |
+             (is_digit & (value - uint32_t('0') + 52U))  |
+             (is_62    & 62U)                            |
+             (is_63    & 63U)                            |
+             (~(is_upper | is_lower | is_digit | is_62 | is_63) & Invalid_Sextet);
+    }
+
+    //*************************************************************************
+    /// Encodes 'groups' groups of 3 octets to 4 characters each.
+    //*************************************************************************
+    template <typename T>
+    ETL_CONSTEXPR14
+    void encode_groups_portable(const T* input, size_t groups, char* output, const char* table)
+    {
+      while (groups-- != 0U)
+      {
+        const uint32_t octets = (uint32_t(static_cast<uint8_t>(input[0])) << 16) |
+                                (uint32_t(static_cast<uint8_t>(input[1])) << 8)  |
+                                (uint32_t(static_cast<uint8_t>(input[2])));
+
+        output[0] = table[(octets >> 18) & 0x3FU];
+        output[1] = table[(octets >> 12) & 0x3FU];
+        output[2] = table[(octets >>  6) & 0x3FU];
+        output[3] = table[(octets >>  0) & 0x3FU];
+
+        input  += 3;
+        output += 4;
+      }
+    }
+
+    //*************************************************************************
+    /// Decodes up to 'groups' groups of 4 characters to 3 octets each.
+    /// Stops before the first group that has a character that is not in the
+    /// encoding, including padding.
+    /// Returns the number of groups decoded.
+    //*************************************************************************
+    template <typename T>
+    ETL_CONSTEXPR14
+    size_t decode_groups_portable(const T* input, size_t groups, unsigned char* output, char c62, char c63)
+    {
+      const uint8_t u62 = static_cast<uint8_t>(c62);
+      const uint8_t u63 = static_cast<uint8_t>(c63);
+
+      size_t decoded = 0U;
+
+      while (decoded < groups)
+      {
+        const uint32_t s0 = decode_sextet(static_cast<uint8_t>(input[0]), u62, u63);
+        const uint32_t s1 = decode_sextet(static_cast<uint8_t>(input[1]), u62, u63);
+        const uint32_t s2 = decode_sextet(static_cast<uint8_t>(input[2]), u62, u63);
+        const uint32_t s3 = decode_sextet(static_cast<uint8_t>(input[3]), u62, u63);
+
+        if (((s0 | s1 | s2 | s3) & Invalid_Sextet) != 0U)
+        {
+          break;
+        }
+
+        const uint32_t sextets = (s0 << 18) | (s1 << 12) | (s2 << 6) | s3;
+
+        output[0] = static_cast<unsigned char>(sextets >> 16);
+        output[1] = static_cast<unsigned char>(sextets >> 8);
+        output[2] = static_cast<unsigned char>(sextets);
+
+        input  += 4;
+        output += 3;
+        ++decoded;
+      }
+
+      return decoded;
+    }
+
+#if ETL_USING_BASE64_SIMD
+  #if defined(__AVX2__)
+    //*************************************************************************
+    /// Encodes 8 groups per step while at least 10 groups remain, as each
+    /// step reads 28 octets.
+    /// Returns the number of groups encoded.
+    //*************************************************************************
+    inline size_t encode_groups_simd(const uint8_t* input, size_t groups, char* output, const char* table)
+    {
+      const __m256i shuffle   = _mm256_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10,
+                                                 1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10);
+      const __m128i shift_128 = _mm_setr_epi8(char('a' - 26), char('0' - 52), char('0' - 52), char('0' - 52),
+                                              char('0' - 52), char('0' - 52), char('0' - 52), char('0' - 52),
+                                              char('0' - 52), char('0' - 52), char('0' - 52), char(table[62] - 62),
+                                              char(table[63] - 63), char('A'), 0, 0);
+      const __m256i shift     = _mm256_broadcastsi128_si256(shift_128);
+
+      size_t done = 0U;
+
+      while ((groups - done) >= 10U)
+      {
+        const __m128i lo = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input));
+        const __m128i hi = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + 12));
+
+        // Each 128 bit lane holds 4 groups of 3 octets, spread to 4 groups of 32 bits.
+        __m256i in = _mm256_inserti128_si256(_mm256_castsi128_si256(lo), hi, 1);
+        in = _mm256_shuffle_epi8(in, shuffle);
+
+        // Split each 24 bits in to 4 sextets, one per octet.
+        const __m256i t0      = _mm256_mulhi_epu16(_mm256_and_si256(in, _mm256_set1_epi32(0x0FC0FC00)), _mm256_set1_epi32(0x04000040));
+        const __m256i t1      = _mm256_mullo_epi16(_mm256_and_si256(in, _mm256_set1_epi32(0x003F03F0)), _mm256_set1_epi32(0x01000010));
+        const __m256i indices = _mm256_or_si256(t0, t1);
+
+        // Map each sextet to the offset to its character.
+        __m256i offsets = _mm256_subs_epu8(indices, _mm256_set1_epi8(51));
+        offsets = _mm256_or_si256(offsets, _mm256_and_si256(_mm256_cmpgt_epi8(_mm256_set1_epi8(26), indices), _mm256_set1_epi8(13)));
+        offsets = _mm256_shuffle_epi8(shift, offsets);
+
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(output), _mm256_add_epi8(offsets, indices));
+
+        input  += 24;
+        output += 32;
+        done   += 8U;
+      }
+
+      return done;
+    }
+
+    //*************************************************************************
+    /// Decodes 8 groups per step while at least 10 groups remain, as each
+    /// step writes 28 octets.
+    /// Stops before a step that has a character that is not in the encoding.
+    /// Returns the number of groups decoded.
+    //*************************************************************************
+    inline size_t decode_groups_simd(const uint8_t* input, size_t groups, unsigned char* output, char c62, char c63)
+    {
+      const __m256i pack = _mm256_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1,
+                                            2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1);
+
+      size_t done = 0U;
+
+      while ((groups - done) >= 10U)
+      {
+        const __m256i in = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(input));
+
+        const __m256i upper = _mm256_and_si256(_mm256_cmpgt_epi8(in, _mm256_set1_epi8('A' - 1)), _mm256_cmpgt_epi8(_mm256_set1_epi8('Z' + 1), in));
+        const __m256i lower = _mm256_and_si256(_mm256_cmpgt_epi8(in, _mm256_set1_epi8('a' - 1)), _mm256_cmpgt_epi8(_mm256_set1_epi8('z' + 1), in));
+        const __m256i digit = _mm256_and_si256(_mm256_cmpgt_epi8(in, _mm256_set1_epi8('0' - 1)), _mm256_cmpgt_epi8(_mm256_set1_epi8('9' + 1), in));
+        const __m256i is_62 = _mm256_cmpeq_epi8(in, _mm256_set1_epi8(c62));
+        const __m256i is_63 = _mm256_cmpeq_epi8(in, _mm256_set1_epi8(c63));
+
+        const __m256i valid = _mm256_or_si256(_mm256_or_si256(_mm256_or_si256(upper, lower), digit), _mm256_or_si256(is_62, is_63));
+
+        if (_mm256_movemask_epi8(valid) != -1)
+        {
+          break;
+        }
+
+        __m256i offsets = _mm256_and_si256(upper, _mm256_set1_epi8(char(-'A')));
+        offsets = _mm256_or_si256(offsets, _mm256_and_si256(lower, _mm256_set1_epi8(char(26 - 'a'))));
+        offsets = _mm256_or_si256(offsets, _mm256_and_si256(digit, _mm256_set1_epi8(char(52 - '0'))));
+        offsets = _mm256_or_si256(offsets, _mm256_and_si256(is_62, _mm256_set1_epi8(char(62 - c62))));
+        offsets = _mm256_or_si256(offsets, _mm256_and_si256(is_63, _mm256_set1_epi8(char(63 - c63))));
+
+        const __m256i sextets = _mm256_add_epi8(in, offsets);
+
+        // Merge 4 sextets in to 24 bits, then pack the octets.
+        const __m256i pairs  = _mm256_maddubs_epi16(sextets, _mm256_set1_epi32(0x01400140));
+        const __m256i merged = _mm256_madd_epi16(pairs, _mm256_set1_epi32(0x00011000));
+        const __m256i packed = _mm256_shuffle_epi8(merged, pack);
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(output),      _mm256_castsi256_si128(packed));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(output + 12), _mm256_extracti128_si256(packed, 1));
+
+        input  += 32;
+        output += 24;
+        done   += 8U;
+      }
+
+      return done;
+    }
+  #else
+    //*************************************************************************
+    /// Encodes 4 groups per step while at least 6 groups remain, as each
+    /// step reads 16 octets.
+    /// Returns the number of groups encoded.
+    //*************************************************************************
+    inline size_t encode_groups_simd(const uint8_t* input, size_t groups, char* output, const char* table)
+    {
+      const __m128i shuffle = _mm_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10);
+      const __m128i shift   = _mm_setr_epi8(char('a' - 26), char('0' - 52), char('0' - 52), char('0' - 52),
+                                            char('0' - 52), char('0' - 52), char('0' - 52), char('0' - 52),
+                                            char('0' - 52), char('0' - 52), char('0' - 52), char(table[62] - 62),
+                                            char(table[63] - 63), char('A'), 0, 0);
+
+      size_t done = 0U;
+
+      while ((groups - done) >= 6U)
+      {
+        // Spread 4 groups of 3 octets to 4 groups of 32 bits.
+        __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input));
+        in = _mm_shuffle_epi8(in, shuffle);
+
+        // Split each 24 bits in to 4 sextets, one per octet.
+        const __m128i t0      = _mm_mulhi_epu16(_mm_and_si128(in, _mm_set1_epi32(0x0FC0FC00)), _mm_set1_epi32(0x04000040));
+        const __m128i t1      = _mm_mullo_epi16(_mm_and_si128(in, _mm_set1_epi32(0x003F03F0)), _mm_set1_epi32(0x01000010));
+        const __m128i indices = _mm_or_si128(t0, t1);
+
+        // Map each sextet to the offset to its character.
+        __m128i offsets = _mm_subs_epu8(indices, _mm_set1_epi8(51));
+        offsets = _mm_or_si128(offsets, _mm_and_si128(_mm_cmpgt_epi8(_mm_set1_epi8(26), indices), _mm_set1_epi8(13)));
+        offsets = _mm_shuffle_epi8(shift, offsets);
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(output), _mm_add_epi8(offsets, indices));
+
+        input  += 12;
+        output += 16;
+        done   += 4U;
+      }
+
+      return done;
+    }
+
+    //*************************************************************************
+    /// Decodes 4 groups per step while at least 6 groups remain, as each
+    /// step writes 16 octets.
+    /// Stops before a step that has a character that is not in the encoding.
+    /// Returns the number of groups decoded.
+    //*************************************************************************
+    inline size_t decode_groups_simd(const uint8_t* input, size_t groups, unsigned char* output, char c62, char c63)
+    {
+      const __m128i pack = _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1);
+
+      size_t done = 0U;
+
+      while ((groups - done) >= 6U)
+      {
+        const __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input));
+
+        const __m128i upper = _mm_and_si128(_mm_cmpgt_epi8(in, _mm_set1_epi8('A' - 1)), _mm_cmpgt_epi8(_mm_set1_epi8('Z' + 1), in));
+        const __m128i lower = _mm_and_si128(_mm_cmpgt_epi8(in, _mm_set1_epi8('a' - 1)), _mm_cmpgt_epi8(_mm_set1_epi8('z' + 1), in));
+        const __m128i digit = _mm_and_si128(_mm_cmpgt_epi8(in, _mm_set1_epi8('0' - 1)), _mm_cmpgt_epi8(_mm_set1_epi8('9' + 1), in));
+        const __m128i is_62 = _mm_cmpeq_epi8(in, _mm_set1_epi8(c62));
+        const __m128i is_63 = _mm_cmpeq_epi8(in, _mm_set1_epi8(c63));
+
+        const __m128i valid = _mm_or_si128(_mm_or_si128(_mm_or_si128(upper, lower), digit), _mm_or_si128(is_62, is_63));
+
+        if (_mm_movemask_epi8(valid) != 0xFFFF)
+        {
+          break;
+        }
+
+        __m128i offsets = _mm_and_si128(upper, _mm_set1_epi8(char(-'A')));
+        offsets = _mm_or_si128(offsets, _mm_and_si128(lower, _mm_set1_epi8(char(26 - 'a'))));
+        offsets = _mm_or_si128(offsets, _mm_and_si128(digit, _mm_set1_epi8(char(52 - '0'))));
+        offsets = _mm_or_si128(offsets, _mm_and_si128(is_62, _mm_set1_epi8(char(62 - c62))));
+        offsets = _mm_or_si128(offsets, _mm_and_si128(is_63, _mm_set1_epi8(char(63 - c63))));
+
+        const __m128i sextets = _mm_add_epi8(in, offsets);
+
+        // Merge 4 sextets in to 24 bits, then pack the octets.
+        const __m128i pairs  = _mm_maddubs_epi16(sextets, _mm_set1_epi32(0x01400140));
+        const __m128i merged = _mm_madd_epi16(pairs, _mm_set1_epi32(0x00011000));
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(output), _mm_shuffle_epi8(merged, pack));
+
+        input  += 16;
+        output += 12;
+        done   += 4U;
+      }
+
+      return done;
+    }
+  #endif
+#endif
+
+    //*************************************************************************
+    /// Encodes 'groups' groups of 3 octets to 4 characters each.
+    //*************************************************************************
+    template <typename T>
+    ETL_CONSTEXPR14
+    void encode_groups(const T* input, size_t groups, char* output, const char* table)
+    {
+#if ETL_USING_BASE64_SIMD
+      if (!etl::is_constant_evaluated())
+      {
+        const size_t done = encode_groups_simd(reinterpret_cast<const uint8_t*>(input), groups, output, table);
+
+        input  += done * 3U;
+        output += done * 4U;
+        groups -= done;
+      }
+#endif
+
+      encode_groups_portable(input, groups, output, table);
+    }
+
+    //*************************************************************************
+    /// Decodes up to 'groups' groups of 4 characters to 3 octets each.
+    /// Stops before the first group that has a character that is not in the
+    /// encoding, including padding.
+    /// Returns the number of groups decoded.
+    //*************************************************************************
+    template <typename T>
+    ETL_CONSTEXPR14
+    size_t decode_groups(const T* input, size_t groups, unsigned char* output, char c62, char c63)
+    {
+      size_t done = 0U;
+
+#if ETL_USING_BASE64_SIMD
+      if (!etl::is_constant_evaluated())
+      {
+        done = decode_groups_simd(reinterpret_cast<const uint8_t*>(input), groups, output, c62, c63);
+      }
+#endif
+
+      return done + decode_groups_portable(input + (done * 4U), groups - done, output + (done * 3U), c62, c63);
+    }
+  }
+}
+
+#endif
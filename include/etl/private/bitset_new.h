@@ -59,6 +59,42 @@ SOFTWARE.
 
 #include "minmax_push.h"
 
+//*****************************************************************************
+// The bitset word kernels scan, count and combine runs of elements with SSE2,
+// SSSE3 or AVX2 instructions, when they are available for the target.
+// Define ETL_BITSET_NO_SIMD to always use the portable code.
+//*****************************************************************************
+#if !defined(ETL_BITSET_NO_SIMD) && (ETL_USING_CPP20 || (ETL_USING_BUILTIN_IS_CONSTANT_EVALUATED == 1) || !ETL_USING_CPP14)
+  #if (defined(__AVX2__) || defined(__SSE2__)) && (defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86))
+    #include <immintrin.h>
+    #define ETL_USING_BITSET_SIMD 1
+  #endif
+#endif
+
+#if !defined(ETL_USING_BITSET_SIMD)
+  #define ETL_USING_BITSET_SIMD 0
+#endif
+
+//*****************************************************************************
+// Use the compiler's popcount builtin only where it maps to an instruction.
+// Elsewhere it becomes a library call that is slower than etl::count_bits.
+//*****************************************************************************
+#if (defined(ETL_COMPILER_GCC) || defined(ETL_COMPILER_CLANG)) && (defined(__POPCNT__) || defined(__aarch64__) || defined(__ARM_NEON))
+  #define ETL_USING_BITSET_BUILTIN_POPCOUNT 1
+#else
+  #define ETL_USING_BITSET_BUILTIN_POPCOUNT 0
+#endif
+
+//*****************************************************************************
+// Use the compiler's count trailing zeros builtin, except on ARM cores
+// without a CLZ instruction, where it becomes a library call.
+//*****************************************************************************
+#if (defined(ETL_COMPILER_GCC) || defined(ETL_COMPILER_CLANG)) && !(defined(__ARM_ARCH) && !defined(__ARM_FEATURE_CLZ))
+  #define ETL_USING_BITSET_BUILTIN_CTZ 1
+#else
+  #define ETL_USING_BITSET_BUILTIN_CTZ 0
+#endif
+
 #if defined(ETL_COMPILER_KEIL)
 #pragma diag_suppress 1300
 #endif
@@ -190,6 +226,423 @@ namespace etl
 
     template <typename TElement>
     ETL_CONSTANT TElement bitset_impl_common<TElement>::All_Clear_Element;
+
+    //*************************************************************************
+    /// Word kernels for the bitset implementations.
+    /// Counts and searches a word at a time with popcount/ctz and skips or
+    /// combines runs of whole elements several at a time.
+    /// All functions may be used in constant expressions.
+    //*************************************************************************
+    template <typename TElement>
+    class bitset_word_kernel
+    {
+    public:
+
+      typedef TElement        element_type;
+      typedef TElement*       pointer;
+      typedef const TElement* const_pointer;
+
+      //***********************************
+      /// Count the set bits in an element.
+      //***********************************
+      static
+      ETL_CONSTEXPR14
+      size_t count_bits(element_type value) ETL_NOEXCEPT
+      {
+#if ETL_USING_BITSET_BUILTIN_POPCOUNT
+        return (sizeof(element_type) <= sizeof(unsigned int)) ? static_cast<size_t>(__builtin_popcount(static_cast<unsigned int>(value)))
+                                                              : static_cast<size_t>(__builtin_popcountll(static_cast<unsigned long long>(value)));
+#else
+        return etl::count_bits(value);
+#endif
+      }
+
+      //***********************************
+      /// The position of the lowest set bit.
+      /// The value must not be zero.
+      //***********************************
+      static
+      ETL_CONSTEXPR14
+      size_t count_trailing_zeros(element_type value) ETL_NOEXCEPT
+      {
+#if ETL_USING_BITSET_BUILTIN_CTZ
+        return (sizeof(element_type) <= sizeof(unsigned int)) ? static_cast<size_t>(__builtin_ctz(static_cast<unsigned int>(value)))
+                                                              : static_cast<size_t>(__builtin_ctzll(static_cast<unsigned long long>(value)));
+#else
+        return etl::count_trailing_zeros(value);
+#endif
+      }
+
+      //***********************************
+      /// Count the set bits in a run of elements.
+      //***********************************
+      static
+      ETL_CONSTEXPR14
+      size_t count(const_pointer pbuffer,
+                   size_t        number_of_elements) ETL_NOEXCEPT
+      {
+        size_t index = 0U;
+        size_t count = 0U;
+
+#if ETL_USING_BITSET_SIMD && (defined(__AVX2__) || defined(__SSSE3__))
+        if (!etl::is_constant_evaluated())
+        {
+          index = count_simd(pbuffer, number_of_elements, count);
+        }
+#endif
+
+        // Four independent counts, so that the popcounts may overlap.
+        size_t count1 = 0U;
+        size_t count2 = 0U;
+        size_t count3 = 0U;
+
+        while ((index + 4U) <= number_of_elements)
+        {
+          count  += count_bits(pbuffer[index]);
+          count1 += count_bits(pbuffer[index + 1U]);
+          count2 += count_bits(pbuffer[index + 2U]);
+          count3 += count_bits(pbuffer[index + 3U]);
+          index  += 4U;
+        }
+
+        while (index < number_of_elements)
+        {
+          count += count_bits(pbuffer[index]);
+          ++index;
+        }
+
+        return count + count1 + count2 + count3;
+      }
+
+      //***********************************
+      /// Finds the first element in [index, number_of_elements) that is not
+      /// equal to skip, which must be all clear or all set.
+      ///\returns The index of the element or number_of_elements if none were found.
+      //***********************************
+      static
+      ETL_CONSTEXPR14
+      size_t find_first_not(const_pointer pbuffer,
+                            size_t        index,
+                            size_t        number_of_elements,
+                            element_type  skip) ETL_NOEXCEPT
+      {
+#if ETL_USING_BITSET_SIMD
+        if (!etl::is_constant_evaluated() && (index < number_of_elements))
+        {
+          index = find_first_not_simd(pbuffer, index, number_of_elements, skip);
+        }
+#endif
+
+        while ((index + 4U) <= number_of_elements)
+        {
+          const element_type difference = element_type((pbuffer[index]      ^ skip) |
+                                                       (pbuffer[index + 1U] ^ skip) |
+                                                       (pbuffer[index + 2U] ^ skip) |
+                                                       (pbuffer[index + 3U] ^ skip));
+
+          if (difference != element_type(0))
+          {
+            break;
+          }
+
+          index += 4U;
+        }
+
+        while ((index < number_of_elements) && (pbuffer[index] == skip))
+        {
+          ++index;
+        }
+
+        return index;
+      }
+
+      //***********************************
+      /// AND rhs into lhs.
+      //***********************************
+      static
+      ETL_CONSTEXPR14
+      void operator_and(pointer       lhs_pbuffer,
+                        const_pointer rhs_pbuffer,
+                        size_t        number_of_elements) ETL_NOEXCEPT
+      {
+        apply<and_operation>(lhs_pbuffer, rhs_pbuffer, number_of_elements);
+      }
+
+      //***********************************
+      /// OR rhs into lhs.
+      //***********************************
+      static
+      ETL_CONSTEXPR14
+      void operator_or(pointer       lhs_pbuffer,
+                       const_pointer rhs_pbuffer,
+                       size_t        number_of_elements) ETL_NOEXCEPT
+      {
+        apply<or_operation>(lhs_pbuffer, rhs_pbuffer, number_of_elements);
+      }
+
+      //***********************************
+      /// XOR rhs into lhs.
+      //***********************************
+      static
+      ETL_CONSTEXPR14
+      void operator_xor(pointer       lhs_pbuffer,
+                        const_pointer rhs_pbuffer,
+                        size_t        number_of_elements) ETL_NOEXCEPT
+      {
+        apply<xor_operation>(lhs_pbuffer, rhs_pbuffer, number_of_elements);
+      }
+
+      //***********************************
+      /// Invert the elements.
+      //***********************************
+      static
+      ETL_CONSTEXPR14
+      void operator_not(pointer pbuffer,
+                        size_t  number_of_elements) ETL_NOEXCEPT
+      {
+        apply<not_operation>(pbuffer, pbuffer, number_of_elements);
+      }
+
+    private:
+
+      //***********************************
+      struct and_operation
+      {
+        static ETL_CONSTEXPR element_type apply(element_type lhs, element_type rhs) ETL_NOEXCEPT { return element_type(lhs & rhs); }
+#if ETL_USING_BITSET_SIMD
+  #if defined(__AVX2__)
+        static __m256i apply(__m256i lhs, __m256i rhs) ETL_NOEXCEPT { return _mm256_and_si256(lhs, rhs); }
+  #endif
+        static __m128i apply(__m128i lhs, __m128i rhs) ETL_NOEXCEPT { return _mm_and_si128(lhs, rhs); }
+#endif
+      };
+
+      //***********************************
+      struct or_operation
+      {
+        static ETL_CONSTEXPR element_type apply(element_type lhs, element_type rhs) ETL_NOEXCEPT { return element_type(lhs | rhs); }
+#if ETL_USING_BITSET_SIMD
+  #if defined(__AVX2__)
+        static __m256i apply(__m256i lhs, __m256i rhs) ETL_NOEXCEPT { return _mm256_or_si256(lhs, rhs); }
+  #endif
+        static __m128i apply(__m128i lhs, __m128i rhs) ETL_NOEXCEPT { return _mm_or_si128(lhs, rhs); }
+#endif
+      };
+
+      //***********************************
+      struct xor_operation
+      {
+        static ETL_CONSTEXPR element_type apply(element_type lhs, element_type rhs) ETL_NOEXCEPT { return element_type(lhs ^ rhs); }
+#if ETL_USING_BITSET_SIMD
+  #if defined(__AVX2__)
+        static __m256i apply(__m256i lhs, __m256i rhs) ETL_NOEXCEPT { return _mm256_xor_si256(lhs, rhs); }
+  #endif
+        static __m128i apply(__m128i lhs, __m128i rhs) ETL_NOEXCEPT { return _mm_xor_si128(lhs, rhs); }
+#endif
+      };
+
+      //***********************************
+      struct not_operation
+      {
+        static ETL_CONSTEXPR element_type apply(element_type lhs, element_type /*rhs*/) ETL_NOEXCEPT { return element_type(~lhs); }
+#if ETL_USING_BITSET_SIMD
+  #if defined(__AVX2__)
+        static __m256i apply(__m256i lhs, __m256i /*rhs*/) ETL_NOEXCEPT { return _mm256_xor_si256(lhs, _mm256_set1_epi32(-1)); }
+  #endif
+        static __m128i apply(__m128i lhs, __m128i /*rhs*/) ETL_NOEXCEPT { return _mm_xor_si128(lhs, _mm_set1_epi32(-1)); }
+#endif
+      };
+
+      //***********************************
+      /// Applies the operation to each element pair, storing the result in lhs.
+      //***********************************
+      template <typename TOperation>
+      static
+      ETL_CONSTEXPR14
+      void apply(pointer       lhs_pbuffer,
+                 const_pointer rhs_pbuffer,
+                 size_t        number_of_elements) ETL_NOEXCEPT
+      {
+#if ETL_USING_BITSET_SIMD
+        if (!etl::is_constant_evaluated())
+        {
+          apply_simd<TOperation>(lhs_pbuffer, rhs_pbuffer, number_of_elements);
+          return;
+        }
+#endif
+
+        for (size_t index = 0U; index < number_of_elements; ++index)
+        {
+          lhs_pbuffer[index] = TOperation::apply(lhs_pbuffer[index], rhs_pbuffer[index]);
+        }
+      }
+
+#if ETL_USING_BITSET_SIMD
+      //***********************************
+      /// The number of elements in a vector register.
+      //***********************************
+  #if defined(__AVX2__)
+      static ETL_CONSTANT size_t Elements_Per_Vector = sizeof(__m256i) / sizeof(element_type);
+  #else
+      static ETL_CONSTANT size_t Elements_Per_Vector = sizeof(__m128i) / sizeof(element_type);
+  #endif
+
+      //***********************************
+      /// Skips whole vectors of elements equal to skip.
+      ///\returns The index of the first vector that contains a different element.
+      //***********************************
+      static
+      size_t find_first_not_simd(const_pointer pbuffer,
+                                 size_t        index,
+                                 size_t        number_of_elements,
+                                 element_type  skip) ETL_NOEXCEPT
+      {
+        // Skip is all clear or all set, so every byte of it is the same.
+        const char skip_byte = static_cast<char>(skip & 0xFFU);
+
+  #if defined(__AVX2__)
+        const __m256i pattern = _mm256_set1_epi8(skip_byte);
+
+        // Two vectors per step.
+        while ((index + (2U * Elements_Per_Vector)) <= number_of_elements)
+        {
+          const __m256i block0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pbuffer + index));
+          const __m256i block1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pbuffer + index + Elements_Per_Vector));
+          const __m256i equal  = _mm256_and_si256(_mm256_cmpeq_epi8(block0, pattern), _mm256_cmpeq_epi8(block1, pattern));
+
+          if (_mm256_movemask_epi8(equal) != -1)
+          {
+            break;
+          }
+
+          index += 2U * Elements_Per_Vector;
+        }
+  #else
+        const __m128i pattern = _mm_set1_epi8(skip_byte);
+
+        // Four vectors per step.
+        while ((index + (4U * Elements_Per_Vector)) <= number_of_elements)
+        {
+          const __m128i block0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pbuffer + index));
+          const __m128i block1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pbuffer + index + Elements_Per_Vector));
+          const __m128i block2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pbuffer + index + (2U * Elements_Per_Vector)));
+          const __m128i block3 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pbuffer + index + (3U * Elements_Per_Vector)));
+          const __m128i equal  = _mm_and_si128(_mm_and_si128(_mm_cmpeq_epi8(block0, pattern), _mm_cmpeq_epi8(block1, pattern)),
+                                               _mm_and_si128(_mm_cmpeq_epi8(block2, pattern), _mm_cmpeq_epi8(block3, pattern)));
+
+          if (_mm_movemask_epi8(equal) != 0xFFFF)
+          {
+            break;
+          }
+
+          index += 4U * Elements_Per_Vector;
+        }
+  #endif
+
+        return index;
+      }
+
+      //***********************************
+      /// Applies the operation to whole vectors of elements, then to the
+      /// remaining elements one at a time.
+      //***********************************
+      template <typename TOperation>
+      static
+      void apply_simd(pointer       lhs_pbuffer,
+                      const_pointer rhs_pbuffer,
+                      size_t        number_of_elements) ETL_NOEXCEPT
+      {
+        const size_t number_of_vectors = number_of_elements / Elements_Per_Vector;
+
+        for (size_t vector = 0U; vector < number_of_vectors; ++vector)
+        {
+          const size_t index = vector * Elements_Per_Vector;
+
+  #if defined(__AVX2__)
+          const __m256i lhs = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(lhs_pbuffer + index));
+          const __m256i rhs = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(rhs_pbuffer + index));
+
+          _mm256_storeu_si256(reinterpret_cast<__m256i*>(lhs_pbuffer + index), TOperation::apply(lhs, rhs));
+  #else
+          const __m128i lhs = _mm_loadu_si128(reinterpret_cast<const __m128i*>(lhs_pbuffer + index));
+          const __m128i rhs = _mm_loadu_si128(reinterpret_cast<const __m128i*>(rhs_pbuffer + index));
+
+          _mm_storeu_si128(reinterpret_cast<__m128i*>(lhs_pbuffer + index), TOperation::apply(lhs, rhs));
+  #endif
+        }
+
+        for (size_t index = number_of_vectors * Elements_Per_Vector; index < number_of_elements; ++index)
+        {
+          lhs_pbuffer[index] = TOperation::apply(lhs_pbuffer[index], rhs_pbuffer[index]);
+        }
+      }
+
+  #if defined(__AVX2__) || defined(__SSSE3__)
+      //***********************************
+      /// Counts the set bits in whole vectors of elements, using a nibble
+      /// lookup table and summing the bytes of each vector.
+      ///\returns The index of the first element not counted.
+      //***********************************
+      static
+      size_t count_simd(const_pointer pbuffer,
+                        size_t        number_of_elements,
+                        size_t&       total_count) ETL_NOEXCEPT
+      {
+        size_t index = 0U;
+
+    #if defined(__AVX2__)
+        const __m256i lookup     = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+                                                    0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+        const __m256i low_nibble = _mm256_set1_epi8(0x0F);
+        __m256i       total      = _mm256_setzero_si256();
+
+        while ((index + Elements_Per_Vector) <= number_of_elements)
+        {
+          const __m256i block  = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pbuffer + index));
+          const __m256i low    = _mm256_and_si256(block, low_nibble);
+          const __m256i high   = _mm256_and_si256(_mm256_srli_epi16(block, 4), low_nibble);
+          const __m256i counts = _mm256_add_epi8(_mm256_shuffle_epi8(lookup, low), _mm256_shuffle_epi8(lookup, high));
+
+          total  = _mm256_add_epi64(total, _mm256_sad_epu8(counts, _mm256_setzero_si256()));
+          index += Elements_Per_Vector;
+        }
+
+        uint64_t totals[4];
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(totals), total);
+
+        total_count += static_cast<size_t>(totals[0] + totals[1] + totals[2] + totals[3]);
+    #else
+        const __m128i lookup     = _mm_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+        const __m128i low_nibble = _mm_set1_epi8(0x0F);
+        __m128i       total      = _mm_setzero_si128();
+
+        while ((index + Elements_Per_Vector) <= number_of_elements)
+        {
+          const __m128i block  = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pbuffer + index));
+          const __m128i low    = _mm_and_si128(block, low_nibble);
+          const __m128i high   = _mm_and_si128(_mm_srli_epi16(block, 4), low_nibble);
+          const __m128i counts = _mm_add_epi8(_mm_shuffle_epi8(lookup, low), _mm_shuffle_epi8(lookup, high));
+
+          total  = _mm_add_epi64(total, _mm_sad_epu8(counts, _mm_setzero_si128()));
+          index += Elements_Per_Vector;
+        }
+
+        uint64_t totals[2];
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(totals), total);
+
+        total_count += static_cast<size_t>(totals[0] + totals[1]);
+    #endif
+
+        return index;
+      }
+  #endif
+#endif
+    };
+
+#if ETL_USING_BITSET_SIMD
+    template <typename TElement>
+    ETL_CONSTANT size_t bitset_word_kernel<TElement>::Elements_Per_Vector;
+#endif
   }
 
   //*************************************************************************
@@ -206,6 +659,10 @@ namespace etl
   template <typename TElement>
   class bitset_impl<TElement, etl::bitset_storage_model::Single> : public etl::private_bitset::bitset_impl_common<TElement>
   {
+  private:
+
+    typedef etl::private_bitset::bitset_word_kernel<TElement> kernel;
+
   public:
 
     using typename etl::private_bitset::bitset_impl_common<TElement>::element_type;
@@ -533,7 +990,7 @@ namespace etl
     size_t count(const_pointer pbuffer, 
                  size_t        /*number_of_elements*/) ETL_NOEXCEPT
     {
-      return etl::count_bits(*pbuffer);
+      return kernel::count_bits(*pbuffer);
     }
 
     //*************************************************************************
@@ -683,26 +1140,17 @@ namespace etl
     {
       if (position < active_bits)
       {
-        // Where to start.
-        size_t bit = position;
+        // Search for set bits in the value, ignoring those below the start position.
+        element_type value = state ? *pbuffer : element_type(~*pbuffer);
+        value &= element_type(All_Set_Element << position);
 
-        element_type mask = 1U << position;
-
-        // Needs checking?
-        if ((state && (*pbuffer != All_Clear_Element)) || (!state && (*pbuffer != All_Set_Element)))
+        if (value != All_Clear_Element)
         {
-          // For each bit in the element...
-          while (bit < active_bits)
+          const size_t bit = kernel::count_trailing_zeros(value);
+
+          if (bit < active_bits)
           {
-            // Equal to the required state?
-            if (((*pbuffer & mask) != 0) == state)
-            {
-              return bit;
-            }
-
-            // Move on to the next bit.
-            mask <<= 1;
-            ++bit;
+            return bit;
           }
         }
       }
@@ -864,6 +1312,7 @@ namespace etl
   private:
 
     typedef etl::private_bitset::bitset_impl_common<TElement> common;
+    typedef etl::private_bitset::bitset_word_kernel<TElement> kernel;
 
   public:
 
@@ -909,14 +1358,7 @@ namespace etl
     size_t count(const_pointer pbuffer,
                  size_t        number_of_elements) ETL_NOEXCEPT
     {
-      size_t count = 0;
-
-      while (number_of_elements-- != 0)
-      {
-        count += etl::count_bits(*pbuffer++);
-      }
-
-      return count;
+      return kernel::count(pbuffer, number_of_elements);
     }
 
     //*************************************************************************
@@ -928,17 +1370,16 @@ namespace etl
              size_t        number_of_elements,
              element_type  top_mask) ETL_NOEXCEPT
     {
+      const size_t last = number_of_elements - 1U;
+
       // All but the last.
-      while (number_of_elements-- != 1U)
+      if (kernel::find_first_not(pbuffer, 0U, last, All_Set_Element) != last)
       {
-        if (*pbuffer++ != All_Set_Element)
-        {
-          return false;
-        }
+        return false;
       }
 
       // The last.
-      if ((*pbuffer & top_mask) != top_mask)
+      if ((pbuffer[last] & top_mask) != top_mask)
       {
         return false;
       }
@@ -954,15 +1395,7 @@ namespace etl
     bool none(const_pointer pbuffer,
               size_t        number_of_elements) ETL_NOEXCEPT
     {
-      while (number_of_elements-- != 0)
-      {
-        if (*pbuffer++ != 0)
-        {
-          return false;
-        }
-      }
-
-      return true;
+      return kernel::find_first_not(pbuffer, 0U, number_of_elements, All_Clear_Element) == number_of_elements;
     }
 
     //*************************************************************************
@@ -973,18 +1406,7 @@ namespace etl
     bool any(const_pointer pbuffer,
              size_t        number_of_elements) ETL_NOEXCEPT
     {
-      bool any_set = false;
-
-      while (number_of_elements-- != 0)
-      {
-        if (*pbuffer++ != All_Clear_Element)
-        {
-          any_set = true;
-          break;
-        }
-      }
-
-      return any_set;
+      return kernel::find_first_not(pbuffer, 0U, number_of_elements, All_Clear_Element) != number_of_elements;
     }
 
     //*************************************************************************
@@ -1474,49 +1896,38 @@ namespace etl
                      bool          state, 
                      size_t        position) ETL_NOEXCEPT
     {
+      if (position >= total_bits)
+      {
+        return npos;
+      }
+
       // Where to start.
       size_t index = position >> log2<Bits_Per_Element>::value;
       size_t bit   = position & (Bits_Per_Element - 1);
 
-      element_type mask = 1 << bit;
+      // Elements with no bits in the required state.
+      const element_type skip = state ? All_Clear_Element : All_Set_Element;
+
+      // Search for set bits in the first value, ignoring those below the start position.
+      element_type value = element_type(pbuffer[index] ^ skip);
+      value &= element_type(All_Set_Element << bit);
 
-      // For each element in the bitset...
-      while (index < number_of_elements)
+      if (value == All_Clear_Element)
       {
-        element_type value = pbuffer[index];
+        // Skip the elements that have no bits in the required state.
+        index = kernel::find_first_not(pbuffer, index + 1U, number_of_elements, skip);
 
-        // Needs checking?
-        if ((state && (value != All_Clear_Element)) ||
-            (!state && (value != All_Set_Element)))
+        if (index == number_of_elements)
         {
-          // For each bit in the element...
-          while ((bit < Bits_Per_Element) && (position < total_bits))
-          {
-            // Equal to the required state?
-            if (((value & mask) != 0) == state)
-            {
-              return position;
-            }
-
-            // Move on to the next bit.
-            mask <<= 1;
-            ++position;
-            ++bit;
-          }
+          return npos;
         }
-        else
-        {
-          position += (Bits_Per_Element - bit);
-        }
-
-        // Start at the beginning for all other elements.
-        bit = 0;
-        mask = 1;
 
-        ++index;
+        value = element_type(pbuffer[index] ^ skip);
       }
 
-      return npos;
+      position = (index << log2<Bits_Per_Element>::value) + kernel::count_trailing_zeros(value);
+
+      return (position < total_bits) ? position : npos;
     }
 
     //*************************************************************************
@@ -1571,12 +1982,7 @@ namespace etl
                       const_pointer rhs_pbuffer, 
                       size_t        number_of_elements) ETL_NOEXCEPT
     {
-      while (number_of_elements-- != 0)
-      {
-        *lhs_pbuffer &= *rhs_pbuffer;
-        ++lhs_pbuffer;
-        ++rhs_pbuffer;
-      }
+      kernel::operator_and(lhs_pbuffer, rhs_pbuffer, number_of_elements);
     }
 
     //*************************************************************************
@@ -1588,12 +1994,7 @@ namespace etl
                      const_pointer rhs_pbuffer, 
                      size_t        number_of_elements) ETL_NOEXCEPT
     {
-      while (number_of_elements-- != 0)
-      {
-        *lhs_pbuffer |= *rhs_pbuffer;
-        ++lhs_pbuffer;
-        ++rhs_pbuffer;
-      }
+      kernel::operator_or(lhs_pbuffer, rhs_pbuffer, number_of_elements);
     }
 
     //*************************************************************************
@@ -1605,12 +2006,7 @@ namespace etl
                       const_pointer rhs_pbuffer, 
                       size_t        number_of_elements) ETL_NOEXCEPT
     {
-      while (number_of_elements-- != 0)
-      {
-        *lhs_pbuffer ^= *rhs_pbuffer;
-        ++lhs_pbuffer;
-        ++rhs_pbuffer;
-      }
+      kernel::operator_xor(lhs_pbuffer, rhs_pbuffer, number_of_elements);
     }
 
     //*************************************************************************
@@ -1621,11 +2017,7 @@ namespace etl
     void operator_not(pointer pbuffer, 
                       size_t  number_of_elements) ETL_NOEXCEPT
     {
-      while (number_of_elements-- != 0)
-      {
-        *pbuffer = ~*pbuffer;
-        ++pbuffer;
-      }
+      kernel::operator_not(pbuffer, number_of_elements);
     }
 
     //*************************************************************************
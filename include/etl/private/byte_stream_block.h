@@ -0,0 +1,191 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_BYTE_STREAM_BLOCK_INCLUDED
+#define ETL_BYTE_STREAM_BLOCK_INCLUDED
+
+#include "../platform.h"
+#include "../binary.h"
+#include "../algorithm.h"
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+//*****************************************************************************
+// The byte streams reverse the bytes of runs of 2, 4 or 8 byte elements with
+// SSSE3 or AVX2 byte shuffles, when they are available for the target.
+// Define ETL_BYTE_STREAM_NO_SIMD to always use the portable code.
+//*****************************************************************************
+#if !defined(ETL_BYTE_STREAM_NO_SIMD)
+  #if (defined(__AVX2__) || defined(__SSSE3__)) && (defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86))
+    #include <immintrin.h>
+    #define ETL_USING_BYTE_STREAM_SIMD 1
+  #endif
+#endif
+
+#if !defined(ETL_USING_BYTE_STREAM_SIMD)
+  #define ETL_USING_BYTE_STREAM_SIMD 0
+#endif
+
+namespace etl
+{
+  namespace private_byte_stream
+  {
+    //*************************************************************************
+    /// Copies elements of the same endianness.
+    //*************************************************************************
+    inline void copy_elements(const char* source, char* destination, size_t length) ETL_NOEXCEPT
+    {
+      if (length != 0U)
+      {
+        memcpy(destination, source, length);
+      }
+    }
+
+    //*************************************************************************
+    /// Copies count elements of Size bytes, reversing the bytes of each.
+    /// Used for element sizes with no dedicated kernel.
+    //*************************************************************************
+    template <size_t Size>
+    struct reverse_copier
+    {
+      static void copy(const char* source, char* destination, size_t count) ETL_NOEXCEPT
+      {
+        while (count-- != 0U)
+        {
+          etl::reverse_copy(source, source + Size, destination);
+          source      += Size;
+          destination += Size;
+        }
+      }
+    };
+
+#if ETL_USING_BYTE_STREAM_SIMD
+    //*************************************************************************
+    /// Reverses the bytes of each element in whole vectors, using a byte
+    /// shuffle within each 128 bit lane.
+    ///\returns The number of elements copied.
+    //*************************************************************************
+    template <size_t Size>
+    size_t reverse_copy_simd(const char* source, char* destination, size_t count) ETL_NOEXCEPT
+    {
+      // The shuffle that reverses each Size byte element of a 16 byte lane.
+      char shuffle[16];
+
+      for (size_t i = 0U; i < 16U; ++i)
+      {
+        shuffle[i] = static_cast<char>((i - (i % Size)) + (Size - 1U - (i % Size)));
+      }
+
+      const size_t length = count * Size;
+      size_t       index  = 0U;
+
+  #if defined(__AVX2__)
+      const __m128i lane    = _mm_loadu_si128(reinterpret_cast<const __m128i*>(shuffle));
+      const __m256i control = _mm256_broadcastsi128_si256(lane);
+
+      while ((index + 32U) <= length)
+      {
+        const __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(source + index));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(destination + index), _mm256_shuffle_epi8(block, control));
+        index += 32U;
+      }
+  #endif
+
+      const __m128i control16 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(shuffle));
+
+      while ((index + 16U) <= length)
+      {
+        const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + index));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(destination + index), _mm_shuffle_epi8(block, control16));
+        index += 16U;
+      }
+
+      return index / Size;
+    }
+#endif
+
+    //*************************************************************************
+    /// Copies count elements of TUnsigned, reversing the bytes of each.
+    //*************************************************************************
+    template <typename TUnsigned>
+    struct reverse_copier_uint
+    {
+      static void copy(const char* source, char* destination, size_t count) ETL_NOEXCEPT
+      {
+        size_t i = 0U;
+
+#if ETL_USING_BYTE_STREAM_SIMD
+        i = reverse_copy_simd<sizeof(TUnsigned)>(source, destination, count);
+#endif
+
+        for (; i < count; ++i)
+        {
+          TUnsigned value;
+          memcpy(&value, source + (i * sizeof(TUnsigned)), sizeof(TUnsigned));
+          value = etl::reverse_bytes(value);
+          memcpy(destination + (i * sizeof(TUnsigned)), &value, sizeof(TUnsigned));
+        }
+      }
+    };
+
+    //*************************************************************************
+    template <>
+    struct reverse_copier<2U> : public reverse_copier_uint<uint16_t>
+    {
+    };
+
+    //*************************************************************************
+    template <>
+    struct reverse_copier<4U> : public reverse_copier_uint<uint32_t>
+    {
+    };
+
+#if ETL_USING_64BIT_TYPES
+    //*************************************************************************
+    template <>
+    struct reverse_copier<8U> : public reverse_copier_uint<uint64_t>
+    {
+    };
+#endif
+
+    //*************************************************************************
+    /// Copies count elements of Size bytes, reversing the bytes of each.
+    //*************************************************************************
+    template <size_t Size>
+    void reverse_copy_elements(const char* source, char* destination, size_t count) ETL_NOEXCEPT
+    {
+      reverse_copier<Size>::copy(source, destination, count);
+    }
+  }
+}
+
+#endif
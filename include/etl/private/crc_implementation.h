@@ -41,6 +41,27 @@ SOFTWARE.
 
 #include "crc_parameters.h"
 
+//*****************************************************************************
+// CRC32-C uses the processor's CRC32C instructions for slice by 8 and slice by
+// 16 tables, when they are available for the target.
+// Define ETL_CRC_NO_HARDWARE to always use the tables.
+//*****************************************************************************
+#if !defined(ETL_CRC_NO_HARDWARE) && (ETL_USING_CPP20 || (ETL_USING_BUILTIN_IS_CONSTANT_EVALUATED == 1) || !ETL_USING_CPP14)
+  #if defined(__SSE4_2__) && (defined(__x86_64__) || defined(_M_X64))
+    #include <nmmintrin.h>
+    #define ETL_CRC32_C_HARDWARE_X86
+    #define ETL_USING_CRC32_C_HARDWARE 1
+  #elif defined(__ARM_FEATURE_CRC32) && (defined(__aarch64__) || defined(_M_ARM64))
+    #include <arm_acle.h>
+    #define ETL_CRC32_C_HARDWARE_ARM
+    #define ETL_USING_CRC32_C_HARDWARE 1
+  #endif
+#endif
+
+#if !defined(ETL_USING_CRC32_C_HARDWARE)
+  #define ETL_USING_CRC32_C_HARDWARE 0
+#endif
+
 #if defined(ETL_COMPILER_KEIL)
 #pragma diag_suppress 1300
 #endif
@@ -614,6 +635,191 @@ namespace etl
     template <typename TAccumulator, size_t Accumulator_Bits, size_t Chunk_Bits, uint8_t Chunk_Mask, TAccumulator Polynomial, bool Reflect>
     ETL_CONSTANT TAccumulator crc_table<TAccumulator, Accumulator_Bits, Chunk_Bits, Chunk_Mask, Polynomial, Reflect, 256U>::table[256U];
 #endif
+
+    //*****************************************************************************
+    /// CRC Slice Tables.
+    /// Slice 'n' holds the CRC of each byte value followed by 'n' zero bytes.
+    //*****************************************************************************
+    template <typename TAccumulator, size_t Accumulator_Bits, TAccumulator Polynomial, bool Reflect, size_t Slices>
+    struct crc_slice_tables
+    {
+      //*************************************************************************
+      ETL_CONSTEXPR14 crc_slice_tables()
+        : table()
+      {
+        for (size_t i = 0U; i < 256U; ++i)
+        {
+          TAccumulator entry = Reflect ? TAccumulator(i) : TAccumulator(TAccumulator(i) << (Accumulator_Bits - 8U));
+
+          for (size_t bit = 0U; bit < 8U; ++bit)
+          {
+            if (Reflect)
+            {
+              entry = ((entry & TAccumulator(1U)) != 0U) ? TAccumulator((entry >> 1U) ^ etl::reverse_bits_const<TAccumulator, Polynomial>::value)
+                                                         : TAccumulator(entry >> 1U);
+            }
+            else
+            {
+              entry = ((entry & (TAccumulator(1U) << (Accumulator_Bits - 1U))) != 0U) ? TAccumulator(TAccumulator(entry << 1U) ^ Polynomial)
+                                                                                       : TAccumulator(entry << 1U);
+            }
+          }
+
+          table[0U][i] = entry;
+        }
+
+        for (size_t slice = 1U; slice < Slices; ++slice)
+        {
+          for (size_t i = 0U; i < 256U; ++i)
+          {
+            table[slice][i] = crc_update_chunk<TAccumulator, Accumulator_Bits, 8U, 0xFFU, Reflect>(table[slice - 1U][i], 0U, table[0U]);
+          }
+        }
+      }
+
+      TAccumulator table[Slices][256U];
+    };
+
+    //*****************************************************************************
+    /// CRC Slice Step.
+    /// Looks up byte 'Index' of a block in its slice table, combining it with
+    /// the accumulator for the leading bytes. Recursive, so that it is unrolled.
+    //*****************************************************************************
+    template <typename TAccumulator, size_t Accumulator_Bits, bool Reflect, size_t Slices, size_t Index>
+    struct crc_slice_step
+    {
+      static ETL_CONSTANT bool   Use_Crc = Index < (Accumulator_Bits / 8U);
+      static ETL_CONSTANT size_t Shift   = !Use_Crc ? 0U : (Reflect ? (8U * Index) : (Accumulator_Bits - 8U - (8U * Index)));
+
+      template <typename TIterator>
+      static ETL_CONSTEXPR14 TAccumulator add(TAccumulator crc, TIterator data, const TAccumulator (&table)[Slices][256U])
+      {
+        const uint8_t crc_byte = Use_Crc ? static_cast<uint8_t>(crc >> Shift) : 0U;
+
+        return TAccumulator(table[Slices - 1U - Index][static_cast<uint8_t>(static_cast<uint8_t>(data[Index]) ^ crc_byte)] ^
+                            crc_slice_step<TAccumulator, Accumulator_Bits, Reflect, Slices, Index + 1U>::add(crc, data, table));
+      }
+    };
+
+    template <typename TAccumulator, size_t Accumulator_Bits, bool Reflect, size_t Slices, size_t Index>
+    ETL_CONSTANT bool crc_slice_step<TAccumulator, Accumulator_Bits, Reflect, Slices, Index>::Use_Crc;
+
+    template <typename TAccumulator, size_t Accumulator_Bits, bool Reflect, size_t Slices, size_t Index>
+    ETL_CONSTANT size_t crc_slice_step<TAccumulator, Accumulator_Bits, Reflect, Slices, Index>::Shift;
+
+    //*********************************
+    // End of the block.
+    template <typename TAccumulator, size_t Accumulator_Bits, bool Reflect, size_t Slices>
+    struct crc_slice_step<TAccumulator, Accumulator_Bits, Reflect, Slices, Slices>
+    {
+      template <typename TIterator>
+      static ETL_CONSTEXPR14 TAccumulator add(TAccumulator, TIterator, const TAccumulator (&)[Slices][256U])
+      {
+        return 0U;
+      }
+    };
+
+    //*****************************************************************************
+    /// CRC Slice Table.
+    /// Processes 'Slices' bytes per step with 'Slices' 256 entry tables.
+    /// The tables are generated at compile time for C++14 and above, otherwise
+    /// on first use.
+    //*****************************************************************************
+    template <typename TAccumulator, size_t Accumulator_Bits, TAccumulator Polynomial, bool Reflect, size_t Slices>
+    struct crc_slice_table
+    {
+      typedef crc_slice_tables<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slices> tables_t;
+
+      ETL_STATIC_ASSERT((Accumulator_Bits % 8U) == 0U, "Slice tables require a whole number of bytes");
+      ETL_STATIC_ASSERT(Slices >= (Accumulator_Bits / 8U), "Slice tables require at least one slice per accumulator byte");
+
+      static ETL_CONSTANT size_t Block_Size = Slices;
+
+#if ETL_USING_CPP14
+      static constexpr tables_t tables = tables_t();
+
+      //*************************************************************************
+      static ETL_CONSTEXPR14 const tables_t& get_tables()
+      {
+        return tables;
+      }
+#else
+      //*************************************************************************
+      static const tables_t& get_tables()
+      {
+        static const tables_t tables;
+
+        return tables;
+      }
+#endif
+
+      //*************************************************************************
+      ETL_CONSTEXPR14 TAccumulator add(TAccumulator crc, uint8_t value) const
+      {
+        return crc_update_chunk<TAccumulator, Accumulator_Bits, 8U, 0xFFU, Reflect>(crc, value, get_tables().table[0U]);
+      }
+
+      //*************************************************************************
+      /// Adds 'Slices' bytes, starting at 'data'.
+      //*************************************************************************
+      template <typename TIterator>
+      ETL_CONSTEXPR14 TAccumulator add_block(TAccumulator crc, TIterator data) const
+      {
+        return crc_slice_step<TAccumulator, Accumulator_Bits, Reflect, Slices, 0U>::add(crc, data, get_tables().table);
+      }
+    };
+
+#if ETL_USING_CPP14
+    template <typename TAccumulator, size_t Accumulator_Bits, TAccumulator Polynomial, bool Reflect, size_t Slices>
+    constexpr typename crc_slice_table<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slices>::tables_t crc_slice_table<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slices>::tables;
+#endif
+
+    template <typename TAccumulator, size_t Accumulator_Bits, TAccumulator Polynomial, bool Reflect, size_t Slices>
+    ETL_CONSTANT size_t crc_slice_table<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slices>::Block_Size;
+
+    //*********************************
+    // Table size of 2048. Slice by 8.
+    template <typename TAccumulator, size_t Accumulator_Bits, size_t Chunk_Bits, uint8_t Chunk_Mask, TAccumulator Polynomial, bool Reflect>
+    struct crc_table<TAccumulator, Accumulator_Bits, Chunk_Bits, Chunk_Mask, Polynomial, Reflect, 2048U>
+      : public crc_slice_table<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 8U>
+    {
+    };
+
+    //*********************************
+    // Table size of 4096. Slice by 16.
+    template <typename TAccumulator, size_t Accumulator_Bits, size_t Chunk_Bits, uint8_t Chunk_Mask, TAccumulator Polynomial, bool Reflect>
+    struct crc_table<TAccumulator, Accumulator_Bits, Chunk_Bits, Chunk_Mask, Polynomial, Reflect, 4096U>
+      : public crc_slice_table<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 16U>
+    {
+    };
+
+#if ETL_USING_CRC32_C_HARDWARE
+    //*****************************************************************************
+    /// CRC32-C using the processor's CRC32C instructions.
+    //*****************************************************************************
+    struct crc32_c_hardware
+    {
+      //*************************************************************************
+      /// Adds 'Length' bytes, starting at 'data'. 'Length' must be a multiple of 8.
+      //*************************************************************************
+      template <size_t Length, typename TIterator>
+      static uint32_t add_block(uint32_t crc, TIterator data)
+      {
+        for (size_t i = 0U; i < Length; i += 8U)
+        {
+          const uint64_t value = etl::private_frame_check_sequence::read_uint64_le(data + i);
+
+  #if defined(ETL_CRC32_C_HARDWARE_X86)
+          crc = static_cast<uint32_t>(_mm_crc32_u64(crc, value));
+  #else
+          crc = __crc32cd(crc, value);
+  #endif
+        }
+
+        return crc;
+      }
+    };
+#endif
     //*****************************************************************************
     // CRC Policies.
     //*****************************************************************************
@@ -676,6 +882,64 @@ namespace etl
       }
     };
 
+    //*********************************
+    // Policy for slice by 8 and slice by 16 tables.
+    template <typename TCrcParameters, size_t Table_Size>
+    struct crc_slice_policy : public crc_table<typename TCrcParameters::accumulator_type, 
+                                               TCrcParameters::Accumulator_Bits, 
+                                               8U, 
+                                               0xFFU, 
+                                               TCrcParameters::Polynomial, 
+                                               TCrcParameters::Reflect, 
+                                               Table_Size> 
+    {
+      typedef typename TCrcParameters::accumulator_type accumulator_type;
+      typedef accumulator_type value_type;
+
+      typedef crc_table<accumulator_type, TCrcParameters::Accumulator_Bits, 8U, 0xFFU, TCrcParameters::Polynomial, TCrcParameters::Reflect, Table_Size> table_t;
+
+      //*************************************************************************
+      ETL_CONSTEXPR accumulator_type initial() const
+      {
+        return TCrcParameters::Reflect ? etl::reverse_bits_const<accumulator_type, TCrcParameters::Initial>::value
+                                       : TCrcParameters::Initial;
+      }
+
+      //*************************************************************************
+      ETL_CONSTEXPR accumulator_type final(accumulator_type crc) const
+      {
+        return crc ^ TCrcParameters::Xor_Out;
+      }
+
+      //*************************************************************************
+      template <typename TIterator>
+      ETL_CONSTEXPR14 accumulator_type add_block(accumulator_type crc, TIterator data) const
+      {
+#if ETL_USING_CRC32_C_HARDWARE
+        if (etl::is_same<TCrcParameters, crc32_c_parameters>::value && !etl::is_constant_evaluated())
+        {
+          return accumulator_type(crc32_c_hardware::add_block<table_t::Block_Size>(uint32_t(crc), data));
+        }
+#endif
+
+        return table_t::add_block(crc, data);
+      }
+    };
+
+    //*********************************
+    // Policy for 2048 entry table.
+    template <typename TCrcParameters>
+    struct crc_policy<TCrcParameters, 2048U> : public crc_slice_policy<TCrcParameters, 2048U>
+    {
+    };
+
+    //*********************************
+    // Policy for 4096 entry table.
+    template <typename TCrcParameters>
+    struct crc_policy<TCrcParameters, 4096U> : public crc_slice_policy<TCrcParameters, 4096U>
+    {
+    };
+
     //*********************************
     // Policy for 4 entry table.
     template <typename TCrcParameters>
@@ -705,6 +969,19 @@ namespace etl
     };
   }
 
+  //*****************************************************************************
+  /// The slice by 8 and slice by 16 policies add blocks of bytes.
+  //*****************************************************************************
+  template <typename TCrcParameters>
+  struct frame_check_sequence_block_size<private_crc::crc_policy<TCrcParameters, 2048U> > : public etl::integral_constant<size_t, 8U>
+  {
+  };
+
+  template <typename TCrcParameters>
+  struct frame_check_sequence_block_size<private_crc::crc_policy<TCrcParameters, 4096U> > : public etl::integral_constant<size_t, 16U>
+  {
+  };
+
   //*****************************************************************************
   /// Basic parameterised CRC type.
   //*****************************************************************************
@@ -713,7 +990,7 @@ namespace etl
   {
   public:
 
-    ETL_STATIC_ASSERT((Table_Size == 4U) || (Table_Size == 16U) || (Table_Size == 256U), "Table size must be 4, 16 or 256");
+    ETL_STATIC_ASSERT((Table_Size == 4U) || (Table_Size == 16U) || (Table_Size == 256U) || (Table_Size == 2048U) || (Table_Size == 4096U), "Table size must be 4, 16, 256, 2048 or 4096");
 
     //*************************************************************************
     /// Default constructor.
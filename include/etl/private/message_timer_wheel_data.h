@@ -0,0 +1,93 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_MESSAGE_TIMER_WHEEL_DATA_INCLUDED
+#define ETL_MESSAGE_TIMER_WHEEL_DATA_INCLUDED
+
+#include "../platform.h"
+#include "../nullptr.h"
+#include "../message.h"
+#include "../message_router.h"
+#include "../message_bus.h"
+#include "../timer.h"
+#include "timer_wheel.h"
+
+#include <stdint.h>
+
+namespace etl
+{
+  namespace private_timer
+  {
+    //*************************************************************************
+    /// A timer of the '_wheel' message timers, that sends a message to a
+    /// router when it expires.
+    //*************************************************************************
+    struct message_timer_wheel_data : public etl::private_timer::timer_wheel_node
+    {
+      //*******************************************
+      message_timer_wheel_data()
+        : timer_wheel_node()
+        , p_message(ETL_NULLPTR)
+        , p_router(ETL_NULLPTR)
+        , destination_router_id(etl::imessage_bus::ALL_MESSAGE_ROUTERS)
+      {
+      }
+
+      //*******************************************
+      message_timer_wheel_data(etl::timer::id::type     id_,
+                               const etl::imessage&     message_,
+                               etl::imessage_router&    irouter_,
+                               uint32_t                 period_,
+                               bool                     repeating_,
+                               etl::message_router_id_t destination_router_id_ = etl::imessage_bus::ALL_MESSAGE_ROUTERS)
+        : timer_wheel_node(id_, period_, repeating_)
+        , p_message(&message_)
+        , p_router(&irouter_)
+        , destination_router_id(destination_router_id_)
+      {
+      }
+
+      //*******************************************
+      void dispatch() const
+      {
+        if (p_router != ETL_NULLPTR)
+        {
+          p_router->receive(destination_router_id, *p_message);
+        }
+      }
+
+      const etl::imessage*     p_message;
+      etl::imessage_router*    p_router;
+      etl::message_router_id_t destination_router_id;
+    };
+  }
+}
+
+#endif
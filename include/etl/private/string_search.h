@@ -0,0 +1,475 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_STRING_SEARCH_INCLUDED
+#define ETL_STRING_SEARCH_INCLUDED
+
+#include "../platform.h"
+#include "../type_traits.h"
+#include "../binary.h"
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+//*****************************************************************************
+// The string search kernels scan runs of characters with SSE2 instructions,
+// when they are available for the target.
+// Define ETL_STRING_NO_SIMD to always use the portable code.
+//*****************************************************************************
+#if !defined(ETL_STRING_NO_SIMD) && (ETL_USING_CPP20 || (ETL_USING_BUILTIN_IS_CONSTANT_EVALUATED == 1) || !ETL_USING_CPP14)
+  #if (defined(__SSE2__) || defined(_M_X64)) && (defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86))
+    #include <emmintrin.h>
+    #define ETL_USING_STRING_SIMD 1
+  #endif
+#endif
+
+#if !defined(ETL_USING_STRING_SIMD)
+  #define ETL_USING_STRING_SIMD 0
+#endif
+
+//*****************************************************************************
+// The kernels are not constexpr.
+// A constexpr caller may only use them where it can detect constant evaluation.
+//*****************************************************************************
+#if ETL_USING_CPP20 || (ETL_USING_BUILTIN_IS_CONSTANT_EVALUATED == 1) || !ETL_USING_CPP14
+  #define ETL_USING_STRING_SEARCH_KERNELS 1
+#else
+  #define ETL_USING_STRING_SEARCH_KERNELS 0
+#endif
+
+namespace etl
+{
+  namespace private_string_search
+  {
+#if ETL_USING_STRING_SIMD
+    //*************************************************************************
+    /// Compares 16 bytes of characters of size 'Size' with SSE2.
+    //*************************************************************************
+    template <size_t Size>
+    struct simd_element
+    {
+      static __m128i broadcast(uint32_t c)
+      {
+        return _mm_set1_epi32(static_cast<int>(c));
+      }
+
+      static __m128i equal(__m128i a, __m128i b)
+      {
+        return _mm_cmpeq_epi32(a, b);
+      }
+    };
+
+    template <>
+    struct simd_element<1U>
+    {
+      static __m128i broadcast(uint32_t c)
+      {
+        return _mm_set1_epi8(static_cast<char>(c));
+      }
+
+      static __m128i equal(__m128i a, __m128i b)
+      {
+        return _mm_cmpeq_epi8(a, b);
+      }
+    };
+
+    template <>
+    struct simd_element<2U>
+    {
+      static __m128i broadcast(uint32_t c)
+      {
+        return _mm_set1_epi16(static_cast<short>(c));
+      }
+
+      static __m128i equal(__m128i a, __m128i b)
+      {
+        return _mm_cmpeq_epi16(a, b);
+      }
+    };
+
+    //*************************************************************************
+    /// Can characters of type T be compared with SSE2?
+    //*************************************************************************
+    template <typename T>
+    struct is_simd_element : etl::bool_constant<(sizeof(T) == 1U) || (sizeof(T) == 2U) || (sizeof(T) == 4U)>
+    {
+    };
+
+    //*************************************************************************
+    /// The byte mask of the characters in the 16 bytes at p that equal,
+    /// or do not equal, the broadcast character.
+    //*************************************************************************
+    template <bool Is_Match, typename T>
+    uint32_t match_mask(const T* p, __m128i broadcast)
+    {
+      const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+      const uint32_t mask = static_cast<uint32_t>(_mm_movemask_epi8(simd_element<sizeof(T)>::equal(block, broadcast)));
+
+      return Is_Match ? mask : (mask ^ 0xFFFFU);
+    }
+
+    //*************************************************************************
+    /// The bits of the element of size 'Size' that starts at 'bit'.
+    //*************************************************************************
+    template <size_t Size>
+    uint32_t element_bits(uint32_t bit)
+    {
+      return ((1U << Size) - 1U) << bit;
+    }
+#endif
+
+    //*************************************************************************
+    /// Finds the first character that equals, or does not equal, 'c'.
+    /// Returns 'last' if there is none.
+    //*************************************************************************
+    template <bool Is_Match, typename T>
+    const T* scan_forward(const T* first, const T* last, T c)
+    {
+      if ((sizeof(T) == 1U) && Is_Match)
+      {
+        if (first == last)
+        {
+          return last;
+        }
+
+        const void* p = memchr(first, static_cast<unsigned char>(c), static_cast<size_t>(last - first));
+
+        return (p != ETL_NULLPTR) ? static_cast<const T*>(p) : last;
+      }
+
+#if ETL_USING_STRING_SIMD
+      if (is_simd_element<T>::value)
+      {
+        const ptrdiff_t Block     = static_cast<ptrdiff_t>(16U / sizeof(T));
+        const __m128i   broadcast = simd_element<sizeof(T)>::broadcast(static_cast<uint32_t>(c));
+
+        while ((last - first) >= Block)
+        {
+          const uint32_t mask = match_mask<Is_Match>(first, broadcast);
+
+          if (mask != 0U)
+          {
+            return first + (etl::count_trailing_zeros(mask) / sizeof(T));
+          }
+
+          first += Block;
+        }
+      }
+#endif
+
+      while ((first != last) && ((*first == c) != Is_Match))
+      {
+        ++first;
+      }
+
+      return first;
+    }
+
+    //*************************************************************************
+    /// Finds the last character that equals, or does not equal, 'c'.
+    /// Returns 'last' if there is none.
+    //*************************************************************************
+    template <bool Is_Match, typename T>
+    const T* scan_backward(const T* first, const T* last, T c)
+    {
+      const T* p = last;
+
+#if ETL_USING_STRING_SIMD
+      if (is_simd_element<T>::value)
+      {
+        const ptrdiff_t Block     = static_cast<ptrdiff_t>(16U / sizeof(T));
+        const __m128i   broadcast = simd_element<sizeof(T)>::broadcast(static_cast<uint32_t>(c));
+
+        while ((p - first) >= Block)
+        {
+          p -= Block;
+
+          const uint32_t mask = match_mask<Is_Match>(p, broadcast);
+
+          if (mask != 0U)
+          {
+            return p + ((31U - etl::count_leading_zeros(mask)) / sizeof(T));
+          }
+        }
+      }
+#endif
+
+      while (p != first)
+      {
+        --p;
+
+        if ((*p == c) == Is_Match)
+        {
+          return p;
+        }
+      }
+
+      return last;
+    }
+
+    //*************************************************************************
+    /// Finds the first occurrence of the needle of length 'n'.
+    /// Candidates are found by matching the first and last characters of the
+    /// needle, 16 bytes at a time where SIMD is available. Only those are
+    /// compared in full.
+    /// Returns 'first' for an empty needle and 'last' if there is no match.
+    //*************************************************************************
+    template <typename T>
+    const T* find_substring(const T* first, const T* last, const T* needle, size_t n)
+    {
+      if (n == 0U)
+      {
+        return first;
+      }
+
+      if (static_cast<size_t>(last - first) < n)
+      {
+        return last;
+      }
+
+      if (n == 1U)
+      {
+        return scan_forward<true>(first, last, needle[0]);
+      }
+
+      // One past the last position that a match may start at.
+      const T* const candidates_end = last - n + 1U;
+      const T        first_char     = needle[0];
+      const T        last_char      = needle[n - 1U];
+
+#if ETL_USING_STRING_SIMD
+      if (is_simd_element<T>::value)
+      {
+        const ptrdiff_t Block      = static_cast<ptrdiff_t>(16U / sizeof(T));
+        const __m128i   first_mask = simd_element<sizeof(T)>::broadcast(static_cast<uint32_t>(first_char));
+        const __m128i   last_mask  = simd_element<sizeof(T)>::broadcast(static_cast<uint32_t>(last_char));
+
+        while ((candidates_end - first) >= Block)
+        {
+          uint32_t mask = match_mask<true>(first, first_mask) & match_mask<true>(first + n - 1U, last_mask);
+
+          while (mask != 0U)
+          {
+            const uint32_t bit       = etl::count_trailing_zeros(mask);
+            const T*       candidate = first + (bit / sizeof(T));
+
+            if (memcmp(candidate + 1U, needle + 1U, (n - 2U) * sizeof(T)) == 0)
+            {
+              return candidate;
+            }
+
+            mask &= ~element_bits<sizeof(T)>(bit);
+          }
+
+          first += Block;
+        }
+      }
+#endif
+
+      while (first != candidates_end)
+      {
+        first = scan_forward<true>(first, candidates_end, first_char);
+
+        if (first == candidates_end)
+        {
+          break;
+        }
+
+        if ((first[n - 1U] == last_char) && (memcmp(first + 1U, needle + 1U, (n - 2U) * sizeof(T)) == 0))
+        {
+          return first;
+        }
+
+        ++first;
+      }
+
+      return last;
+    }
+
+    //*************************************************************************
+    /// Finds the last occurrence of the non-empty needle of length 'n' that
+    /// lies entirely within [first, last).
+    /// Returns 'last' if there is no match.
+    //*************************************************************************
+    template <typename T>
+    const T* rfind_substring(const T* first, const T* last, const T* needle, size_t n)
+    {
+      if (static_cast<size_t>(last - first) < n)
+      {
+        return last;
+      }
+
+      const T* candidates_end = last - n + 1U;
+
+      while (true)
+      {
+        const T* candidate = scan_backward<true>(first, candidates_end, needle[0]);
+
+        if (candidate == candidates_end)
+        {
+          return last;
+        }
+
+        if (memcmp(candidate + 1U, needle + 1U, (n - 1U) * sizeof(T)) == 0)
+        {
+          return candidate;
+        }
+
+        candidates_end = candidate;
+      }
+    }
+
+    //*************************************************************************
+    /// A 256 bit lookup table of a set of byte sized characters.
+    //*************************************************************************
+    class char_set
+    {
+    public:
+
+      template <typename T>
+      char_set(const T* s, size_t n)
+      {
+        memset(bits, 0, sizeof(bits));
+
+        while (n-- != 0U)
+        {
+          const unsigned char c = static_cast<unsigned char>(*s++);
+          bits[c >> 5U] |= (uint32_t(1U) << (c & 31U));
+        }
+      }
+
+      template <typename T>
+      bool contains(T c) const
+      {
+        const unsigned char uc = static_cast<unsigned char>(c);
+
+        return (bits[uc >> 5U] & (uint32_t(1U) << (uc & 31U))) != 0U;
+      }
+
+    private:
+
+      uint32_t bits[8];
+    };
+
+    //*************************************************************************
+    /// Is 'c' one of the 'n' characters at 's'?
+    //*************************************************************************
+    template <typename T>
+    bool contains(const T* s, size_t n, T c)
+    {
+      for (size_t i = 0U; i < n; ++i)
+      {
+        if (s[i] == c)
+        {
+          return true;
+        }
+      }
+
+      return false;
+    }
+
+    //*************************************************************************
+    /// Finds the first character that is, or is not, one of the 'n'
+    /// characters at 's'. Byte sized characters use a lookup table.
+    /// Returns 'last' if there is none.
+    //*************************************************************************
+    template <bool Is_Match, typename T>
+    const T* find_of(const T* first, const T* last, const T* s, size_t n)
+    {
+      if (n == 1U)
+      {
+        return scan_forward<Is_Match>(first, last, s[0]);
+      }
+
+      if (sizeof(T) == 1U)
+      {
+        const char_set set(s, n);
+
+        while ((first != last) && (set.contains(*first) != Is_Match))
+        {
+          ++first;
+        }
+      }
+      else
+      {
+        while ((first != last) && (contains(s, n, *first) != Is_Match))
+        {
+          ++first;
+        }
+      }
+
+      return first;
+    }
+
+    //*************************************************************************
+    /// Finds the last character that is, or is not, one of the 'n'
+    /// characters at 's'. Byte sized characters use a lookup table.
+    /// Returns 'last' if there is none.
+    //*************************************************************************
+    template <bool Is_Match, typename T>
+    const T* rfind_of(const T* first, const T* last, const T* s, size_t n)
+    {
+      if (n == 1U)
+      {
+        return scan_backward<Is_Match>(first, last, s[0]);
+      }
+
+      const T* p = last;
+
+      if (sizeof(T) == 1U)
+      {
+        const char_set set(s, n);
+
+        while (p != first)
+        {
+          if (set.contains(*--p) == Is_Match)
+          {
+            return p;
+          }
+        }
+      }
+      else
+      {
+        while (p != first)
+        {
+          if (contains(s, n, *--p) == Is_Match)
+          {
+            return p;
+          }
+        }
+      }
+
+      return last;
+    }
+  }
+}
+
+#endif
@@ -0,0 +1,1041 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_TIMER_WHEEL_INCLUDED
+#define ETL_TIMER_WHEEL_INCLUDED
+
+#include "../platform.h"
+#include "../binary.h"
+#include "../timer.h"
+#include "../delegate.h"
+#include "../placement_new.h"
+
+#include <stdint.h>
+
+namespace etl
+{
+  namespace private_timer
+  {
+    //*************************************************************************
+    /// A hierarchical timing wheel of intrusive timer lists.
+    /// Used by the '_wheel' variants of the callback and message timers in
+    /// place of the delta sorted list.
+    /// Start and stop are O(1). Each timer is moved down at most Levels - 1
+    /// times before it expires, so 'tick' is amortised O(1) per expiry, and
+    /// runs of empty ticks are skipped in one step.
+    /// Level N holds the timers that are due in less than 16^(N+1) ticks,
+    /// slotted by bits 4N to 4N+3 of their expiry time.
+    /// Timers that expire on the same tick are returned in an unspecified order.
+    /// TTimer must have the members 'id', 'previous', 'next', 'delta',
+    /// 'expiry' and 'slot'. 'delta' is the period to the expiry when the timer
+    /// is inserted, and etl::timer::state::Inactive when it is not active.
+    /// 'expiry' and 'slot' are only used by the wheel.
+    //*************************************************************************
+    template <typename TTimer>
+    class timer_wheel
+    {
+    public:
+
+      static ETL_CONSTANT uint_least8_t Slot_Bits       = 4U;
+      static ETL_CONSTANT uint_least8_t Slots_Per_Level = 16U;
+      static ETL_CONSTANT uint_least8_t Levels          = 8U;
+      static ETL_CONSTANT uint_least8_t Number_Of_Slots = Slots_Per_Level * Levels;
+
+      //*******************************
+      timer_wheel(TTimer* ptimers_)
+        : now(0U)
+        , number_of_active_timers(0U)
+        , ptimers(ptimers_)
+      {
+        reset();
+      }
+
+      //*******************************
+      bool empty() const
+      {
+        return number_of_active_timers == 0U;
+      }
+
+      //*******************************
+      /// Inserts the timer to expire 'delta' ticks from now.
+      //*******************************
+      void insert(etl::timer::id::type id_)
+      {
+        TTimer& timer = ptimers[id_];
+
+        timer.expiry = now + timer.delta;
+        place(timer);
+
+        ++number_of_active_timers;
+      }
+
+      //*******************************
+      /// Removes the timer and sets it inactive.
+      //*******************************
+      void remove(etl::timer::id::type id_, bool /*has_expired*/)
+      {
+        TTimer& timer = ptimers[id_];
+
+        if (timer.delta != etl::timer::state::Inactive)
+        {
+          unlink(timer);
+          --number_of_active_timers;
+        }
+
+        timer.delta = etl::timer::state::Inactive;
+      }
+
+      //*******************************
+      /// Advances the wheel by up to 'count' ticks, stopping at the first
+      /// timer that expires.
+      /// Returns the id of the expired timer, which has been removed and set
+      /// inactive, and reduces 'count' by the ticks used to reach it.
+      /// Returns etl::timer::id::NO_TIMER when there are no more expired timers
+      /// in 'count' ticks, and sets 'count' to zero.
+      //*******************************
+      etl::timer::id::type expire(uint32_t& count)
+      {
+        for (;;)
+        {
+          // Anything in the current slot of the first level is due now.
+          const uint_least8_t due_slot = uint_least8_t(now & Slot_Mask);
+
+          if ((occupied[0] & (1U << due_slot)) != 0U)
+          {
+            const etl::timer::id::type id = heads[due_slot];
+
+            remove(id, true);
+
+            return id;
+          }
+
+          const uint32_t distance = distance_to_next_event();
+
+          if ((distance == 0U) || (distance > count))
+          {
+            now  += count;
+            count = 0U;
+
+            return etl::timer::id::NO_TIMER;
+          }
+
+          now   += distance;
+          count -= distance;
+
+          cascade();
+        }
+      }
+
+      //*******************************
+      /// The number of ticks to the next expiry.
+      /// Returns etl::timer::interval::No_Active_Interval if there are no active timers.
+      //*******************************
+      uint32_t time_to_next() const
+      {
+        uint32_t delta = static_cast<uint32_t>(etl::timer::interval::No_Active_Interval);
+
+        if (occupied[0] != 0U)
+        {
+          // All of the timers in a first level slot have the same expiry.
+          const uint16_t rotated = etl::rotate_right(occupied[0], size_t(now & Slot_Mask));
+
+          delta = etl::count_trailing_zeros(rotated);
+        }
+
+        for (uint_least8_t level = 1U; level < Levels; ++level)
+        {
+          if (occupied[level] != 0U)
+          {
+            // The nearest slot of the level holds its earliest timers.
+            etl::timer::id::type id = heads[first_slot(level)];
+
+            while (id != etl::timer::id::NO_TIMER)
+            {
+              const uint32_t remaining = ptimers[id].expiry - now;
+
+              if (remaining < delta)
+              {
+                delta = remaining;
+              }
+
+              id = ptimers[id].next;
+            }
+          }
+        }
+
+        return delta;
+      }
+
+      //*******************************
+      void clear()
+      {
+        for (uint_least8_t slot = 0U; slot < Number_Of_Slots; ++slot)
+        {
+          etl::timer::id::type id = heads[slot];
+
+          while (id != etl::timer::id::NO_TIMER)
+          {
+            TTimer& timer = ptimers[id];
+            id = timer.next;
+
+            timer.previous = etl::timer::id::NO_TIMER;
+            timer.next     = etl::timer::id::NO_TIMER;
+            timer.delta    = etl::timer::state::Inactive;
+          }
+        }
+
+        reset();
+
+        now                     = 0U;
+        number_of_active_timers = 0U;
+      }
+
+    private:
+
+      static ETL_CONSTANT uint32_t Slot_Mask = Slots_Per_Level - 1U;
+
+      //*******************************
+      void reset()
+      {
+        for (uint_least8_t slot = 0U; slot < Number_Of_Slots; ++slot)
+        {
+          heads[slot] = etl::timer::id::NO_TIMER;
+        }
+
+        for (uint_least8_t level = 0U; level < Levels; ++level)
+        {
+          occupied[level] = 0U;
+        }
+      }
+
+      //*******************************
+      /// Adds the timer to the slot for its expiry, relative to now.
+      //*******************************
+      void place(TTimer& timer)
+      {
+        const uint32_t remaining = timer.expiry - now;
+
+        uint_least8_t level = 0U;
+
+        while ((level < (Levels - 1U)) && ((remaining >> ((level + 1U) * Slot_Bits)) != 0U))
+        {
+          ++level;
+        }
+
+        const uint_least8_t index = uint_least8_t((timer.expiry >> (level * Slot_Bits)) & Slot_Mask);
+        const uint_least8_t slot  = uint_least8_t((level * Slots_Per_Level) + index);
+
+        timer.previous = etl::timer::id::NO_TIMER;
+        timer.next     = heads[slot];
+        timer.slot     = slot;
+
+        if (timer.next != etl::timer::id::NO_TIMER)
+        {
+          ptimers[timer.next].previous = timer.id;
+        }
+
+        heads[slot]      = timer.id;
+        occupied[level] |= uint16_t(1U << index);
+      }
+
+      //*******************************
+      /// Removes the timer from its slot.
+      //*******************************
+      void unlink(TTimer& timer)
+      {
+        const uint_least8_t slot = timer.slot;
+
+        if (timer.previous == etl::timer::id::NO_TIMER)
+        {
+          heads[slot] = timer.next;
+
+          if (heads[slot] == etl::timer::id::NO_TIMER)
+          {
+            occupied[slot / Slots_Per_Level] &= uint16_t(~(1U << (slot % Slots_Per_Level)));
+          }
+        }
+        else
+        {
+          ptimers[timer.previous].next = timer.next;
+        }
+
+        if (timer.next != etl::timer::id::NO_TIMER)
+        {
+          ptimers[timer.next].previous = timer.previous;
+        }
+
+        timer.previous = etl::timer::id::NO_TIMER;
+        timer.next     = etl::timer::id::NO_TIMER;
+      }
+
+      //*******************************
+      /// The slot of the level that is due to be reached first.
+      //*******************************
+      uint_least8_t first_slot(uint_least8_t level) const
+      {
+        const uint_least8_t shift   = uint_least8_t(level * Slot_Bits);
+        const uint_least8_t current = uint_least8_t((now >> shift) & Slot_Mask);
+        const uint_least8_t start   = uint_least8_t((current + 1U) & Slot_Mask);
+        const uint16_t      rotated = etl::rotate_right(occupied[level], size_t(start));
+
+        return uint_least8_t((level * Slots_Per_Level) + ((start + etl::count_trailing_zeros(rotated)) & Slot_Mask));
+      }
+
+      //*******************************
+      /// The number of ticks to the next time that a first level timer
+      /// expires, or that an occupied slot must be moved down a level.
+      /// Returns zero if there is nothing to do.
+      //*******************************
+      uint32_t distance_to_next_event() const
+      {
+        uint32_t distance = 0U;
+
+        for (uint_least8_t level = 0U; level < Levels; ++level)
+        {
+          if (occupied[level] != 0U)
+          {
+            const uint_least8_t shift   = uint_least8_t(level * Slot_Bits);
+            const uint_least8_t current = uint_least8_t((now >> shift) & Slot_Mask);
+            const uint16_t      rotated = etl::rotate_right(occupied[level], size_t((current + 1U) & Slot_Mask));
+            const uint32_t      step    = etl::count_trailing_zeros(rotated);
+            const uint32_t      low     = now & ((uint32_t(1U) << shift) - 1U);
+
+            // Ticks to the start of the slot's span of time.
+            const uint32_t level_distance = (step << shift) + ((uint32_t(1U) << shift) - low);
+
+            if ((distance == 0U) || (level_distance < distance))
+            {
+              distance = level_distance;
+            }
+          }
+        }
+
+        return distance;
+      }
+
+      //*******************************
+      /// Moves the timers in the current slot of each level that has just
+      /// been reached down to the lower levels.
+      //*******************************
+      void cascade()
+      {
+        for (uint_least8_t level = Levels - 1U; level != 0U; --level)
+        {
+          const uint_least8_t shift = uint_least8_t(level * Slot_Bits);
+
+          if ((now & ((uint32_t(1U) << shift) - 1U)) == 0U)
+          {
+            const uint_least8_t index = uint_least8_t((now >> shift) & Slot_Mask);
+            const uint_least8_t slot  = uint_least8_t((level * Slots_Per_Level) + index);
+
+            etl::timer::id::type id = heads[slot];
+
+            heads[slot]      = etl::timer::id::NO_TIMER;
+            occupied[level] &= uint16_t(~(1U << index));
+
+            while (id != etl::timer::id::NO_TIMER)
+            {
+              TTimer& timer = ptimers[id];
+              id = timer.next;
+
+              place(timer);
+            }
+          }
+        }
+      }
+
+      uint32_t             now;                     ///< The current time, in ticks.
+      uint16_t             occupied[Levels];        ///< A bit for each non-empty slot.
+      uint_least8_t        number_of_active_timers;
+      etl::timer::id::type heads[Number_Of_Slots];  ///< The first timer in each slot.
+
+      TTimer* const ptimers;
+    };
+
+    template <typename TTimer>
+    ETL_CONSTANT uint_least8_t timer_wheel<TTimer>::Slot_Bits;
+
+    template <typename TTimer>
+    ETL_CONSTANT uint_least8_t timer_wheel<TTimer>::Slots_Per_Level;
+
+    template <typename TTimer>
+    ETL_CONSTANT uint_least8_t timer_wheel<TTimer>::Levels;
+
+    template <typename TTimer>
+    ETL_CONSTANT uint_least8_t timer_wheel<TTimer>::Number_Of_Slots;
+
+    template <typename TTimer>
+    ETL_CONSTANT uint32_t timer_wheel<TTimer>::Slot_Mask;
+
+    //*************************************************************************
+    /// The members of a timer that are common to all of the '_wheel' timers.
+    /// The timer types derive from this and add a 'dispatch' member function,
+    /// which is called when the timer expires.
+    //*************************************************************************
+    struct timer_wheel_node
+    {
+      //*******************************************
+      timer_wheel_node()
+        : period(0U)
+        , delta(etl::timer::state::Inactive)
+        , expiry(0U)
+        , id(etl::timer::id::NO_TIMER)
+        , previous(etl::timer::id::NO_TIMER)
+        , next(etl::timer::id::NO_TIMER)
+        , slot(0U)
+        , repeating(true)
+      {
+      }
+
+      //*******************************************
+      timer_wheel_node(etl::timer::id::type id_,
+                       uint32_t             period_,
+                       bool                 repeating_)
+        : period(period_)
+        , delta(etl::timer::state::Inactive)
+        , expiry(0U)
+        , id(id_)
+        , previous(etl::timer::id::NO_TIMER)
+        , next(etl::timer::id::NO_TIMER)
+        , slot(0U)
+        , repeating(repeating_)
+      {
+      }
+
+      //*******************************************
+      /// Returns true if the timer is active.
+      //*******************************************
+      bool is_active() const
+      {
+        return delta != etl::timer::state::Inactive;
+      }
+
+      //*******************************************
+      /// Sets the timer to the inactive state.
+      //*******************************************
+      void set_inactive()
+      {
+        delta = etl::timer::state::Inactive;
+      }
+
+      uint32_t             period;
+      uint32_t             delta;
+      uint32_t             expiry;
+      etl::timer::id::type id;
+      uint_least8_t        previous;
+      uint_least8_t        next;
+      uint_least8_t        slot;
+      bool                 repeating;
+
+    private:
+
+      // Disabled.
+      timer_wheel_node(const timer_wheel_node& other);
+      timer_wheel_node& operator =(const timer_wheel_node& other);
+    };
+
+    //*************************************************************************
+    /// A timer that calls a delegate, held by value.
+    //*************************************************************************
+    struct delegate_timer_wheel_data : public timer_wheel_node
+    {
+      typedef etl::delegate<void(void)> callback_type;
+
+      //*******************************************
+      delegate_timer_wheel_data()
+        : timer_wheel_node()
+        , callback()
+      {
+      }
+
+      //*******************************************
+      delegate_timer_wheel_data(etl::timer::id::type id_,
+                                callback_type        callback_,
+                                uint32_t             period_,
+                                bool                 repeating_)
+        : timer_wheel_node(id_, period_, repeating_)
+        , callback(callback_)
+      {
+      }
+
+      //*******************************************
+      void dispatch() const
+      {
+        if (callback.is_valid())
+        {
+          callback();
+        }
+      }
+
+      callback_type callback;
+    };
+
+    //*************************************************************************
+    /// The lock policies of timer_wheel_engine.
+    /// Each has a 'scoped_lock' that guards an update of the timers, and
+    /// 'try_lock_tick' and 'unlock_tick' that guard the processing of a tick.
+    //*************************************************************************
+
+    //*************************************************************************
+    /// No locking.
+    //*************************************************************************
+    class timer_wheel_no_lock
+    {
+    public:
+
+      class scoped_lock
+      {
+      public:
+
+        explicit scoped_lock(const timer_wheel_no_lock&)
+        {
+        }
+      };
+
+      bool try_lock_tick() const
+      {
+        return true;
+      }
+
+      void unlock_tick() const
+      {
+      }
+    };
+
+    //*************************************************************************
+    /// Counts the updates in progress in a semaphore.
+    /// A tick is not processed while an update is in progress.
+    //*************************************************************************
+    template <typename TSemaphore>
+    class timer_wheel_semaphore_lock
+    {
+    public:
+
+      class scoped_lock
+      {
+      public:
+
+        explicit scoped_lock(const timer_wheel_semaphore_lock& lock_)
+          : semaphore(lock_.process_semaphore)
+        {
+          ++semaphore;
+        }
+
+        ~scoped_lock()
+        {
+          --semaphore;
+        }
+
+      private:
+
+        TSemaphore& semaphore;
+      };
+
+      friend class scoped_lock;
+
+      timer_wheel_semaphore_lock()
+        : process_semaphore(0U)
+      {
+      }
+
+      bool try_lock_tick() const
+      {
+        return process_semaphore == 0U;
+      }
+
+      void unlock_tick() const
+      {
+      }
+
+    private:
+
+      mutable TSemaphore process_semaphore;
+    };
+
+    //*************************************************************************
+    /// Holds a TInterruptGuard for the duration of each update.
+    /// 'tick' is expected to be called from the interrupt.
+    //*************************************************************************
+    template <typename TInterruptGuard>
+    class timer_wheel_interrupt_lock
+    {
+    public:
+
+      class scoped_lock
+      {
+      public:
+
+        explicit scoped_lock(const timer_wheel_interrupt_lock&)
+          : guard()
+        {
+        }
+
+      private:
+
+        TInterruptGuard guard;
+      };
+
+      bool try_lock_tick() const
+      {
+        return true;
+      }
+
+      void unlock_tick() const
+      {
+      }
+    };
+
+    //*************************************************************************
+    /// Calls user supplied lock delegates.
+    //*************************************************************************
+    class timer_wheel_delegate_lock
+    {
+    public:
+
+      typedef etl::delegate<bool(void)> try_lock_type;
+      typedef etl::delegate<void(void)> lock_type;
+      typedef etl::delegate<void(void)> unlock_type;
+
+      class scoped_lock
+      {
+      public:
+
+        explicit scoped_lock(const timer_wheel_delegate_lock& lock_)
+          : locks(lock_)
+        {
+          locks.lock();
+        }
+
+        ~scoped_lock()
+        {
+          locks.unlock();
+        }
+
+      private:
+
+        const timer_wheel_delegate_lock& locks;
+      };
+
+      friend class scoped_lock;
+
+      //*******************************************
+      /// Sets the lock and unlock delegates.
+      //*******************************************
+      void set_locks(try_lock_type try_lock_, lock_type lock_, unlock_type unlock_)
+      {
+        try_lock = try_lock_;
+        lock     = lock_;
+        unlock   = unlock_;
+      }
+
+      bool try_lock_tick() const
+      {
+        return try_lock();
+      }
+
+      void unlock_tick() const
+      {
+        unlock();
+      }
+
+    private:
+
+      try_lock_type try_lock; ///< The callback that tries to lock.
+      lock_type     lock;     ///< The callback that locks.
+      unlock_type   unlock;   ///< The callback that unlocks.
+    };
+
+    //*************************************************************************
+    /// The timer controller shared by the '_wheel' timers.
+    /// Holds the registered timers and a timer_wheel of the active ones.
+    /// TTimer is derived from timer_wheel_node and is expired by calling its
+    /// 'dispatch' member function.
+    /// TLock is one of the lock policies above.
+    /// A repeating timer is restarted before it is dispatched, so that its
+    /// callback may stop or restart it.
+    //*************************************************************************
+    template <typename TTimer, typename TLock>
+    class timer_wheel_engine : protected TLock
+    {
+    public:
+
+      typedef etl::delegate<void(etl::timer::id::type)> event_callback_type;
+
+      //*******************************************
+      /// Unregister a timer.
+      //*******************************************
+      bool unregister_timer(etl::timer::id::type id_)
+      {
+        bool result = false;
+
+        if (is_valid_timer_id(id_))
+        {
+          TTimer& timer = timer_array[id_];
+
+          if (timer.id != etl::timer::id::NO_TIMER)
+          {
+            if (timer.is_active())
+            {
+              scoped_lock guard(*this);
+              active_list.remove(timer.id, false);
+              remove_callback.call_if(timer.id);
+            }
+
+            // Reset in-place.
+            ::new (&timer) TTimer();
+            --number_of_registered_timers;
+
+            result = true;
+          }
+        }
+
+        return result;
+      }
+
+      //*******************************************
+      /// Enable/disable the timer.
+      //*******************************************
+      void enable(bool state_)
+      {
+        enabled = state_;
+      }
+
+      //*******************************************
+      /// Get the enable/disable state.
+      //*******************************************
+      bool is_running() const
+      {
+        return enabled;
+      }
+
+      //*******************************************
+      /// Clears the timer of data.
+      //*******************************************
+      void clear()
+      {
+        {
+          scoped_lock guard(*this);
+          active_list.clear();
+        }
+
+        for (uint_least8_t i = 0U; i < Max_Timers; ++i)
+        {
+          ::new (&timer_array[i]) TTimer();
+        }
+
+        number_of_registered_timers = 0U;
+      }
+
+      //*******************************************
+      // Called by the timer service to indicate the
+      // amount of time that has elapsed since the last successful call to 'tick'.
+      // Returns true if the tick was processed,
+      // false if not.
+      //*******************************************
+      bool tick(uint32_t count)
+      {
+        if (enabled)
+        {
+          if (this->try_lock_tick())
+          {
+            // Expire the timers that are due.
+            etl::timer::id::type id = active_list.expire(count);
+
+            while (id != etl::timer::id::NO_TIMER)
+            {
+              TTimer& timer = timer_array[id];
+
+              remove_callback.call_if(timer.id);
+
+              if (timer.repeating)
+              {
+                // Reinsert the timer.
+                timer.delta = timer.period;
+                active_list.insert(timer.id);
+                insert_callback.call_if(timer.id);
+              }
+
+              timer.dispatch();
+
+              id = active_list.expire(count);
+            }
+
+            this->unlock_tick();
+
+            return true;
+          }
+        }
+
+        return false;
+      }
+
+      //*******************************************
+      /// Starts a timer.
+      //*******************************************
+      bool start(etl::timer::id::type id_, bool immediate_ = false)
+      {
+        bool result = false;
+
+        if (is_valid_timer_id(id_))
+        {
+          TTimer& timer = timer_array[id_];
+
+          // Registered timer with a valid period?
+          if ((timer.id != etl::timer::id::NO_TIMER) && (timer.period != etl::timer::state::Inactive))
+          {
+            scoped_lock guard(*this);
+
+            if (timer.is_active())
+            {
+              active_list.remove(timer.id, false);
+              remove_callback.call_if(timer.id);
+            }
+
+            timer.delta = immediate_ ? 0U : timer.period;
+            active_list.insert(timer.id);
+            insert_callback.call_if(timer.id);
+
+            result = true;
+          }
+        }
+
+        return result;
+      }
+
+      //*******************************************
+      /// Stops a timer.
+      //*******************************************
+      bool stop(etl::timer::id::type id_)
+      {
+        bool result = false;
+
+        if (is_valid_timer_id(id_))
+        {
+          TTimer& timer = timer_array[id_];
+
+          // Registered timer?
+          if (timer.id != etl::timer::id::NO_TIMER)
+          {
+            if (timer.is_active())
+            {
+              scoped_lock guard(*this);
+              active_list.remove(timer.id, false);
+              remove_callback.call_if(timer.id);
+            }
+
+            result = true;
+          }
+        }
+
+        return result;
+      }
+
+      //*******************************************
+      /// Sets a timer's period.
+      //*******************************************
+      bool set_period(etl::timer::id::type id_, uint32_t period_)
+      {
+        if (stop(id_))
+        {
+          timer_array[id_].period = period_;
+          return true;
+        }
+
+        return false;
+      }
+
+      //*******************************************
+      /// Sets a timer's mode.
+      //*******************************************
+      bool set_mode(etl::timer::id::type id_, bool repeating_)
+      {
+        if (stop(id_))
+        {
+          timer_array[id_].repeating = repeating_;
+          return true;
+        }
+
+        return false;
+      }
+
+      //*******************************************
+      /// Check if there is an active timer.
+      //*******************************************
+      bool has_active_timer() const
+      {
+        scoped_lock guard(*this);
+
+        return !active_list.empty();
+      }
+
+      //*******************************************
+      /// Get the time to the next timer event.
+      /// Returns etl::timer::interval::No_Active_Interval if there is no active timer.
+      //*******************************************
+      uint32_t time_to_next() const
+      {
+        scoped_lock guard(*this);
+
+        return active_list.time_to_next();
+      }
+
+      //*******************************************
+      /// Checks if a timer is currently active.
+      /// Returns <b>true</b> if the timer is active, otherwise <b>false</b>.
+      //*******************************************
+      bool is_active(etl::timer::id::type id_) const
+      {
+        bool result = false;
+
+        if (is_valid_timer_id(id_))
+        {
+          scoped_lock guard(*this);
+
+          const TTimer& timer = timer_array[id_];
+
+          // Registered timer?
+          result = (timer.id != etl::timer::id::NO_TIMER) && timer.is_active();
+        }
+
+        return result;
+      }
+
+      //*******************************************
+      /// Set a callback when a timer is inserted on list
+      //*******************************************
+      void set_insert_callback(event_callback_type insert_)
+      {
+        insert_callback = insert_;
+      }
+
+      //*******************************************
+      /// Set a callback when a timer is removed from list
+      //*******************************************
+      void set_remove_callback(event_callback_type remove_)
+      {
+        remove_callback = remove_;
+      }
+
+      //*******************************************
+      void clear_insert_callback()
+      {
+        insert_callback.clear();
+      }
+
+      //*******************************************
+      void clear_remove_callback()
+      {
+        remove_callback.clear();
+      }
+
+    protected:
+
+      //*******************************************
+      /// Constructor.
+      //*******************************************
+      timer_wheel_engine(TTimer* const timer_array_, const uint_least8_t Max_Timers_)
+        : timer_array(timer_array_)
+        , active_list(timer_array_)
+        , enabled(false)
+        , number_of_registered_timers(0U)
+        , Max_Timers(Max_Timers_)
+      {
+      }
+
+      //*******************************************
+      /// Destructor.
+      //*******************************************
+      ~timer_wheel_engine()
+      {
+      }
+
+      //*******************************************
+      /// Reserves an unregistered timer, to be constructed in-place by the
+      /// caller with the returned id.
+      /// Returns etl::timer::id::NO_TIMER if all of the timers are registered.
+      //*******************************************
+      etl::timer::id::type allocate_timer()
+      {
+        if (number_of_registered_timers < Max_Timers)
+        {
+          // Search for the free space.
+          for (uint_least8_t i = 0U; i < Max_Timers; ++i)
+          {
+            if (timer_array[i].id == etl::timer::id::NO_TIMER)
+            {
+              ++number_of_registered_timers;
+              return i;
+            }
+          }
+        }
+
+        return etl::timer::id::NO_TIMER;
+      }
+
+      //*******************************************
+      /// Gets the storage for a timer.
+      //*******************************************
+      TTimer& get_timer(etl::timer::id::type id_)
+      {
+        return timer_array[id_];
+      }
+
+    private:
+
+      typedef typename TLock::scoped_lock scoped_lock;
+
+      //*******************************************
+      /// Check that the timer id is valid.
+      //*******************************************
+      bool is_valid_timer_id(etl::timer::id::type id_) const
+      {
+        return (id_ < Max_Timers);
+      }
+
+      // The array of timer data structures.
+      TTimer* const timer_array;
+
+      // The timing wheel of active timers.
+      etl::private_timer::timer_wheel<TTimer> active_list;
+
+      volatile bool enabled;
+      uint_least8_t number_of_registered_timers;
+
+      event_callback_type insert_callback;
+      event_callback_type remove_callback;
+
+    public:
+
+      const uint_least8_t Max_Timers;
+    };
+  }
+}
+
+#endif
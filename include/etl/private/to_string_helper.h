@@ -44,6 +44,7 @@ SOFTWARE.
 #include "../iterator.h"
 #include "../math.h"
 #include "../limits.h"
+#include "to_string_shortest.h"
 
 #include <math.h>
 
@@ -136,6 +137,141 @@ namespace etl
       etl::private_to_string::add_alignment(str, start, format);
     }
 
+    //***************************************************************************
+    /// The decimal digit pairs '00' to '99'.
+    //***************************************************************************
+    template <typename T = void>
+    struct digit_pairs
+    {
+      static const char table[200];
+    };
+
+    template <typename T>
+    const char digit_pairs<T>::table[200] =
+    {
+      '0', '0', '0', '1', '0', '2', '0', '3', '0', '4', '0', '5', '0', '6', '0', '7', '0', '8', '0', '9',
+      '1', '0', '1', '1', '1', '2', '1', '3', '1', '4', '1', '5', '1', '6', '1', '7', '1', '8', '1', '9',
+      '2', '0', '2', '1', '2', '2', '2', '3', '2', '4', '2', '5', '2', '6', '2', '7', '2', '8', '2', '9',
+      '3', '0', '3', '1', '3', '2', '3', '3', '3', '4', '3', '5', '3', '6', '3', '7', '3', '8', '3', '9',
+      '4', '0', '4', '1', '4', '2', '4', '3', '4', '4', '4', '5', '4', '6', '4', '7', '4', '8', '4', '9',
+      '5', '0', '5', '1', '5', '2', '5', '3', '5', '4', '5', '5', '5', '6', '5', '7', '5', '8', '5', '9',
+      '6', '0', '6', '1', '6', '2', '6', '3', '6', '4', '6', '5', '6', '6', '6', '7', '6', '8', '6', '9',
+      '7', '0', '7', '1', '7', '2', '7', '3', '7', '4', '7', '5', '7', '6', '7', '7', '7', '8', '7', '9',
+      '8', '0', '8', '1', '8', '2', '8', '3', '8', '4', '8', '5', '8', '6', '8', '7', '8', '8', '8', '9',
+      '9', '0', '9', '1', '9', '2', '9', '3', '9', '4', '9', '5', '9', '6', '9', '7', '9', '8', '9', '9'
+    };
+
+    //***************************************************************************
+    /// Writes the decimal digits of a value of up to 32 bits backwards from
+    /// 'p', two digits at a time. Returns a pointer to the first digit.
+    //***************************************************************************
+    template <typename TChar>
+    TChar* write_decimal_digits(uint32_t value, TChar* p)
+    {
+      const char* pairs = digit_pairs<>::table;
+
+      while (value >= 100U)
+      {
+        const uint32_t index = (value % 100U) * 2U;
+        value /= 100U;
+
+        *--p = TChar(pairs[index + 1U]);
+        *--p = TChar(pairs[index]);
+      }
+
+      if (value >= 10U)
+      {
+        const uint32_t index = value * 2U;
+
+        *--p = TChar(pairs[index + 1U]);
+        *--p = TChar(pairs[index]);
+      }
+      else
+      {
+        *--p = TChar('0' + value);
+      }
+
+      return p;
+    }
+
+#if ETL_USING_64BIT_TYPES
+    //***************************************************************************
+    /// Writes the decimal digits of a 64 bit value backwards from 'p'.
+    /// Blocks of eight digits are split off so that the rest of the work
+    /// uses 32 bit arithmetic. Returns a pointer to the first digit.
+    //***************************************************************************
+    template <typename TChar>
+    TChar* write_decimal_digits(uint64_t value, TChar* p)
+    {
+      const uint64_t Block = 100000000U;
+
+      while (value > etl::integral_limits<uint32_t>::max)
+      {
+        uint32_t block = static_cast<uint32_t>(value % Block);
+        value /= Block;
+
+        // Exactly eight digits, including leading zeros.
+        TChar* first = write_decimal_digits(block, p);
+
+        while (first != (p - 8))
+        {
+          *--first = TChar('0');
+        }
+
+        p = first;
+      }
+
+      return write_decimal_digits(static_cast<uint32_t>(value), p);
+    }
+#endif
+
+    //***************************************************************************
+    /// Writes the digits of a value backwards from 'p', in any base.
+    /// Returns a pointer to the first digit.
+    //***************************************************************************
+    template <typename TChar, typename TUnsigned>
+    TChar* write_digits(TUnsigned value, TChar* p, const uint32_t base, const bool upper_case)
+    {
+      const char* const digits = upper_case ? "0123456789ABCDEF" : "0123456789abcdef";
+
+      switch (base)
+      {
+        case 10U:
+        {
+          typedef typename etl::conditional<(sizeof(TUnsigned) <= sizeof(uint32_t)), uint32_t, uworkspace_t>::type decimal_t;
+          return write_decimal_digits(static_cast<decimal_t>(value), p);
+        }
+
+        case 2U:
+        case 8U:
+        case 16U:
+        {
+          // Powers of two need only a shift and mask per digit.
+          const uint32_t shift = (base == 2U) ? 1U : ((base == 8U) ? 3U : 4U);
+          const uint32_t mask  = base - 1U;
+
+          do
+          {
+            *--p = TChar(digits[static_cast<uint32_t>(value) & mask]);
+            value >>= shift;
+          } while (value != 0U);
+
+          return p;
+        }
+
+        default:
+        {
+          do
+          {
+            *--p = TChar(digits[static_cast<uint32_t>(value % base)]);
+            value /= base;
+          } while (value != 0U);
+
+          return p;
+        }
+      }
+    }
+
     //***************************************************************************
     /// Helper function for integrals.
     //***************************************************************************
@@ -146,8 +282,9 @@ namespace etl
                       bool append,
                       const bool negative)
     {
-      typedef typename TIString::value_type type;
-      typedef typename TIString::iterator   iterator;
+      typedef typename TIString::value_type        type;
+      typedef typename TIString::iterator          iterator;
+      typedef typename etl::make_unsigned<T>::type unsigned_t;
 
       if (!append)
       {
@@ -156,67 +293,53 @@ namespace etl
 
       iterator start = str.end();
 
-      if (value == 0)
-      {
-        // If number is negative, append '-' (a negative zero might occur for fractional numbers > -1.0)
-        if ((format.get_base() == 10U) && negative)
-        {
-          str.push_back(type('-'));
-        }
+      // Room for the binary digits, a sign and a base prefix.
+      type  buffer[(CHAR_BIT * sizeof(T)) + 3U];
+      type* const end = buffer + (sizeof(buffer) / sizeof(buffer[0]));
 
-        str.push_back(type('0'));
-      }
-      else
-      {
-        // Extract the digits, in reverse order.
-        while (value != 0)
-        {
-          T remainder = etl::absolute(value % T(format.get_base()));
-          str.push_back((remainder > 9) ? (format.is_upper_case() ? type('A' + (remainder - 10)) : type('a' + (remainder - 10))) : type('0' + remainder));
-          value = value / T(format.get_base());
-        }
+      const unsigned_t abs_value = etl::absolute_unsigned(value);
 
-        // If number is negative, append '-'
-        if ((format.get_base() == 10U) && negative)
-        {
-          str.push_back(type('-'));
-        }
+      type* p = etl::private_to_string::write_digits(abs_value, end, format.get_base(), format.is_upper_case());
 
-        if (format.is_show_base())
+      // If number is negative, prepend '-' (a negative zero might occur for fractional numbers > -1.0)
+      if ((format.get_base() == 10U) && negative)
+      {
+        *--p = type('-');
+      }
+
+      if ((abs_value != 0U) && format.is_show_base())
+      {
+        switch (format.get_base())
         {
-          switch (format.get_base())
+          case 2U:
           {
-            case 2U:
-            {
-              str.push_back(format.is_upper_case() ? type('B') : type('b'));
-              str.push_back(type('0'));
-              break;
-            }
+            *--p = format.is_upper_case() ? type('B') : type('b');
+            *--p = type('0');
+            break;
+          }
 
-            case 8U:
-            {
-              str.push_back(type('0'));
-              break;
-            }
+          case 8U:
+          {
+            *--p = type('0');
+            break;
+          }
 
-            case 16U:
-            {
-              str.push_back(format.is_upper_case() ? type('X') : type('x'));
-              str.push_back(type('0'));
-              break;
-            }
+          case 16U:
+          {
+            *--p = format.is_upper_case() ? type('X') : type('x');
+            *--p = type('0');
+            break;
+          }
 
-            default:
-            {
-              break;
-            }
+          default:
+          {
+            break;
           }
         }
-
-        // Reverse the string we appended.
-        etl::reverse(start, str.end());
       }
 
+      str.insert(str.end(), p, end);
+
       etl::private_to_string::add_alignment(str, start, format);
     }
 
@@ -289,6 +412,147 @@ namespace etl
     }
 #endif
 
+#if ETL_USING_64BIT_TYPES
+    //***************************************************************************
+    /// Helper function for floating point, using the fewest digits that
+    /// convert back to the same value.
+    /// Values from 1e-6 up to 1e21 are written in fixed notation, with at
+    /// least 'precision' fractional digits. Others are written in scientific
+    /// notation.
+    //***************************************************************************
+    template <typename T, typename TIString>
+    void add_floating_point_shortest(const T value,
+                                     TIString& str,
+                                     const etl::basic_format_spec<TIString>& format)
+    {
+      typedef typename TIString::value_type type;
+
+      etl::private_to_string::shortest_decimal decimal;
+      etl::private_to_string::to_shortest_decimal(value, decimal);
+
+      // Room for the sign, the digits, up to 21 leading or trailing zeros,
+      // the decimal point, the exponent and the minimum fractional digits.
+      type  buffer[1U + 17U + 21U + 1U + 6U + 255U];
+      type* p = buffer;
+
+      if (decimal.negative)
+      {
+        *p++ = type('-');
+      }
+
+      // The position of the decimal point relative to the first digit.
+      const int point = decimal.length + decimal.exponent;
+
+      int fractional_digits = 0;
+
+      if ((point > -6) && (point <= 21))
+      {
+        if (point <= 0)
+        {
+          // 0.000ddd
+          *p++ = type('0');
+          *p++ = type('.');
+
+          for (int i = point; i < 0; ++i)
+          {
+            *p++ = type('0');
+          }
+
+          for (int i = 0; i < decimal.length; ++i)
+          {
+            *p++ = type(decimal.digits[i]);
+          }
+
+          fractional_digits = decimal.length - point;
+        }
+        else if (point < decimal.length)
+        {
+          // ddd.ddd
+          for (int i = 0; i < decimal.length; ++i)
+          {
+            if (i == point)
+            {
+              *p++ = type('.');
+            }
+
+            *p++ = type(decimal.digits[i]);
+          }
+
+          fractional_digits = decimal.length - point;
+        }
+        else
+        {
+          // ddd000
+          for (int i = 0; i < decimal.length; ++i)
+          {
+            *p++ = type(decimal.digits[i]);
+          }
+
+          for (int i = decimal.length; i < point; ++i)
+          {
+            *p++ = type('0');
+          }
+        }
+
+        // Pad to the minimum number of fractional digits.
+        const int precision = static_cast<int>(format.get_precision());
+
+        if (fractional_digits < precision)
+        {
+          if (fractional_digits == 0)
+          {
+            *p++ = type('.');
+          }
+
+          while (fractional_digits < precision)
+          {
+            *p++ = type('0');
+            ++fractional_digits;
+          }
+        }
+      }
+      else
+      {
+        // d.ddde+xx
+        *p++ = type(decimal.digits[0]);
+
+        if (decimal.length > 1)
+        {
+          *p++ = type('.');
+
+          for (int i = 1; i < decimal.length; ++i)
+          {
+            *p++ = type(decimal.digits[i]);
+          }
+        }
+
+        int exponent = point - 1;
+
+        *p++ = format.is_upper_case() ? type('E') : type('e');
+        *p++ = (exponent < 0) ? type('-') : type('+');
+
+        exponent = (exponent < 0) ? -exponent : exponent;
+
+        type  digits[4];
+        type* const digits_end = digits + 4;
+        type* first = etl::private_to_string::write_decimal_digits(static_cast<uint32_t>(exponent), digits_end);
+
+        // At least two exponent digits.
+        if ((digits_end - first) < 2)
+        {
+          *p++ = type('0');
+        }
+
+        while (first != digits_end)
+        {
+          *p++ = *first++;
+        }
+      }
+
+      str.insert(str.end(), buffer, p);
+    }
+#endif
+
     //***************************************************************************
     /// Helper function for floating point.
     //***************************************************************************
@@ -312,6 +576,12 @@ namespace etl
       {
         etl::private_to_string::add_nan_inf(isnan(value), isinf(value), str);
       }
+#if ETL_USING_64BIT_TYPES
+      else if (format.is_shortest())
+      {
+        etl::private_to_string::add_floating_point_shortest(value, str, format);
+      }
+#endif
       else
       {
         // Make sure we format the two halves correctly.
@@ -529,7 +799,7 @@ namespace etl
     template <typename T, typename TIString>
     typename etl::enable_if<etl::is_integral<T>::value &&
                             !etl::is_same<T, bool>::value &&
-                            !etl::is_one_of<T, int64_t, uint64_t>::value, const TIString&>::type
+                            (sizeof(T) <= sizeof(int32_t)), const TIString&>::type
       to_string(const T value, TIString& str, const etl::basic_format_spec<TIString>& format, const bool append = false)
     {
       typedef typename etl::conditional<etl::is_signed<T>::value, int32_t, uint32_t>::type type;
@@ -545,7 +815,7 @@ namespace etl
     template <typename T, typename TIString>
     typename etl::enable_if<etl::is_integral<T>::value &&
                             !etl::is_same<T, bool>::value &&
-                            etl::is_one_of<T, int64_t, uint64_t>::value, const TIString&>::type
+                            (sizeof(T) > sizeof(int32_t)), const TIString&>::type
       to_string(const T value, TIString& str, const etl::basic_format_spec<TIString>& format, const bool append = false)
     {
       etl::private_to_string::add_integral(value, str, format, append, etl::is_negative(value));
@@ -559,7 +829,7 @@ namespace etl
     template <typename T, typename TIString>
     typename etl::enable_if<etl::is_integral<T>::value &&
                             !etl::is_same<T, bool>::value &&
-                            !etl::is_one_of<T, int64_t, uint64_t>::value, const TIString&>::type
+                            (sizeof(T) <= sizeof(int32_t)), const TIString&>::type
       to_string(const T value, uint32_t denominator_exponent, TIString& str, const etl::basic_format_spec<TIString>& format, const bool append = false)
     {
       typedef typename etl::conditional<etl::is_signed<T>::value, int32_t, uint32_t>::type type;
@@ -575,7 +845,7 @@ namespace etl
     template <typename T, typename TIString>
     typename etl::enable_if<etl::is_integral<T>::value&&
                             !etl::is_same<T, bool>::value&&
-                            etl::is_one_of<T, int64_t, uint64_t>::value, const TIString&>::type
+                            (sizeof(T) > sizeof(int32_t)), const TIString&>::type
       to_string(const T value, uint32_t denominator_exponent, TIString& str, const etl::basic_format_spec<TIString>& format, const bool append = false)
     {
       etl::private_to_string::add_integral_denominated(value, denominator_exponent, str, format, append);
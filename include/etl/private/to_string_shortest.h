@@ -0,0 +1,524 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_TO_STRING_SHORTEST_INCLUDED
+#define ETL_TO_STRING_SHORTEST_INCLUDED
+
+///\ingroup private
+
+#include "../platform.h"
+#include "../limits.h"
+#include "../type_traits.h"
+
+#include <stdint.h>
+#include <string.h>
+#include <limits.h>
+
+#if ETL_USING_64BIT_TYPES
+
+namespace etl
+{
+  namespace private_to_string
+  {
+    //*************************************************************************
+    /// The shortest decimal representation of a floating point value.
+    /// The value is digits * 10^exponent.
+    //*************************************************************************
+    struct shortest_decimal
+    {
+      static ETL_CONSTANT int Max_Digits = 17;
+
+      char digits[Max_Digits];
+      int  length;
+      int  exponent;
+      bool negative;
+    };
+
+    //*************************************************************************
+    /// A floating point value as an unsigned significand and binary exponent.
+    //*************************************************************************
+    struct diy_fp
+    {
+      diy_fp()
+        : f(0U)
+        , e(0)
+      {
+      }
+
+      diy_fp(uint64_t f_, int e_)
+        : f(f_)
+        , e(e_)
+      {
+      }
+
+      //*********************************
+      /// x - y. The exponents must be the same and x.f >= y.f.
+      //*********************************
+      static diy_fp sub(const diy_fp& x, const diy_fp& y)
+      {
+        return diy_fp(x.f - y.f, x.e);
+      }
+
+      //*********************************
+      /// x * y, rounded to the upper 64 bits of the product.
+      //*********************************
+      static diy_fp mul(const diy_fp& x, const diy_fp& y)
+      {
+        const uint64_t u_lo = x.f & 0xFFFFFFFFU;
+        const uint64_t u_hi = x.f >> 32U;
+        const uint64_t v_lo = y.f & 0xFFFFFFFFU;
+        const uint64_t v_hi = y.f >> 32U;
+
+        const uint64_t p0 = u_lo * v_lo;
+        const uint64_t p1 = u_lo * v_hi;
+        const uint64_t p2 = u_hi * v_lo;
+        const uint64_t p3 = u_hi * v_hi;
+
+        uint64_t q = (p0 >> 32U) + (p1 & 0xFFFFFFFFU) + (p2 & 0xFFFFFFFFU);
+        q += uint64_t(1U) << 31U; // Round.
+
+        return diy_fp(p3 + (p1 >> 32U) + (p2 >> 32U) + (q >> 32U), x.e + y.e + 64);
+      }
+
+      //*********************************
+      /// Shift the significand until the top bit is set.
+      //*********************************
+      static diy_fp normalise(diy_fp x)
+      {
+        while ((x.f >> 63U) == 0U)
+        {
+          x.f <<= 1U;
+          --x.e;
+        }
+
+        return x;
+      }
+
+      //*********************************
+      /// Shift the significand to the target exponent.
+      //*********************************
+      static diy_fp normalise_to(const diy_fp& x, int target_exponent)
+      {
+        return diy_fp(x.f << (x.e - target_exponent), target_exponent);
+      }
+
+      uint64_t f;
+      int      e;
+    };
+
+    //*************************************************************************
+    /// A normalised power of ten.
+    //*************************************************************************
+    struct cached_power
+    {
+      uint64_t f;
+      int      e;
+      int      k;
+    };
+
+    //*************************************************************************
+    /// The normalised powers of ten from 10^-300 to 10^324, in steps of 10^8.
+    //*************************************************************************
+    template <typename T = void>
+    struct cached_powers
+    {
+      static const int Min_Decimal_Exponent = -300;
+      static const int Decimal_Step         = 8;
+
+      static const cached_power table[79];
+    };
+
+    template <typename T>
+    const int cached_powers<T>::Min_Decimal_Exponent;
+
+    template <typename T>
+    const int cached_powers<T>::Decimal_Step;
+
+    template <typename T>
+    const cached_power cached_powers<T>::table[79] =
+    {
+        { 0xAB70FE17C79AC6CAULL, -1060, -300 },
+        { 0xFF77B1FCBEBCDC4FULL, -1034, -292 },
+        { 0xBE5691EF416BD60CULL, -1007, -284 },
+        { 0x8DD01FAD907FFC3CULL,  -980, -276 },
+        { 0xD3515C2831559A83ULL,  -954, -268 },
+        { 0x9D71AC8FADA6C9B5ULL,  -927, -260 },
+        { 0xEA9C227723EE8BCBULL,  -901, -252 },
+        { 0xAECC49914078536DULL,  -874, -244 },
+        { 0x823C12795DB6CE57ULL,  -847, -236 },
+        { 0xC21094364DFB5637ULL,  -821, -228 },
+        { 0x9096EA6F3848984FULL,  -794, -220 },
+        { 0xD77485CB25823AC7ULL,  -768, -212 },
+        { 0xA086CFCD97BF97F4ULL,  -741, -204 },
+        { 0xEF340A98172AACE5ULL,  -715, -196 },
+        { 0xB23867FB2A35B28EULL,  -688, -188 },
+        { 0x84C8D4DFD2C63F3BULL,  -661, -180 },
+        { 0xC5DD44271AD3CDBAULL,  -635, -172 },
+        { 0x936B9FCEBB25C996ULL,  -608, -164 },
+        { 0xDBAC6C247D62A584ULL,  -582, -156 },
+        { 0xA3AB66580D5FDAF6ULL,  -555, -148 },
+        { 0xF3E2F893DEC3F126ULL,  -529, -140 },
+        { 0xB5B5ADA8AAFF80B8ULL,  -502, -132 },
+        { 0x87625F056C7C4A8BULL,  -475, -124 },
+        { 0xC9BCFF6034C13053ULL,  -449, -116 },
+        { 0x964E858C91BA2655ULL,  -422, -108 },
+        { 0xDFF9772470297EBDULL,  -396, -100 },
+        { 0xA6DFBD9FB8E5B88FULL,  -369,  -92 },
+        { 0xF8A95FCF88747D94ULL,  -343,  -84 },
+        { 0xB94470938FA89BCFULL,  -316,  -76 },
+        { 0x8A08F0F8BF0F156BULL,  -289,  -68 },
+        { 0xCDB02555653131B6ULL,  -263,  -60 },
+        { 0x993FE2C6D07B7FACULL,  -236,  -52 },
+        { 0xE45C10C42A2B3B06ULL,  -210,  -44 },
+        { 0xAA242499697392D3ULL,  -183,  -36 },
+        { 0xFD87B5F28300CA0EULL,  -157,  -28 },
+        { 0xBCE5086492111AEBULL,  -130,  -20 },
+        { 0x8CBCCC096F5088CCULL,  -103,  -12 },
+        { 0xD1B71758E219652CULL,   -77,   -4 },
+        { 0x9C40000000000000ULL,   -50,    4 },
+        { 0xE8D4A51000000000ULL,   -24,   12 },
+        { 0xAD78EBC5AC620000ULL,     3,   20 },
+        { 0x813F3978F8940984ULL,    30,   28 },
+        { 0xC097CE7BC90715B3ULL,    56,   36 },
+        { 0x8F7E32CE7BEA5C70ULL,    83,   44 },
+        { 0xD5D238A4ABE98068ULL,   109,   52 },
+        { 0x9F4F2726179A2245ULL,   136,   60 },
+        { 0xED63A231D4C4FB27ULL,   162,   68 },
+        { 0xB0DE65388CC8ADA8ULL,   189,   76 },
+        { 0x83C7088E1AAB65DBULL,   216,   84 },
+        { 0xC45D1DF942711D9AULL,   242,   92 },
+        { 0x924D692CA61BE758ULL,   269,  100 },
+        { 0xDA01EE641A708DEAULL,   295,  108 },
+        { 0xA26DA3999AEF774AULL,   322,  116 },
+        { 0xF209787BB47D6B85ULL,   348,  124 },
+        { 0xB454E4A179DD1877ULL,   375,  132 },
+        { 0x865B86925B9BC5C2ULL,   402,  140 },
+        { 0xC83553C5C8965D3DULL,   428,  148 },
+        { 0x952AB45CFA97A0B3ULL,   455,  156 },
+        { 0xDE469FBD99A05FE3ULL,   481,  164 },
+        { 0xA59BC234DB398C25ULL,   508,  172 },
+        { 0xF6C69A72A3989F5CULL,   534,  180 },
+        { 0xB7DCBF5354E9BECEULL,   561,  188 },
+        { 0x88FCF317F22241E2ULL,   588,  196 },
+        { 0xCC20CE9BD35C78A5ULL,   614,  204 },
+        { 0x98165AF37B2153DFULL,   641,  212 },
+        { 0xE2A0B5DC971F303AULL,   667,  220 },
+        { 0xA8D9D1535CE3B396ULL,   694,  228 },
+        { 0xFB9B7CD9A4A7443CULL,   720,  236 },
+        { 0xBB764C4CA7A44410ULL,   747,  244 },
+        { 0x8BAB8EEFB6409C1AULL,   774,  252 },
+        { 0xD01FEF10A657842CULL,   800,  260 },
+        { 0x9B10A4E5E9913129ULL,   827,  268 },
+        { 0xE7109BFBA19C0C9DULL,   853,  276 },
+        { 0xAC2820D9623BF429ULL,   880,  284 },
+        { 0x80444B5E7AA7CF85ULL,   907,  292 },
+        { 0xBF21E44003ACDD2DULL,   933,  300 },
+        { 0x8E679C2F5E44FF8FULL,   960,  308 },
+        { 0xD433179D9C8CB841ULL,   986,  316 },
+        { 0x9E19DB92B4E31BA9ULL,  1013,  324 }
+    };
+
+    //*************************************************************************
+    /// Grisu2 scales the exponents into [-60, -32] so that the integral part
+    /// of the scaled value fits in 32 bits.
+    //*************************************************************************
+    static ETL_CONSTANT int Grisu_Alpha = -60;
+
+    //*************************************************************************
+    /// The value and its neighbouring boundaries, with a common exponent.
+    //*************************************************************************
+    struct boundaries
+    {
+      diy_fp w;
+      diy_fp minus;
+      diy_fp plus;
+    };
+
+    //*************************************************************************
+    /// Computes the boundaries of a finite, positive value.
+    /// 'Precision' is the significand width, including the hidden bit.
+    //*************************************************************************
+    template <int Precision, int Max_Exponent>
+    boundaries compute_boundaries(uint64_t bits)
+    {
+      const int      Bias       = (Max_Exponent - 1) + (Precision - 1);
+      const int      Min_Exp    = 1 - Bias;
+      const uint64_t Hidden_Bit = uint64_t(1U) << (Precision - 1);
+
+      const uint64_t biased_exponent = bits >> (Precision - 1);
+      const uint64_t fraction        = bits & (Hidden_Bit - 1U);
+
+      const diy_fp v = (biased_exponent == 0U) ? diy_fp(fraction, Min_Exp)
+                                               : diy_fp(fraction + Hidden_Bit, static_cast<int>(biased_exponent) - Bias);
+
+      // The lower boundary is closer when the value is an exact power of two.
+      const bool lower_boundary_is_closer = (fraction == 0U) && (biased_exponent > 1U);
+
+      const diy_fp m_plus  = diy_fp((2U * v.f) + 1U, v.e - 1);
+      const diy_fp m_minus = lower_boundary_is_closer ? diy_fp((4U * v.f) - 1U, v.e - 2)
+                                                      : diy_fp((2U * v.f) - 1U, v.e - 1);
+
+      boundaries result;
+      result.plus  = diy_fp::normalise(m_plus);
+      result.minus = diy_fp::normalise_to(m_minus, result.plus.e);
+      result.w     = diy_fp::normalise(v);
+
+      return result;
+    }
+
+    //*************************************************************************
+    /// Gets the power of ten that scales 2^e into [Alpha, Gamma].
+    //*************************************************************************
+    inline cached_power get_cached_power(int e)
+    {
+      // k = ceil((Alpha - e - 1) * log10(2))
+      const int f     = Grisu_Alpha - e - 1;
+      const int k     = ((f * 78913) / (1 << 18)) + ((f > 0) ? 1 : 0);
+      const int index = (-cached_powers<>::Min_Decimal_Exponent + k + (cached_powers<>::Decimal_Step - 1)) / cached_powers<>::Decimal_Step;
+
+      return cached_powers<>::table[index];
+    }
+
+    //*************************************************************************
+    /// Finds the largest power of ten <= n. Returns the number of digits in n.
+    //*************************************************************************
+    inline int find_largest_pow10(uint32_t n, uint32_t& pow10)
+    {
+      static const uint32_t powers[] = { 1U, 10U, 100U, 1000U, 10000U, 100000U, 1000000U, 10000000U, 100000000U, 1000000000U };
+
+      int digits = 10;
+
+      while ((digits > 1) && (n < powers[digits - 1]))
+      {
+        --digits;
+      }
+
+      pow10 = powers[digits - 1];
+
+      return digits;
+    }
+
+    //*************************************************************************
+    /// Moves the last digit towards the value while it stays in range.
+    //*************************************************************************
+    inline void grisu2_round(char* buffer, int length, uint64_t dist, uint64_t delta, uint64_t rest, uint64_t ten_k)
+    {
+      while ((rest < dist) &&
+             ((delta - rest) >= ten_k) &&
+             (((rest + ten_k) < dist) || ((dist - rest) > (rest + ten_k - dist))))
+      {
+        --buffer[length - 1];
+        rest += ten_k;
+      }
+    }
+
+    //*************************************************************************
+    /// Generates the shortest digits of w that lie between m_minus and m_plus.
+    //*************************************************************************
+    inline void grisu2_digit_gen(shortest_decimal& result, diy_fp m_minus, diy_fp w, diy_fp m_plus)
+    {
+      uint64_t delta = diy_fp::sub(m_plus, m_minus).f;
+      uint64_t dist  = diy_fp::sub(m_plus, w).f;
+
+      const int      shift = -m_plus.e;
+      const uint64_t one   = uint64_t(1U) << shift;
+
+      uint32_t p1 = static_cast<uint32_t>(m_plus.f >> shift);
+      uint64_t p2 = m_plus.f & (one - 1U);
+
+      // The integral digits.
+      uint32_t pow10;
+      int n = find_largest_pow10(p1, pow10);
+
+      while (n > 0)
+      {
+        const uint32_t digit = p1 / pow10;
+        p1 %= pow10;
+        --n;
+
+        result.digits[result.length++] = static_cast<char>('0' + digit);
+
+        const uint64_t rest = (uint64_t(p1) << shift) + p2;
+
+        if (rest <= delta)
+        {
+          result.exponent += n;
+          grisu2_round(result.digits, result.length, dist, delta, rest, uint64_t(pow10) << shift);
+          return;
+        }
+
+        pow10 /= 10U;
+      }
+
+      // The fractional digits.
+      int m = 0;
+
+      for (;;)
+      {
+        p2 *= 10U;
+        const uint64_t digit = p2 >> shift;
+        p2 &= (one - 1U);
+        ++m;
+
+        result.digits[result.length++] = static_cast<char>('0' + digit);
+
+        delta *= 10U;
+        dist  *= 10U;
+
+        // A double never needs more than Max_Digits digits.
+        if ((p2 <= delta) || (result.length == shortest_decimal::Max_Digits))
+        {
+          break;
+        }
+      }
+
+      result.exponent -= m;
+      grisu2_round(result.digits, result.length, dist, delta, p2, one);
+    }
+
+    //*************************************************************************
+    /// Grisu2. Generates the shortest digits that convert back to the value,
+    /// in almost all cases, and digits that convert back to the value always.
+    //*************************************************************************
+    inline void grisu2(shortest_decimal& result, const boundaries& b)
+    {
+      const cached_power cached = get_cached_power(b.plus.e);
+      const diy_fp       c_minus_k(cached.f, cached.e);
+
+      const diy_fp w       = diy_fp::mul(b.w,     c_minus_k);
+      const diy_fp w_minus = diy_fp::mul(b.minus, c_minus_k);
+      const diy_fp w_plus  = diy_fp::mul(b.plus,  c_minus_k);
+
+      // Narrow the range by one unit to allow for the rounding of mul.
+      const diy_fp m_minus(w_minus.f + 1U, w_minus.e);
+      const diy_fp m_plus(w_plus.f - 1U, w_plus.e);
+
+      result.length   = 0;
+      result.exponent = -cached.k;
+
+      grisu2_digit_gen(result, m_minus, w, m_plus);
+    }
+
+    //*************************************************************************
+    /// Converts the bits of a finite value to its shortest decimal form.
+    //*************************************************************************
+    template <int Precision, int Max_Exponent>
+    void to_shortest_decimal(uint64_t bits, bool negative, shortest_decimal& result)
+    {
+      result.negative = negative;
+
+      if (bits == 0U)
+      {
+        result.digits[0] = '0';
+        result.length    = 1;
+        result.exponent  = 0;
+      }
+      else
+      {
+        etl::private_to_string::grisu2(result, etl::private_to_string::compute_boundaries<Precision, Max_Exponent>(bits));
+      }
+    }
+
+    //*************************************************************************
+    /// Converts a finite IEEE 754 value to its shortest decimal form.
+    /// 'TBits' is the unsigned type with the same size as 'TFloat'.
+    //*************************************************************************
+    template <typename TFloat, typename TBits>
+    void to_shortest_decimal_ieee(TFloat value, shortest_decimal& result)
+    {
+      TBits bits;
+      memcpy(&bits, &value, sizeof(bits));
+
+      const TBits Sign_Bit = TBits(1U) << ((CHAR_BIT * sizeof(TBits)) - 1U);
+
+      etl::private_to_string::to_shortest_decimal<etl::numeric_limits<TFloat>::digits,
+                                                  etl::numeric_limits<TFloat>::max_exponent>(bits & ~Sign_Bit, (bits & Sign_Bit) != 0U, result);
+    }
+
+    //*************************************************************************
+    /// Converts a finite float to its shortest decimal form.
+    //*************************************************************************
+    inline void to_shortest_decimal(float value, shortest_decimal& result)
+    {
+      etl::private_to_string::to_shortest_decimal_ieee<float, uint32_t>(value, result);
+    }
+
+    //*************************************************************************
+    /// Converts a finite double to its shortest decimal form.
+    //*************************************************************************
+    inline void to_shortest_decimal(double value, shortest_decimal& result)
+    {
+      typedef etl::conditional<sizeof(double) == sizeof(uint64_t), uint64_t, uint32_t>::type bits_t;
+
+      etl::private_to_string::to_shortest_decimal_ieee<double, bits_t>(value, result);
+    }
+
+    //*************************************************************************
+    /// Converts a finite long double to the shortest decimal form of the
+    /// nearest double.
+    /// Values outside the range of double are first scaled by powers of 1e256
+    /// and the scale is added back to the decimal exponent.
+    //*************************************************************************
+    inline void to_shortest_decimal(long double value, shortest_decimal& result)
+    {
+      const long double Scale     = 1e256L;
+      const int         Scale_Exp = 256;
+
+      int exponent = 0;
+
+      if (etl::numeric_limits<long double>::max_exponent > etl::numeric_limits<double>::max_exponent)
+      {
+        const long double Max = etl::numeric_limits<double>::max();
+        const long double Min = etl::numeric_limits<double>::min();
+
+        while ((value > Max) || (value < -Max))
+        {
+          value    /= Scale;
+          exponent += Scale_Exp;
+        }
+
+        const bool is_zero = !((value > 0.0L) || (value < 0.0L));
+
+        while (!is_zero && (value < Min) && (value > -Min))
+        {
+          value    *= Scale;
+          exponent -= Scale_Exp;
+        }
+      }
+
+      etl::private_to_string::to_shortest_decimal(static_cast<double>(value), result);
+
+      result.exponent += exponent;
+    }
+  }
+}
+
+#endif
+#endif
@@ -0,0 +1,674 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_MPMC_QUEUE_ATOMIC_INCLUDED
+#define ETL_MPMC_QUEUE_ATOMIC_INCLUDED
+
+#include "platform.h"
+#include "alignment.h"
+#include "parameter_type.h"
+#include "atomic.h"
+#include "memory_model.h"
+#include "integral_limits.h"
+#include "type_traits.h"
+#include "power.h"
+#include "utility.h"
+#include "placement_new.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if ETL_HAS_ATOMIC
+
+namespace etl
+{
+  //***************************************************************************
+  /// The base for all lock free multi producer, multi consumer queues.
+  /// Each element slot has a sequence counter, following the design by
+  /// Dmitry Vyukov.
+  /// The read and write counters are kept on separate cache lines.
+  //***************************************************************************
+  template <size_t Memory_Model = etl::memory_model::MEMORY_MODEL_LARGE>
+  class queue_mpmc_atomic_base
+  {
+  public:
+
+    /// The type used for determining the size of queue.
+    typedef typename etl::size_type_lookup<Memory_Model>::type size_type;
+
+    //*************************************************************************
+    /// Is the queue empty?
+    /// Due to concurrency, this is a guess.
+    //*************************************************************************
+    bool empty() const
+    {
+      return size() == 0U;
+    }
+
+    //*************************************************************************
+    /// Is the queue full?
+    /// Due to concurrency, this is a guess.
+    //*************************************************************************
+    bool full() const
+    {
+      return size() == Max_Size;
+    }
+
+    //*************************************************************************
+    /// How many items in the queue?
+    /// Due to concurrency, this is a guess.
+    //*************************************************************************
+    size_type size() const
+    {
+      // Load 'read' first, so that 'write' can never be behind it.
+      const size_type read_index  = read.load(etl::memory_order_acquire);
+      const size_type write_index = write.load(etl::memory_order_acquire);
+
+      const size_type n = size_type(write_index - read_index);
+
+      return (n > Max_Size) ? Max_Size : n;
+    }
+
+    //*************************************************************************
+    /// How much free space available in the queue.
+    /// Due to concurrency, this is a guess.
+    //*************************************************************************
+    size_type available() const
+    {
+      return Max_Size - size();
+    }
+
+    //*************************************************************************
+    /// How many items can the queue hold.
+    //*************************************************************************
+    size_type capacity() const
+    {
+      return Max_Size;
+    }
+
+    //*************************************************************************
+    /// How many items can the queue hold.
+    //*************************************************************************
+    size_type max_size() const
+    {
+      return Max_Size;
+    }
+
+  protected:
+
+    queue_mpmc_atomic_base(size_type max_size_)
+      : Max_Size(max_size_),
+        write(0),
+        read(0)
+    {
+    }
+
+    const size_type        Max_Size;                          ///< The maximum number of items in the queue. Always a power of 2.
+    char                   padding0[ETL_CACHE_LINE_SIZE];     ///< Separates the counters from the read only data.
+    etl::atomic<size_type> write;                             ///< The next position to push to.
+    char                   padding1[ETL_CACHE_LINE_SIZE];     ///< Separates the counters from each other.
+    etl::atomic<size_type> read;                              ///< The next position to pop from.
+    char                   padding2[ETL_CACHE_LINE_SIZE];     ///< Separates the counters from the data that follows.
+
+  private:
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+#if defined(ETL_POLYMORPHIC_MPMC_QUEUE_ATOMIC) || defined(ETL_POLYMORPHIC_CONTAINERS)
+  public:
+    virtual ~queue_mpmc_atomic_base()
+    {
+    }
+#else
+  protected:
+    ~queue_mpmc_atomic_base()
+    {
+    }
+#endif
+  };
+
+  //***************************************************************************
+  ///\ingroup queue_mpmc_atomic
+  ///\brief This is the base for all queue_mpmc_atomics that contain a particular type.
+  ///\details Normally a reference to this type will be taken from a derived queue_mpmc_atomic.
+  ///\code
+  /// etl::queue_mpmc_atomic<int, 16> myQueue;
+  /// etl::iqueue_mpmc_atomic<int>& iQueue = myQueue;
+  ///\endcode
+  /// This queue supports concurrent access by any number of producers and consumers,
+  /// without locks.
+  /// \tparam T The type of value that the queue_mpmc_atomic holds.
+  //***************************************************************************
+  template <typename T, const size_t Memory_Model = etl::memory_model::MEMORY_MODEL_LARGE>
+  class iqueue_mpmc_atomic : public queue_mpmc_atomic_base<Memory_Model>
+  {
+  private:
+
+    typedef typename etl::queue_mpmc_atomic_base<Memory_Model> base_t;
+
+  public:
+
+    typedef T                          value_type;      ///< The type stored in the queue.
+    typedef T&                         reference;       ///< A reference to the type used in the queue.
+    typedef const T&                   const_reference; ///< A const reference to the type used in the queue.
+#if ETL_USING_CPP11
+    typedef T&&                        rvalue_reference;///< An rvalue_reference to the type used in the queue.
+#endif
+    typedef typename base_t::size_type size_type;       ///< The type used for determining the size of the queue.
+
+    using base_t::write;
+    using base_t::read;
+    using base_t::Max_Size;
+
+    //*************************************************************************
+    /// Push a value to the queue.
+    /// Returns <b>false</b> if the queue is full.
+    //*************************************************************************
+    bool push(const_reference value)
+    {
+      size_type position;
+      cell*     p_cell = claim_push(position);
+
+      if (p_cell != ETL_NULLPTR)
+      {
+        ::new (&p_cell->value) T(value);
+
+        publish_push(p_cell, position);
+
+        return true;
+      }
+
+      // Queue is full.
+      return false;
+    }
+
+#if ETL_USING_CPP11 && ETL_NOT_USING_STLPORT && !defined(ETL_QUEUE_ATOMIC_FORCE_CPP03_IMPLEMENTATION)
+    //*************************************************************************
+    /// Push a value to the queue.
+    /// Returns <b>false</b> if the queue is full.
+    //*************************************************************************
+    bool push(rvalue_reference value)
+    {
+      size_type position;
+      cell*     p_cell = claim_push(position);
+
+      if (p_cell != ETL_NULLPTR)
+      {
+        ::new (&p_cell->value) T(etl::move(value));
+
+        publish_push(p_cell, position);
+
+        return true;
+      }
+
+      // Queue is full.
+      return false;
+    }
+#endif
+
+#if ETL_USING_CPP11 && ETL_NOT_USING_STLPORT && !defined(ETL_QUEUE_ATOMIC_FORCE_CPP03_IMPLEMENTATION)
+    //*************************************************************************
+    /// Constructs a value in the queue 'in place'.
+    /// Returns <b>false</b> if the queue is full.
+    //*************************************************************************
+    template <typename ... Args>
+    bool emplace(Args&&... args)
+    {
+      size_type position;
+      cell*     p_cell = claim_push(position);
+
+      if (p_cell != ETL_NULLPTR)
+      {
+        ::new (&p_cell->value) T(etl::forward<Args>(args)...);
+
+        publish_push(p_cell, position);
+
+        return true;
+      }
+
+      // Queue is full.
+      return false;
+    }
+#else
+    //*************************************************************************
+    /// Constructs a value in the queue 'in place'.
+    /// Returns <b>false</b> if the queue is full.
+    //*************************************************************************
+    bool emplace()
+    {
+      size_type position;
+      cell*     p_cell = claim_push(position);
+
+      if (p_cell != ETL_NULLPTR)
+      {
+        ::new (&p_cell->value) T();
+
+        publish_push(p_cell, position);
+
+        return true;
+      }
+
+      // Queue is full.
+      return false;
+    }
+
+    //*************************************************************************
+    /// Constructs a value in the queue 'in place'.
+    /// Returns <b>false</b> if the queue is full.
+    //*************************************************************************
+    template <typename T1>
+    bool emplace(const T1& value1)
+    {
+      size_type position;
+      cell*     p_cell = claim_push(position);
+
+      if (p_cell != ETL_NULLPTR)
+      {
+        ::new (&p_cell->value) T(value1);
+
+        publish_push(p_cell, position);
+
+        return true;
+      }
+
+      // Queue is full.
+      return false;
+    }
+
+    //*************************************************************************
+    /// Constructs a value in the queue 'in place'.
+    /// Returns <b>false</b> if the queue is full.
+    //*************************************************************************
+    template <typename T1, typename T2>
+    bool emplace(const T1& value1, const T2& value2)
+    {
+      size_type position;
+      cell*     p_cell = claim_push(position);
+
+      if (p_cell != ETL_NULLPTR)
+      {
+        ::new (&p_cell->value) T(value1, value2);
+
+        publish_push(p_cell, position);
+
+        return true;
+      }
+
+      // Queue is full.
+      return false;
+    }
+
+    //*************************************************************************
+    /// Constructs a value in the queue 'in place'.
+    /// Returns <b>false</b> if the queue is full.
+    //*************************************************************************
+    template <typename T1, typename T2, typename T3>
+    bool emplace(const T1& value1, const T2& value2, const T3& value3)
+    {
+      size_type position;
+      cell*     p_cell = claim_push(position);
+
+      if (p_cell != ETL_NULLPTR)
+      {
+        ::new (&p_cell->value) T(value1, value2, value3);
+
+        publish_push(p_cell, position);
+
+        return true;
+      }
+
+      // Queue is full.
+      return false;
+    }
+
+    //*************************************************************************
+    /// Constructs a value in the queue 'in place'.
+    /// Returns <b>false</b> if the queue is full.
+    //*************************************************************************
+    template <typename T1, typename T2, typename T3, typename T4>
+    bool emplace(const T1& value1, const T2& value2, const T3& value3, const T4& value4)
+    {
+      size_type position;
+      cell*     p_cell = claim_push(position);
+
+      if (p_cell != ETL_NULLPTR)
+      {
+        ::new (&p_cell->value) T(value1, value2, value3, value4);
+
+        publish_push(p_cell, position);
+
+        return true;
+      }
+
+      // Queue is full.
+      return false;
+    }
+#endif
+
+    //*************************************************************************
+    /// Peek the next value in the queue without removing it.
+    /// Only valid when no other thread is popping from the queue.
+    //*************************************************************************
+    bool front(reference value)
+    {
+      const size_type position = read.load(etl::memory_order_relaxed);
+      const cell&     c        = p_buffer[position & (Max_Size - 1U)];
+
+      if (c.sequence.load(etl::memory_order_acquire) != size_type(position + 1U))
+      {
+        // Queue is empty
+        return false;
+      }
+
+      value = *reinterpret_cast<const T*>(&c.value);
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Peek a value from the front of the queue.
+    /// Only valid when the queue is not empty and no other thread is popping from the queue.
+    //*************************************************************************
+    reference front()
+    {
+      const size_type position = read.load(etl::memory_order_relaxed);
+
+      return *reinterpret_cast<T*>(&p_buffer[position & (Max_Size - 1U)].value);
+    }
+
+    //*************************************************************************
+    /// Peek a value from the front of the queue.
+    /// Only valid when the queue is not empty and no other thread is popping from the queue.
+    //*************************************************************************
+    const_reference front() const
+    {
+      const size_type position = read.load(etl::memory_order_relaxed);
+
+      return *reinterpret_cast<const T*>(&p_buffer[position & (Max_Size - 1U)].value);
+    }
+
+    //*************************************************************************
+    /// Pop a value from the queue.
+    /// Returns <b>false</b> if the queue is empty.
+    //*************************************************************************
+    bool pop(reference value)
+    {
+      size_type position;
+      cell*     p_cell = claim_pop(position);
+
+      if (p_cell != ETL_NULLPTR)
+      {
+        T& item = *reinterpret_cast<T*>(&p_cell->value);
+
+#if ETL_USING_CPP11 && ETL_NOT_USING_STLPORT && !defined(ETL_QUEUE_ATOMIC_FORCE_CPP03_IMPLEMENTATION)
+        value = etl::move(item);
+#else
+        value = item;
+#endif
+
+        item.~T();
+
+        release_pop(p_cell, position);
+
+        return true;
+      }
+
+      // Queue is empty.
+      return false;
+    }
+
+    //*************************************************************************
+    /// Pop a value from the queue and discard.
+    /// Returns <b>false</b> if the queue is empty.
+    //*************************************************************************
+    bool pop()
+    {
+      size_type position;
+      cell*     p_cell = claim_pop(position);
+
+      if (p_cell != ETL_NULLPTR)
+      {
+        reinterpret_cast<T*>(&p_cell->value)->~T();
+
+        release_pop(p_cell, position);
+
+        return true;
+      }
+
+      // Queue is empty.
+      return false;
+    }
+
+    //*************************************************************************
+    /// Clear the queue.
+    /// Pops every item that was pushed before the call.
+    //*************************************************************************
+    void clear()
+    {
+      while (pop())
+      {
+        // Do nothing.
+      }
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// An element slot.
+    /// The sequence is equal to the position when the slot is free to be
+    /// pushed to, and the position + 1 when it holds a value to be popped.
+    //*************************************************************************
+    struct cell
+    {
+      etl::atomic<size_type> sequence;
+      typename etl::aligned_storage<sizeof(T), etl::alignment_of<T>::value>::type value;
+    };
+
+    //*************************************************************************
+    /// The constructor that is called from derived classes.
+    //*************************************************************************
+    iqueue_mpmc_atomic(cell* p_buffer_, size_type max_size_)
+      : base_t(max_size_),
+        p_buffer(p_buffer_)
+    {
+    }
+
+    //*************************************************************************
+    /// Sets the initial slot sequences.
+    /// Called by derived classes once the buffer has been constructed.
+    //*************************************************************************
+    void initialise()
+    {
+      for (size_type i = 0U; i < Max_Size; ++i)
+      {
+        p_buffer[i].sequence.store(i, etl::memory_order_relaxed);
+      }
+    }
+
+  private:
+
+    typedef typename etl::make_signed<size_type>::type difference_type;
+
+    //*************************************************************************
+    /// Claims the slot at the write position.
+    /// Returns a null pointer if the queue is full.
+    //*************************************************************************
+    cell* claim_push(size_type& position)
+    {
+      position = write.load(etl::memory_order_relaxed);
+
+      while (true)
+      {
+        cell& c = p_buffer[position & (Max_Size - 1U)];
+
+        const size_type       sequence   = c.sequence.load(etl::memory_order_acquire);
+        const difference_type difference = difference_type(size_type(sequence - position));
+
+        if (difference == 0)
+        {
+          // The slot is free. Try to claim it.
+          if (write.compare_exchange_weak(position, size_type(position + 1U), etl::memory_order_relaxed))
+          {
+            return &c;
+          }
+        }
+        else if (difference < 0)
+        {
+          // The slot still holds a value from the previous lap.
+          return ETL_NULLPTR;
+        }
+        else
+        {
+          // Another producer claimed the slot.
+          position = write.load(etl::memory_order_relaxed);
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Makes the pushed value visible to the consumers.
+    //*************************************************************************
+    static void publish_push(cell* p_cell, size_type position)
+    {
+      p_cell->sequence.store(size_type(position + 1U), etl::memory_order_release);
+    }
+
+    //*************************************************************************
+    /// Claims the slot at the read position.
+    /// Returns a null pointer if the queue is empty.
+    //*************************************************************************
+    cell* claim_pop(size_type& position)
+    {
+      position = read.load(etl::memory_order_relaxed);
+
+      while (true)
+      {
+        cell& c = p_buffer[position & (Max_Size - 1U)];
+
+        const size_type       sequence   = c.sequence.load(etl::memory_order_acquire);
+        const difference_type difference = difference_type(size_type(sequence - size_type(position + 1U)));
+
+        if (difference == 0)
+        {
+          // The slot holds a value. Try to claim it.
+          if (read.compare_exchange_weak(position, size_type(position + 1U), etl::memory_order_relaxed))
+          {
+            return &c;
+          }
+        }
+        else if (difference < 0)
+        {
+          // The slot has not been pushed to yet.
+          return ETL_NULLPTR;
+        }
+        else
+        {
+          // Another consumer claimed the slot.
+          position = read.load(etl::memory_order_relaxed);
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Frees the slot for the producers on the next lap.
+    //*************************************************************************
+    void release_pop(cell* p_cell, size_type position)
+    {
+      p_cell->sequence.store(size_type(position + Max_Size), etl::memory_order_release);
+    }
+
+    // Disable copy construction and assignment.
+    iqueue_mpmc_atomic(const iqueue_mpmc_atomic&) ETL_DELETE;
+    iqueue_mpmc_atomic& operator =(const iqueue_mpmc_atomic&) ETL_DELETE;
+
+#if ETL_USING_CPP11
+    iqueue_mpmc_atomic(iqueue_mpmc_atomic&&) = delete;
+    iqueue_mpmc_atomic& operator =(iqueue_mpmc_atomic&&) = delete;
+#endif
+
+    cell* p_buffer; ///< The internal buffer.
+  };
+
+  //***************************************************************************
+  ///\ingroup queue_mpmc_atomic
+  /// A fixed capacity lock free mpmc queue.
+  /// This queue supports concurrent access by any number of producers and consumers.
+  /// \tparam T            The type this queue should support.
+  /// \tparam Size         The maximum capacity of the queue. Must be a power of 2.
+  /// \tparam Memory_Model The memory model for the queue. Determines the type of the internal counter variables.
+  //***************************************************************************
+  template <typename T, size_t Size, const size_t Memory_Model = etl::memory_model::MEMORY_MODEL_LARGE>
+  class queue_mpmc_atomic : public iqueue_mpmc_atomic<T, Memory_Model>
+  {
+  private:
+
+    typedef typename etl::iqueue_mpmc_atomic<T, Memory_Model> base_t;
+
+  public:
+
+    typedef typename base_t::size_type size_type;
+
+    ETL_STATIC_ASSERT((etl::is_power_of_2<Size>::value), "Size must be a power of 2");
+    // At half of the counter range the sequence differences cannot tell full from empty.
+    ETL_STATIC_ASSERT((Size <= (etl::integral_limits<size_type>::max / 2U)), "Size too large for memory model");
+
+    static ETL_CONSTANT size_type MAX_SIZE = size_type(Size);
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    queue_mpmc_atomic()
+      : base_t(buffer, MAX_SIZE)
+    {
+      base_t::initialise();
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~queue_mpmc_atomic()
+    {
+      base_t::clear();
+    }
+
+  private:
+
+    /// The element slots used in the queue.
+    typename base_t::cell buffer[Size];
+  };
+
+  template <typename T, size_t Size, const size_t Memory_Model>
+  ETL_CONSTANT typename queue_mpmc_atomic<T, Size, Memory_Model>::size_type queue_mpmc_atomic<T, Size, Memory_Model>::MAX_SIZE;
+}
+
+#endif
+
+#endif
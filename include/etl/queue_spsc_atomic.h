@@ -39,6 +39,9 @@ SOFTWARE.
 #include "integral_limits.h"
 #include "utility.h"
 #include "placement_new.h"
+#include "span.h"
+#include "error_handler.h"
+#include "exception.h"
 
 #include <stddef.h>
 #include <stdint.h>
@@ -47,6 +50,32 @@ SOFTWARE.
 
 namespace etl
 {
+  //***************************************************************************
+  /// Base exception class for queue_spsc_atomic.
+  //***************************************************************************
+  class queue_spsc_atomic_exception : public etl::exception
+  {
+  public:
+
+    queue_spsc_atomic_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : etl::exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// A commit or release was larger than the reserved or peeked area.
+  //***************************************************************************
+  class queue_spsc_atomic_reserve_invalid : public etl::queue_spsc_atomic_exception
+  {
+  public:
+
+    queue_spsc_atomic_reserve_invalid(string_type file_name_, numeric_type line_number_)
+      : queue_spsc_atomic_exception(ETL_ERROR_TEXT("queue_spsc_atomic:reserve", ETL_QUEUE_SPSC_ATOMIC_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
   template <size_t Memory_Model = etl::memory_model::MEMORY_MODEL_LARGE>
   class queue_spsc_atomic_base
   {
@@ -127,12 +156,23 @@ namespace etl
 
   protected:
 
+#if defined(ETL_QUEUE_SPSC_ATOMIC_USE_CACHE_LINE_PADDING)
+    queue_spsc_atomic_base(size_type reserved_)
+      : Reserved(reserved_),
+        write(0),
+        cached_read(0),
+        read(0),
+        cached_write(0)
+    {
+    }
+#else
     queue_spsc_atomic_base(size_type reserved_)
       : write(0),
         read(0),
         Reserved(reserved_)
     {
     }
+#endif
 
     //*************************************************************************
     /// Calculate the next index.
@@ -149,9 +189,140 @@ namespace etl
       return index;
     }
 
+    //*************************************************************************
+    /// Is there space to push at the write index?
+    /// Call from the 'push' thread.
+    //*************************************************************************
+    bool can_push(size_type next_index)
+    {
+#if defined(ETL_QUEUE_SPSC_ATOMIC_USE_CACHE_LINE_PADDING)
+      // Only reload the consumer's index when the cached copy says the queue is full.
+      if (next_index == cached_read)
+      {
+        cached_read = read.load(etl::memory_order_acquire);
+
+        return next_index != cached_read;
+      }
+
+      return true;
+#else
+      return next_index != read.load(etl::memory_order_acquire);
+#endif
+    }
+
+    //*************************************************************************
+    /// Is there nothing to pop at the read index?
+    /// Call from the 'pop' thread.
+    //*************************************************************************
+    bool is_empty_for_pop(size_type read_index)
+    {
+#if defined(ETL_QUEUE_SPSC_ATOMIC_USE_CACHE_LINE_PADDING)
+      // Only reload the producer's index when the cached copy says the queue is empty.
+      if (read_index == cached_write)
+      {
+        cached_write = write.load(etl::memory_order_acquire);
+
+        return read_index == cached_write;
+      }
+
+      return false;
+#else
+      return read_index == write.load(etl::memory_order_acquire);
+#endif
+    }
+
+    //*************************************************************************
+    /// The number of contiguous free slots from the write index.
+    /// Call from the 'push' thread.
+    //*************************************************************************
+    size_type contiguous_free(size_type write_index)
+    {
+      const size_type read_index = read.load(etl::memory_order_acquire);
+
+#if defined(ETL_QUEUE_SPSC_ATOMIC_USE_CACHE_LINE_PADDING)
+      cached_read = read_index;
+#endif
+
+      if (write_index >= read_index)
+      {
+        // Free to the end of the buffer, but one slot must always stay empty.
+        return Reserved - write_index - ((read_index == 0U) ? 1U : 0U);
+      }
+      else
+      {
+        return read_index - write_index - 1U;
+      }
+    }
+
+    //*************************************************************************
+    /// The number of contiguous used slots from the read index.
+    /// Call from the 'pop' thread.
+    //*************************************************************************
+    size_type contiguous_used(size_type read_index)
+    {
+      const size_type write_index = write.load(etl::memory_order_acquire);
+
+#if defined(ETL_QUEUE_SPSC_ATOMIC_USE_CACHE_LINE_PADDING)
+      cached_write = write_index;
+#endif
+
+      if (write_index >= read_index)
+      {
+        return write_index - read_index;
+      }
+      else
+      {
+        return Reserved - read_index;
+      }
+    }
+
+    //*************************************************************************
+    /// Advances an index by n, wrapping at the end of the buffer.
+    //*************************************************************************
+    size_type advance_index(size_type index, size_type n) const
+    {
+      index += n;
+
+      if (index >= Reserved)
+      {
+        index -= Reserved;
+      }
+
+      return index;
+    }
+
+    //*************************************************************************
+    /// Resets the indexes.
+    /// Only when there is no possibility of concurrent access.
+    //*************************************************************************
+    void reset_indexes()
+    {
+      write = 0;
+      read  = 0;
+
+#if defined(ETL_QUEUE_SPSC_ATOMIC_USE_CACHE_LINE_PADDING)
+      cached_read  = 0;
+      cached_write = 0;
+#endif
+    }
+
+#if defined(ETL_QUEUE_SPSC_ATOMIC_USE_CACHE_LINE_PADDING)
+    // The producer and consumer data are on separate cache lines.
+    // Each side keeps a copy of the other side's index, so that the
+    // shared cache line is only read when the queue appears full or empty.
+    const size_type        Reserved;                      ///< The maximum number of items in the queue.
+    char                   padding0[ETL_CACHE_LINE_SIZE]; ///< Separates the indexes from the read only data.
+    etl::atomic<size_type> write;                         ///< Where to input new data.
+    size_type              cached_read;                   ///< The 'push' thread's copy of 'read'.
+    char                   padding1[ETL_CACHE_LINE_SIZE]; ///< Separates the producer and consumer data.
+    etl::atomic<size_type> read;                          ///< Where to get the oldest data.
+    size_type              cached_write;                  ///< The 'pop' thread's copy of 'write'.
+    char                   padding2[ETL_CACHE_LINE_SIZE]; ///< Separates the indexes from the data that follows.
+#else
     etl::atomic<size_type> write; ///< Where to input new data.
     etl::atomic<size_type> read;  ///< Where to get the oldest data.
     const size_type Reserved;     ///< The maximum number of items in the queue.
+#endif
 
   private:
 
@@ -203,6 +374,11 @@ namespace etl
     using base_t::read;
     using base_t::Reserved;
     using base_t::get_next_index;
+    using base_t::can_push;
+    using base_t::is_empty_for_pop;
+    using base_t::contiguous_free;
+    using base_t::contiguous_used;
+    using base_t::advance_index;
 
     //*************************************************************************
     /// Push a value to the queue.
@@ -212,7 +388,7 @@ namespace etl
       size_type write_index = write.load(etl::memory_order_relaxed);
       size_type next_index  = get_next_index(write_index, Reserved);
 
-      if (next_index != read.load(etl::memory_order_acquire))
+      if (can_push(next_index))
       {
         ::new (&p_buffer[write_index]) T(value);
 
@@ -234,7 +410,7 @@ namespace etl
       size_type write_index = write.load(etl::memory_order_relaxed);
       size_type next_index = get_next_index(write_index, Reserved);
 
-      if (next_index != read.load(etl::memory_order_acquire))
+      if (can_push(next_index))
       {
         ::new (&p_buffer[write_index]) T(etl::move(value));
 
@@ -259,7 +435,7 @@ namespace etl
       size_type write_index = write.load(etl::memory_order_relaxed);
       size_type next_index  = get_next_index(write_index, Reserved);
 
-      if (next_index != read.load(etl::memory_order_acquire))
+      if (can_push(next_index))
       {
         ::new (&p_buffer[write_index]) T(etl::forward<Args>(args)...);
 
@@ -281,7 +457,7 @@ namespace etl
       size_type write_index = write.load(etl::memory_order_relaxed);
       size_type next_index = get_next_index(write_index, Reserved);
 
-      if (next_index != read.load(etl::memory_order_acquire))
+      if (can_push(next_index))
       {
         ::new (&p_buffer[write_index]) T();
 
@@ -304,7 +480,7 @@ namespace etl
       size_type write_index = write.load(etl::memory_order_relaxed);
       size_type next_index  = get_next_index(write_index, Reserved);
 
-      if (next_index != read.load(etl::memory_order_acquire))
+      if (can_push(next_index))
       {
         ::new (&p_buffer[write_index]) T(value1);
 
@@ -327,7 +503,7 @@ namespace etl
       size_type write_index = write.load(etl::memory_order_relaxed);
       size_type next_index  = get_next_index(write_index, Reserved);
 
-      if (next_index != read.load(etl::memory_order_acquire))
+      if (can_push(next_index))
       {
         ::new (&p_buffer[write_index]) T(value1, value2);
 
@@ -350,7 +526,7 @@ namespace etl
       size_type write_index = write.load(etl::memory_order_relaxed);
       size_type next_index  = get_next_index(write_index, Reserved);
 
-      if (next_index != read.load(etl::memory_order_acquire))
+      if (can_push(next_index))
       {
         ::new (&p_buffer[write_index]) T(value1, value2, value3);
 
@@ -373,7 +549,7 @@ namespace etl
       size_type write_index = write.load(etl::memory_order_relaxed);
       size_type next_index  = get_next_index(write_index, Reserved);
 
-      if (next_index != read.load(etl::memory_order_acquire))
+      if (can_push(next_index))
       {
         ::new (&p_buffer[write_index]) T(value1, value2, value3, value4);
 
@@ -394,7 +570,7 @@ namespace etl
     {
       size_type read_index = read.load(etl::memory_order_relaxed);
 
-      if (read_index == write.load(etl::memory_order_acquire))
+      if (is_empty_for_pop(read_index))
       {
         // Queue is empty
         return false;
@@ -412,7 +588,7 @@ namespace etl
     {
       size_type read_index = read.load(etl::memory_order_relaxed);
 
-      if (read_index == write.load(etl::memory_order_acquire))
+      if (is_empty_for_pop(read_index))
       {
         // Queue is empty
         return false;
@@ -440,7 +616,7 @@ namespace etl
     {
       size_type read_index = read.load(etl::memory_order_relaxed);
 
-      if (read_index == write.load(etl::memory_order_acquire))
+      if (is_empty_for_pop(read_index))
       {
         // Queue is empty
         return false;
@@ -455,6 +631,159 @@ namespace etl
       return true;
     }
 
+    //*************************************************************************
+    /// Pushes as many of the values as there is space for.
+    /// The items are published to the consumer together.
+    /// \return The number of values pushed.
+    //*************************************************************************
+    size_type push(const etl::span<const T>& values)
+    {
+      size_type       write_index = write.load(etl::memory_order_relaxed);
+      const size_type start_index = write_index;
+      const T*        p_value     = values.data();
+      size_type       remaining   = size_type(values.size());
+      size_type       count       = 0U;
+
+      // At most two contiguous areas, before and after the end of the buffer.
+      for (int area = 0; (area < 2) && (remaining != 0U); ++area)
+      {
+        size_type n = contiguous_free(write_index);
+        n = (n < remaining) ? n : remaining;
+
+        for (size_type i = 0U; i < n; ++i)
+        {
+          ::new (&p_buffer[write_index + i]) T(*p_value++);
+        }
+
+        write_index = advance_index(write_index, n);
+        remaining   = size_type(remaining - n);
+        count       = size_type(count + n);
+      }
+
+      if (write_index != start_index)
+      {
+        write.store(write_index, etl::memory_order_release);
+      }
+
+      return count;
+    }
+
+    //*************************************************************************
+    /// Pops as many values as there are, up to the size of the span.
+    /// The slots are released to the producer together.
+    /// \return The number of values popped.
+    //*************************************************************************
+    size_type pop(const etl::span<T>& values)
+    {
+      size_type       read_index  = read.load(etl::memory_order_relaxed);
+      const size_type start_index = read_index;
+      T*              p_value     = values.data();
+      size_type       remaining   = size_type(values.size());
+      size_type       count       = 0U;
+
+      // At most two contiguous areas, before and after the end of the buffer.
+      for (int area = 0; (area < 2) && (remaining != 0U); ++area)
+      {
+        size_type n = contiguous_used(read_index);
+        n = (n < remaining) ? n : remaining;
+
+        for (size_type i = 0U; i < n; ++i)
+        {
+#if ETL_USING_CPP11 && ETL_NOT_USING_STLPORT && !defined(ETL_QUEUE_ATOMIC_FORCE_CPP03_IMPLEMENTATION)
+          *p_value++ = etl::move(p_buffer[read_index + i]);
+#else
+          *p_value++ = p_buffer[read_index + i];
+#endif
+          p_buffer[read_index + i].~T();
+        }
+
+        read_index = advance_index(read_index, n);
+        remaining  = size_type(remaining - n);
+        count      = size_type(count + n);
+      }
+
+      if (read_index != start_index)
+      {
+        read.store(read_index, etl::memory_order_release);
+      }
+
+      return count;
+    }
+
+    //*************************************************************************
+    /// Reserves the contiguous free area at the back of the queue, up to max_reserve_size items.
+    /// The area is uninitialised storage. The items must be constructed in
+    /// place, unless T is trivially default constructible.
+    /// Call write_commit with the number of items written.
+    /// There may be more free space at the start of the buffer once the
+    /// area has been committed.
+    //*************************************************************************
+    etl::span<T> write_reserve(size_type max_reserve_size = etl::integral_limits<size_type>::max)
+    {
+      const size_type write_index = write.load(etl::memory_order_relaxed);
+
+      size_type n = contiguous_free(write_index);
+      n = (n < max_reserve_size) ? n : max_reserve_size;
+
+      return etl::span<T>(p_buffer + write_index, n);
+    }
+
+    //*************************************************************************
+    /// Publishes the first n items of the area returned by write_reserve.
+    /// If asserts or exceptions are enabled, throws an etl::queue_spsc_atomic_reserve_invalid
+    /// if n is larger than the free contiguous area.
+    //*************************************************************************
+    void write_commit(size_type n)
+    {
+      const size_type write_index = write.load(etl::memory_order_relaxed);
+
+      ETL_ASSERT_OR_RETURN(n <= contiguous_free(write_index), ETL_ERROR(etl::queue_spsc_atomic_reserve_invalid));
+
+      if (n != 0U)
+      {
+        write.store(advance_index(write_index, n), etl::memory_order_release);
+      }
+    }
+
+    //*************************************************************************
+    /// Gets the contiguous area of items at the front of the queue, up to max_peek_size items.
+    /// Call read_release with the number of items consumed.
+    /// There may be more items at the start of the buffer once the area
+    /// has been released.
+    //*************************************************************************
+    etl::span<T> read_peek(size_type max_peek_size = etl::integral_limits<size_type>::max)
+    {
+      const size_type read_index = read.load(etl::memory_order_relaxed);
+
+      size_type n = contiguous_used(read_index);
+      n = (n < max_peek_size) ? n : max_peek_size;
+
+      return etl::span<T>(p_buffer + read_index, n);
+    }
+
+    //*************************************************************************
+    /// Destroys the first n items of the area returned by read_peek and
+    /// releases their slots to the producer.
+    /// If asserts or exceptions are enabled, throws an etl::queue_spsc_atomic_reserve_invalid
+    /// if n is larger than the contiguous used area.
+    //*************************************************************************
+    void read_release(size_type n)
+    {
+      const size_type read_index = read.load(etl::memory_order_relaxed);
+
+      ETL_ASSERT_OR_RETURN(n <= contiguous_used(read_index), ETL_ERROR(etl::queue_spsc_atomic_reserve_invalid));
+
+      if (n != 0U)
+      {
+        for (size_type i = 0U; i < n; ++i)
+        {
+          p_buffer[read_index + i].~T();
+        }
+
+        read.store(advance_index(read_index, n), etl::memory_order_release);
+      }
+    }
+
     //*************************************************************************
     /// Peek a value from the front of the queue.
     //*************************************************************************
@@ -484,8 +813,7 @@ namespace etl
     {
       if ETL_IF_CONSTEXPR(etl::is_trivially_destructible<T>::value)
       {
-        write = 0;
-        read  = 0;
+        base_t::reset_indexes();
       }
       else
       {
@@ -38,12 +38,41 @@ SOFTWARE.
 #include "integral_limits.h"
 #include "utility.h"
 #include "placement_new.h"
+#include "span.h"
+#include "error_handler.h"
+#include "exception.h"
 
 #include <stddef.h>
 #include <stdint.h>
 
 namespace etl
 {
+  //***************************************************************************
+  /// Base exception class for queue_spsc_isr.
+  //***************************************************************************
+  class queue_spsc_isr_exception : public etl::exception
+  {
+  public:
+
+    queue_spsc_isr_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : etl::exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// A commit or release was larger than the reserved or peeked area.
+  //***************************************************************************
+  class queue_spsc_isr_reserve_invalid : public etl::queue_spsc_isr_exception
+  {
+  public:
+
+    queue_spsc_isr_reserve_invalid(string_type file_name_, numeric_type line_number_)
+      : queue_spsc_isr_exception(ETL_ERROR_TEXT("queue_spsc_isr:reserve", ETL_QUEUE_SPSC_ISR_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
   template <typename T, const size_t MEMORY_MODEL = etl::memory_model::MEMORY_MODEL_LARGE>
   class queue_spsc_isr_base
   {
@@ -106,6 +135,62 @@ namespace etl
       return pop_implementation();
     }
 
+    //*************************************************************************
+    /// Push as many of the values as there is space for from an ISR.
+    /// \return The number of values pushed.
+    //*************************************************************************
+    size_type push_from_isr(const etl::span<const T>& values)
+    {
+      return push_implementation(values);
+    }
+
+    //*************************************************************************
+    /// Pop up to values.size() values from the queue from an ISR.
+    /// \return The number of values popped.
+    //*************************************************************************
+    size_type pop_from_isr(const etl::span<T>& values)
+    {
+      return pop_implementation(values);
+    }
+
+    //*************************************************************************
+    /// Reserve the contiguous free area at the back of the queue from an ISR.
+    //*************************************************************************
+    etl::span<T> write_reserve_from_isr(size_type max_reserve_size = etl::integral_limits<size_type>::max)
+    {
+      return write_reserve_implementation(max_reserve_size);
+    }
+
+    //*************************************************************************
+    /// Commit n items of the reserved area from an ISR.
+    //*************************************************************************
+    void write_commit_from_isr(size_type n)
+    {
+      const bool valid = write_commit_implementation(n);
+
+      ETL_ASSERT(valid, ETL_ERROR(etl::queue_spsc_isr_reserve_invalid));
+      (void)valid;
+    }
+
+    //*************************************************************************
+    /// Get the contiguous area of items at the front of the queue from an ISR.
+    //*************************************************************************
+    etl::span<T> read_peek_from_isr(size_type max_peek_size = etl::integral_limits<size_type>::max)
+    {
+      return read_peek_implementation(max_peek_size);
+    }
+
+    //*************************************************************************
+    /// Release n items of the peeked area from an ISR.
+    //*************************************************************************
+    void read_release_from_isr(size_type n)
+    {
+      const bool valid = read_release_implementation(n);
+
+      ETL_ASSERT(valid, ETL_ERROR(etl::queue_spsc_isr_reserve_invalid));
+      (void)valid;
+    }
+
     //*************************************************************************
     /// Peek a value at the front of the queue from an ISR
     //*************************************************************************
@@ -435,6 +520,177 @@ namespace etl
       return true;
     }
 
+    //*************************************************************************
+    /// Push as many of the values as there is space for.
+    //*************************************************************************
+    size_type push_implementation(const etl::span<const T>& values)
+    {
+      const T*  p_value   = values.data();
+      size_type remaining = size_type(values.size());
+      size_type count     = 0U;
+
+      // At most two contiguous areas, before and after the end of the buffer.
+      for (int area = 0; (area < 2) && (remaining != 0U); ++area)
+      {
+        size_type n = contiguous_free();
+        n = (n < remaining) ? n : remaining;
+
+        for (size_type i = 0U; i < n; ++i)
+        {
+          ::new (&p_buffer[write_index + i]) T(*p_value++);
+        }
+
+        write_index  = advance_index(write_index, n);
+        current_size = size_type(current_size + n);
+        remaining    = size_type(remaining - n);
+        count        = size_type(count + n);
+      }
+
+      return count;
+    }
+
+    //*************************************************************************
+    /// Pop up to values.size() values.
+    //*************************************************************************
+    size_type pop_implementation(const etl::span<T>& values)
+    {
+      T*        p_value   = values.data();
+      size_type remaining = size_type(values.size());
+      size_type count     = 0U;
+
+      // At most two contiguous areas, before and after the end of the buffer.
+      for (int area = 0; (area < 2) && (remaining != 0U); ++area)
+      {
+        size_type n = contiguous_used();
+        n = (n < remaining) ? n : remaining;
+
+        for (size_type i = 0U; i < n; ++i)
+        {
+#if ETL_USING_CPP11 && ETL_NOT_USING_STLPORT && !defined(ETL_QUEUE_LOCKABLE_FORCE_CPP03_IMPLEMENTATION)
+          *p_value++ = etl::move(p_buffer[read_index + i]);
+#else
+          *p_value++ = p_buffer[read_index + i];
+#endif
+          p_buffer[read_index + i].~T();
+        }
+
+        read_index   = advance_index(read_index, n);
+        current_size = size_type(current_size - n);
+        remaining    = size_type(remaining - n);
+        count        = size_type(count + n);
+      }
+
+      return count;
+    }
+
+    //*************************************************************************
+    /// Get the contiguous free area at the back of the queue.
+    /// The area is uninitialised storage. The items must be constructed in
+    /// place, unless T is trivially default constructible.
+    //*************************************************************************
+    etl::span<T> write_reserve_implementation(size_type max_reserve_size)
+    {
+      size_type n = contiguous_free();
+      n = (n < max_reserve_size) ? n : max_reserve_size;
+
+      return etl::span<T>(p_buffer + write_index, n);
+    }
+
+    //*************************************************************************
+    /// Add the first n items of the reserved area to the queue.
+    /// Returns false if n is larger than the free contiguous area.
+    //*************************************************************************
+    bool write_commit_implementation(size_type n)
+    {
+      if (n > contiguous_free())
+      {
+        return false;
+      }
+
+      write_index  = advance_index(write_index, n);
+      current_size = size_type(current_size + n);
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Get the contiguous area of items at the front of the queue.
+    //*************************************************************************
+    etl::span<T> read_peek_implementation(size_type max_peek_size)
+    {
+      size_type n = contiguous_used();
+      n = (n < max_peek_size) ? n : max_peek_size;
+
+      return etl::span<T>(p_buffer + read_index, n);
+    }
+
+    //*************************************************************************
+    /// Destroy and remove the first n items of the peeked area.
+    /// Returns false if n is larger than the contiguous used area.
+    //*************************************************************************
+    bool read_release_implementation(size_type n)
+    {
+      if (n > contiguous_used())
+      {
+        return false;
+      }
+
+      for (size_type i = 0U; i < n; ++i)
+      {
+        p_buffer[read_index + i].~T();
+      }
+
+      read_index   = advance_index(read_index, n);
+      current_size = size_type(current_size - n);
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// The number of contiguous free slots from the write index.
+    //*************************************************************************
+    size_type contiguous_free() const
+    {
+      if ((current_size == MAX_SIZE) || (write_index < read_index))
+      {
+        return size_type(read_index - write_index);
+      }
+      else
+      {
+        return size_type(MAX_SIZE - write_index);
+      }
+    }
+
+    //*************************************************************************
+    /// The number of contiguous used slots from the read index.
+    //*************************************************************************
+    size_type contiguous_used() const
+    {
+      if ((current_size == 0U) || (read_index < write_index))
+      {
+        return size_type(write_index - read_index);
+      }
+      else
+      {
+        return size_type(MAX_SIZE - read_index);
+      }
+    }
+
+    //*************************************************************************
+    /// Advance an index by n, wrapping at the end of the buffer.
+    //*************************************************************************
+    size_type advance_index(size_type index, size_type n) const
+    {
+      index = size_type(index + n);
+
+      if (index >= MAX_SIZE)
+      {
+        index = size_type(index - MAX_SIZE);
+      }
+
+      return index;
+    }
+
     //*************************************************************************
     /// Calculate the next index.
     //*************************************************************************
@@ -657,6 +913,102 @@ namespace etl
       return result;
     }
 
+    //*************************************************************************
+    /// Push as many of the values as there is space for.
+    /// \return The number of values pushed.
+    //*************************************************************************
+    size_type push(const etl::span<const T>& values)
+    {
+      TAccess::lock();
+
+      size_type result = this->push_implementation(values);
+
+      TAccess::unlock();
+
+      return result;
+    }
+
+    //*************************************************************************
+    /// Pop up to values.size() values from the queue.
+    /// \return The number of values popped.
+    //*************************************************************************
+    size_type pop(const etl::span<T>& values)
+    {
+      TAccess::lock();
+
+      size_type result = this->pop_implementation(values);
+
+      TAccess::unlock();
+
+      return result;
+    }
+
+    //*************************************************************************
+    /// Reserve the contiguous free area at the back of the queue, up to max_reserve_size items.
+    /// The area is uninitialised storage. The items must be constructed in
+    /// place, unless T is trivially default constructible.
+    /// Call write_commit with the number of items written.
+    //*************************************************************************
+    etl::span<T> write_reserve(size_type max_reserve_size = etl::integral_limits<size_type>::max)
+    {
+      TAccess::lock();
+
+      etl::span<T> result = this->write_reserve_implementation(max_reserve_size);
+
+      TAccess::unlock();
+
+      return result;
+    }
+
+    //*************************************************************************
+    /// Add the first n items of the area returned by write_reserve to the queue.
+    /// If asserts or exceptions are enabled, throws an etl::queue_spsc_isr_reserve_invalid
+    /// if n is larger than the free contiguous area.
+    //*************************************************************************
+    void write_commit(size_type n)
+    {
+      TAccess::lock();
+
+      const bool valid = this->write_commit_implementation(n);
+
+      TAccess::unlock();
+
+      ETL_ASSERT(valid, ETL_ERROR(etl::queue_spsc_isr_reserve_invalid));
+      (void)valid;
+    }
+
+    //*************************************************************************
+    /// Get the contiguous area of items at the front of the queue, up to max_peek_size items.
+    /// Call read_release with the number of items consumed.
+    //*************************************************************************
+    etl::span<T> read_peek(size_type max_peek_size = etl::integral_limits<size_type>::max)
+    {
+      TAccess::lock();
+
+      etl::span<T> result = this->read_peek_implementation(max_peek_size);
+
+      TAccess::unlock();
+
+      return result;
+    }
+
+    //*************************************************************************
+    /// Destroy and remove the first n items of the area returned by read_peek.
+    /// If asserts or exceptions are enabled, throws an etl::queue_spsc_isr_reserve_invalid
+    /// if n is larger than the contiguous used area.
+    //*************************************************************************
+    void read_release(size_type n)
+    {
+      TAccess::lock();
+
+      const bool valid = this->read_release_implementation(n);
+
+      TAccess::unlock();
+
+      ETL_ASSERT(valid, ETL_ERROR(etl::queue_spsc_isr_reserve_invalid));
+      (void)valid;
+    }
+
     //*************************************************************************
     /// Peek a value at the front of the queue.
     //*************************************************************************
@@ -45,6 +45,9 @@ SOFTWARE.
 
 namespace etl
 {
+  template <typename TCounter, size_t Block_Size, size_t Block_Alignment, size_t Batch_Size>
+  class reference_counted_message_pool_cache;
+
   //***************************************************************************
   /// Exception type for etl::reference_counted_message_pool
   //***************************************************************************
@@ -282,6 +285,50 @@ namespace etl
 
   private:
 
+    template <typename, size_t, size_t, size_t>
+    friend class etl::reference_counted_message_pool_cache;
+
+    //*************************************************************************
+    /// Allocate up to n blocks under a single lock.
+    /// The blocks are returned as a list linked through their first word.
+    //*************************************************************************
+    void* allocate_blocks(size_t n, size_t size, size_t alignment)
+    {
+      void* p_head = ETL_NULLPTR;
+
+      lock();
+      for (size_t i = 0U; i < n; ++i)
+      {
+        void* p = memory_block_allocator.allocate(size, alignment);
+
+        if (p == ETL_NULLPTR)
+        {
+          break;
+        }
+
+        *static_cast<void**>(p) = p_head;
+        p_head = p;
+      }
+      unlock();
+
+      return p_head;
+    }
+
+    //*************************************************************************
+    /// Release a list of blocks from allocate_blocks under a single lock.
+    //*************************************************************************
+    void release_blocks(void* p_head)
+    {
+      lock();
+      while (p_head != ETL_NULLPTR)
+      {
+        void* p_next = *static_cast<void**>(p_head);
+        memory_block_allocator.release(p_head);
+        p_head = p_next;
+      }
+      unlock();
+    }
+
     /// The raw memory block pool.
     imemory_block_allocator& memory_block_allocator;
 
@@ -317,6 +364,316 @@ namespace etl
 #if ETL_USING_CPP11 && ETL_HAS_ATOMIC
   using  atomic_counted_message_pool = reference_counted_message_pool<etl::atomic_int>;
 #endif
+
+#if ETL_HAS_ATOMIC
+  //***************************************************************************
+  /// A cache in front of a reference_counted_message_pool, for use by one thread.
+  /// Each thread that creates messages constructs its own cache over the shared pool.
+  /// Messages are allocated from a list that only the owning thread touches, so
+  /// allocation takes no lock. When the list is empty, the blocks released back to
+  /// the cache since the last refill are taken with one atomic exchange. If there are
+  /// none, a batch of Batch_Size blocks is taken from the pool under a single lock.
+  /// Messages may be released from any thread; they are pushed on to a lock free
+  /// list that the owning thread collects.
+  /// The cache must outlive the messages that it has allocated.
+  /// When more than 2 x Batch_Size released blocks are waiting to be collected, the
+  /// releasing thread returns Batch_Size of them to the pool under a single lock, so
+  /// that a burst of releases does not starve the other threads' caches.
+  /// flush() and the destructor return all of the cached blocks to the pool.
+  ///\tparam TCounter        The reference counter type of the pool.
+  ///\tparam Block_Size      The size of the blocks taken from the pool. Normally pool_message_parameters::max_size.
+  ///\tparam Block_Alignment The alignment of the blocks taken from the pool. Normally pool_message_parameters::max_alignment.
+  ///\tparam Batch_Size      The number of blocks taken from the pool at a time.
+  //***************************************************************************
+  template <typename TCounter, size_t Block_Size, size_t Block_Alignment, size_t Batch_Size = 8U>
+  class reference_counted_message_pool_cache : public etl::ireference_counted_message_pool
+  {
+  public:
+
+    typedef etl::reference_counted_message_pool<TCounter> pool_type;
+
+    ETL_STATIC_ASSERT(Block_Size >= sizeof(void*), "Block size too small");
+    ETL_STATIC_ASSERT(Batch_Size > 0U, "Batch size must be at least 1");
+
+    /// The number of released blocks above which a batch is returned to the pool.
+    static ETL_CONSTANT size_t High_Water = 2U * Batch_Size;
+
+    //*************************************************************************
+    /// Constructor
+    //*************************************************************************
+    reference_counted_message_pool_cache(pool_type& pool_)
+      : pool(pool_)
+      , p_free(ETL_NULLPTR)
+      , p_returned(ETL_NULLPTR)
+      , returned_count(0U)
+    {
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    /// Returns all cached blocks to the pool.
+    //*************************************************************************
+    ~reference_counted_message_pool_cache()
+    {
+      flush();
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Allocate a reference counted message from the cache.
+    //*************************************************************************
+    template <typename TMessage, typename... TArgs>
+    etl::reference_counted_message<TMessage, TCounter>* allocate(TArgs&&... args)
+    {
+      ETL_STATIC_ASSERT((etl::is_base_of<etl::imessage, TMessage>::value), "Not a message type");
+
+      typedef etl::reference_counted_message<TMessage, TCounter> rcm_t;
+      typedef rcm_t* prcm_t;
+
+      ETL_STATIC_ASSERT(sizeof(rcm_t) <= Block_Size, "Message too large for the cache");
+      ETL_STATIC_ASSERT(etl::alignment_of<rcm_t>::value <= Block_Alignment, "Message has incompatible alignment");
+
+      prcm_t p = static_cast<prcm_t>(allocate_block());
+
+      if (p != ETL_NULLPTR)
+      {
+        ::new(p) rcm_t(*this, etl::forward<TArgs>(args)...);
+      }
+
+      ETL_ASSERT((p != ETL_NULLPTR), ETL_ERROR(etl::reference_counted_message_pool_allocation_failure));
+
+      return p;
+    }
+#endif
+
+    //*************************************************************************
+    /// Allocate a reference counted message from the cache.
+    //*************************************************************************
+    template <typename TMessage>
+    etl::reference_counted_message<TMessage, TCounter>* allocate(const TMessage& message)
+    {
+      ETL_STATIC_ASSERT((etl::is_base_of<etl::imessage, TMessage>::value), "Not a message type");
+
+      typedef etl::reference_counted_message<TMessage, TCounter> rcm_t;
+      typedef rcm_t* prcm_t;
+
+      ETL_STATIC_ASSERT(sizeof(rcm_t) <= Block_Size, "Message too large for the cache");
+      ETL_STATIC_ASSERT(etl::alignment_of<rcm_t>::value <= Block_Alignment, "Message has incompatible alignment");
+
+      prcm_t p = static_cast<prcm_t>(allocate_block());
+
+      if (p != ETL_NULLPTR)
+      {
+        ::new(p) rcm_t(message, *this);
+      }
+
+      ETL_ASSERT((p != ETL_NULLPTR), ETL_ERROR(etl::reference_counted_message_pool_allocation_failure));
+
+      return p;
+    }
+
+    //*************************************************************************
+    /// Allocate a reference counted message from the cache.
+    //*************************************************************************
+    template <typename TMessage>
+    etl::reference_counted_message<TMessage, TCounter>* allocate()
+    {
+      ETL_STATIC_ASSERT((etl::is_base_of<etl::imessage, TMessage>::value), "Not a message type");
+
+      typedef etl::reference_counted_message<TMessage, TCounter> rcm_t;
+      typedef rcm_t* prcm_t;
+
+      ETL_STATIC_ASSERT(sizeof(rcm_t) <= Block_Size, "Message too large for the cache");
+      ETL_STATIC_ASSERT(etl::alignment_of<rcm_t>::value <= Block_Alignment, "Message has incompatible alignment");
+
+      prcm_t p = static_cast<prcm_t>(allocate_block());
+
+      if (p != ETL_NULLPTR)
+      {
+        ::new(p) rcm_t(*this);
+      }
+
+      ETL_ASSERT((p != ETL_NULLPTR), ETL_ERROR(etl::reference_counted_message_pool_allocation_failure));
+
+      return p;
+    }
+
+    //*************************************************************************
+    /// Destruct a message and send it back to the cache.
+    /// May be called from any thread.
+    //*************************************************************************
+    void release(const etl::ireference_counted_message& rcmessage) ETL_OVERRIDE
+    {
+      rcmessage.~ireference_counted_message();
+
+      const uintptr_t address = uintptr_t(&rcmessage);
+      block* p_block = reinterpret_cast<block*>(address);
+
+      // Counted before it is pushed, so the count is never less than the length of the list.
+      const size_t count = returned_count.fetch_add(1U, etl::memory_order_relaxed) + 1U;
+
+      push_returned(p_block, p_block);
+
+      if (count > High_Water)
+      {
+        return_batch();
+      }
+    }
+
+    //*************************************************************************
+    /// Return all of the cached blocks to the pool.
+    /// Must only be called by the owning thread.
+    //*************************************************************************
+    void flush()
+    {
+      collect_returned();
+
+      if (p_free != ETL_NULLPTR)
+      {
+        pool.release_blocks(p_free);
+        p_free = ETL_NULLPTR;
+      }
+    }
+
+  private:
+
+    /// A free block, linked through its first word.
+    struct block
+    {
+      block* p_next;
+    };
+
+    //*************************************************************************
+    /// Take a block from the free list, refilling it if necessary.
+    //*************************************************************************
+    void* allocate_block()
+    {
+      if (p_free == ETL_NULLPTR)
+      {
+        p_free = p_returned.exchange(ETL_NULLPTR, etl::memory_order_acquire);
+
+        if (p_free == ETL_NULLPTR)
+        {
+          p_free = static_cast<block*>(pool.allocate_blocks(Batch_Size, Block_Size, Block_Alignment));
+        }
+        else
+        {
+          size_t n = 0U;
+
+          for (block* p_block = p_free; p_block != ETL_NULLPTR; p_block = p_block->p_next)
+          {
+            ++n;
+          }
+
+          returned_count.fetch_sub(n, etl::memory_order_relaxed);
+        }
+      }
+
+      block* p_block = p_free;
+
+      if (p_block != ETL_NULLPTR)
+      {
+        p_free = p_block->p_next;
+      }
+
+      return p_block;
+    }
+
+    //*************************************************************************
+    /// Move the released blocks on to the free list.
+    //*************************************************************************
+    void collect_returned()
+    {
+      block* p_head = p_returned.exchange(ETL_NULLPTR, etl::memory_order_acquire);
+      size_t n = 0U;
+
+      while (p_head != ETL_NULLPTR)
+      {
+        block* p_next = p_head->p_next;
+        p_head->p_next = p_free;
+        p_free = p_head;
+        p_head = p_next;
+        ++n;
+      }
+
+      returned_count.fetch_sub(n, etl::memory_order_relaxed);
+    }
+
+    //*************************************************************************
+    /// Push a list of blocks on to the released list.
+    /// May be called from any thread.
+    //*************************************************************************
+    void push_returned(block* p_first, block* p_last)
+    {
+      block* p_head = p_returned.load(etl::memory_order_relaxed);
+
+      do
+      {
+        p_last->p_next = p_head;
+      } while (!p_returned.compare_exchange_weak(p_head, p_first, etl::memory_order_release, etl::memory_order_relaxed));
+    }
+
+    //*************************************************************************
+    /// Return up to Batch_Size of the released blocks to the pool under a
+    /// single lock, and put the rest back on the released list.
+    /// May be called from any thread.
+    //*************************************************************************
+    void return_batch()
+    {
+      block* p_head = p_returned.exchange(ETL_NULLPTR, etl::memory_order_acquire);
+
+      if (p_head == ETL_NULLPTR)
+      {
+        return;
+      }
+
+      // Split off the batch.
+      block* p_last = p_head;
+      size_t n      = 1U;
+
+      while ((n < Batch_Size) && (p_last->p_next != ETL_NULLPTR))
+      {
+        p_last = p_last->p_next;
+        ++n;
+      }
+
+      block* p_rest = p_last->p_next;
+      p_last->p_next = ETL_NULLPTR;
+
+      returned_count.fetch_sub(n, etl::memory_order_relaxed);
+      pool.release_blocks(p_head);
+
+      if (p_rest != ETL_NULLPTR)
+      {
+        p_last = p_rest;
+
+        while (p_last->p_next != ETL_NULLPTR)
+        {
+          p_last = p_last->p_next;
+        }
+
+        push_returned(p_rest, p_last);
+      }
+    }
+
+    pool_type&           pool;           ///< The shared pool.
+    block*               p_free;         ///< The blocks available to the owning thread.
+    etl::atomic<block*>  p_returned;     ///< The blocks released since the last refill.
+    etl::atomic<size_t>  returned_count; ///< The number of blocks on, or being pushed on to, the released list.
+
+    // Should not be copied.
+    reference_counted_message_pool_cache(const reference_counted_message_pool_cache&) ETL_DELETE;
+    reference_counted_message_pool_cache& operator =(const reference_counted_message_pool_cache&) ETL_DELETE;
+  };
+
+  template <typename TCounter, size_t Block_Size, size_t Block_Alignment, size_t Batch_Size>
+  ETL_CONSTANT size_t reference_counted_message_pool_cache<TCounter, Block_Size, Block_Alignment, Batch_Size>::High_Water;
+#endif
+
+#if ETL_USING_CPP11 && ETL_HAS_ATOMIC
+  template <size_t Block_Size, size_t Block_Alignment, size_t Batch_Size = 8U>
+  using atomic_counted_message_pool_cache = reference_counted_message_pool_cache<etl::atomic_int, Block_Size, Block_Alignment, Batch_Size>;
+#endif
 }
 
 #endif
\ No newline at end of file
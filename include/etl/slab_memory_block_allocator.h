@@ -0,0 +1,410 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_SLAB_MEMORY_BLOCK_ALLOCATOR_INCLUDED
+#define ETL_SLAB_MEMORY_BLOCK_ALLOCATOR_INCLUDED
+
+#include "platform.h"
+#include "imemory_block_allocator.h"
+#include "alignment.h"
+#include "bit.h"
+#include "log.h"
+#include "power.h"
+#include "static_assert.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace etl
+{
+  //*************************************************************************
+  /// The interface for slab memory block allocators.
+  /// The allocator has a number of size classes, each with its own free list.
+  /// The block size of each class is double that of the one before.
+  /// A request is served from the smallest class that fits. If that class is
+  /// full then the next larger class with a free block is used.
+  /// The classes are laid out one after the other in a single buffer, so
+  /// ownership and the class of a released block are found from its address.
+  //*************************************************************************
+  class islab_memory_block_allocator : public imemory_block_allocator
+  {
+  public:
+
+    //*************************************************************************
+    /// The number of size classes.
+    //*************************************************************************
+    size_t number_of_classes() const
+    {
+      return Number_Of_Classes;
+    }
+
+    //*************************************************************************
+    /// The size class that serves blocks of the required size.
+    /// Returns number_of_classes() if the size is larger than the largest block.
+    //*************************************************************************
+    size_t class_index(size_t required_size) const
+    {
+      if (required_size <= Min_Block_Size)
+      {
+        return 0U;
+      }
+
+      const size_t index = size_t(etl::bit_width(size_t(required_size - 1U))) - Min_Block_Shift;
+
+      return (index < Number_Of_Classes) ? index : Number_Of_Classes;
+    }
+
+    //*************************************************************************
+    /// The size of the blocks in a class.
+    //*************************************************************************
+    size_t block_size(size_t index) const
+    {
+      return Min_Block_Size << index;
+    }
+
+    //*************************************************************************
+    /// The number of blocks in a class.
+    //*************************************************************************
+    size_t max_size(size_t index) const
+    {
+      (void)index;
+      return Blocks_Per_Class;
+    }
+
+    //*************************************************************************
+    /// The number of allocated blocks in a class.
+    //*************************************************************************
+    size_t size(size_t index) const
+    {
+      return p_slabs[index].allocated;
+    }
+
+    //*************************************************************************
+    /// The number of free blocks in a class.
+    //*************************************************************************
+    size_t available(size_t index) const
+    {
+      return Blocks_Per_Class - p_slabs[index].allocated;
+    }
+
+    //*************************************************************************
+    /// The largest number of blocks that have been allocated from a class at one time.
+    //*************************************************************************
+    size_t peak_size(size_t index) const
+    {
+      return p_slabs[index].peak;
+    }
+
+    //*************************************************************************
+    /// The total number of blocks in all classes.
+    //*************************************************************************
+    size_t max_size() const
+    {
+      return Blocks_Per_Class * Number_Of_Classes;
+    }
+
+    //*************************************************************************
+    /// The total number of allocated blocks in all classes.
+    //*************************************************************************
+    size_t size() const
+    {
+      size_t total = 0U;
+
+      for (size_t i = 0U; i < Number_Of_Classes; ++i)
+      {
+        total += p_slabs[i].allocated;
+      }
+
+      return total;
+    }
+
+    //*************************************************************************
+    /// Checks to see if there are no allocated blocks.
+    //*************************************************************************
+    bool empty() const
+    {
+      return size() == 0U;
+    }
+
+    //*************************************************************************
+    /// Resets the peak statistics to the current number of allocated blocks.
+    //*************************************************************************
+    void reset_peak_size()
+    {
+      for (size_t i = 0U; i < Number_Of_Classes; ++i)
+      {
+        p_slabs[i].peak = p_slabs[i].allocated;
+      }
+    }
+
+  protected:
+
+    /// The state of one size class.
+    struct slab
+    {
+      char*    p_next;      ///< The next free block.
+      uint32_t allocated;   ///< The number of blocks allocated.
+      uint32_t initialised; ///< The number of blocks that have been linked into the free list.
+      uint32_t peak;        ///< The largest value of 'allocated'.
+    };
+
+    //*************************************************************************
+    /// Constructor
+    //*************************************************************************
+    islab_memory_block_allocator(char*  p_buffer_,
+                                 slab*  p_slabs_,
+                                 size_t number_of_classes_,
+                                 size_t min_block_size_,
+                                 size_t min_block_shift_,
+                                 size_t blocks_per_class_,
+                                 size_t alignment_)
+      : p_buffer(p_buffer_)
+      , p_slabs(p_slabs_)
+      , Number_Of_Classes(number_of_classes_)
+      , Min_Block_Size(min_block_size_)
+      , Min_Block_Shift(min_block_shift_)
+      , Blocks_Per_Class(blocks_per_class_)
+      , Alignment(alignment_)
+      , Slab_Unit(blocks_per_class_ * min_block_size_)
+    {
+      for (size_t i = 0U; i < Number_Of_Classes; ++i)
+      {
+        p_slabs[i].p_next      = slab_begin(i);
+        p_slabs[i].allocated   = 0U;
+        p_slabs[i].initialised = 0U;
+        p_slabs[i].peak        = 0U;
+      }
+    }
+
+    //*************************************************************************
+    /// The overridden virtual function to allocate a block.
+    //*************************************************************************
+    virtual void* allocate_block(size_t required_size, size_t required_alignment) ETL_OVERRIDE
+    {
+      if (required_alignment <= Alignment)
+      {
+        for (size_t i = class_index(required_size); i < Number_Of_Classes; ++i)
+        {
+          if (p_slabs[i].allocated < Blocks_Per_Class)
+          {
+            return allocate_from(i);
+          }
+        }
+      }
+
+      return ETL_NULLPTR;
+    }
+
+    //*************************************************************************
+    /// The overridden virtual function to release a block.
+    //*************************************************************************
+    virtual bool release_block(const void* const pblock) ETL_OVERRIDE
+    {
+      if (!is_owner_of_block(pblock))
+      {
+        return false;
+      }
+
+      const char*  p      = static_cast<const char*>(pblock);
+      const size_t offset = size_t(p - p_buffer);
+
+      // Class i ends at Slab_Unit * (2^(i + 1) - 1).
+      // There are few classes, so comparing is cheaper than dividing.
+      size_t index = 0U;
+      size_t end   = Slab_Unit;
+
+      while (offset >= end)
+      {
+        ++index;
+        end = (end * 2U) + Slab_Unit;
+      }
+
+      slab& s = p_slabs[index];
+
+      // Modulus and division can be slow on some architectures, so only do this in debug.
+#if ETL_IS_DEBUG_BUILD
+      // Is the address on a valid block boundary?
+      if ((size_t(p - slab_begin(index)) % block_size(index)) != 0U)
+      {
+        return false;
+      }
+#endif
+
+      if (s.allocated == 0U)
+      {
+        return false;
+      }
+
+      // Recover a non-const pointer to the block.
+      char* p_value = p_buffer + offset;
+
+      *reinterpret_cast<char**>(p_value) = s.p_next;
+      s.p_next = p_value;
+      --s.allocated;
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Returns true if the allocator is the owner of the block.
+    //*************************************************************************
+    virtual bool is_owner_of_block(const void* const pblock) const ETL_OVERRIDE
+    {
+      const char* p = static_cast<const char*>(pblock);
+
+      return (p >= p_buffer) && (p < (p_buffer + buffer_size()));
+    }
+
+  private:
+
+    //*************************************************************************
+    /// The start of a class in the buffer.
+    //*************************************************************************
+    char* slab_begin(size_t index) const
+    {
+      return p_buffer + (Slab_Unit * ((size_t(1U) << index) - 1U));
+    }
+
+    //*************************************************************************
+    /// The size of the buffer.
+    //*************************************************************************
+    size_t buffer_size() const
+    {
+      return Slab_Unit * ((size_t(1U) << Number_Of_Classes) - 1U);
+    }
+
+    //*************************************************************************
+    /// Allocate a block from a class that is known not to be full.
+    //*************************************************************************
+    char* allocate_from(size_t index)
+    {
+      slab&        s      = p_slabs[index];
+      const size_t stride = block_size(index);
+
+      // Initialise another one if necessary.
+      if (s.initialised < Blocks_Per_Class)
+      {
+        char* p = slab_begin(index) + (s.initialised * stride);
+        *reinterpret_cast<char**>(p) = p + stride;
+        ++s.initialised;
+      }
+
+      char* p_value = s.p_next;
+
+      ++s.allocated;
+
+      if (s.allocated > s.peak)
+      {
+        s.peak = s.allocated;
+      }
+
+      s.p_next = (s.allocated < Blocks_Per_Class) ? *reinterpret_cast<char**>(p_value) : ETL_NULLPTR;
+
+      return p_value;
+    }
+
+    char* const  p_buffer;          ///< The storage for all of the classes.
+    slab* const  p_slabs;           ///< The state of each class.
+    const size_t Number_Of_Classes; ///< The number of size classes.
+    const size_t Min_Block_Size;    ///< The block size of the smallest class.
+    const size_t Min_Block_Shift;   ///< log2(Min_Block_Size).
+    const size_t Blocks_Per_Class;  ///< The number of blocks in each class.
+    const size_t Alignment;         ///< The alignment of every block.
+    const size_t Slab_Unit;         ///< The size of the smallest class.
+  };
+
+  //*************************************************************************
+  /// A slab memory block allocator with power of two size classes.
+  ///\tparam VMin_Block_Size    The block size of the smallest class. A power of 2.
+  ///\tparam VAlignment         The alignment of every block. A power of 2, no larger than VMin_Block_Size.
+  ///\tparam VNumber_Of_Classes The number of size classes. The largest block is VMin_Block_Size * 2^(VNumber_Of_Classes - 1).
+  ///\tparam VBlocks_Per_Class  The number of blocks in each class.
+  //*************************************************************************
+  template <size_t VMin_Block_Size, size_t VAlignment, size_t VNumber_Of_Classes, size_t VBlocks_Per_Class>
+  class slab_memory_block_allocator : public islab_memory_block_allocator
+  {
+  public:
+
+    static ETL_CONSTANT size_t Min_Block_Size    = VMin_Block_Size;
+    static ETL_CONSTANT size_t Max_Block_Size    = VMin_Block_Size << (VNumber_Of_Classes - 1U);
+    static ETL_CONSTANT size_t Alignment         = VAlignment;
+    static ETL_CONSTANT size_t Number_Of_Classes = VNumber_Of_Classes;
+    static ETL_CONSTANT size_t Blocks_Per_Class  = VBlocks_Per_Class;
+
+    ETL_STATIC_ASSERT(etl::is_power_of_2<VMin_Block_Size>::value, "Minimum block size must be a power of 2");
+    ETL_STATIC_ASSERT((VAlignment != 0U) && ((VAlignment & (VAlignment - 1U)) == 0U), "Alignment must be a power of 2");
+    ETL_STATIC_ASSERT(VAlignment <= VMin_Block_Size, "Alignment must not be larger than the minimum block size");
+    ETL_STATIC_ASSERT(VMin_Block_Size >= sizeof(char*), "Minimum block size must hold a pointer");
+    ETL_STATIC_ASSERT((VNumber_Of_Classes > 0U) && (VNumber_Of_Classes < (sizeof(size_t) * 8U)), "Invalid number of classes");
+    ETL_STATIC_ASSERT(VBlocks_Per_Class > 0U, "There must be at least one block per class");
+
+    //*************************************************************************
+    /// Default constructor
+    //*************************************************************************
+    slab_memory_block_allocator()
+      : islab_memory_block_allocator(reinterpret_cast<char*>(&buffer), slabs, VNumber_Of_Classes, VMin_Block_Size, etl::log2<VMin_Block_Size>::value, VBlocks_Per_Class, VAlignment)
+    {
+    }
+
+  private:
+
+    static ETL_CONSTANT size_t Buffer_Size = VBlocks_Per_Class * VMin_Block_Size * ((size_t(1U) << VNumber_Of_Classes) - 1U);
+
+    // The free list links are stored in the blocks, so the buffer is at least pointer aligned.
+    static ETL_CONSTANT size_t Buffer_Alignment = (etl::alignment_of<char*>::value > VAlignment) ? etl::alignment_of<char*>::value : VAlignment;
+
+    /// The state of each class.
+    slab slabs[VNumber_Of_Classes];
+
+    /// The storage for all of the classes.
+    typename etl::aligned_storage<Buffer_Size, Buffer_Alignment>::type buffer;
+
+    // Should not be copied.
+    slab_memory_block_allocator(const slab_memory_block_allocator&) ETL_DELETE;
+    slab_memory_block_allocator& operator =(const slab_memory_block_allocator&) ETL_DELETE;
+  };
+
+  template <size_t VMin_Block_Size, size_t VAlignment, size_t VNumber_Of_Classes, size_t VBlocks_Per_Class>
+  ETL_CONSTANT size_t slab_memory_block_allocator<VMin_Block_Size, VAlignment, VNumber_Of_Classes, VBlocks_Per_Class>::Min_Block_Size;
+
+  template <size_t VMin_Block_Size, size_t VAlignment, size_t VNumber_Of_Classes, size_t VBlocks_Per_Class>
+  ETL_CONSTANT size_t slab_memory_block_allocator<VMin_Block_Size, VAlignment, VNumber_Of_Classes, VBlocks_Per_Class>::Max_Block_Size;
+
+  template <size_t VMin_Block_Size, size_t VAlignment, size_t VNumber_Of_Classes, size_t VBlocks_Per_Class>
+  ETL_CONSTANT size_t slab_memory_block_allocator<VMin_Block_Size, VAlignment, VNumber_Of_Classes, VBlocks_Per_Class>::Alignment;
+
+  template <size_t VMin_Block_Size, size_t VAlignment, size_t VNumber_Of_Classes, size_t VBlocks_Per_Class>
+  ETL_CONSTANT size_t slab_memory_block_allocator<VMin_Block_Size, VAlignment, VNumber_Of_Classes, VBlocks_Per_Class>::Number_Of_Classes;
+
+  template <size_t VMin_Block_Size, size_t VAlignment, size_t VNumber_Of_Classes, size_t VBlocks_Per_Class>
+  ETL_CONSTANT size_t slab_memory_block_allocator<VMin_Block_Size, VAlignment, VNumber_Of_Classes, VBlocks_Per_Class>::Blocks_Per_Class;
+}
+
+#endif
@@ -1234,6 +1234,29 @@ namespace etl
     return true;
   }
 
+  //*************************************************************************
+  /// Stable sort, using the span as a scratch buffer.
+  /// Does not allocate. A buffer of at least half the range length gives
+  /// the fastest sort. Any smaller buffer, including an empty one, is valid.
+  ///\param first  Start of the range to sort
+  ///\param last   End of the range to sort
+  ///\param buffer The scratch buffer
+  //*************************************************************************
+  template <typename TIterator, typename T, size_t N, typename TCompare>
+  void stable_sort(TIterator first, TIterator last, const etl::span<T, N>& buffer, TCompare compare)
+  {
+    etl::merge_sort(first, last, buffer.begin(), buffer.end(), compare);
+  }
+
+  //*************************************************************************
+  /// Stable sort, using the span as a scratch buffer.
+  //*************************************************************************
+  template <typename TIterator, typename T, size_t N>
+  void stable_sort(TIterator first, TIterator last, const etl::span<T, N>& buffer)
+  {
+    etl::merge_sort(first, last, buffer.begin(), buffer.end(), etl::less<typename etl::iterator_traits<TIterator>::value_type>());
+  }
+
   //*************************************************************************
   /// Template deduction guides.
   //*************************************************************************
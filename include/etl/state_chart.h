@@ -30,23 +30,54 @@ SOFTWARE.
 #define ETL_STATE_CHART_INCLUDED
 
 #include "platform.h"
+#include "algorithm.h"
 #include "nullptr.h"
 #include "array.h"
 #include "array_view.h"
 #include "utility.h"
+#include "integral_limits.h"
+#include "error_handler.h"
+#include "exception.h"
 
 #include <stdint.h>
 
 namespace etl
 {
+  //***************************************************************************
+  /// Base exception class for state chart.
+  //***************************************************************************
+  class state_chart_exception : public etl::exception
+  {
+  public:
+
+    state_chart_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : etl::exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The index buffer is too small for the tables.
+  //***************************************************************************
+  class state_chart_index_size : public etl::state_chart_exception
+  {
+  public:
+
+    state_chart_index_size(string_type file_name_, numeric_type line_number_)
+      : state_chart_exception(ETL_ERROR_TEXT("state_chart:index size", ETL_STATE_CHART_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
   //***************************************************************************
   /// Simple Finite State Machine Types
   //***************************************************************************
   
   namespace state_chart_traits
   {
-    typedef uint_least8_t state_id_t;
-    typedef uint_least8_t event_id_t;
+    typedef uint_least8_t  state_id_t;
+    typedef uint_least8_t  event_id_t;
+    typedef uint_least16_t index_t;
 
     //*************************************************************************
     /// Transition definition
@@ -152,6 +183,250 @@ namespace etl
     };
   }
 
+  namespace private_state_chart
+  {
+    //*************************************************************************
+    /// Sorted index of a transition table.
+    /// Entries are ordered by 'from any state', event id, state id and then
+    /// table position, so a binary search finds the first transition in
+    /// table order that matches an event and state.
+    //*************************************************************************
+    template <typename TTransition>
+    class transition_index
+    {
+    public:
+
+      typedef state_chart_traits::state_id_t state_id_t;
+      typedef state_chart_traits::event_id_t event_id_t;
+      typedef state_chart_traits::index_t    index_t;
+
+      //*******************************************
+      /// Sorts the index for the table.
+      //*******************************************
+      static void build(const TTransition* table, size_t size, index_t* index)
+      {
+        for (size_t i = 0U; i < size; ++i)
+        {
+          index[i] = index_t(i);
+        }
+
+        etl::sort(index, index + size, compare_position(table));
+      }
+
+      //*******************************************
+      /// Finds the first matching transition at or after 'from'.
+      //*******************************************
+      static const TTransition* find(const TTransition* table,
+                                     size_t             size,
+                                     const index_t*     index,
+                                     const TTransition* from,
+                                     event_id_t         event_id,
+                                     state_id_t         state_id)
+      {
+        const size_t position = size_t(from - table);
+
+        // The first transition from this state.
+        size_t first = find_first(table, size, index, key(false, event_id, state_id, position));
+
+        // The first transition from any state.
+        const size_t first_any = find_first(table, size, index, key(true, event_id, 0U, position));
+
+        if (first_any < first)
+        {
+          first = first_any;
+        }
+
+        return table + first;
+      }
+
+    private:
+
+      //*******************************************
+      struct key
+      {
+        key(bool from_any_state_, event_id_t event_id_, state_id_t state_id_, size_t position_)
+          : from_any_state(from_any_state_)
+          , event_id(event_id_)
+          , state_id(state_id_)
+          , position(position_)
+        {
+        }
+
+        key(const TTransition& t, size_t position_)
+          : from_any_state(t.from_any_state)
+          , event_id(t.event_id)
+          , state_id(t.from_any_state ? state_id_t(0U) : t.current_state_id)
+          , position(position_)
+        {
+        }
+
+        //*****************************************
+        /// Same transition group, ignoring position.
+        //*****************************************
+        bool matches(const key& other) const
+        {
+          return (from_any_state == other.from_any_state) &&
+                 (event_id       == other.event_id) &&
+                 (state_id       == other.state_id);
+        }
+
+        //*****************************************
+        friend bool operator <(const key& lhs, const key& rhs)
+        {
+          if (lhs.from_any_state != rhs.from_any_state)
+          {
+            return rhs.from_any_state;
+          }
+
+          if (lhs.event_id != rhs.event_id)
+          {
+            return lhs.event_id < rhs.event_id;
+          }
+
+          if (lhs.state_id != rhs.state_id)
+          {
+            return lhs.state_id < rhs.state_id;
+          }
+
+          return lhs.position < rhs.position;
+        }
+
+        bool       from_any_state;
+        event_id_t event_id;
+        state_id_t state_id;
+        size_t     position;
+      };
+
+      //*******************************************
+      struct compare_position
+      {
+        compare_position(const TTransition* table_)
+          : table(table_)
+        {
+        }
+
+        bool operator()(index_t lhs, index_t rhs) const
+        {
+          return key(table[lhs], lhs) < key(table[rhs], rhs);
+        }
+
+        const TTransition* table;
+      };
+
+      //*******************************************
+      struct compare_key
+      {
+        compare_key(const TTransition* table_)
+          : table(table_)
+        {
+        }
+
+        bool operator()(index_t lhs, const key& rhs) const
+        {
+          return key(table[lhs], lhs) < rhs;
+        }
+
+        const TTransition* table;
+      };
+
+      //*******************************************
+      /// The position of the first transition in the group of 'k' at or after
+      /// its position, or 'size' if there is none.
+      //*******************************************
+      static size_t find_first(const TTransition* table, size_t size, const index_t* index, const key& k)
+      {
+        const index_t* itr = etl::lower_bound(index, index + size, k, compare_key(table));
+
+        if ((itr != (index + size)) && key(table[*itr], *itr).matches(k))
+        {
+          return *itr;
+        }
+        else
+        {
+          return size;
+        }
+      }
+    };
+
+    //*************************************************************************
+    /// Sorted index of a state table.
+    /// Entries are ordered by state id and then table position.
+    //*************************************************************************
+    template <typename TState>
+    class state_index
+    {
+    public:
+
+      typedef state_chart_traits::state_id_t state_id_t;
+      typedef state_chart_traits::index_t    index_t;
+
+      //*******************************************
+      /// Sorts the index for the table.
+      //*******************************************
+      static void build(const TState* table, size_t size, index_t* index)
+      {
+        for (size_t i = 0U; i < size; ++i)
+        {
+          index[i] = index_t(i);
+        }
+
+        etl::sort(index, index + size, compare_position(table));
+      }
+
+      //*******************************************
+      /// Finds the first state in table order with the id.
+      //*******************************************
+      static const TState* find(const TState* table, size_t size, const index_t* index, state_id_t state_id)
+      {
+        const index_t* itr = etl::lower_bound(index, index + size, state_id, compare_id(table));
+
+        if ((itr != (index + size)) && (table[*itr].state_id == state_id))
+        {
+          return table + *itr;
+        }
+        else
+        {
+          return table + size;
+        }
+      }
+
+    private:
+
+      //*******************************************
+      struct compare_position
+      {
+        compare_position(const TState* table_)
+          : table(table_)
+        {
+        }
+
+        bool operator()(index_t lhs, index_t rhs) const
+        {
+          return (table[lhs].state_id < table[rhs].state_id) ||
+                 ((table[lhs].state_id == table[rhs].state_id) && (lhs < rhs));
+        }
+
+        const TState* table;
+      };
+
+      //*******************************************
+      struct compare_id
+      {
+        compare_id(const TState* table_)
+          : table(table_)
+        {
+        }
+
+        bool operator()(index_t lhs, state_id_t rhs) const
+        {
+          return table[lhs].state_id < rhs;
+        }
+
+        const TState* table;
+      };
+    };
+  }
+
   //***************************************************************************
   /// For non-void parameter types
   //***************************************************************************
@@ -626,6 +901,7 @@ namespace etl
     typedef state_chart_traits::event_id_t event_id_t;
     typedef state_chart_traits::transition<TObject, parameter_t> transition;
     typedef state_chart_traits::state<TObject> state;
+    typedef state_chart_traits::index_t index_t;
 
     //*************************************************************************
     /// Constructor.
@@ -648,6 +924,8 @@ namespace etl
       , state_table_begin(state_table_begin_)
       , transition_table_size(transition_table_end_ - transition_table_begin_)
       , state_table_size(state_table_end_ - state_table_begin_)
+      , index_begin(ETL_NULLPTR)
+      , index_size(0U)
       , started(false)
     {
     }
@@ -662,6 +940,8 @@ namespace etl
     {
       transition_table_begin = transition_table_begin_;
       transition_table_size = transition_table_end_ - transition_table_begin_;
+
+      rebuild_index();
     }
 
     //*************************************************************************
@@ -674,6 +954,42 @@ namespace etl
     {
       state_table_begin = state_table_begin_;
       state_table_size = state_table_end_ - state_table_begin_;
+
+      rebuild_index();
+    }
+
+    //*************************************************************************
+    /// Sets a buffer for an index of the transition and state tables.
+    /// The linear searches of the tables are replaced by binary searches.
+    /// The buffer must have space for the sum of the transition and state
+    /// table sizes and is rebuilt whenever a table is set.
+    /// Charts with only a few transitions may be faster without an index.
+    /// \param index_begin_ The start of the index buffer.
+    /// \param index_end_   The end of the index buffer.
+    //*************************************************************************
+    void set_index(index_t* index_begin_, index_t* index_end_)
+    {
+      index_begin = index_begin_;
+      index_size  = index_end_ - index_begin_;
+
+      rebuild_index();
+    }
+
+    //*************************************************************************
+    /// Removes the index and returns to linear searches of the tables.
+    //*************************************************************************
+    void clear_index()
+    {
+      index_begin = ETL_NULLPTR;
+      index_size  = 0U;
+    }
+
+    //*************************************************************************
+    /// Returns <b>true</b> if the tables are indexed.
+    //*************************************************************************
+    bool has_index() const
+    {
+      return index_begin != ETL_NULLPTR;
     }
 
     //*************************************************************************
@@ -733,7 +1049,7 @@ namespace etl
         while (t != transition_table_end())
         {
           // Scan the transition table from the latest position.
-          t = etl::find_if(t, transition_table_end(), is_transition(event_id, this->current_state_id));
+          t = find_transition(t, event_id);
 
           // Found an entry?
           if (t != transition_table_end())
@@ -801,12 +1117,65 @@ namespace etl
       {
         return state_table_end();
       }
+      else if (has_index())
+      {
+        return private_state_chart::state_index<state>::find(state_table_begin, state_table_size, state_index_begin(), state_id);
+      }
       else
       {
         return etl::find_if(state_table_begin, state_table_end(), is_state(state_id));
       }
     }
 
+    //*************************************************************************
+    /// Finds the next transition for the event and current state, starting at 't'.
+    //*************************************************************************
+    const transition* find_transition(const transition* t, event_id_t event_id) const
+    {
+      if (has_index())
+      {
+        return private_state_chart::transition_index<transition>::find(transition_table_begin, transition_table_size, index_begin, t, event_id, this->current_state_id);
+      }
+      else
+      {
+        return etl::find_if(t, transition_table_end(), is_transition(event_id, this->current_state_id));
+      }
+    }
+
+    //*************************************************************************
+    /// Sorts the index for the current tables.
+    /// The index is removed if the buffer is too small.
+    //*************************************************************************
+    void rebuild_index()
+    {
+      if (has_index())
+      {
+        const bool fits = ((transition_table_size + state_table_size) <= index_size) &&
+                          (transition_table_size <= etl::integral_limits<index_t>::max) &&
+                          (state_table_size <= etl::integral_limits<index_t>::max);
+
+        if (!fits)
+        {
+          clear_index();
+        }
+
+        ETL_ASSERT_OR_RETURN(fits, ETL_ERROR(etl::state_chart_index_size));
+
+        private_state_chart::transition_index<transition>::build(transition_table_begin, transition_table_size, index_begin);
+
+        if (state_table_begin != ETL_NULLPTR)
+        {
+          private_state_chart::state_index<state>::build(state_table_begin, state_table_size, state_index_begin());
+        }
+      }
+    }
+
+    //*************************************************************************
+    index_t* state_index_begin() const
+    {
+      return index_begin + transition_table_size;
+    }
+
     //*************************************************************************
     const transition* transition_table_end() const
     {
@@ -860,8 +1229,10 @@ namespace etl
     TObject&          object;                 ///< The object that supplies guard and action member functions.
     const transition* transition_table_begin; ///< The start of the table of transitions.
     const state*      state_table_begin;      ///< The start of the table of states.
-    uint_least8_t     transition_table_size;  ///< The size of the table of transitions.
-    uint_least8_t     state_table_size;       ///< The size of the table of states.
+    size_t            transition_table_size;  ///< The size of the table of transitions.
+    size_t            state_table_size;       ///< The size of the table of states.
+    index_t*          index_begin;            ///< The start of the index buffer, or null if not indexed.
+    size_t            index_size;             ///< The size of the index buffer.
     bool              started;                ///< Set if the state chart has been started.
   };
 
@@ -880,6 +1251,7 @@ namespace etl
     typedef state_chart_traits::event_id_t event_id_t;
     typedef state_chart_traits::transition<TObject, void> transition;
     typedef state_chart_traits::state<TObject> state;
+    typedef state_chart_traits::index_t index_t;
 
     //*************************************************************************
     /// Constructor.
@@ -902,6 +1274,8 @@ namespace etl
       , state_table_begin(state_table_begin_)
       , transition_table_size(transition_table_end_ - transition_table_begin_)
       , state_table_size(state_table_end_ - state_table_begin_)
+      , index_begin(ETL_NULLPTR)
+      , index_size(0U)
       , started(false)
     {
     }
@@ -916,6 +1290,8 @@ namespace etl
     {
       transition_table_begin = transition_table_begin_;
       transition_table_size  = transition_table_end_ - transition_table_begin_;
+
+      rebuild_index();
     }
 
     //*************************************************************************
@@ -928,6 +1304,42 @@ namespace etl
     {
       state_table_begin = state_table_begin_;
       state_table_size  = state_table_end_ - state_table_begin_;
+
+      rebuild_index();
+    }
+
+    //*************************************************************************
+    /// Sets a buffer for an index of the transition and state tables.
+    /// The linear searches of the tables are replaced by binary searches.
+    /// The buffer must have space for the sum of the transition and state
+    /// table sizes and is rebuilt whenever a table is set.
+    /// Charts with only a few transitions may be faster without an index.
+    /// \param index_begin_ The start of the index buffer.
+    /// \param index_end_   The end of the index buffer.
+    //*************************************************************************
+    void set_index(index_t* index_begin_, index_t* index_end_)
+    {
+      index_begin = index_begin_;
+      index_size  = index_end_ - index_begin_;
+
+      rebuild_index();
+    }
+
+    //*************************************************************************
+    /// Removes the index and returns to linear searches of the tables.
+    //*************************************************************************
+    void clear_index()
+    {
+      index_begin = ETL_NULLPTR;
+      index_size  = 0U;
+    }
+
+    //*************************************************************************
+    /// Returns <b>true</b> if the tables are indexed.
+    //*************************************************************************
+    bool has_index() const
+    {
+      return index_begin != ETL_NULLPTR;
     }
 
     //*************************************************************************
@@ -987,7 +1399,7 @@ namespace etl
         while (t != transition_table_end())
         {
           // Scan the transition table from the latest position.
-          t = etl::find_if(t, transition_table_end(), is_transition(event_id, this->current_state_id));
+          t = find_transition(t, event_id);
 
           // Found an entry?
           if (t != transition_table_end())
@@ -1051,12 +1463,65 @@ namespace etl
       {
         return state_table_end();
       }
+      else if (has_index())
+      {
+        return private_state_chart::state_index<state>::find(state_table_begin, state_table_size, state_index_begin(), state_id);
+      }
       else
       {
         return etl::find_if(state_table_begin, state_table_end(), is_state(state_id));
       }
     }
 
+    //*************************************************************************
+    /// Finds the next transition for the event and current state, starting at 't'.
+    //*************************************************************************
+    const transition* find_transition(const transition* t, event_id_t event_id) const
+    {
+      if (has_index())
+      {
+        return private_state_chart::transition_index<transition>::find(transition_table_begin, transition_table_size, index_begin, t, event_id, this->current_state_id);
+      }
+      else
+      {
+        return etl::find_if(t, transition_table_end(), is_transition(event_id, this->current_state_id));
+      }
+    }
+
+    //*************************************************************************
+    /// Sorts the index for the current tables.
+    /// The index is removed if the buffer is too small.
+    //*************************************************************************
+    void rebuild_index()
+    {
+      if (has_index())
+      {
+        const bool fits = ((transition_table_size + state_table_size) <= index_size) &&
+                          (transition_table_size <= etl::integral_limits<index_t>::max) &&
+                          (state_table_size <= etl::integral_limits<index_t>::max);
+
+        if (!fits)
+        {
+          clear_index();
+        }
+
+        ETL_ASSERT_OR_RETURN(fits, ETL_ERROR(etl::state_chart_index_size));
+
+        private_state_chart::transition_index<transition>::build(transition_table_begin, transition_table_size, index_begin);
+
+        if (state_table_begin != ETL_NULLPTR)
+        {
+          private_state_chart::state_index<state>::build(state_table_begin, state_table_size, state_index_begin());
+        }
+      }
+    }
+
+    //*************************************************************************
+    index_t* state_index_begin() const
+    {
+      return index_begin + transition_table_size;
+    }
+
     //*************************************************************************
     const transition* transition_table_end() const
     {
@@ -1110,8 +1575,10 @@ namespace etl
     TObject&          object;                 ///< The object that supplies guard and action member functions.
     const transition* transition_table_begin; ///< The start of the table of transitions.
     const state*      state_table_begin;      ///< The start of the table of states.
-    uint_least8_t     transition_table_size;  ///< The size of the table of transitions.
-    uint_least8_t     state_table_size;       ///< The size of the table of states.
+    size_t            transition_table_size;  ///< The size of the table of transitions.
+    size_t            state_table_size;       ///< The size of the table of states.
+    index_t*          index_begin;            ///< The start of the index buffer, or null if not indexed.
+    size_t            index_size;             ///< The size of the index buffer.
     bool              started;                ///< Set if the state chart has been started.
   };
 }
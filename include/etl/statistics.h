@@ -0,0 +1,631 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_STATISTICS_INCLUDED
+#define ETL_STATISTICS_INCLUDED
+
+#include "platform.h"
+#include "functional.h"
+#include "type_traits.h"
+#include "static_assert.h"
+#include "span.h"
+
+#include <math.h>
+#include <stddef.h>
+
+///\defgroup statistics statistics
+/// Single pass mean, variance, standard deviation, rms, covariance and
+/// correlation, using Welford's updates.
+/// Partial results, such as those from other threads, may be combined.
+///\ingroup maths
+
+namespace etl
+{
+  namespace private_statistics
+  {
+    //***************************************************************************
+    /// Statistics Type.
+    //***************************************************************************
+    template<typename T = void>
+    struct statistics_type_statics
+    {
+      static ETL_CONSTANT bool Sample     = false;
+      static ETL_CONSTANT bool Population = true;
+    };
+
+    template<typename T>
+    ETL_CONSTANT bool statistics_type_statics<T>::Sample;
+
+    template<typename T>
+    ETL_CONSTANT bool statistics_type_statics<T>::Population;
+
+    //***************************************************************************
+    /// The default calculation type.
+    /// Floating point inputs use their own type, all others use double.
+    //***************************************************************************
+    template <typename TInput>
+    struct default_calc_type
+    {
+      typedef typename etl::conditional<etl::is_floating_point<TInput>::value, TInput, double>::type type;
+    };
+
+    //***************************************************************************
+    /// The number of values in each block of a batch update.
+    //***************************************************************************
+    static ETL_CONSTANT size_t Block_Size = 64U;
+
+    //***************************************************************************
+    /// The sum of a block of values.
+    /// Four independent partial sums let the additions overlap.
+    //***************************************************************************
+    template <typename TCalc, typename TInput>
+    TCalc block_sum(const TInput* values, size_t n)
+    {
+      TCalc sum0 = TCalc(0);
+      TCalc sum1 = TCalc(0);
+      TCalc sum2 = TCalc(0);
+      TCalc sum3 = TCalc(0);
+
+      size_t i = 0U;
+
+      for (; (i + 4U) <= n; i += 4U)
+      {
+        sum0 += TCalc(values[i]);
+        sum1 += TCalc(values[i + 1U]);
+        sum2 += TCalc(values[i + 2U]);
+        sum3 += TCalc(values[i + 3U]);
+      }
+
+      for (; i < n; ++i)
+      {
+        sum0 += TCalc(values[i]);
+      }
+
+      return (sum0 + sum1) + (sum2 + sum3);
+    }
+
+    //***************************************************************************
+    /// The sum of the products of the deviations of two blocks of values from
+    /// their means. Pass the same block twice for the sum of squares.
+    //***************************************************************************
+    template <typename TCalc, typename TInput>
+    TCalc block_sum_of_products(const TInput* values1, TCalc mean1, const TInput* values2, TCalc mean2, size_t n)
+    {
+      TCalc sum0 = TCalc(0);
+      TCalc sum1 = TCalc(0);
+      TCalc sum2 = TCalc(0);
+      TCalc sum3 = TCalc(0);
+
+      size_t i = 0U;
+
+      for (; (i + 4U) <= n; i += 4U)
+      {
+        sum0 += (TCalc(values1[i])      - mean1) * (TCalc(values2[i])      - mean2);
+        sum1 += (TCalc(values1[i + 1U]) - mean1) * (TCalc(values2[i + 1U]) - mean2);
+        sum2 += (TCalc(values1[i + 2U]) - mean1) * (TCalc(values2[i + 2U]) - mean2);
+        sum3 += (TCalc(values1[i + 3U]) - mean1) * (TCalc(values2[i + 3U]) - mean2);
+      }
+
+      for (; i < n; ++i)
+      {
+        sum0 += (TCalc(values1[i]) - mean1) * (TCalc(values2[i]) - mean2);
+      }
+
+      return (sum0 + sum1) + (sum2 + sum3);
+    }
+  }
+
+  struct statistics_type : public private_statistics::statistics_type_statics<>
+  {
+  };
+
+  //***************************************************************************
+  /// Single variable statistics.
+  /// Mean, variance, standard deviation and rms from a single pass.
+  ///\tparam Statistics_Type Population or Sample.
+  ///\tparam TInput          The input value type.
+  ///\tparam TCalc           The floating point type used for the calculation.
+  //***************************************************************************
+  template <bool Statistics_Type, typename TInput, typename TCalc = typename private_statistics::default_calc_type<TInput>::type>
+  class statistics
+    : public etl::unary_function<TInput, void>
+  {
+  private:
+
+    ETL_STATIC_ASSERT(etl::is_floating_point<TCalc>::value, "TCalc must be a floating point type");
+
+    static ETL_CONSTANT size_t Adjustment = (Statistics_Type == statistics_type::Population) ? 0U : 1U;
+
+    typedef TCalc calc_t;
+
+  public:
+
+    //*********************************
+    /// Constructor.
+    //*********************************
+    statistics()
+    {
+      clear();
+    }
+
+    //*********************************
+    /// Constructor.
+    //*********************************
+    template <typename TIterator>
+    statistics(TIterator first, TIterator last)
+    {
+      clear();
+      add(first, last);
+    }
+
+    //*********************************
+    /// Add a value.
+    //*********************************
+    void add(TInput value)
+    {
+      const calc_t x     = calc_t(value);
+      const calc_t delta = x - mean_value;
+
+      ++counter;
+      mean_value     += delta / calc_t(counter);
+      sum_of_squares += delta * (x - mean_value);
+    }
+
+    //*********************************
+    /// Add a range.
+    //*********************************
+    template <typename TIterator>
+    void add(TIterator first, TIterator last)
+    {
+      while (first != last)
+      {
+        add(*first);
+        ++first;
+      }
+    }
+
+    //*********************************
+    /// Add a contiguous block of values.
+    /// The values are summarised a block at a time with two passes, then
+    /// each block is combined with the running result.
+    //*********************************
+    void add(const etl::span<const TInput>& values)
+    {
+      const TInput* p         = values.data();
+      size_t        remaining = values.size();
+
+      while (remaining != 0U)
+      {
+        const size_t n = (remaining < private_statistics::Block_Size) ? remaining : private_statistics::Block_Size;
+
+        const calc_t block_mean = private_statistics::block_sum<calc_t>(p, n) / calc_t(n);
+        const calc_t block_m2   = private_statistics::block_sum_of_products<calc_t>(p, block_mean, p, block_mean, n);
+
+        combine(n, block_mean, block_m2);
+
+        p         += n;
+        remaining -= n;
+      }
+    }
+
+    //*********************************
+    /// Combine with the results of another.
+    //*********************************
+    void combine(const statistics& other)
+    {
+      combine(other.counter, other.mean_value, other.sum_of_squares);
+    }
+
+    //*********************************
+    /// operator ()
+    /// Add a value.
+    //*********************************
+    void operator ()(TInput value)
+    {
+      add(value);
+    }
+
+    //*********************************
+    /// operator ()
+    /// Add a range.
+    //*********************************
+    template <typename TIterator>
+    void operator ()(TIterator first, TIterator last)
+    {
+      add(first, last);
+    }
+
+    //*********************************
+    /// Get the mean.
+    //*********************************
+    double get_mean() const
+    {
+      return double(mean_value);
+    }
+
+    //*********************************
+    /// Get the variance.
+    //*********************************
+    double get_variance() const
+    {
+      if (counter > Adjustment)
+      {
+        return double(sum_of_squares) / double(counter - Adjustment);
+      }
+      else
+      {
+        return 0.0;
+      }
+    }
+
+    //*********************************
+    /// Get the standard deviation.
+    //*********************************
+    double get_standard_deviation() const
+    {
+      return sqrt(get_variance());
+    }
+
+    //*********************************
+    /// Get the rms.
+    //*********************************
+    double get_rms() const
+    {
+      if (counter != 0U)
+      {
+        const double mean = double(mean_value);
+
+        return sqrt((double(sum_of_squares) / double(counter)) + (mean * mean));
+      }
+      else
+      {
+        return 0.0;
+      }
+    }
+
+    //*********************************
+    /// Get the total number added entries.
+    //*********************************
+    size_t count() const
+    {
+      return counter;
+    }
+
+    //*********************************
+    /// Clear the statistics.
+    //*********************************
+    void clear()
+    {
+      counter        = 0U;
+      mean_value     = calc_t(0);
+      sum_of_squares = calc_t(0);
+    }
+
+  private:
+
+    //*********************************
+    /// Combine with a partial result, using Chan's update.
+    //*********************************
+    void combine(size_t other_counter, calc_t other_mean, calc_t other_sum_of_squares)
+    {
+      if (other_counter != 0U)
+      {
+        const size_t n     = counter + other_counter;
+        const calc_t delta = other_mean - mean_value;
+        const calc_t ratio = calc_t(other_counter) / calc_t(n);
+
+        mean_value     += delta * ratio;
+        sum_of_squares += other_sum_of_squares + (delta * delta * calc_t(counter) * ratio);
+        counter         = n;
+      }
+    }
+
+    size_t counter;
+    calc_t mean_value;
+    calc_t sum_of_squares;
+  };
+
+  template <bool Statistics_Type, typename TInput, typename TCalc>
+  ETL_CONSTANT size_t statistics<Statistics_Type, TInput, TCalc>::Adjustment;
+
+  //***************************************************************************
+  /// Two variable statistics.
+  /// Means, variances, covariance and correlation from a single pass.
+  ///\tparam Statistics_Type Population or Sample.
+  ///\tparam TInput          The input value type.
+  ///\tparam TCalc           The floating point type used for the calculation.
+  //***************************************************************************
+  template <bool Statistics_Type, typename TInput, typename TCalc = typename private_statistics::default_calc_type<TInput>::type>
+  class bivariate_statistics
+    : public etl::binary_function<TInput, TInput, void>
+  {
+  private:
+
+    ETL_STATIC_ASSERT(etl::is_floating_point<TCalc>::value, "TCalc must be a floating point type");
+
+    static ETL_CONSTANT size_t Adjustment = (Statistics_Type == statistics_type::Population) ? 0U : 1U;
+
+    typedef TCalc calc_t;
+
+  public:
+
+    //*********************************
+    /// Constructor.
+    //*********************************
+    bivariate_statistics()
+    {
+      clear();
+    }
+
+    //*********************************
+    /// Constructor.
+    //*********************************
+    template <typename TIterator>
+    bivariate_statistics(TIterator first1, TIterator last1, TIterator first2)
+    {
+      clear();
+      add(first1, last1, first2);
+    }
+
+    //*********************************
+    /// Add a pair of values.
+    //*********************************
+    void add(TInput value1, TInput value2)
+    {
+      const calc_t x       = calc_t(value1);
+      const calc_t y       = calc_t(value2);
+      const calc_t delta_x = x - mean_x;
+      const calc_t delta_y = y - mean_y;
+
+      ++counter;
+      mean_x += delta_x / calc_t(counter);
+      mean_y += delta_y / calc_t(counter);
+
+      sum_of_squares_x += delta_x * (x - mean_x);
+      sum_of_squares_y += delta_y * (y - mean_y);
+      sum_of_products  += delta_x * (y - mean_y);
+    }
+
+    //*********************************
+    /// Add a range.
+    //*********************************
+    template <typename TIterator>
+    void add(TIterator first1, TIterator last1, TIterator first2)
+    {
+      while (first1 != last1)
+      {
+        add(*first1, *first2);
+        ++first1;
+        ++first2;
+      }
+    }
+
+    //*********************************
+    /// Add contiguous blocks of values.
+    /// Pairs are taken up to the size of the shorter of the two.
+    /// The values are summarised a block at a time with two passes, then
+    /// each block is combined with the running result.
+    //*********************************
+    void add(const etl::span<const TInput>& values1, const etl::span<const TInput>& values2)
+    {
+      const TInput* p1        = values1.data();
+      const TInput* p2        = values2.data();
+      size_t        remaining = (values1.size() < values2.size()) ? values1.size() : values2.size();
+
+      while (remaining != 0U)
+      {
+        const size_t n = (remaining < private_statistics::Block_Size) ? remaining : private_statistics::Block_Size;
+
+        const calc_t block_mean_x = private_statistics::block_sum<calc_t>(p1, n) / calc_t(n);
+        const calc_t block_mean_y = private_statistics::block_sum<calc_t>(p2, n) / calc_t(n);
+
+        combine(n,
+                block_mean_x,
+                block_mean_y,
+                private_statistics::block_sum_of_products<calc_t>(p1, block_mean_x, p1, block_mean_x, n),
+                private_statistics::block_sum_of_products<calc_t>(p2, block_mean_y, p2, block_mean_y, n),
+                private_statistics::block_sum_of_products<calc_t>(p1, block_mean_x, p2, block_mean_y, n));
+
+        p1        += n;
+        p2        += n;
+        remaining -= n;
+      }
+    }
+
+    //*********************************
+    /// Combine with the results of another.
+    //*********************************
+    void combine(const bivariate_statistics& other)
+    {
+      combine(other.counter, other.mean_x, other.mean_y, other.sum_of_squares_x, other.sum_of_squares_y, other.sum_of_products);
+    }
+
+    //*********************************
+    /// operator ()
+    /// Add a pair of values.
+    //*********************************
+    void operator ()(TInput value1, TInput value2)
+    {
+      add(value1, value2);
+    }
+
+    //*********************************
+    /// operator ()
+    /// Add a range.
+    //*********************************
+    template <typename TIterator>
+    void operator ()(TIterator first1, TIterator last1, TIterator first2)
+    {
+      add(first1, last1, first2);
+    }
+
+    //*********************************
+    /// Get the mean of the first values.
+    //*********************************
+    double get_mean1() const
+    {
+      return double(mean_x);
+    }
+
+    //*********************************
+    /// Get the mean of the second values.
+    //*********************************
+    double get_mean2() const
+    {
+      return double(mean_y);
+    }
+
+    //*********************************
+    /// Get the variance of the first values.
+    //*********************************
+    double get_variance1() const
+    {
+      return adjusted(sum_of_squares_x);
+    }
+
+    //*********************************
+    /// Get the variance of the second values.
+    //*********************************
+    double get_variance2() const
+    {
+      return adjusted(sum_of_squares_y);
+    }
+
+    //*********************************
+    /// Get the covariance.
+    //*********************************
+    double get_covariance() const
+    {
+      return adjusted(sum_of_products);
+    }
+
+    //*********************************
+    /// Get the correlation.
+    //*********************************
+    double get_correlation() const
+    {
+      const double product_of_squares = double(sum_of_squares_x) * double(sum_of_squares_y);
+
+      if (product_of_squares > 0.0)
+      {
+        return double(sum_of_products) / sqrt(product_of_squares);
+      }
+      else
+      {
+        return 0.0;
+      }
+    }
+
+    //*********************************
+    /// Get the correlation.
+    //*********************************
+    operator double() const
+    {
+      return get_correlation();
+    }
+
+    //*********************************
+    /// Get the total number added entries.
+    //*********************************
+    size_t count() const
+    {
+      return counter;
+    }
+
+    //*********************************
+    /// Clear the statistics.
+    //*********************************
+    void clear()
+    {
+      counter          = 0U;
+      mean_x           = calc_t(0);
+      mean_y           = calc_t(0);
+      sum_of_squares_x = calc_t(0);
+      sum_of_squares_y = calc_t(0);
+      sum_of_products  = calc_t(0);
+    }
+
+  private:
+
+    //*********************************
+    /// Divide by the count, adjusted for the statistics type.
+    //*********************************
+    double adjusted(calc_t sum) const
+    {
+      if (counter > Adjustment)
+      {
+        return double(sum) / double(counter - Adjustment);
+      }
+      else
+      {
+        return 0.0;
+      }
+    }
+
+    //*********************************
+    /// Combine with a partial result, using Chan's update.
+    //*********************************
+    void combine(size_t other_counter,
+                 calc_t other_mean_x,
+                 calc_t other_mean_y,
+                 calc_t other_sum_of_squares_x,
+                 calc_t other_sum_of_squares_y,
+                 calc_t other_sum_of_products)
+    {
+      if (other_counter != 0U)
+      {
+        const size_t n       = counter + other_counter;
+        const calc_t delta_x = other_mean_x - mean_x;
+        const calc_t delta_y = other_mean_y - mean_y;
+        const calc_t ratio   = calc_t(other_counter) / calc_t(n);
+        const calc_t weight  = calc_t(counter) * ratio;
+
+        mean_x           += delta_x * ratio;
+        mean_y           += delta_y * ratio;
+        sum_of_squares_x += other_sum_of_squares_x + (delta_x * delta_x * weight);
+        sum_of_squares_y += other_sum_of_squares_y + (delta_y * delta_y * weight);
+        sum_of_products  += other_sum_of_products  + (delta_x * delta_y * weight);
+        counter           = n;
+      }
+    }
+
+    size_t counter;
+    calc_t mean_x;
+    calc_t mean_y;
+    calc_t sum_of_squares_x;
+    calc_t sum_of_squares_y;
+    calc_t sum_of_products;
+  };
+
+  template <bool Statistics_Type, typename TInput, typename TCalc>
+  ETL_CONSTANT size_t bivariate_statistics<Statistics_Type, TInput, TCalc>::Adjustment;
+}
+
+#endif
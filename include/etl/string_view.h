@@ -41,6 +41,7 @@ SOFTWARE.
 #include "hash.h"
 #include "basic_string.h"
 #include "algorithm.h"
+#include "private/string_search.h"
 #include "private/minmax_push.h"
 
 #if ETL_USING_STL && ETL_USING_CPP17
@@ -518,11 +519,25 @@ namespace etl
     //*************************************************************************
     ETL_CONSTEXPR14 size_type find(etl::basic_string_view<T, TTraits> view, size_type position = 0) const ETL_NOEXCEPT
     {
-      if ((size() < view.size()))
+      if ((size() < view.size()) || (position > size()))
       {
         return npos;
       }
 
+      if (view.empty())
+      {
+        return position;
+      }
+
+#if ETL_USING_STRING_SEARCH_KERNELS
+      if (!etl::is_constant_evaluated())
+      {
+        const_pointer i = private_string_search::find_substring(mbegin + position, mend, view.data(), view.size());
+
+        return (i != mend) ? static_cast<size_type>(i - mbegin) : npos;
+      }
+#endif
+
       const_iterator iposition = etl::search(begin() + position, end(), view.begin(), view.end());
 
       if (iposition == end())
@@ -562,12 +577,26 @@ namespace etl
 
       position = etl::min(position, size());
 
+      if (view.empty())
+      {
+        return position;
+      }
+
+#if ETL_USING_STRING_SEARCH_KERNELS
+      if (!etl::is_constant_evaluated())
+      {
+        const_pointer i = private_string_search::rfind_substring(mbegin, mbegin + position, view.data(), view.size());
+
+        return (i != mbegin + position) ? static_cast<size_type>(i - mbegin) : npos;
+      }
+#endif
+
       const_iterator iposition = etl::find_end(begin(),
                                                begin() + position,
                                                view.begin(),
                                                view.end());
 
-      if (iposition == end())
+      if (iposition == (begin() + position))
       {
         return npos;
       }
@@ -601,6 +630,15 @@ namespace etl
 
       if (position < lengthtext)
       {
+#if ETL_USING_STRING_SEARCH_KERNELS
+        if (!etl::is_constant_evaluated())
+        {
+          const_pointer i = private_string_search::find_of<true>(mbegin + position, mend, view.data(), view.size());
+
+          return (i != mend) ? static_cast<size_type>(i - mbegin) : npos;
+        }
+#endif
+
         for (size_t i = position; i < lengthtext; ++i)
         {
           const size_t lengthview = view.size();
@@ -645,6 +683,15 @@ namespace etl
 
       position = etl::min(position, size() - 1);
 
+#if ETL_USING_STRING_SEARCH_KERNELS
+      if (!etl::is_constant_evaluated())
+      {
+        const_pointer i = private_string_search::rfind_of<true>(mbegin, mbegin + position + 1U, view.data(), view.size());
+
+        return (i != mbegin + position + 1U) ? static_cast<size_type>(i - mbegin) : npos;
+      }
+#endif
+
       const_reverse_iterator it = rbegin() + size() - position - 1;
 
       while (it != rend())
@@ -690,6 +737,15 @@ namespace etl
 
       if (position < lengthtext)
       {
+#if ETL_USING_STRING_SEARCH_KERNELS
+        if (!etl::is_constant_evaluated())
+        {
+          const_pointer i = private_string_search::find_of<false>(mbegin + position, mend, view.data(), view.size());
+
+          return (i != mend) ? static_cast<size_type>(i - mbegin) : npos;
+        }
+#endif
+
         for (size_t i = position; i < lengthtext; ++i)
         {
           bool found = false;
@@ -742,6 +798,15 @@ namespace etl
 
       position = etl::min(position, size() - 1);
 
+#if ETL_USING_STRING_SEARCH_KERNELS
+      if (!etl::is_constant_evaluated())
+      {
+        const_pointer i = private_string_search::rfind_of<false>(mbegin, mbegin + position + 1U, view.data(), view.size());
+
+        return (i != mbegin + position + 1U) ? static_cast<size_type>(i - mbegin) : npos;
+      }
+#endif
+
       const_reverse_iterator it = rbegin() + size() - position - 1;
 
       while (it != rend())
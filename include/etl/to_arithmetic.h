@@ -46,7 +46,21 @@ SOFTWARE.
 #include "expected.h"
 #include "math.h"
 
+#include "endianness.h"
+
 #include <math.h>
+#include <string.h>
+
+//*****************************************************************************
+// Decimal char text uses word at a time fast paths at run time.
+// Define ETL_TO_ARITHMETIC_NO_FAST_PATH to always use the scalar conversion.
+// The fast paths need 64 bit types.
+//*****************************************************************************
+#if !defined(ETL_TO_ARITHMETIC_NO_FAST_PATH) && ETL_USING_64BIT_TYPES && (ETL_USING_CPP20 || (ETL_USING_BUILTIN_IS_CONSTANT_EVALUATED == 1) || !ETL_USING_CPP14)
+  #define ETL_USING_TO_ARITHMETIC_FAST_PATH 1
+#else
+  #define ETL_USING_TO_ARITHMETIC_FAST_PATH 0
+#endif
 
 namespace etl
 {
@@ -504,7 +518,7 @@ namespace etl
             {
               const char digit = digit_value(c, etl::radix::decimal);
               floating_point_value *= 10;
-              is_negative_mantissa ? floating_point_value -= digit : floating_point_value += digit;
+              floating_point_value += digit;
               conversion_status = to_arithmetic_status::Valid;
               expecting_sign = false;
             }
@@ -535,8 +549,7 @@ namespace etl
             {
               const char digit = digit_value(c, etl::radix::decimal);
               divisor *= 10;
-              long double fraction = digit / divisor;
-              is_negative_mantissa ? floating_point_value -= fraction : floating_point_value += fraction;
+              floating_point_value += digit / divisor;
               conversion_status = to_arithmetic_status::Valid;
             }
             else
@@ -564,8 +577,13 @@ namespace etl
             else if (is_valid(c, etl::radix::decimal))
             {
               const char digit = digit_value(c, etl::radix::decimal);
-              exponent_value *= etl::radix::decimal;
-              is_negative_exponent ? exponent_value -= digit : exponent_value += digit;
+
+              // Saturate. The value has already overflowed or underflowed long double.
+              if ((exponent_value < Max_Exponent) && (exponent_value > -Max_Exponent))
+              {
+                exponent_value *= etl::radix::decimal;
+                is_negative_exponent ? exponent_value -= digit : exponent_value += digit;
+              }
             }
             else
             {
@@ -599,7 +617,8 @@ namespace etl
       ETL_CONSTEXPR14
       long double value() const
       {
-        return floating_point_value;
+        // The sign is applied last, so that "-0" gives -0.0.
+        return is_negative_mantissa ? -floating_point_value : floating_point_value;
       }
 
       //*********************************
@@ -627,6 +646,8 @@ namespace etl
         Parsing_Exponential
       };
 
+      static ETL_CONSTANT int Max_Exponent = (etl::integral_limits<int>::max - 9) / 10;
+
       long double divisor;
       long double floating_point_value;
       bool is_negative_mantissa;
@@ -669,6 +690,291 @@ namespace etl
     };
 #endif
 
+    //***************************************************************************
+    // Fast paths for decimal char text.
+    // Eight digits are validated and converted at a time in a 64 bit word.
+    // Floating point text that has at most 19 significant digits and a small
+    // exponent is converted exactly, with a single correctly rounded
+    // multiplication or division by an exact power of ten.
+    // All other text uses the accumulators above.
+    //***************************************************************************
+#if ETL_USING_TO_ARITHMETIC_FAST_PATH
+    template <typename T = void>
+    struct exact_powers_of_ten
+    {
+      static const double table[23];
+    };
+
+    template <typename T>
+    const double exact_powers_of_ten<T>::table[23] =
+    {
+      1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+      1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+    };
+
+    //*******************************************
+    /// Loads eight chars with the first in the least significant byte.
+    //*******************************************
+    inline uint64_t load_eight_chars(const char* p)
+    {
+      uint64_t chunk;
+      memcpy(&chunk, p, sizeof(chunk));
+
+      if (etl::endianness::value() == etl::endian::big)
+      {
+        chunk = etl::reverse_bytes(chunk);
+      }
+
+      return chunk;
+    }
+
+    //*******************************************
+    /// Are all eight chars in '0' to '9'?
+    //*******************************************
+    inline bool is_eight_digits(uint64_t chunk)
+    {
+      return (((chunk + UINT64_C(0x4646464646464646)) | (chunk - UINT64_C(0x3030303030303030))) & UINT64_C(0x8080808080808080)) == 0U;
+    }
+
+    //*******************************************
+    /// Converts eight validated digits.
+    //*******************************************
+    inline uint32_t parse_eight_digits(uint64_t chunk)
+    {
+      const uint64_t Mask = UINT64_C(0x000000FF000000FF);
+
+      chunk -= UINT64_C(0x3030303030303030);
+      chunk  = (chunk * 10U) + (chunk >> 8U);
+      chunk  = (((chunk & Mask) * UINT64_C(0x000F424000000064)) + (((chunk >> 16U) & Mask) * UINT64_C(0x0000271000000001))) >> 32U;
+
+      return static_cast<uint32_t>(chunk);
+    }
+
+    //*******************************************
+    /// Decimal text to integral.
+    /// Returns false if there is no fast path for this character type.
+    //*******************************************
+    template <typename TChar, typename TAccumulatorType>
+    bool to_arithmetic_decimal_fast(const TChar*, size_t, TAccumulatorType, etl::to_arithmetic_result<TAccumulatorType>&)
+    {
+      return false;
+    }
+
+    //*******************************************
+    template <typename TAccumulatorType>
+    bool to_arithmetic_decimal_fast(const char*                                  p,
+                                    size_t                                       length,
+                                    const TAccumulatorType                       maximum,
+                                    etl::to_arithmetic_result<TAccumulatorType>& result)
+    {
+      typedef typename etl::unexpected<etl::to_arithmetic_status> unexpected_type;
+
+      const char* const p_end = p + length;
+      TAccumulatorType  value = 0;
+
+      while ((p_end - p) >= 8)
+      {
+        const uint64_t chunk = load_eight_chars(p);
+
+        if (!is_eight_digits(chunk))
+        {
+          break;
+        }
+
+        const TAccumulatorType digits = parse_eight_digits(chunk);
+
+        if ((digits > maximum) || (value > ((maximum - digits) / 100000000U)))
+        {
+          result = unexpected_type(to_arithmetic_status::Overflow);
+          return true;
+        }
+
+        value = (value * 100000000U) + digits;
+        p += 8;
+      }
+
+      while (p != p_end)
+      {
+        const char c = *p++;
+
+        if ((c < '0') || (c > '9'))
+        {
+          result = unexpected_type(to_arithmetic_status::Invalid_Format);
+          return true;
+        }
+
+        const TAccumulatorType digit = static_cast<TAccumulatorType>(c - '0');
+
+        if (value > ((maximum - digit) / 10U))
+        {
+          result = unexpected_type(to_arithmetic_status::Overflow);
+          return true;
+        }
+
+        value = (value * 10U) + digit;
+      }
+
+      result = value;
+
+      return true;
+    }
+
+    //*******************************************
+    /// Accumulates decimal digits while the total count stays within 19.
+    //*******************************************
+    inline void accumulate_decimal_digits(const char*& p, const char* p_end, uint64_t& value, int& count)
+    {
+      // value < 10^11 so value * 10^8 + 99999999 cannot overflow.
+      while (((p_end - p) >= 8) && (count <= 11))
+      {
+        const uint64_t chunk = load_eight_chars(p);
+
+        if (!is_eight_digits(chunk))
+        {
+          break;
+        }
+
+        value  = (value * 100000000U) + parse_eight_digits(chunk);
+        count += 8;
+        p     += 8;
+      }
+
+      while ((p != p_end) && (*p >= '0') && (*p <= '9') && (count < 20))
+      {
+        if (count < 19)
+        {
+          value = (value * 10U) + static_cast<uint64_t>(*p - '0');
+        }
+
+        ++count;
+        ++p;
+      }
+    }
+
+    //*******************************************
+    /// Decimal text to floating point.
+    /// Returns false if the text must be converted by the accumulator.
+    //*******************************************
+    template <typename TValue, typename TChar>
+    bool to_arithmetic_floating_point_fast(const TChar*, size_t, etl::to_arithmetic_result<TValue>&)
+    {
+      return false;
+    }
+
+    //*******************************************
+    template <typename TValue>
+    bool to_arithmetic_floating_point_fast(const char* p, size_t length, etl::to_arithmetic_result<TValue>& result)
+    {
+      const char* const p_end = p + length;
+
+      const bool is_negative = (*p == char_constant::Negative_Char);
+
+      if (is_negative || (*p == char_constant::Positive_Char))
+      {
+        ++p;
+      }
+
+      uint64_t mantissa = 0U;
+      int      count    = 0;
+      int      exponent = 0;
+
+      // Leading zeros are not significant.
+      const char* const p_integral = p;
+
+      while ((p != p_end) && (*p == '0'))
+      {
+        ++p;
+      }
+
+      accumulate_decimal_digits(p, p_end, mantissa, count);
+
+      bool has_digits = (p != p_integral);
+
+      if ((p != p_end) && ((*p == char_constant::Radix_Point1_Char) || (*p == char_constant::Radix_Point2_Char)))
+      {
+        ++p;
+
+        const char* const p_fractional = p;
+
+        if (count == 0)
+        {
+          while ((p != p_end) && (*p == '0'))
+          {
+            ++p;
+          }
+        }
+
+        accumulate_decimal_digits(p, p_end, mantissa, count);
+
+        exponent   -= static_cast<int>(p - p_fractional);
+        has_digits |= (p != p_fractional);
+      }
+
+      if (!has_digits || (count > 19))
+      {
+        return false;
+      }
+
+      if ((p != p_end) && ((*p == char_constant::Exponential_Char) || (*p == 'E')))
+      {
+        ++p;
+
+        const bool is_negative_exponent = ((p != p_end) && (*p == char_constant::Negative_Char));
+
+        if ((p != p_end) && ((*p == char_constant::Negative_Char) || (*p == char_constant::Positive_Char)))
+        {
+          ++p;
+        }
+
+        const char* const p_exponent = p;
+        int exponent_value = 0;
+
+        while ((p != p_end) && (*p >= '0') && (*p <= '9') && ((p - p_exponent) < 4))
+        {
+          exponent_value = (exponent_value * 10) + (*p - '0');
+          ++p;
+        }
+
+        if (p == p_exponent)
+        {
+          return false;
+        }
+
+        exponent += is_negative_exponent ? -exponent_value : exponent_value;
+      }
+
+      if (p != p_end)
+      {
+        return false;
+      }
+
+      // Exact only if the mantissa and the power of ten are both exactly representable.
+      const int  Mantissa_Bits     = etl::numeric_limits<TValue>::digits;
+      const int  Max_Exponent      = (Mantissa_Bits >= 53) ? 22 : 10;
+      const bool is_exact_mantissa = (Mantissa_Bits >= 64) || (mantissa <= (UINT64_C(1) << (Mantissa_Bits % 64)));
+
+      if (!is_exact_mantissa || (exponent < -Max_Exponent) || (exponent > Max_Exponent))
+      {
+        return false;
+      }
+
+      TValue value = static_cast<TValue>(mantissa);
+
+      if (exponent < 0)
+      {
+        value /= static_cast<TValue>(exact_powers_of_ten<>::table[-exponent]);
+      }
+      else
+      {
+        value *= static_cast<TValue>(exact_powers_of_ten<>::table[exponent]);
+      }
+
+      result = is_negative ? -value : value;
+
+      return true;
+    }
+#endif
+
     //***************************************************************************
     /// Text to integral from view, radix value and maximum.
     //***************************************************************************
@@ -685,6 +991,16 @@ namespace etl
       typename etl::basic_string_view<TChar>::const_iterator       itr     = view.begin();
       const typename etl::basic_string_view<TChar>::const_iterator itr_end = view.end();
 
+#if ETL_USING_TO_ARITHMETIC_FAST_PATH
+      if (!etl::is_constant_evaluated() && (radix == etl::radix::decimal))
+      {
+        if (to_arithmetic_decimal_fast(view.data(), view.size(), maximum, accumulator_result))
+        {
+          return accumulator_result;
+        }
+      }
+#endif
+
       integral_accumulator<TAccumulatorType> accumulator(radix, maximum);
 
       while ((itr != itr_end) && accumulator.add(convert(*itr)))
@@ -891,6 +1207,12 @@ namespace etl
     {
       result = unexpected_type(to_arithmetic_status::Invalid_Format);
     }
+#if ETL_USING_TO_ARITHMETIC_FAST_PATH
+    else if (!etl::is_constant_evaluated() && to_arithmetic_floating_point_fast(view.data(), view.size(), result))
+    {
+      // Converted exactly.
+    }
+#endif
     else
     {
       floating_point_accumulator accumulator;
@@ -0,0 +1,1692 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_UNORDERED_FLAT_MAP_INCLUDED
+#define ETL_UNORDERED_FLAT_MAP_INCLUDED
+
+#include "platform.h"
+#include "algorithm.h"
+#include "iterator.h"
+#include "functional.h"
+#include "utility.h"
+#include "memory.h"
+#include "power.h"
+#include "hash.h"
+#include "type_traits.h"
+#include "integral_limits.h"
+#include "static_assert.h"
+#include "nullptr.h"
+#include "error_handler.h"
+#include "exception.h"
+#include "debug_count.h"
+#include "placement_new.h"
+#include "initializer_list.h"
+
+#include "private/comparator_is_transparent.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+//*****************************************************************************
+///\defgroup unordered_flat_map unordered_flat_map
+/// An open addressing unordered_map with the capacity defined at compile time.
+/// Elements are stored in a flat array, with a parallel array of 16 bit
+/// probe distances. Collisions are resolved with Robin Hood linear probing,
+/// and erasure uses backward shift deletion, so there are no tombstones.
+/// Lookups scan the compact distance array and only compare keys of
+/// elements that share the key's home slot.
+/// Iterators and references are invalidated by insertion and erasure.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// Exception for the unordered_flat_map.
+  ///\ingroup unordered_flat_map
+  //***************************************************************************
+  class unordered_flat_map_exception : public etl::exception
+  {
+  public:
+
+    unordered_flat_map_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : etl::exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Full exception for the unordered_flat_map.
+  ///\ingroup unordered_flat_map
+  //***************************************************************************
+  class unordered_flat_map_full : public etl::unordered_flat_map_exception
+  {
+  public:
+
+    unordered_flat_map_full(string_type file_name_, numeric_type line_number_)
+      : etl::unordered_flat_map_exception(ETL_ERROR_TEXT("unordered_flat_map:full", ETL_UNORDERED_FLAT_MAP_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Out of range exception for the unordered_flat_map.
+  ///\ingroup unordered_flat_map
+  //***************************************************************************
+  class unordered_flat_map_out_of_range : public etl::unordered_flat_map_exception
+  {
+  public:
+
+    unordered_flat_map_out_of_range(string_type file_name_, numeric_type line_number_)
+      : etl::unordered_flat_map_exception(ETL_ERROR_TEXT("unordered_flat_map:range", ETL_UNORDERED_FLAT_MAP_FILE_ID"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Iterator exception for the unordered_flat_map.
+  ///\ingroup unordered_flat_map
+  //***************************************************************************
+  class unordered_flat_map_iterator : public etl::unordered_flat_map_exception
+  {
+  public:
+
+    unordered_flat_map_iterator(string_type file_name_, numeric_type line_number_)
+      : etl::unordered_flat_map_exception(ETL_ERROR_TEXT("unordered_flat_map:iterator", ETL_UNORDERED_FLAT_MAP_FILE_ID"C"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Calculates the table dimensions for an unordered_flat_map of a given size.
+  /// Buckets : The number of home slots. A power of 2, giving a maximum load factor of 0.8.
+  ///           At least 2, so that the hash shift is less than the width of size_t.
+  /// Slots   : The number of elements in each buffer. Probes wrap around, so this is Buckets.
+  ///\ingroup unordered_flat_map
+  //***************************************************************************
+  template <size_t Max_Size>
+  struct unordered_flat_map_dimensions
+  {
+    static ETL_CONSTANT size_t Buckets = etl::power_of_2_round_up<(Max_Size > 0U) ? Max_Size + (Max_Size / 4U) + 1U : 2U>::value;
+    static ETL_CONSTANT size_t Slots   = Buckets;
+  };
+
+  template <size_t Max_Size>
+  ETL_CONSTANT size_t unordered_flat_map_dimensions<Max_Size>::Buckets;
+
+  template <size_t Max_Size>
+  ETL_CONSTANT size_t unordered_flat_map_dimensions<Max_Size>::Slots;
+
+  //***************************************************************************
+  /// The base class for specifically sized unordered_flat_map.
+  /// Can be used as a reference type for all unordered_flat_map containing a specific type.
+  ///\ingroup unordered_flat_map
+  //***************************************************************************
+  template <typename TKey, typename T, typename THash = etl::hash<TKey>, typename TKeyEqual = etl::equal_to<TKey> >
+  class iunordered_flat_map
+  {
+  public:
+
+    typedef ETL_OR_STD::pair<const TKey, T> value_type;
+
+    typedef TKey              key_type;
+    typedef T                 mapped_type;
+    typedef THash             hasher;
+    typedef TKeyEqual         key_equal;
+    typedef value_type&       reference;
+    typedef const value_type& const_reference;
+#if ETL_USING_CPP11
+    typedef value_type&&      rvalue_reference;
+#endif
+    typedef value_type*       pointer;
+    typedef const value_type* const_pointer;
+    typedef size_t            size_type;
+
+    /// Defines the parameter types
+    typedef const key_type&    const_key_reference;
+#if ETL_USING_CPP11
+    typedef key_type&&         rvalue_key_reference;
+#endif
+    typedef mapped_type&       mapped_reference;
+    typedef const mapped_type& const_mapped_reference;
+
+    /// The type used to store the probe distances.
+    typedef uint_least16_t distance_type;
+
+    /// The probe distance stored for an empty slot.
+    static ETL_CONSTANT distance_type Empty_Slot = 0U;
+
+    /// The largest probe distance that can be stored.
+    /// Also the largest maximum size for which the full capacity is guaranteed.
+    static ETL_CONSTANT distance_type Max_Distance = etl::integral_limits<distance_type>::max;
+
+    class const_iterator;
+
+    //*********************************************************************
+    class iterator : public etl::iterator<ETL_OR_STD::forward_iterator_tag, value_type>
+    {
+    public:
+
+      friend class iunordered_flat_map;
+      friend class const_iterator;
+
+      //*********************************
+      iterator()
+        : pvalue(ETL_NULLPTR)
+        , pdistance(ETL_NULLPTR)
+        , pdistance_end(ETL_NULLPTR)
+      {
+      }
+
+      //*********************************
+      iterator(const iterator& other)
+        : pvalue(other.pvalue)
+        , pdistance(other.pdistance)
+        , pdistance_end(other.pdistance_end)
+      {
+      }
+
+      //*********************************
+      iterator& operator ++()
+      {
+        do
+        {
+          ++pvalue;
+          ++pdistance;
+        } while ((pdistance != pdistance_end) && (*pdistance == Empty_Slot));
+
+        return *this;
+      }
+
+      //*********************************
+      iterator operator ++(int)
+      {
+        iterator temp(*this);
+        operator++();
+        return temp;
+      }
+
+      //*********************************
+      iterator& operator =(const iterator& other)
+      {
+        pvalue        = other.pvalue;
+        pdistance     = other.pdistance;
+        pdistance_end = other.pdistance_end;
+
+        return *this;
+      }
+
+      //*********************************
+      reference operator *() const
+      {
+        return *pvalue;
+      }
+
+      //*********************************
+      pointer operator &() const
+      {
+        return pvalue;
+      }
+
+      //*********************************
+      pointer operator ->() const
+      {
+        return pvalue;
+      }
+
+      //*********************************
+      friend bool operator == (const iterator& lhs, const iterator& rhs)
+      {
+        return lhs.pdistance == rhs.pdistance;
+      }
+
+      //*********************************
+      friend bool operator != (const iterator& lhs, const iterator& rhs)
+      {
+        return !(lhs == rhs);
+      }
+
+    private:
+
+      //*********************************
+      iterator(pointer pvalue_, distance_type* pdistance_, distance_type* pdistance_end_)
+        : pvalue(pvalue_)
+        , pdistance(pdistance_)
+        , pdistance_end(pdistance_end_)
+      {
+      }
+
+      pointer  pvalue;
+      distance_type* pdistance;
+      distance_type* pdistance_end;
+    };
+
+    //*********************************************************************
+    class const_iterator : public etl::iterator<ETL_OR_STD::forward_iterator_tag, const value_type>
+    {
+    public:
+
+      friend class iunordered_flat_map;
+      friend class iterator;
+
+      //*********************************
+      const_iterator()
+        : pvalue(ETL_NULLPTR)
+        , pdistance(ETL_NULLPTR)
+        , pdistance_end(ETL_NULLPTR)
+      {
+      }
+
+      //*********************************
+      const_iterator(const typename iunordered_flat_map::iterator& other)
+        : pvalue(other.pvalue)
+        , pdistance(other.pdistance)
+        , pdistance_end(other.pdistance_end)
+      {
+      }
+
+      //*********************************
+      const_iterator(const const_iterator& other)
+        : pvalue(other.pvalue)
+        , pdistance(other.pdistance)
+        , pdistance_end(other.pdistance_end)
+      {
+      }
+
+      //*********************************
+      const_iterator& operator ++()
+      {
+        do
+        {
+          ++pvalue;
+          ++pdistance;
+        } while ((pdistance != pdistance_end) && (*pdistance == Empty_Slot));
+
+        return *this;
+      }
+
+      //*********************************
+      const_iterator operator ++(int)
+      {
+        const_iterator temp(*this);
+        operator++();
+        return temp;
+      }
+
+      //*********************************
+      const_iterator& operator =(const const_iterator& other)
+      {
+        pvalue        = other.pvalue;
+        pdistance     = other.pdistance;
+        pdistance_end = other.pdistance_end;
+
+        return *this;
+      }
+
+      //*********************************
+      const_reference operator *() const
+      {
+        return *pvalue;
+      }
+
+      //*********************************
+      const_pointer operator &() const
+      {
+        return pvalue;
+      }
+
+      //*********************************
+      const_pointer operator ->() const
+      {
+        return pvalue;
+      }
+
+      //*********************************
+      friend bool operator == (const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return lhs.pdistance == rhs.pdistance;
+      }
+
+      //*********************************
+      friend bool operator != (const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return !(lhs == rhs);
+      }
+
+    private:
+
+      //*********************************
+      const_iterator(const_pointer pvalue_, const distance_type* pdistance_, const distance_type* pdistance_end_)
+        : pvalue(pvalue_)
+        , pdistance(pdistance_)
+        , pdistance_end(pdistance_end_)
+      {
+      }
+
+      const_pointer  pvalue;
+      const distance_type* pdistance;
+      const distance_type* pdistance_end;
+    };
+
+    typedef typename etl::iterator_traits<iterator>::difference_type difference_type;
+
+    //*********************************************************************
+    /// Returns the number of buckets required for a map of the given size.
+    //*********************************************************************
+    static ETL_CONSTEXPR14 size_t required_buckets(size_t max_size_)
+    {
+      size_t minimum = max_size_ + (max_size_ / 4U) + 1U;
+      size_t buckets = 2U;
+
+      while (buckets < minimum)
+      {
+        buckets <<= 1U;
+      }
+
+      return buckets;
+    }
+
+    //*********************************************************************
+    /// Returns the number of slots required in each of the buffers for a map of the given size.
+    /// The same as unordered_flat_map_dimensions<Max_Size>::Slots.
+    //*********************************************************************
+    static ETL_CONSTEXPR14 size_t required_slots(size_t max_size_)
+    {
+      return required_buckets(max_size_);
+    }
+
+    //*********************************************************************
+    /// Returns an iterator to the beginning of the unordered_flat_map.
+    ///\return An iterator to the beginning of the unordered_flat_map.
+    //*********************************************************************
+    iterator begin()
+    {
+      return make_iterator(first_occupied(0U));
+    }
+
+    //*********************************************************************
+    /// Returns a const_iterator to the beginning of the unordered_flat_map.
+    ///\return A const iterator to the beginning of the unordered_flat_map.
+    //*********************************************************************
+    const_iterator begin() const
+    {
+      return make_const_iterator(first_occupied(0U));
+    }
+
+    //*********************************************************************
+    /// Returns a const_iterator to the beginning of the unordered_flat_map.
+    ///\return A const iterator to the beginning of the unordered_flat_map.
+    //*********************************************************************
+    const_iterator cbegin() const
+    {
+      return make_const_iterator(first_occupied(0U));
+    }
+
+    //*********************************************************************
+    /// Returns an iterator to the end of the unordered_flat_map.
+    ///\return An iterator to the end of the unordered_flat_map.
+    //*********************************************************************
+    iterator end()
+    {
+      return make_iterator(number_of_slots);
+    }
+
+    //*********************************************************************
+    /// Returns a const_iterator to the end of the unordered_flat_map.
+    ///\return A const iterator to the end of the unordered_flat_map.
+    //*********************************************************************
+    const_iterator end() const
+    {
+      return make_const_iterator(number_of_slots);
+    }
+
+    //*********************************************************************
+    /// Returns a const_iterator to the end of the unordered_flat_map.
+    ///\return A const iterator to the end of the unordered_flat_map.
+    //*********************************************************************
+    const_iterator cend() const
+    {
+      return make_const_iterator(number_of_slots);
+    }
+
+    //*********************************************************************
+    /// Returns the maximum number of the buckets the container can hold.
+    ///\return The maximum number of the buckets the container can hold.
+    //*********************************************************************
+    size_type max_bucket_count() const
+    {
+      return number_of_slots;
+    }
+
+    //*********************************************************************
+    /// Returns the number of the buckets the container holds.
+    ///\return The number of the buckets the container holds.
+    //*********************************************************************
+    size_type bucket_count() const
+    {
+      return number_of_slots;
+    }
+
+    //*********************************************************************
+    /// Returns a reference to the value at index 'key'
+    /// If asserts or exceptions are enabled, emits an etl::unordered_flat_map_full if a new key cannot be added.
+    ///\param key The key.
+    ///\return A reference to the value at index 'key'
+    //*********************************************************************
+    mapped_reference operator [](const_key_reference key)
+    {
+      return subscript(key);
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    /// Returns a reference to the value at index 'key'
+    /// If asserts or exceptions are enabled, emits an etl::unordered_flat_map_full if a new key cannot be added.
+    ///\param key The key.
+    ///\return A reference to the value at index 'key'
+    //*********************************************************************
+    mapped_reference operator [](rvalue_key_reference key)
+    {
+      probe_result result = probe(key);
+
+      if (!result.found)
+      {
+        pointer p = make_space(result);
+
+        ETL_ASSERT_OR_RETURN_VALUE(p != ETL_NULLPTR, ETL_ERROR(unordered_flat_map_full), pvalues[first_empty()].second);
+
+        ::new (p) value_type(etl::move(key), mapped_type());
+        ETL_INCREMENT_DEBUG_COUNT;
+      }
+
+      return pvalues[result.index].second;
+    }
+
+    //*********************************************************************
+    /// Returns a reference to the value at index 'key'
+    /// If asserts or exceptions are enabled, emits an etl::unordered_flat_map_full if a new key cannot be added.
+    ///\param key The key.
+    ///\return A reference to the value at index 'key'
+    //*********************************************************************
+    template <typename K, typename KE = TKeyEqual, etl::enable_if_t<comparator_is_transparent<KE>::value, int> = 0>
+    mapped_reference operator [](const K& key)
+    {
+      return subscript(key);
+    }
+#endif
+
+    //*********************************************************************
+    /// Returns a reference to the value at index 'key'
+    /// If asserts or exceptions are enabled, emits an etl::unordered_flat_map_out_of_range if the key is not in the range.
+    ///\param key The key.
+    ///\return A reference to the value at index 'key'
+    //*********************************************************************
+    mapped_reference at(const_key_reference key)
+    {
+      size_t index = find_index(key);
+
+      ETL_ASSERT(index != number_of_slots, ETL_ERROR(unordered_flat_map_out_of_range));
+
+      return pvalues[index].second;
+    }
+
+    //*********************************************************************
+    /// Returns a const reference to the value at index 'key'
+    /// If asserts or exceptions are enabled, emits an etl::unordered_flat_map_out_of_range if the key is not in the range.
+    ///\param key The key.
+    ///\return A const reference to the value at index 'key'
+    //*********************************************************************
+    const_mapped_reference at(const_key_reference key) const
+    {
+      size_t index = find_index(key);
+
+      ETL_ASSERT(index != number_of_slots, ETL_ERROR(unordered_flat_map_out_of_range));
+
+      return pvalues[index].second;
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    /// Returns a reference to the value at index 'key'
+    /// If asserts or exceptions are enabled, emits an etl::unordered_flat_map_out_of_range if the key is not in the range.
+    ///\param key The key.
+    ///\return A reference to the value at index 'key'
+    //*********************************************************************
+    template <typename K, typename KE = TKeyEqual, etl::enable_if_t<comparator_is_transparent<KE>::value, int> = 0>
+    mapped_reference at(const K& key)
+    {
+      size_t index = find_index(key);
+
+      ETL_ASSERT(index != number_of_slots, ETL_ERROR(unordered_flat_map_out_of_range));
+
+      return pvalues[index].second;
+    }
+
+    //*********************************************************************
+    /// Returns a const reference to the value at index 'key'
+    /// If asserts or exceptions are enabled, emits an etl::unordered_flat_map_out_of_range if the key is not in the range.
+    ///\param key The key.
+    ///\return A const reference to the value at index 'key'
+    //*********************************************************************
+    template <typename K, typename KE = TKeyEqual, etl::enable_if_t<comparator_is_transparent<KE>::value, int> = 0>
+    const_mapped_reference at(const K& key) const
+    {
+      size_t index = find_index(key);
+
+      ETL_ASSERT(index != number_of_slots, ETL_ERROR(unordered_flat_map_out_of_range));
+
+      return pvalues[index].second;
+    }
+#endif
+
+    //*********************************************************************
+    /// Assigns values to the unordered_flat_map.
+    /// If asserts or exceptions are enabled, emits unordered_flat_map_full if the unordered_flat_map does not have enough free space.
+    /// If asserts or exceptions are enabled, emits unordered_flat_map_iterator if the iterators are reversed.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*********************************************************************
+    template <typename TIterator>
+    void assign(TIterator first_, TIterator last_)
+    {
+#if ETL_IS_DEBUG_BUILD
+      difference_type d = etl::distance(first_, last_);
+      ETL_ASSERT(d >= 0, ETL_ERROR(unordered_flat_map_iterator));
+      ETL_ASSERT(size_t(d) <= max_size(), ETL_ERROR(unordered_flat_map_full));
+#endif
+
+      clear();
+
+      while (first_ != last_)
+      {
+        insert(*first_);
+        ++first_;
+      }
+    }
+
+    //*********************************************************************
+    /// Inserts a value to the unordered_flat_map.
+    /// If asserts or exceptions are enabled, emits unordered_flat_map_full if the unordered_flat_map is already full.
+    ///\param value The value to insert.
+    //*********************************************************************
+    ETL_OR_STD::pair<iterator, bool> insert(const_reference key_value_pair)
+    {
+      probe_result result = probe(key_value_pair.first);
+
+      if (result.found)
+      {
+        return ETL_OR_STD::pair<iterator, bool>(make_iterator(result.index), false);
+      }
+
+      value_type* p = make_space(result);
+
+      ETL_ASSERT_OR_RETURN_VALUE(p != ETL_NULLPTR, ETL_ERROR(unordered_flat_map_full), insert_result(end(), false));
+
+      ::new (p) value_type(key_value_pair);
+      ETL_INCREMENT_DEBUG_COUNT;
+
+      return ETL_OR_STD::pair<iterator, bool>(make_iterator(result.index), true);
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    /// Inserts a value to the unordered_flat_map.
+    /// If asserts or exceptions are enabled, emits unordered_flat_map_full if the unordered_flat_map is already full.
+    ///\param value The value to insert.
+    //*********************************************************************
+    ETL_OR_STD::pair<iterator, bool> insert(rvalue_reference key_value_pair)
+    {
+      probe_result result = probe(key_value_pair.first);
+
+      if (result.found)
+      {
+        return ETL_OR_STD::pair<iterator, bool>(make_iterator(result.index), false);
+      }
+
+      value_type* p = make_space(result);
+
+      ETL_ASSERT_OR_RETURN_VALUE(p != ETL_NULLPTR, ETL_ERROR(unordered_flat_map_full), insert_result(end(), false));
+
+      ::new (p) value_type(etl::move(key_value_pair));
+      ETL_INCREMENT_DEBUG_COUNT;
+
+      return ETL_OR_STD::pair<iterator, bool>(make_iterator(result.index), true);
+    }
+#endif
+
+    //*********************************************************************
+    /// Inserts a value to the unordered_flat_map.
+    /// If asserts or exceptions are enabled, emits unordered_flat_map_full if the unordered_flat_map is already full.
+    ///\param position The position to insert at.
+    ///\param value    The value to insert.
+    //*********************************************************************
+    iterator insert(const_iterator, const_reference key_value_pair)
+    {
+      return insert(key_value_pair).first;
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    /// Inserts a value to the unordered_flat_map.
+    /// If asserts or exceptions are enabled, emits unordered_flat_map_full if the unordered_flat_map is already full.
+    ///\param position The position to insert at.
+    ///\param value    The value to insert.
+    //*********************************************************************
+    iterator insert(const_iterator, rvalue_reference key_value_pair)
+    {
+      return insert(etl::move(key_value_pair)).first;
+    }
+#endif
+
+    //*********************************************************************
+    /// Inserts a range of values to the unordered_flat_map.
+    /// If asserts or exceptions are enabled, emits unordered_flat_map_full if the unordered_flat_map does not have enough free space.
+    ///\param first    The first element to add.
+    ///\param last     The last + 1 element to add.
+    //*********************************************************************
+    template <class TIterator>
+    void insert(TIterator first_, TIterator last_)
+    {
+      while (first_ != last_)
+      {
+        insert(*first_);
+        ++first_;
+      }
+    }
+
+    //*********************************************************************
+    /// Erases an element.
+    ///\param key The key to erase.
+    ///\return The number of elements erased. 0 or 1.
+    //*********************************************************************
+    size_t erase(const_key_reference key)
+    {
+      size_t index = find_index(key);
+
+      if (index == number_of_slots)
+      {
+        return 0U;
+      }
+
+      erase_at(index);
+
+      return 1U;
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    /// Erases an element.
+    ///\param key The key to erase.
+    ///\return The number of elements erased. 0 or 1.
+    //*********************************************************************
+    template <typename K, typename KE = TKeyEqual, etl::enable_if_t<comparator_is_transparent<KE>::value, int> = 0>
+    size_t erase(const K& key)
+    {
+      size_t index = find_index(key);
+
+      if (index == number_of_slots)
+      {
+        return 0U;
+      }
+
+      erase_at(index);
+
+      return 1U;
+    }
+#endif
+
+    //*********************************************************************
+    /// Erases an element.
+    /// Following elements may be shifted back in to the erased slot, so the
+    /// returned iterator may refer to the same slot.
+    /// Probes wrap around, so a shift may move an element from the start of
+    /// the table to the last slot, where an iteration would visit it again.
+    ///\param ielement Iterator to the element.
+    ///\return An iterator to the element after the erased one.
+    //*********************************************************************
+    iterator erase(const_iterator ielement)
+    {
+      size_t index = size_t(ielement.pdistance - pdistances);
+
+      erase_at(index);
+
+      // An element shifted in to the last slot has come from the start of the table.
+      return make_iterator((index == (number_of_slots - 1U)) ? number_of_slots : first_occupied(index));
+    }
+
+    //*********************************************************************
+    /// Erases a range of elements.
+    /// The range includes all the elements between first and last, including the
+    /// element pointed by first, but not the one pointed to by last.
+    ///\param first Iterator to the first element.
+    ///\param last  Iterator to the last element.
+    //*********************************************************************
+    iterator erase(const_iterator first_, const_iterator last_)
+    {
+      const size_t mask      = number_of_slots - 1U;
+      size_t       index     = size_t(first_.pdistance - pdistances);
+      size_t       end_index = size_t(last_.pdistance - pdistances);
+      const bool   to_end    = (end_index == number_of_slots);
+
+      while (index != end_index)
+      {
+        if (pdistances[index] == Empty_Slot)
+        {
+          ++index;
+        }
+        else
+        {
+          size_t shift_end = erase_at(index);
+
+          // Was the 'last' element shifted back in to the erased range?
+          // For end(), the 'last' element is the one in the first slot, as it is shifted across the end of the table.
+          size_t last_offset  = ((end_index & mask) - index) & mask;
+          size_t shift_offset = (shift_end - index) & mask;
+
+          if ((last_offset != 0U) && (last_offset < shift_offset))
+          {
+            --end_index;
+          }
+        }
+      }
+
+      return make_iterator(to_end ? number_of_slots : first_occupied(end_index));
+    }
+
+    //*************************************************************************
+    /// Clears the unordered_flat_map.
+    //*************************************************************************
+    void clear()
+    {
+      initialise();
+    }
+
+    //*********************************************************************
+    /// Counts an element.
+    ///\param key The key to search for.
+    ///\return 1 if the key exists, otherwise 0.
+    //*********************************************************************
+    size_t count(const_key_reference key) const
+    {
+      return (find_index(key) == number_of_slots) ? 0U : 1U;
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    /// Counts an element.
+    ///\param key The key to search for.
+    ///\return 1 if the key exists, otherwise 0.
+    //*********************************************************************
+    template <typename K, typename KE = TKeyEqual, etl::enable_if_t<comparator_is_transparent<KE>::value, int> = 0>
+    size_t count(const K& key) const
+    {
+      return (find_index(key) == number_of_slots) ? 0U : 1U;
+    }
+#endif
+
+    //*********************************************************************
+    /// Finds an element.
+    ///\param key The key to search for.
+    ///\return An iterator to the element if the key exists, otherwise end().
+    //*********************************************************************
+    iterator find(const_key_reference key)
+    {
+      return make_iterator(find_index(key));
+    }
+
+    //*********************************************************************
+    /// Finds an element.
+    ///\param key The key to search for.
+    ///\return An iterator to the element if the key exists, otherwise end().
+    //*********************************************************************
+    const_iterator find(const_key_reference key) const
+    {
+      return make_const_iterator(find_index(key));
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    /// Finds an element.
+    ///\param key The key to search for.
+    ///\return An iterator to the element if the key exists, otherwise end().
+    //*********************************************************************
+    template <typename K, typename KE = TKeyEqual, etl::enable_if_t<comparator_is_transparent<KE>::value, int> = 0>
+    iterator find(const K& key)
+    {
+      return make_iterator(find_index(key));
+    }
+
+    //*********************************************************************
+    /// Finds an element.
+    ///\param key The key to search for.
+    ///\return An iterator to the element if the key exists, otherwise end().
+    //*********************************************************************
+    template <typename K, typename KE = TKeyEqual, etl::enable_if_t<comparator_is_transparent<KE>::value, int> = 0>
+    const_iterator find(const K& key) const
+    {
+      return make_const_iterator(find_index(key));
+    }
+#endif
+
+    //*********************************************************************
+    /// Returns a range containing all elements with key key in the container.
+    ///\param key The key to search for.
+    ///\return An iterator pair to the range of elements if the key exists, otherwise end().
+    //*********************************************************************
+    ETL_OR_STD::pair<iterator, iterator> equal_range(const_key_reference key)
+    {
+      iterator f = find(key);
+      iterator l = f;
+
+      if (l != end())
+      {
+        ++l;
+      }
+
+      return ETL_OR_STD::pair<iterator, iterator>(f, l);
+    }
+
+    //*********************************************************************
+    /// Returns a range containing all elements with key key in the container.
+    ///\param key The key to search for.
+    ///\return A const iterator pair to the range of elements if the key exists, otherwise end().
+    //*********************************************************************
+    ETL_OR_STD::pair<const_iterator, const_iterator> equal_range(const_key_reference key) const
+    {
+      const_iterator f = find(key);
+      const_iterator l = f;
+
+      if (l != end())
+      {
+        ++l;
+      }
+
+      return ETL_OR_STD::pair<const_iterator, const_iterator>(f, l);
+    }
+
+    //*************************************************************************
+    /// Gets the size of the unordered_flat_map.
+    //*************************************************************************
+    size_type size() const
+    {
+      return current_size;
+    }
+
+    //*************************************************************************
+    /// Gets the maximum possible size of the unordered_flat_map.
+    //*************************************************************************
+    size_type max_size() const
+    {
+      return maximum_size;
+    }
+
+    //*************************************************************************
+    /// Gets the maximum possible size of the unordered_flat_map.
+    //*************************************************************************
+    size_type capacity() const
+    {
+      return maximum_size;
+    }
+
+    //*************************************************************************
+    /// Checks to see if the unordered_flat_map is empty.
+    //*************************************************************************
+    bool empty() const
+    {
+      return current_size == 0U;
+    }
+
+    //*************************************************************************
+    /// Checks to see if the unordered_flat_map is full.
+    //*************************************************************************
+    bool full() const
+    {
+      return current_size == maximum_size;
+    }
+
+    //*************************************************************************
+    /// Returns the remaining capacity.
+    ///\return The remaining capacity.
+    //*************************************************************************
+    size_t available() const
+    {
+      return maximum_size - current_size;
+    }
+
+    //*************************************************************************
+    /// Returns the load factor = size / bucket_count.
+    ///\return The load factor = size / bucket_count.
+    //*************************************************************************
+    float load_factor() const
+    {
+      return static_cast<float>(size()) / static_cast<float>(bucket_count());
+    }
+
+    //*************************************************************************
+    /// Returns the function that hashes the keys.
+    ///\return The function that hashes the keys..
+    //*************************************************************************
+    hasher hash_function() const
+    {
+      return key_hash_function;
+    }
+
+    //*************************************************************************
+    /// Returns the function that compares the keys.
+    ///\return The function that compares the keys..
+    //*************************************************************************
+    key_equal key_eq() const
+    {
+      return key_equal_function;
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    iunordered_flat_map& operator = (const iunordered_flat_map& rhs)
+    {
+      // Skip if doing self assignment
+      if (this != &rhs)
+      {
+        key_hash_function  = rhs.hash_function();
+        key_equal_function = rhs.key_eq();
+        assign(rhs.cbegin(), rhs.cend());
+      }
+
+      return *this;
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    iunordered_flat_map& operator = (iunordered_flat_map&& rhs)
+    {
+      // Skip if doing self assignment
+      if (this != &rhs)
+      {
+        clear();
+        key_hash_function  = rhs.hash_function();
+        key_equal_function = rhs.key_eq();
+        this->move(rhs.begin(), rhs.end());
+      }
+
+      return *this;
+    }
+#endif
+
+    //*************************************************************************
+    /// Check if the unordered_flat_map contains the key.
+    //*************************************************************************
+    bool contains(const_key_reference key) const
+    {
+      return find_index(key) != number_of_slots;
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Check if the unordered_flat_map contains the key.
+    //*************************************************************************
+    template <typename K, typename KE = TKeyEqual, etl::enable_if_t<comparator_is_transparent<KE>::value, int> = 0>
+    bool contains(const K& key) const
+    {
+      return find_index(key) != number_of_slots;
+    }
+#endif
+
+  protected:
+
+    //*********************************************************************
+    /// Constructor.
+    /// Both buffers must contain required_slots(max_size_) elements.
+    //*********************************************************************
+    iunordered_flat_map(pointer pvalues_, distance_type* pdistances_, size_t max_size_, hasher key_hash_function_, key_equal key_equal_function_)
+      : pvalues(pvalues_)
+      , pdistances(pdistances_)
+      , maximum_size(max_size_)
+      , number_of_slots(required_slots(max_size_))
+      , hash_shift(calculate_hash_shift(number_of_slots))
+      , current_size(0U)
+      , key_hash_function(key_hash_function_)
+      , key_equal_function(key_equal_function_)
+    {
+      etl::fill_n(pdistances, number_of_slots, Empty_Slot);
+    }
+
+    //*********************************************************************
+    /// Initialise the unordered_flat_map.
+    //*********************************************************************
+    void initialise()
+    {
+      if (!empty())
+      {
+        for (size_t i = 0U; i < number_of_slots; ++i)
+        {
+          if (pdistances[i] != Empty_Slot)
+          {
+            pvalues[i].~value_type();
+            pdistances[i] = Empty_Slot;
+            ETL_DECREMENT_DEBUG_COUNT;
+          }
+        }
+
+        current_size = 0U;
+      }
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move from a range
+    //*************************************************************************
+    void move(iterator b, iterator e)
+    {
+      while (b != e)
+      {
+        insert(etl::move(*b));
+        ++b;
+      }
+    }
+#endif
+
+  private:
+
+    typedef ETL_OR_STD::pair<iterator, bool> insert_result;
+
+    //*********************************************************************
+    /// The result of probing for a key.
+    /// If found, 'index' is the key's slot.
+    /// If not found, 'index' is the slot where the key should be inserted,
+    /// 'distance' is its probe distance, or 'index' is number_of_slots if
+    /// no slot is available.
+    /// There are more slots than elements, so every probe reaches an empty slot.
+    //*********************************************************************
+    struct probe_result
+    {
+      size_t        index;
+      distance_type distance;
+      bool          found;
+    };
+
+    //*********************************************************************
+    /// Calculates the shift that maps a mixed hash to a bucket.
+    /// There are at least 2 buckets, so the shift is less than the width of size_t.
+    //*********************************************************************
+    static int calculate_hash_shift(size_t buckets)
+    {
+      int shift = int(etl::integral_limits<size_t>::bits);
+
+      while (buckets > 1U)
+      {
+        buckets >>= 1U;
+        --shift;
+      }
+
+      return shift;
+    }
+
+    //*********************************************************************
+    /// Gets the home slot for a key.
+    /// Fibonacci hashing spreads poorly distributed hashes, such as the
+    /// identity hash used for integers, across the buckets.
+    //*********************************************************************
+    template <typename K>
+    size_t get_home_index(const K& key) const
+    {
+      size_t hash = key_hash_function(key);
+
+      if ETL_IF_CONSTEXPR(sizeof(size_t) >= sizeof(uint64_t))
+      {
+        hash *= static_cast<size_t>(0x9E3779B97F4A7C15ULL);
+      }
+      else
+      {
+        hash *= static_cast<size_t>(0x9E3779B9UL);
+      }
+
+      return hash >> hash_shift;
+    }
+
+    //*********************************************************************
+    /// Finds the slot for a key, or number_of_slots if not present.
+    /// Stops at the first slot that is empty or whose element is closer to
+    /// its home than the key would be, as the key cannot be any further on.
+    //*********************************************************************
+    template <typename K>
+    size_t find_index(const K& key) const
+    {
+      const size_t mask     = number_of_slots - 1U;
+      size_t       index    = get_home_index(key);
+      uint32_t     distance = 1U;
+
+      while (pdistances[index] >= distance)
+      {
+        // Only elements with the same distance share the key's home slot.
+        if ((pdistances[index] == distance) && key_equal_function(pvalues[index].first, key))
+        {
+          return index;
+        }
+
+        index = (index + 1U) & mask;
+        ++distance;
+      }
+
+      return number_of_slots;
+    }
+
+    //*********************************************************************
+    /// Finds the slot for a key, or where it should be inserted.
+    //*********************************************************************
+    template <typename K>
+    probe_result probe(const K& key) const
+    {
+      probe_result result;
+
+      const size_t mask     = number_of_slots - 1U;
+      size_t       index    = get_home_index(key);
+      uint32_t     distance = 1U;
+
+      while (pdistances[index] >= distance)
+      {
+        if ((pdistances[index] == distance) && key_equal_function(pvalues[index].first, key))
+        {
+          result.index    = index;
+          result.distance = distance_type(distance);
+          result.found    = true;
+
+          return result;
+        }
+
+        index = (index + 1U) & mask;
+        ++distance;
+      }
+
+      result.found = false;
+
+      if (full() || (distance > Max_Distance))
+      {
+        result.index    = number_of_slots;
+        result.distance = Empty_Slot;
+      }
+      else
+      {
+        result.index    = index;
+        result.distance = distance_type(distance);
+      }
+
+      return result;
+    }
+
+    //*********************************************************************
+    /// Makes space for a new element at the probed insertion slot, by
+    /// shifting the following run of elements up by one slot.
+    /// Returns the address of the uninitialised slot, or ETL_NULLPTR if
+    /// the run cannot be shifted.
+    //*********************************************************************
+    pointer make_space(const probe_result& result)
+    {
+      if (result.index == number_of_slots)
+      {
+        return ETL_NULLPTR;
+      }
+
+      const size_t mask        = number_of_slots - 1U;
+      size_t       empty_index = result.index;
+
+      // Find the end of the run, checking that no distance would overflow.
+      while (pdistances[empty_index] != Empty_Slot)
+      {
+        if (pdistances[empty_index] == Max_Distance)
+        {
+          return ETL_NULLPTR;
+        }
+
+        empty_index = (empty_index + 1U) & mask;
+      }
+
+      // Shift the run up.
+      for (size_t i = empty_index; i != result.index; i = (i - 1U) & mask)
+      {
+        const size_t previous = (i - 1U) & mask;
+
+        ::new (pvalues + i) value_type(ETL_MOVE(pvalues[previous]));
+        pvalues[previous].~value_type();
+        pdistances[i] = pdistances[previous] + 1U;
+      }
+
+      pdistances[result.index] = result.distance;
+      ++current_size;
+
+      return pvalues + result.index;
+    }
+
+    //*********************************************************************
+    /// Erases the element at the index and shifts the following elements
+    /// back towards their home slots.
+    /// Returns the index of the first slot that was not shifted.
+    //*********************************************************************
+    size_t erase_at(size_t index)
+    {
+      pvalues[index].~value_type();
+      ETL_DECREMENT_DEBUG_COUNT;
+
+      const size_t mask     = number_of_slots - 1U;
+      size_t       previous = index;
+      size_t       next     = (index + 1U) & mask;
+
+      while (pdistances[next] > 1U)
+      {
+        ::new (pvalues + previous) value_type(ETL_MOVE(pvalues[next]));
+        pvalues[next].~value_type();
+        pdistances[previous] = pdistances[next] - 1U;
+        previous = next;
+        next     = (next + 1U) & mask;
+      }
+
+      pdistances[previous] = Empty_Slot;
+      --current_size;
+
+      return next;
+    }
+
+    //*********************************************************************
+    /// Returns the index of the first occupied slot at or after index.
+    //*********************************************************************
+    size_t first_occupied(size_t index) const
+    {
+      while ((index < number_of_slots) && (pdistances[index] == Empty_Slot))
+      {
+        ++index;
+      }
+
+      return index;
+    }
+
+    //*********************************************************************
+    /// Common operator [] implementation.
+    //*********************************************************************
+    template <typename K>
+    mapped_reference subscript(const K& key)
+    {
+      probe_result result = probe(key);
+
+      if (!result.found)
+      {
+        pointer p = make_space(result);
+
+        ETL_ASSERT_OR_RETURN_VALUE(p != ETL_NULLPTR, ETL_ERROR(unordered_flat_map_full), pvalues[first_empty()].second);
+
+        ::new (p) value_type(key_type(key), mapped_type());
+        ETL_INCREMENT_DEBUG_COUNT;
+      }
+
+      return pvalues[result.index].second;
+    }
+
+    //*********************************************************************
+    /// Returns the index of the first empty slot.
+    /// Used by operator [] when a new key cannot be added and asserts are
+    /// disabled. The slot is not an element and its value is not constructed.
+    //*********************************************************************
+    size_t first_empty() const
+    {
+      size_t index = 0U;
+
+      while (pdistances[index] != Empty_Slot)
+      {
+        ++index;
+      }
+
+      return index;
+    }
+
+    //*********************************************************************
+    iterator make_iterator(size_t index)
+    {
+      return iterator(pvalues + index, pdistances + index, pdistances + number_of_slots);
+    }
+
+    //*********************************************************************
+    const_iterator make_const_iterator(size_t index) const
+    {
+      return const_iterator(pvalues + index, pdistances + index, pdistances + number_of_slots);
+    }
+
+    // Disable copy construction.
+    iunordered_flat_map(const iunordered_flat_map&);
+
+    /// The element slots.
+    pointer pvalues;
+
+    /// The probe distance + 1 for each slot. 0 = empty.
+    distance_type* pdistances;
+
+    /// The maximum number of elements.
+    const size_t maximum_size;
+
+    /// The number of slots. Each is the home slot of a bucket.
+    const size_t number_of_slots;
+
+    /// The shift that maps a mixed hash to a home slot.
+    const int hash_shift;
+
+    /// The number of elements.
+    size_t current_size;
+
+    /// The function that creates the hashes.
+    hasher key_hash_function;
+
+    /// The function that compares the keys for equality.
+    key_equal key_equal_function;
+
+    /// For library debugging purposes only.
+    ETL_DECLARE_DEBUG_COUNT;
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+#if defined(ETL_POLYMORPHIC_UNORDERED_FLAT_MAP) || defined(ETL_POLYMORPHIC_CONTAINERS)
+  public:
+    virtual ~iunordered_flat_map()
+    {
+    }
+#else
+  protected:
+    ~iunordered_flat_map()
+    {
+    }
+#endif
+  };
+
+  template <typename TKey, typename T, typename THash, typename TKeyEqual>
+  ETL_CONSTANT typename iunordered_flat_map<TKey, T, THash, TKeyEqual>::distance_type iunordered_flat_map<TKey, T, THash, TKeyEqual>::Empty_Slot;
+
+  template <typename TKey, typename T, typename THash, typename TKeyEqual>
+  ETL_CONSTANT typename iunordered_flat_map<TKey, T, THash, TKeyEqual>::distance_type iunordered_flat_map<TKey, T, THash, TKeyEqual>::Max_Distance;
+
+  //***************************************************************************
+  /// Equal operator.
+  ///\param lhs Reference to the first unordered_flat_map.
+  ///\param rhs Reference to the second unordered_flat_map.
+  ///\return <b>true</b> if the maps are equal, otherwise <b>false</b>
+  ///\ingroup unordered_flat_map
+  //***************************************************************************
+  template <typename TKey, typename T, typename THash, typename TKeyEqual>
+  bool operator ==(const etl::iunordered_flat_map<TKey, T, THash, TKeyEqual>& lhs,
+                   const etl::iunordered_flat_map<TKey, T, THash, TKeyEqual>& rhs)
+  {
+    if (lhs.size() != rhs.size())
+    {
+      return false;
+    }
+
+    typedef typename etl::iunordered_flat_map<TKey, T, THash, TKeyEqual>::const_iterator itr_t;
+
+    for (itr_t itr = lhs.begin(); itr != lhs.end(); ++itr)
+    {
+      itr_t ritr = rhs.find(itr->first);
+
+      if ((ritr == rhs.end()) || !(ritr->second == itr->second))
+      {
+        return false;
+      }
+    }
+
+    return true;
+  }
+
+  //***************************************************************************
+  /// Not equal operator.
+  ///\param lhs Reference to the first unordered_flat_map.
+  ///\param rhs Reference to the second unordered_flat_map.
+  ///\return <b>true</b> if the maps are not equal, otherwise <b>false</b>
+  ///\ingroup unordered_flat_map
+  //***************************************************************************
+  template <typename TKey, typename T, typename THash, typename TKeyEqual>
+  bool operator !=(const etl::iunordered_flat_map<TKey, T, THash, TKeyEqual>& lhs,
+                   const etl::iunordered_flat_map<TKey, T, THash, TKeyEqual>& rhs)
+  {
+    return !(lhs == rhs);
+  }
+
+  //*************************************************************************
+  /// A templated unordered_flat_map implementation that uses a fixed size buffer.
+  //*************************************************************************
+  template <typename TKey, typename TValue, const size_t MAX_SIZE_, typename THash = etl::hash<TKey>, typename TKeyEqual = etl::equal_to<TKey> >
+  class unordered_flat_map : public etl::iunordered_flat_map<TKey, TValue, THash, TKeyEqual>
+  {
+  private:
+
+    typedef etl::iunordered_flat_map<TKey, TValue, THash, TKeyEqual> base;
+
+  public:
+
+    ETL_STATIC_ASSERT(MAX_SIZE_ <= base::Max_Distance, "MAX_SIZE_ too large for the probe distances");
+
+    static ETL_CONSTANT size_t MAX_SIZE    = MAX_SIZE_;
+    static ETL_CONSTANT size_t MAX_BUCKETS = etl::unordered_flat_map_dimensions<MAX_SIZE_>::Buckets;
+    static ETL_CONSTANT size_t MAX_SLOTS   = etl::unordered_flat_map_dimensions<MAX_SIZE_>::Slots;
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    unordered_flat_map(const THash& hash = THash(), const TKeyEqual& equal = TKeyEqual())
+      : base(values, distances, MAX_SIZE_, hash, equal)
+    {
+    }
+
+    //*************************************************************************
+    /// Copy constructor.
+    //*************************************************************************
+    unordered_flat_map(const unordered_flat_map& other)
+      : base(values, distances, MAX_SIZE_, other.hash_function(), other.key_eq())
+    {
+      base::assign(other.cbegin(), other.cend());
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move constructor.
+    //*************************************************************************
+    unordered_flat_map(unordered_flat_map&& other)
+      : base(values, distances, MAX_SIZE_, other.hash_function(), other.key_eq())
+    {
+      if (this != &other)
+      {
+        base::move(other.begin(), other.end());
+      }
+    }
+#endif
+
+    //*************************************************************************
+    /// Constructor, from an iterator range.
+    ///\tparam TIterator The iterator type.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*************************************************************************
+    template <typename TIterator>
+    unordered_flat_map(TIterator first_, TIterator last_, const THash& hash = THash(), const TKeyEqual& equal = TKeyEqual())
+      : base(values, distances, MAX_SIZE_, hash, equal)
+    {
+      base::assign(first_, last_);
+    }
+
+#if ETL_HAS_INITIALIZER_LIST
+    //*************************************************************************
+    /// Construct from initializer_list.
+    //*************************************************************************
+    unordered_flat_map(std::initializer_list<ETL_OR_STD::pair<TKey, TValue>> init, const THash& hash = THash(), const TKeyEqual& equal = TKeyEqual())
+      : base(values, distances, MAX_SIZE_, hash, equal)
+    {
+      base::assign(init.begin(), init.end());
+    }
+#endif
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~unordered_flat_map()
+    {
+      base::initialise();
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    unordered_flat_map& operator = (const unordered_flat_map& rhs)
+    {
+      base::operator=(rhs);
+      return *this;
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    unordered_flat_map& operator = (unordered_flat_map&& rhs)
+    {
+      base::operator=(etl::move(rhs));
+      return *this;
+    }
+#endif
+
+  private:
+
+    /// The element slots.
+    etl::uninitialized_buffer_of<typename base::value_type, MAX_SLOTS> values;
+
+    /// The probe distances.
+    typename base::distance_type distances[MAX_SLOTS];
+  };
+
+  template <typename TKey, typename TValue, const size_t MAX_SIZE_, typename THash, typename TKeyEqual>
+  ETL_CONSTANT size_t unordered_flat_map<TKey, TValue, MAX_SIZE_, THash, TKeyEqual>::MAX_SIZE;
+
+  template <typename TKey, typename TValue, const size_t MAX_SIZE_, typename THash, typename TKeyEqual>
+  ETL_CONSTANT size_t unordered_flat_map<TKey, TValue, MAX_SIZE_, THash, TKeyEqual>::MAX_BUCKETS;
+
+  template <typename TKey, typename TValue, const size_t MAX_SIZE_, typename THash, typename TKeyEqual>
+  ETL_CONSTANT size_t unordered_flat_map<TKey, TValue, MAX_SIZE_, THash, TKeyEqual>::MAX_SLOTS;
+
+  //*************************************************************************
+  /// A templated unordered_flat_map implementation that uses external buffers.
+  /// Both buffers must contain iunordered_flat_map::required_slots(max_size)
+  /// elements, or etl::unordered_flat_map_dimensions<Max_Size>::Slots.
+  /// The full capacity is only guaranteed if max_size is no more than
+  /// iunordered_flat_map::Max_Distance.
+  //*************************************************************************
+  template <typename TKey, typename TValue, typename THash = etl::hash<TKey>, typename TKeyEqual = etl::equal_to<TKey> >
+  class unordered_flat_map_ext : public etl::iunordered_flat_map<TKey, TValue, THash, TKeyEqual>
+  {
+  private:
+
+    typedef etl::iunordered_flat_map<TKey, TValue, THash, TKeyEqual> base;
+
+  public:
+
+    //*************************************************************************
+    /// Constructor.
+    ///\param value_buffer    Uninitialised storage for the elements.
+    ///\param distance_buffer Storage for the probe distances.
+    ///\param max_size        The maximum number of elements.
+    //*************************************************************************
+    unordered_flat_map_ext(void* value_buffer, typename base::distance_type* distance_buffer, size_t max_size, const THash& hash = THash(), const TKeyEqual& equal = TKeyEqual())
+      : base(reinterpret_cast<typename base::pointer>(value_buffer), distance_buffer, max_size, hash, equal)
+    {
+    }
+
+    //*************************************************************************
+    /// Copy constructor.
+    //*************************************************************************
+    unordered_flat_map_ext(const unordered_flat_map_ext& other, void* value_buffer, typename base::distance_type* distance_buffer, size_t max_size)
+      : base(reinterpret_cast<typename base::pointer>(value_buffer), distance_buffer, max_size, other.hash_function(), other.key_eq())
+    {
+      base::assign(other.cbegin(), other.cend());
+    }
+
+    //*************************************************************************
+    /// Constructor, from an iterator range.
+    ///\tparam TIterator The iterator type.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*************************************************************************
+    template <typename TIterator>
+    unordered_flat_map_ext(TIterator first_, TIterator last_, void* value_buffer, typename base::distance_type* distance_buffer, size_t max_size, const THash& hash = THash(), const TKeyEqual& equal = TKeyEqual())
+      : base(reinterpret_cast<typename base::pointer>(value_buffer), distance_buffer, max_size, hash, equal)
+    {
+      base::assign(first_, last_);
+    }
+
+#if ETL_HAS_INITIALIZER_LIST
+    //*************************************************************************
+    /// Construct from initializer_list.
+    //*************************************************************************
+    unordered_flat_map_ext(std::initializer_list<ETL_OR_STD::pair<TKey, TValue>> init, void* value_buffer, typename base::distance_type* distance_buffer, size_t max_size, const THash& hash = THash(), const TKeyEqual& equal = TKeyEqual())
+      : base(reinterpret_cast<typename base::pointer>(value_buffer), distance_buffer, max_size, hash, equal)
+    {
+      base::assign(init.begin(), init.end());
+    }
+#endif
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~unordered_flat_map_ext()
+    {
+      base::initialise();
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    unordered_flat_map_ext& operator = (const unordered_flat_map_ext& rhs)
+    {
+      base::operator=(rhs);
+      return *this;
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    unordered_flat_map_ext& operator = (unordered_flat_map_ext&& rhs)
+    {
+      base::operator=(etl::move(rhs));
+      return *this;
+    }
+#endif
+
+  private:
+
+    // Disable copy construction without buffers.
+    unordered_flat_map_ext(const unordered_flat_map_ext&) ETL_DELETE;
+  };
+}
+
+#endif
@@ -0,0 +1,424 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_XXHASH_INCLUDED
+#define ETL_XXHASH_INCLUDED
+
+#include "platform.h"
+#include "static_assert.h"
+#include "type_traits.h"
+#include "binary.h"
+#include "ihash.h"
+#include "frame_check_sequence.h"
+
+#include <stdint.h>
+#include <stddef.h>
+
+#if defined(ETL_COMPILER_KEIL)
+#pragma diag_suppress 1300
+#endif
+
+///\defgroup xxhash xxHash 32 & 64 bit hash calculations
+/// XXH3 is not provided. Its streaming state is over 500 octets, including a
+/// 256 octet input buffer and a 192 octet secret.
+///\ingroup maths
+
+namespace etl
+{
+  //***************************************************************************
+  /// xxhash32 policy.
+  /// Calculates XXH32.
+  /// The frame check value is the number of octets added.
+  /// Octets are buffered until there is a full stripe of 16.
+  //***************************************************************************
+  struct xxhash32_policy
+  {
+    typedef uint32_t value_type;
+
+    explicit xxhash32_policy(uint32_t seed_ = 0U)
+      : seed(seed_)
+      , accumulator()
+      , buffer()
+      , buffer_size(0U)
+      , has_stripes(false)
+    {
+    }
+
+    uint32_t initial() const
+    {
+      accumulator[0] = seed + PRIME1 + PRIME2;
+      accumulator[1] = seed + PRIME2;
+      accumulator[2] = seed;
+      accumulator[3] = seed - PRIME1;
+      buffer_size    = 0U;
+      has_stripes    = false;
+
+      return 0U;
+    }
+
+    uint32_t add(uint32_t length, uint8_t value) const
+    {
+      buffer[buffer_size++] = value;
+
+      if (buffer_size == Stripe_Size)
+      {
+        add_stripe(buffer);
+        buffer_size = 0U;
+      }
+
+      return length + 1U;
+    }
+
+    template <typename TIterator>
+    uint32_t add_block(uint32_t length, TIterator data) const
+    {
+      if (buffer_size == 0U)
+      {
+        add_stripe(data);
+
+        return length + Stripe_Size;
+      }
+
+      for (size_t i = 0U; i < Stripe_Size; ++i)
+      {
+        length = add(length, static_cast<uint8_t>(data[i]));
+      }
+
+      return length;
+    }
+
+    uint32_t final(uint32_t length) const
+    {
+      uint32_t hash;
+
+      if (has_stripes)
+      {
+        hash = etl::rotate_left(accumulator[0], 1U)  + etl::rotate_left(accumulator[1], 7U) +
+               etl::rotate_left(accumulator[2], 12U) + etl::rotate_left(accumulator[3], 18U);
+      }
+      else
+      {
+        hash = seed + PRIME5;
+      }
+
+      hash += length;
+
+      size_t i = 0U;
+
+      for (; (i + 4U) <= buffer_size; i += 4U)
+      {
+        hash += etl::private_frame_check_sequence::read_uint32_le(buffer + i) * PRIME3;
+        hash  = etl::rotate_left(hash, 17U) * PRIME4;
+      }
+
+      for (; i < buffer_size; ++i)
+      {
+        hash += buffer[i] * PRIME5;
+        hash  = etl::rotate_left(hash, 11U) * PRIME1;
+      }
+
+      hash ^= hash >> 15U;
+      hash *= PRIME2;
+      hash ^= hash >> 13U;
+      hash *= PRIME3;
+      hash ^= hash >> 16U;
+
+      return hash;
+    }
+
+    static ETL_CONSTANT size_t   Stripe_Size = 16U;
+    static ETL_CONSTANT uint32_t PRIME1      = 0x9E3779B1UL;
+    static ETL_CONSTANT uint32_t PRIME2      = 0x85EBCA77UL;
+    static ETL_CONSTANT uint32_t PRIME3      = 0xC2B2AE3DUL;
+    static ETL_CONSTANT uint32_t PRIME4      = 0x27D4EB2FUL;
+    static ETL_CONSTANT uint32_t PRIME5      = 0x165667B1UL;
+
+  private:
+
+    static uint32_t round(uint32_t accumulator_, uint32_t input)
+    {
+      accumulator_ += input * PRIME2;
+      accumulator_  = etl::rotate_left(accumulator_, 13U);
+
+      return accumulator_ * PRIME1;
+    }
+
+    template <typename TIterator>
+    void add_stripe(TIterator data) const
+    {
+      accumulator[0] = round(accumulator[0], etl::private_frame_check_sequence::read_uint32_le(data));
+      accumulator[1] = round(accumulator[1], etl::private_frame_check_sequence::read_uint32_le(data + 4));
+      accumulator[2] = round(accumulator[2], etl::private_frame_check_sequence::read_uint32_le(data + 8));
+      accumulator[3] = round(accumulator[3], etl::private_frame_check_sequence::read_uint32_le(data + 12));
+
+      has_stripes = true;
+    }
+
+    uint32_t         seed;
+    mutable uint32_t accumulator[4];
+    mutable uint8_t  buffer[Stripe_Size];
+    mutable size_t   buffer_size;
+    mutable bool     has_stripes;
+  };
+
+  //***************************************************************************
+  /// xxhash32 processes a stripe of 16 octets per block.
+  //***************************************************************************
+  template <>
+  struct frame_check_sequence_block_size<xxhash32_policy> : public etl::integral_constant<size_t, xxhash32_policy::Stripe_Size>
+  {
+  };
+
+  //***************************************************************************
+  /// Calculates the xxhash32 hash.
+  /// See https://github.com/Cyan4973/xxHash for more details.
+  ///\ingroup xxhash
+  //***************************************************************************
+  class xxhash32 : public etl::frame_check_sequence<xxhash32_policy>
+  {
+  public:
+
+    //*************************************************************************
+    /// Default constructor.
+    /// \param seed The seed value. Default = 0.
+    //*************************************************************************
+    explicit xxhash32(uint32_t seed = 0U)
+      : etl::frame_check_sequence<xxhash32_policy>(xxhash32_policy(seed))
+    {
+    }
+
+    //*************************************************************************
+    /// Constructor from range.
+    /// \param begin Start of the range.
+    /// \param end   End of the range.
+    /// \param seed  The seed value. Default = 0.
+    //*************************************************************************
+    template<typename TIterator>
+    xxhash32(TIterator begin, const TIterator end, uint32_t seed = 0U)
+      : etl::frame_check_sequence<xxhash32_policy>(xxhash32_policy(seed))
+    {
+      this->add(begin, end);
+    }
+  };
+
+#if ETL_USING_64BIT_TYPES
+  //***************************************************************************
+  /// xxhash64 policy.
+  /// Calculates XXH64.
+  /// The frame check value is the number of octets added.
+  /// Octets are buffered until there is a full stripe of 32.
+  //***************************************************************************
+  struct xxhash64_policy
+  {
+    typedef uint64_t value_type;
+
+    explicit xxhash64_policy(uint64_t seed_ = 0U)
+      : seed(seed_)
+      , accumulator()
+      , buffer()
+      , buffer_size(0U)
+    {
+    }
+
+    uint64_t initial() const
+    {
+      accumulator[0] = seed + PRIME1 + PRIME2;
+      accumulator[1] = seed + PRIME2;
+      accumulator[2] = seed;
+      accumulator[3] = seed - PRIME1;
+      buffer_size    = 0U;
+
+      return 0U;
+    }
+
+    uint64_t add(uint64_t length, uint8_t value) const
+    {
+      buffer[buffer_size++] = value;
+
+      if (buffer_size == Stripe_Size)
+      {
+        add_stripe(buffer);
+        buffer_size = 0U;
+      }
+
+      return length + 1U;
+    }
+
+    template <typename TIterator>
+    uint64_t add_block(uint64_t length, TIterator data) const
+    {
+      if (buffer_size == 0U)
+      {
+        add_stripe(data);
+
+        return length + Stripe_Size;
+      }
+
+      for (size_t i = 0U; i < Stripe_Size; ++i)
+      {
+        length = add(length, static_cast<uint8_t>(data[i]));
+      }
+
+      return length;
+    }
+
+    uint64_t final(uint64_t length) const
+    {
+      uint64_t hash;
+
+      if (length >= Stripe_Size)
+      {
+        hash = etl::rotate_left(accumulator[0], 1U)  + etl::rotate_left(accumulator[1], 7U) +
+               etl::rotate_left(accumulator[2], 12U) + etl::rotate_left(accumulator[3], 18U);
+
+        hash = merge_round(hash, accumulator[0]);
+        hash = merge_round(hash, accumulator[1]);
+        hash = merge_round(hash, accumulator[2]);
+        hash = merge_round(hash, accumulator[3]);
+      }
+      else
+      {
+        hash = seed + PRIME5;
+      }
+
+      hash += length;
+
+      size_t i = 0U;
+
+      for (; (i + 8U) <= buffer_size; i += 8U)
+      {
+        hash ^= round(0U, etl::private_frame_check_sequence::read_uint64_le(buffer + i));
+        hash  = (etl::rotate_left(hash, 27U) * PRIME1) + PRIME4;
+      }
+
+      if ((i + 4U) <= buffer_size)
+      {
+        hash ^= uint64_t(etl::private_frame_check_sequence::read_uint32_le(buffer + i)) * PRIME1;
+        hash  = (etl::rotate_left(hash, 23U) * PRIME2) + PRIME3;
+        i += 4U;
+      }
+
+      for (; i < buffer_size; ++i)
+      {
+        hash ^= buffer[i] * PRIME5;
+        hash  = etl::rotate_left(hash, 11U) * PRIME1;
+      }
+
+      hash ^= hash >> 33U;
+      hash *= PRIME2;
+      hash ^= hash >> 29U;
+      hash *= PRIME3;
+      hash ^= hash >> 32U;
+
+      return hash;
+    }
+
+    static ETL_CONSTANT size_t   Stripe_Size = 32U;
+    static ETL_CONSTANT uint64_t PRIME1      = 0x9E3779B185EBCA87ULL;
+    static ETL_CONSTANT uint64_t PRIME2      = 0xC2B2AE3D27D4EB4FULL;
+    static ETL_CONSTANT uint64_t PRIME3      = 0x165667B19E3779F9ULL;
+    static ETL_CONSTANT uint64_t PRIME4      = 0x85EBCA77C2B2AE63ULL;
+    static ETL_CONSTANT uint64_t PRIME5      = 0x27D4EB2F165667C5ULL;
+
+  private:
+
+    static uint64_t round(uint64_t accumulator_, uint64_t input)
+    {
+      accumulator_ += input * PRIME2;
+      accumulator_  = etl::rotate_left(accumulator_, 31U);
+
+      return accumulator_ * PRIME1;
+    }
+
+    static uint64_t merge_round(uint64_t hash, uint64_t accumulator_)
+    {
+      hash ^= round(0U, accumulator_);
+
+      return (hash * PRIME1) + PRIME4;
+    }
+
+    template <typename TIterator>
+    void add_stripe(TIterator data) const
+    {
+      accumulator[0] = round(accumulator[0], etl::private_frame_check_sequence::read_uint64_le(data));
+      accumulator[1] = round(accumulator[1], etl::private_frame_check_sequence::read_uint64_le(data + 8));
+      accumulator[2] = round(accumulator[2], etl::private_frame_check_sequence::read_uint64_le(data + 16));
+      accumulator[3] = round(accumulator[3], etl::private_frame_check_sequence::read_uint64_le(data + 24));
+    }
+
+    uint64_t         seed;
+    mutable uint64_t accumulator[4];
+    mutable uint8_t  buffer[Stripe_Size];
+    mutable size_t   buffer_size;
+  };
+
+  //***************************************************************************
+  /// xxhash64 processes a stripe of 32 octets per block.
+  //***************************************************************************
+  template <>
+  struct frame_check_sequence_block_size<xxhash64_policy> : public etl::integral_constant<size_t, xxhash64_policy::Stripe_Size>
+  {
+  };
+
+  //***************************************************************************
+  /// Calculates the xxhash64 hash.
+  /// See https://github.com/Cyan4973/xxHash for more details.
+  ///\ingroup xxhash
+  //***************************************************************************
+  class xxhash64 : public etl::frame_check_sequence<xxhash64_policy>
+  {
+  public:
+
+    //*************************************************************************
+    /// Default constructor.
+    /// \param seed The seed value. Default = 0.
+    //*************************************************************************
+    explicit xxhash64(uint64_t seed = 0U)
+      : etl::frame_check_sequence<xxhash64_policy>(xxhash64_policy(seed))
+    {
+    }
+
+    //*************************************************************************
+    /// Constructor from range.
+    /// \param begin Start of the range.
+    /// \param end   End of the range.
+    /// \param seed  The seed value. Default = 0.
+    //*************************************************************************
+    template<typename TIterator>
+    xxhash64(TIterator begin, const TIterator end, uint64_t seed = 0U)
+      : etl::frame_check_sequence<xxhash64_policy>(xxhash64_policy(seed))
+    {
+      this->add(begin, end);
+    }
+  };
+#endif
+}
+
+#endif
@@ -0,0 +1,175 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+// Compares the throughput of encoding and decoding Base64 one character at a
+// time with encoding and decoding whole spans, which use the block kernels.
+// Build with -mssse3 or -mavx2 to use the SIMD kernels.
+
+#include "benchmark.h"
+
+#include "etl/base64_encoder.h"
+#include "etl/base64_decoder.h"
+
+#include <random>
+#include <vector>
+
+namespace
+{
+  const size_t Buffer_Size = 3UL * 1024UL * 1024UL;
+  const size_t Iterations  = 10UL;
+
+  typedef etl::base64_rfc4648_padding_encoder<4096> encoder_type;
+  typedef etl::base64_rfc4648_padding_decoder<3072> decoder_type;
+
+  std::vector<uint8_t> buffer;
+  std::vector<char>    encoded;
+
+  size_t output_length = 0UL;
+
+  void on_encoded(const encoder_type::span_type& sp)
+  {
+    output_length += sp.size();
+  }
+
+  void on_decoded(const decoder_type::span_type& sp)
+  {
+    output_length += sp.size();
+  }
+
+  //***************************************************************************
+  void report(const char* name, benchmark::timer& timer, size_t bytes)
+  {
+    double seconds = timer.elapsed_ns() / 1000000000.0;
+    double gb      = double(bytes * Iterations) / (1024.0 * 1024.0 * 1024.0);
+
+    benchmark::do_not_optimise(output_length);
+
+    printf("%-20s %10.2f GB/s\n", name, gb / seconds);
+  }
+
+  //***************************************************************************
+  void run_encode_by_char()
+  {
+    encoder_type b64(encoder_type::callback_type::create<on_encoded>());
+
+    benchmark::timer timer;
+
+    for (size_t i = 0UL; i < Iterations; ++i)
+    {
+      for (size_t j = 0UL; j < buffer.size(); ++j)
+      {
+        b64.encode(buffer[j]);
+      }
+
+      b64.flush();
+    }
+
+    report("encode by char", timer, buffer.size());
+  }
+
+  //***************************************************************************
+  void run_encode_span()
+  {
+    encoder_type b64(encoder_type::callback_type::create<on_encoded>());
+
+    benchmark::timer timer;
+
+    for (size_t i = 0UL; i < Iterations; ++i)
+    {
+      b64.encode_final(etl::span<const uint8_t>(buffer.data(), buffer.size()));
+    }
+
+    report("encode span", timer, buffer.size());
+  }
+
+  //***************************************************************************
+  void run_decode_by_char()
+  {
+    decoder_type b64(decoder_type::callback_type::create<on_decoded>());
+
+    benchmark::timer timer;
+
+    for (size_t i = 0UL; i < Iterations; ++i)
+    {
+      for (size_t j = 0UL; j < encoded.size(); ++j)
+      {
+        b64.decode(encoded[j]);
+      }
+
+      b64.flush();
+    }
+
+    report("decode by char", timer, encoded.size());
+  }
+
+  //***************************************************************************
+  void run_decode_span()
+  {
+    decoder_type b64(decoder_type::callback_type::create<on_decoded>());
+
+    benchmark::timer timer;
+
+    for (size_t i = 0UL; i < Iterations; ++i)
+    {
+      b64.decode_final(etl::span<const char>(encoded.data(), encoded.size()));
+    }
+
+    report("decode span", timer, encoded.size());
+  }
+}
+
+//*****************************************************************************
+int main()
+{
+  std::mt19937 rng(12345);
+
+  buffer.resize(Buffer_Size);
+
+  for (size_t i = 0UL; i < Buffer_Size; ++i)
+  {
+    buffer[i] = uint8_t(rng());
+  }
+
+  etl::base64_rfc4648_padding_encoder<4096> encoder;
+
+  for (size_t i = 0UL; i < Buffer_Size; i += 3072UL)
+  {
+    encoder.restart();
+    encoder.encode(buffer.data() + i, 3072UL);
+    encoded.insert(encoded.end(), encoder.begin(), encoder.end());
+  }
+
+  printf("Base64 SIMD: %s\n\n", ETL_USING_BASE64_SIMD ? "yes" : "no");
+
+  run_encode_by_char();
+  run_encode_span();
+  run_decode_by_char();
+  run_decode_span();
+
+  return 0;
+}
@@ -0,0 +1,85 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_PERFORMANCE_BENCHMARK_H_INCLUDED
+#define ETL_PERFORMANCE_BENCHMARK_H_INCLUDED
+
+#include <chrono>
+#include <stdint.h>
+#include <stdio.h>
+
+namespace benchmark
+{
+  //***************************************************************************
+  /// Simple wall clock stopwatch.
+  //***************************************************************************
+  class timer
+  {
+  public:
+
+    timer()
+      : start_time(std::chrono::steady_clock::now())
+    {
+    }
+
+    void restart()
+    {
+      start_time = std::chrono::steady_clock::now();
+    }
+
+    double elapsed_ns() const
+    {
+      return double(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start_time).count());
+    }
+
+    double elapsed_ms() const
+    {
+      return elapsed_ns() / 1000000.0;
+    }
+
+  private:
+
+    std::chrono::steady_clock::time_point start_time;
+  };
+
+  //***************************************************************************
+  /// Stops the optimiser from discarding a result.
+  //***************************************************************************
+  template <typename T>
+  inline void do_not_optimise(const T& value)
+  {
+#if defined(__GNUC__) || defined(__clang__)
+    __asm__ __volatile__("" : : "g"(&value) : "memory");
+#else
+    static volatile const void* sink;
+    sink = &value;
+#endif
+  }
+}
+
+#endif
@@ -0,0 +1,147 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+// Compares writing and reading 4096 packed fields through
+// etl::bit_stream_writer/reader one value at a time against a whole span,
+// for big and little endian streams and several field widths.
+
+#include "benchmark.h"
+
+#include "etl/bit_stream.h"
+
+#include <vector>
+
+namespace
+{
+  const size_t Length     = 4096UL;
+  const size_t Iterations = 2000UL;
+
+  //***************************************************************************
+  void report(const char* name, benchmark::timer& timer, size_t fields)
+  {
+    double ns = double(timer.elapsed_ns());
+
+    printf("%-40s %8.2f Mfields/s\n", name, (double(fields) * 1000.0) / ns);
+  }
+
+  //***************************************************************************
+  template <typename T>
+  void run(const char* type_name, uint_least8_t nbits, etl::endian endianness, const char* endian_name)
+  {
+    std::vector<T>    values(Length);
+    std::vector<T>    results(Length);
+    std::vector<char> buffer(((Length * nbits) + 7UL) / 8UL);
+
+    for (size_t i = 0UL; i < Length; ++i)
+    {
+      values[i] = T(i * 0x9E3779B97F4A7C15ULL);
+    }
+
+    char name[64];
+
+    // Write one value at a time.
+    benchmark::timer write_value_timer;
+
+    for (size_t i = 0UL; i < Iterations; ++i)
+    {
+      etl::bit_stream_writer writer(buffer.data(), buffer.size(), endianness);
+
+      for (size_t j = 0UL; j < Length; ++j)
+      {
+        writer.write_unchecked(values[j], nbits);
+      }
+
+      benchmark::do_not_optimise(buffer);
+    }
+
+    snprintf(name, sizeof(name), "write %s:%u %s by value", type_name, unsigned(nbits), endian_name);
+    report(name, write_value_timer, Iterations * Length);
+
+    // Write as a span.
+    benchmark::timer write_span_timer;
+
+    for (size_t i = 0UL; i < Iterations; ++i)
+    {
+      etl::bit_stream_writer writer(buffer.data(), buffer.size(), endianness);
+      writer.write_unchecked(etl::span<const T>(values.data(), values.size()), nbits);
+
+      benchmark::do_not_optimise(buffer);
+    }
+
+    snprintf(name, sizeof(name), "write %s:%u %s span", type_name, unsigned(nbits), endian_name);
+    report(name, write_span_timer, Iterations * Length);
+
+    // Read one value at a time.
+    benchmark::timer read_value_timer;
+
+    for (size_t i = 0UL; i < Iterations; ++i)
+    {
+      etl::bit_stream_reader reader(buffer.data(), buffer.size(), endianness);
+
+      for (size_t j = 0UL; j < Length; ++j)
+      {
+        results[j] = reader.read_unchecked<T>(nbits);
+      }
+
+      benchmark::do_not_optimise(results);
+    }
+
+    snprintf(name, sizeof(name), "read %s:%u %s by value", type_name, unsigned(nbits), endian_name);
+    report(name, read_value_timer, Iterations * Length);
+
+    // Read as a span.
+    benchmark::timer read_span_timer;
+
+    for (size_t i = 0UL; i < Iterations; ++i)
+    {
+      etl::bit_stream_reader reader(buffer.data(), buffer.size(), endianness);
+      reader.read_unchecked(etl::span<T>(results.data(), results.size()), nbits);
+
+      benchmark::do_not_optimise(results);
+    }
+
+    snprintf(name, sizeof(name), "read %s:%u %s span", type_name, unsigned(nbits), endian_name);
+    report(name, read_span_timer, Iterations * Length);
+  }
+}
+
+//*****************************************************************************
+int main()
+{
+  run<uint8_t>("uint8_t",   3U,  etl::endian::big,    "big");
+  run<uint8_t>("uint8_t",   3U,  etl::endian::little, "little");
+  run<uint16_t>("uint16_t", 12U, etl::endian::big,    "big");
+  run<uint16_t>("uint16_t", 12U, etl::endian::little, "little");
+  run<int32_t>("int32_t",   23U, etl::endian::big,    "big");
+  run<int32_t>("int32_t",   23U, etl::endian::little, "little");
+  run<uint64_t>("uint64_t", 33U, etl::endian::big,    "big");
+  run<uint64_t>("uint64_t", 33U, etl::endian::little, "little");
+
+  return 0;
+}
@@ -0,0 +1,177 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+// Measures etl::bitset<65536> used as an allocation map.
+// The map is filled to 99.9% and then allocate/free cycles are run, each
+// finding the first free bit with find_first(false).
+// Also times count(), none() and the bitwise operators over the whole map,
+// and a bit by bit search for comparison.
+
+#include "benchmark.h"
+
+#include "etl/bitset.h"
+
+#include <random>
+#include <vector>
+
+namespace
+{
+  const size_t Map_Size   = 65536UL;
+  const size_t Iterations = 20000UL;
+
+  typedef etl::bitset<Map_Size> map_t;
+
+  map_t map1;
+  map_t map2;
+
+  std::vector<size_t> free_order;
+
+  //***************************************************************************
+  void fill()
+  {
+    map1.set();
+
+    // Free one slot in every thousand, at random positions.
+    for (size_t i = 0UL; i < free_order.size(); ++i)
+    {
+      map1.reset(free_order[i]);
+    }
+  }
+
+  //***************************************************************************
+  void report(const char* name, benchmark::timer& timer, size_t operations)
+  {
+    double ns = double(timer.elapsed_ns()) / double(operations);
+
+    printf("%-28s %10.2f ns/op\n", name, ns);
+  }
+
+  //***************************************************************************
+  size_t find_first_free_bit_by_bit(const map_t& map)
+  {
+    for (size_t i = 0UL; i < map.size(); ++i)
+    {
+      if (!map.test(i))
+      {
+        return i;
+      }
+    }
+
+    return map_t::npos;
+  }
+
+  //***************************************************************************
+  template <typename TFind>
+  void run_allocate(const char* name, TFind find)
+  {
+    fill();
+
+    size_t total = 0UL;
+
+    benchmark::timer timer;
+
+    for (size_t i = 0UL; i < Iterations; ++i)
+    {
+      // Allocate the first free slot and free another.
+      size_t position = find(map1);
+      map1.set(position);
+      map1.reset(free_order[i % free_order.size()]);
+
+      total += position;
+    }
+
+    benchmark::do_not_optimise(total);
+
+    report(name, timer, Iterations);
+  }
+
+  //***************************************************************************
+  size_t find_first_free(const map_t& map)
+  {
+    return map.find_first(false);
+  }
+
+  //***************************************************************************
+  void run_whole_map()
+  {
+    fill();
+    map2 = ~map1;
+
+    size_t total = 0UL;
+
+    benchmark::timer count_timer;
+
+    for (size_t i = 0UL; i < Iterations; ++i)
+    {
+      map1.flip(i % Map_Size);
+      total += map1.count();
+    }
+
+    report("count", count_timer, Iterations);
+
+    benchmark::timer none_timer;
+
+    for (size_t i = 0UL; i < Iterations; ++i)
+    {
+      map2.reset(i % Map_Size);
+      total += map2.none() ? 1UL : 0UL;
+    }
+
+    report("none", none_timer, Iterations);
+
+    benchmark::timer operator_timer;
+
+    for (size_t i = 0UL; i < Iterations; ++i)
+    {
+      map2 ^= map1;
+      map2 &= map1;
+      map2 |= map1;
+    }
+
+    report("xor, and, or", operator_timer, Iterations);
+
+    benchmark::do_not_optimise(total + map2.count());
+  }
+}
+
+//*****************************************************************************
+int main()
+{
+  std::mt19937 rng(12345);
+
+  for (size_t i = 0UL; i < (Map_Size / 1000UL); ++i)
+  {
+    free_order.push_back(rng() % Map_Size);
+  }
+
+  run_allocate("find_first(false)", find_first_free);
+  run_allocate("find_first(false) by bit", find_first_free_bit_by_bit);
+  run_whole_map();
+
+  return 0;
+}
@@ -0,0 +1,146 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+// Compares etl::bloom_filter, with three hashes, to etl::blocked_bloom_filter
+// for a 32MB filter holding 16M keys (16 bits per key), which is larger than
+// the L2 cache.
+// Reports the false positive rate and the time per query, for single
+// queries and for a batch query over a span.
+
+#include "benchmark.h"
+
+#include "etl/bloom_filter.h"
+
+#include <random>
+#include <vector>
+
+namespace
+{
+  const size_t Width          = 256UL * 1024UL * 1024UL;
+  const size_t Number_Of_Keys = 16UL * 1024UL * 1024UL;
+
+  //***************************************************************************
+  template <uint64_t Seed>
+  struct hash_t
+  {
+    typedef uint64_t argument_type;
+
+    size_t operator ()(uint64_t key) const
+    {
+      key += Seed;
+      key ^= key >> 31U;
+      key *= 0x7FB5D329728EA185ULL;
+      key ^= key >> 27U;
+      key *= 0x81DADEF4BC2DD44DULL;
+      key ^= key >> 33U;
+
+      return size_t(key);
+    }
+  };
+
+  typedef hash_t<0x9E3779B97F4A7C15ULL> hash1_t;
+  typedef hash_t<0xBF58476D1CE4E5B9ULL> hash2_t;
+  typedef hash_t<0x94D049BB133111EBULL> hash3_t;
+
+  etl::bloom_filter<Width, hash1_t, hash2_t, hash3_t> bloom;
+  etl::blocked_bloom_filter<Width, hash1_t, 8>        blocked_bloom;
+
+  std::vector<uint64_t> keys;
+  std::vector<uint64_t> other_keys;
+
+  //***************************************************************************
+  void report(const char* name, benchmark::timer& timer, size_t found)
+  {
+    double ns = double(timer.elapsed_ns()) / double(other_keys.size());
+
+    printf("%-24s %8.2f ns/query  false positives %6.3f%%\n", name, ns, (100.0 * double(found)) / double(other_keys.size()));
+  }
+
+  //***************************************************************************
+  template <typename TBloom>
+  void run(const char* name, TBloom& filter)
+  {
+    for (size_t i = 0UL; i < keys.size(); ++i)
+    {
+      filter.add(keys[i]);
+    }
+
+    size_t found = 0UL;
+
+    benchmark::timer timer;
+
+    for (size_t i = 0UL; i < other_keys.size(); ++i)
+    {
+      found += filter.exists(other_keys[i]) ? 1UL : 0UL;
+    }
+
+    benchmark::do_not_optimise(found);
+
+    report(name, timer, found);
+  }
+
+  //***************************************************************************
+  void run_blocked_span()
+  {
+    static bool results[4096];
+
+    size_t found = 0UL;
+
+    benchmark::timer timer;
+
+    for (size_t i = 0UL; i < other_keys.size(); i += 4096UL)
+    {
+      found += blocked_bloom.exists(etl::span<const uint64_t>(other_keys.data() + i, 4096UL), etl::span<bool>(results, 4096UL));
+    }
+
+    benchmark::do_not_optimise(found);
+
+    report("blocked_bloom_filter span", timer, found);
+  }
+}
+
+//*****************************************************************************
+int main()
+{
+  std::mt19937_64 rng(12345);
+
+  keys.resize(Number_Of_Keys);
+  other_keys.resize(Number_Of_Keys);
+
+  for (size_t i = 0UL; i < Number_Of_Keys; ++i)
+  {
+    keys[i]       = rng();
+    other_keys[i] = rng();
+  }
+
+  run("bloom_filter", bloom);
+  run("blocked_bloom_filter", blocked_bloom);
+  run_blocked_span();
+
+  return 0;
+}
@@ -0,0 +1,130 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+// Compares writing and reading 4096 element arrays through
+// etl::byte_stream_writer/reader as one block against one value at a time,
+// for streams of the same and the opposite endianness to the host.
+
+#include "benchmark.h"
+
+#include "etl/byte_stream.h"
+
+#include <vector>
+
+namespace
+{
+  const size_t Length     = 4096UL;
+  const size_t Iterations = 2000UL;
+
+  //***************************************************************************
+  void report(const char* name, benchmark::timer& timer, size_t bytes)
+  {
+    double ns = double(timer.elapsed_ns());
+
+    printf("%-36s %8.2f GB/s\n", name, double(bytes) / ns);
+  }
+
+  //***************************************************************************
+  template <typename T>
+  void run(const char* type_name, etl::endian endianness, const char* endian_name)
+  {
+    std::vector<T>    values(Length);
+    std::vector<T>    results(Length);
+    std::vector<char> buffer(Length * sizeof(T));
+
+    for (size_t i = 0UL; i < Length; ++i)
+    {
+      values[i] = T(i * 0x01020304UL);
+    }
+
+    char name[64];
+
+    // Write one value at a time.
+    benchmark::timer by_value_timer;
+
+    for (size_t i = 0UL; i < Iterations; ++i)
+    {
+      etl::byte_stream_writer writer(buffer.data(), buffer.size(), endianness);
+
+      for (size_t j = 0UL; j < Length; ++j)
+      {
+        writer.write_unchecked(values[j]);
+      }
+
+      benchmark::do_not_optimise(buffer);
+    }
+
+    snprintf(name, sizeof(name), "write %s %s by value", type_name, endian_name);
+    report(name, by_value_timer, Iterations * buffer.size());
+
+    // Write as a block.
+    benchmark::timer block_timer;
+
+    for (size_t i = 0UL; i < Iterations; ++i)
+    {
+      etl::byte_stream_writer writer(buffer.data(), buffer.size(), endianness);
+      writer.write_unchecked(values.data(), values.size());
+
+      benchmark::do_not_optimise(buffer);
+    }
+
+    snprintf(name, sizeof(name), "write %s %s block", type_name, endian_name);
+    report(name, block_timer, Iterations * buffer.size());
+
+    // Read as a block.
+    benchmark::timer read_timer;
+
+    for (size_t i = 0UL; i < Iterations; ++i)
+    {
+      etl::byte_stream_reader reader(buffer.data(), buffer.size(), endianness);
+      reader.read_unchecked(results.data(), results.size());
+
+      benchmark::do_not_optimise(results);
+    }
+
+    snprintf(name, sizeof(name), "read %s %s block", type_name, endian_name);
+    report(name, read_timer, Iterations * buffer.size());
+  }
+}
+
+//*****************************************************************************
+int main()
+{
+  const etl::endian host     = etl::endianness::value();
+  const etl::endian opposite = (host == etl::endian::little) ? etl::endian::big : etl::endian::little;
+
+  run<uint16_t>("uint16_t", host,     "same");
+  run<uint16_t>("uint16_t", opposite, "swapped");
+  run<uint32_t>("uint32_t", host,     "same");
+  run<uint32_t>("uint32_t", opposite, "swapped");
+  run<uint64_t>("uint64_t", host,     "same");
+  run<uint64_t>("uint64_t", opposite, "swapped");
+
+  return 0;
+}
@@ -0,0 +1,122 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+// Compares etl::callback_timer_locked, which keeps the active timers in a
+// delta sorted list, with etl::callback_timer_wheel_locked.
+// 250 timers with mixed periods are restarted at random and ticked.
+
+#include "benchmark.h"
+
+#include "etl/callback_timer_locked.h"
+#include "etl/callback_timer_wheel_locked.h"
+
+#include <random>
+#include <vector>
+
+namespace
+{
+  const size_t   Timers    = 250UL;
+  const size_t   Restarts  = 1000000UL;
+  const uint32_t Tick_Step = 3U;
+
+  uint32_t expired = 0U;
+
+  void on_timeout()
+  {
+    ++expired;
+  }
+
+  bool try_lock() { return true; }
+  void lock()     {}
+  void unlock()   {}
+
+  //***************************************************************************
+  template <typename TTimer>
+  void run(const char* name)
+  {
+    static TTimer controller;
+
+    controller.set_locks(TTimer::try_lock_type::template create<try_lock>(),
+                         TTimer::lock_type::template create<lock>(),
+                         TTimer::unlock_type::template create<unlock>());
+
+    std::mt19937 rng(1);
+    std::vector<etl::timer::id::type> ids;
+
+    for (size_t i = 0UL; i < Timers; ++i)
+    {
+      // Protocol style timeouts, from a few ticks to a few thousand.
+      const uint32_t period = 10U + (rng() % 5000U);
+
+      ids.push_back(controller.register_timer(TTimer::callback_type::template create<on_timeout>(), period, etl::timer::mode::Repeating));
+      controller.start(ids.back());
+    }
+
+    controller.enable(true);
+
+    std::vector<etl::timer::id::type> order;
+
+    for (size_t i = 0UL; i < Restarts; ++i)
+    {
+      order.push_back(ids[rng() % Timers]);
+    }
+
+    expired = 0U;
+
+    benchmark::timer timer;
+
+    for (size_t i = 0UL; i < Restarts; ++i)
+    {
+      controller.start(order[i]);
+
+      if ((i % 16U) == 0U)
+      {
+        controller.tick(Tick_Step);
+      }
+    }
+
+    double ns = timer.elapsed_ns() / double(Restarts);
+
+    benchmark::do_not_optimise(expired);
+
+    printf("%-28s %8.1f ns/restart (%u expired)\n", name, ns, unsigned(expired));
+
+    controller.clear();
+  }
+}
+
+//*****************************************************************************
+int main()
+{
+  printf("%zu active timers\n\n", Timers);
+
+  run<etl::callback_timer_locked<254>>("callback_timer_locked");
+  run<etl::callback_timer_wheel_locked<254>>("callback_timer_wheel_locked");
+
+  return 0;
+}
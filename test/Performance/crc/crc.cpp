@@ -0,0 +1,105 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+// Compares the throughput of the CRC table sizes for a 4MB buffer.
+// Build with -msse4.2 (or for ARMv8 with CRC) to use the CRC32-C instructions
+// for the slice by 8 and slice by 16 tables.
+
+#include "benchmark.h"
+
+#include "etl/crc16_ccitt.h"
+#include "etl/crc32.h"
+#include "etl/crc32_c.h"
+#include "etl/crc64_ecma.h"
+
+#include <random>
+#include <vector>
+
+namespace
+{
+  const size_t Buffer_Size = 4UL * 1024UL * 1024UL;
+  const size_t Iterations  = 10UL;
+
+  std::vector<uint8_t> buffer;
+
+  //***************************************************************************
+  template <typename TCrc>
+  void run(const char* name)
+  {
+    typename TCrc::value_type result = 0U;
+
+    benchmark::timer timer;
+
+    for (size_t i = 0UL; i < Iterations; ++i)
+    {
+      result ^= TCrc(buffer.begin(), buffer.end()).value();
+    }
+
+    double seconds = timer.elapsed_ns() / 1000000000.0;
+    double mb      = double(Buffer_Size * Iterations) / (1024.0 * 1024.0);
+
+    benchmark::do_not_optimise(result);
+
+    printf("%-20s %10.1f MB/s\n", name, mb / seconds);
+  }
+}
+
+//*****************************************************************************
+int main()
+{
+  std::mt19937 rng(12345);
+
+  buffer.resize(Buffer_Size);
+
+  for (size_t i = 0UL; i < Buffer_Size; ++i)
+  {
+    buffer[i] = uint8_t(rng());
+  }
+
+  printf("CRC32-C hardware: %s\n\n", ETL_USING_CRC32_C_HARDWARE ? "yes" : "no");
+
+  run<etl::crc16_ccitt_t16>("crc16_ccitt_t16");
+  run<etl::crc16_ccitt_t256>("crc16_ccitt_t256");
+  run<etl::crc16_ccitt_t2048>("crc16_ccitt_t2048");
+  run<etl::crc16_ccitt_t4096>("crc16_ccitt_t4096");
+
+  run<etl::crc32_t16>("crc32_t16");
+  run<etl::crc32_t256>("crc32_t256");
+  run<etl::crc32_t2048>("crc32_t2048");
+  run<etl::crc32_t4096>("crc32_t4096");
+
+  run<etl::crc32_c_t256>("crc32_c_t256");
+  run<etl::crc32_c_t2048>("crc32_c_t2048");
+  run<etl::crc32_c_t4096>("crc32_c_t4096");
+
+  run<etl::crc64_ecma_t256>("crc64_ecma_t256");
+  run<etl::crc64_ecma_t2048>("crc64_ecma_t2048");
+  run<etl::crc64_ecma_t4096>("crc64_ecma_t4096");
+
+  return 0;
+}
@@ -0,0 +1,120 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+// Compares the throughput of the hashes when adding one octet at a time with
+// adding a contiguous range, which uses the block path, for a 4MB buffer.
+
+#include "benchmark.h"
+
+#include "etl/fnv_1.h"
+#include "etl/jenkins.h"
+#include "etl/murmur3.h"
+#include "etl/xxhash.h"
+
+#include <random>
+#include <vector>
+
+namespace
+{
+  const size_t Buffer_Size = 4UL * 1024UL * 1024UL;
+  const size_t Iterations  = 10UL;
+
+  std::vector<uint8_t> buffer;
+
+  //***************************************************************************
+  void report(const char* name, const char* method, benchmark::timer& timer)
+  {
+    double seconds = timer.elapsed_ns() / 1000000000.0;
+    double mb      = double(Buffer_Size * Iterations) / (1024.0 * 1024.0);
+
+    printf("%-12s %-8s %10.1f MB/s\n", name, method, mb / seconds);
+  }
+
+  //***************************************************************************
+  template <typename THash>
+  void run(const char* name)
+  {
+    typename THash::value_type result = 0U;
+
+    {
+      benchmark::timer timer;
+
+      for (size_t i = 0UL; i < Iterations; ++i)
+      {
+        THash hash;
+
+        for (size_t j = 0UL; j < Buffer_Size; ++j)
+        {
+          hash.add(buffer[j]);
+        }
+
+        result ^= hash.value();
+      }
+
+      report(name, "by octet", timer);
+    }
+
+    {
+      benchmark::timer timer;
+
+      for (size_t i = 0UL; i < Iterations; ++i)
+      {
+        THash hash;
+        hash.add(buffer.data(), buffer.data() + Buffer_Size);
+
+        result ^= hash.value();
+      }
+
+      report(name, "range", timer);
+    }
+
+    benchmark::do_not_optimise(result);
+  }
+}
+
+//*****************************************************************************
+int main()
+{
+  std::mt19937 rng(12345);
+
+  buffer.resize(Buffer_Size);
+
+  for (size_t i = 0UL; i < Buffer_Size; ++i)
+  {
+    buffer[i] = uint8_t(rng());
+  }
+
+  run<etl::fnv_1a_32>("fnv_1a_32");
+  run<etl::fnv_1a_64>("fnv_1a_64");
+  run<etl::jenkins>("jenkins");
+  run<etl::murmur3<uint32_t> >("murmur3");
+  run<etl::xxhash32>("xxhash32");
+  run<etl::xxhash64>("xxhash64");
+
+  return 0;
+}
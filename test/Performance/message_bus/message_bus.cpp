@@ -0,0 +1,181 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+// Compares broadcasting through etl::message_bus with and without the
+// subscriber index, for 64 routers that each consume one of 16 message ids,
+// and the batch receive.
+
+#include "benchmark.h"
+
+#include "etl/message_bus.h"
+
+#include <random>
+#include <deque>
+#include <vector>
+
+namespace
+{
+  const size_t Routers    = 64U;
+  const size_t Ids        = 16U;
+  const size_t Messages   = 4096UL;
+  const size_t Iterations = 200UL;
+
+  //***************************************************************************
+  struct Message : public etl::imessage
+  {
+    explicit Message(etl::message_id_t id_)
+      : id(id_)
+    {
+    }
+
+    etl::message_id_t get_message_id() const noexcept override
+    {
+      return id;
+    }
+
+    etl::message_id_t id;
+  };
+
+  //***************************************************************************
+  // A router that consumes one message id.
+  //***************************************************************************
+  class Router : public etl::imessage_router
+  {
+  public:
+
+    Router(etl::message_router_id_t router_id, etl::message_id_t id_)
+      : imessage_router(router_id)
+      , id(id_)
+    {
+    }
+
+    using etl::imessage_router::receive;
+
+    void receive(const etl::imessage& msg) override
+    {
+      sum += msg.get_message_id();
+    }
+
+    bool accepts(etl::message_id_t id_) const override
+    {
+      return id == id_;
+    }
+
+    bool is_null_router() const override
+    {
+      return false;
+    }
+
+    bool is_producer() const override
+    {
+      return false;
+    }
+
+    bool is_consumer() const override
+    {
+      return true;
+    }
+
+    size_t sum = 0U;
+
+  private:
+
+    etl::message_id_t id;
+  };
+
+  //***************************************************************************
+  template <typename TBus>
+  void run(const char* name, bool batch, const std::vector<const etl::imessage*>& sequence)
+  {
+    std::deque<Router> routers;
+
+    TBus bus;
+
+    for (size_t i = 0U; i < Routers; ++i)
+    {
+      routers.emplace_back(etl::message_router_id_t(i), etl::message_id_t(i % Ids));
+      bus.subscribe(routers.back());
+    }
+
+    benchmark::timer timer;
+
+    for (size_t i = 0UL; i < Iterations; ++i)
+    {
+      if (batch)
+      {
+        bus.receive(etl::span<const etl::imessage* const>(sequence.data(), sequence.size()));
+      }
+      else
+      {
+        for (size_t j = 0UL; j < Messages; ++j)
+        {
+          bus.receive(*sequence[j]);
+        }
+      }
+    }
+
+    double ns = double(timer.elapsed_ns()) / double(Messages * Iterations);
+
+    size_t sum = 0U;
+
+    for (const Router& router : routers)
+    {
+      sum += router.sum;
+    }
+
+    benchmark::do_not_optimise(sum);
+
+    printf("%-20s %8.2f ns/message\n", name, ns);
+  }
+}
+
+//*****************************************************************************
+int main()
+{
+  std::deque<Message> messages;
+
+  for (size_t i = 0U; i < Ids; ++i)
+  {
+    messages.emplace_back(etl::message_id_t(i));
+  }
+
+  std::mt19937 rng(12345);
+  std::vector<const etl::imessage*> sequence(Messages);
+
+  for (size_t i = 0UL; i < Messages; ++i)
+  {
+    sequence[i] = &messages[rng() % Ids];
+  }
+
+  run<etl::message_bus<Routers>>("unindexed", false, sequence);
+  run<etl::message_bus<Routers, Ids>>("indexed", false, sequence);
+  run<etl::message_bus<Routers>>("unindexed batch", true, sequence);
+  run<etl::message_bus<Routers, Ids>>("indexed batch", true, sequence);
+
+  return 0;
+}
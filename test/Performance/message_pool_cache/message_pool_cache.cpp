@@ -0,0 +1,183 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+// Compares allocating shared messages from an etl::atomic_counted_message_pool
+// locked by a std::mutex, directly and through a per-thread
+// etl::atomic_counted_message_pool_cache, with 1, 4 and 16 threads.
+// Each thread creates a few messages and drops them.
+
+#include "benchmark.h"
+
+#include "etl/message.h"
+#include "etl/shared_message.h"
+#include "etl/reference_counted_message_pool.h"
+#include "etl/fixed_sized_memory_block_allocator.h"
+
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace
+{
+  const size_t Operations = 2000000UL;
+  const size_t Held       = 4U;
+
+  struct Message : public etl::message<1>
+  {
+    Message(uint32_t value_)
+      : value(value_)
+    {
+    }
+
+    uint32_t value;
+  };
+
+  using parameters = etl::atomic_counted_message_pool::pool_message_parameters<Message>;
+
+  using allocator_t = etl::fixed_sized_memory_block_allocator<parameters::max_size, parameters::max_alignment, 1024U>;
+
+  using cache_t = etl::atomic_counted_message_pool_cache<parameters::max_size, parameters::max_alignment, 16U>;
+
+  //***************************************************************************
+  class locked_message_pool : public etl::atomic_counted_message_pool
+  {
+  public:
+
+    locked_message_pool(etl::imemory_block_allocator& memory_block_allocator_)
+      : etl::atomic_counted_message_pool(memory_block_allocator_)
+    {
+    }
+
+  protected:
+
+    void lock() override
+    {
+      mutex.lock();
+    }
+
+    void unlock() override
+    {
+      mutex.unlock();
+    }
+
+  private:
+
+    std::mutex mutex;
+  };
+
+  //***************************************************************************
+  template <typename TPool>
+  size_t work(TPool& pool, size_t iterations)
+  {
+    size_t sum = 0U;
+
+    for (size_t i = 0U; i < iterations; ++i)
+    {
+      etl::shared_message messages[Held] = { etl::shared_message::create<Message>(pool, uint32_t(i)),
+                                             etl::shared_message::create<Message>(pool, uint32_t(i)),
+                                             etl::shared_message::create<Message>(pool, uint32_t(i)),
+                                             etl::shared_message::create<Message>(pool, uint32_t(i)) };
+
+      for (size_t h = 0U; h < Held; ++h)
+      {
+        sum += static_cast<const Message&>(messages[h].get_message()).value;
+      }
+    }
+
+    return sum;
+  }
+
+  //***************************************************************************
+  template <bool Use_Cache>
+  void run(const char* name, size_t threads)
+  {
+    allocator_t         allocator;
+    locked_message_pool pool(allocator);
+
+    std::atomic<bool>   start(false);
+    std::atomic<size_t> checksum(0U);
+
+    std::vector<std::thread> workers;
+
+    const size_t per_thread = Operations / threads / Held;
+    const size_t total      = per_thread * threads * Held;
+
+    for (size_t t = 0U; t < threads; ++t)
+    {
+      workers.emplace_back([&pool, &start, &checksum, per_thread]()
+      {
+        while (!start.load())
+        {
+          std::this_thread::yield();
+        }
+
+        if (Use_Cache)
+        {
+          cache_t cache(pool);
+          checksum += work(cache, per_thread);
+        }
+        else
+        {
+          checksum += work(pool, per_thread);
+        }
+      });
+    }
+
+    benchmark::timer timer;
+
+    start.store(true);
+
+    for (auto& worker : workers)
+    {
+      worker.join();
+    }
+
+    double ns = double(timer.elapsed_ns());
+
+    benchmark::do_not_optimise(checksum.load());
+
+    printf("%-20s %2zu threads %8.2f Mmsgs/s %8.2f ns/msg\n", name, threads, (double(total) / ns) * 1000.0, ns / double(total));
+  }
+}
+
+//*****************************************************************************
+int main()
+{
+  printf("Hardware threads: %u\n\n", std::thread::hardware_concurrency());
+
+  const size_t thread_counts[] = { 1U, 4U, 16U };
+
+  for (size_t threads : thread_counts)
+  {
+    run<false>("locked pool", threads);
+    run<true>("per-thread cache", threads);
+  }
+
+  return 0;
+}
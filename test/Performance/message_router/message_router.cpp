@@ -0,0 +1,180 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+// Compares the dispatch time of etl::message_router against a linear search
+// of the message types, for routers handling 4, 16 and 64 message types.
+
+#include "benchmark.h"
+
+#include "etl/message_router.h"
+
+#include <random>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace
+{
+  const size_t Messages   = 4096UL;
+  const size_t Iterations = 1000UL;
+
+  //***************************************************************************
+  template <size_t Index>
+  struct Message : public etl::message<etl::message_id_t((Index * 3U) + 1U)>
+  {
+  };
+
+  //***************************************************************************
+  // Dispatch through etl::message_router.
+  //***************************************************************************
+  template <typename... TMessages>
+  class Router : public etl::message_router<Router<TMessages...>, TMessages...>
+  {
+  public:
+
+    template <typename TMessage>
+    void on_receive(const TMessage& msg)
+    {
+      sum += msg.get_message_id();
+    }
+
+    void on_receive_unknown(const etl::imessage&)
+    {
+    }
+
+    size_t sum = 0U;
+  };
+
+  //***************************************************************************
+  // Dispatch by testing each message type in turn.
+  //***************************************************************************
+  template <typename... TMessages>
+  class Linear_Router : public etl::imessage_router
+  {
+  public:
+
+    Linear_Router()
+      : imessage_router(0)
+    {
+    }
+
+    using etl::imessage_router::receive;
+
+    void receive(const etl::imessage& msg) override
+    {
+      (receive_message_type<TMessages>(msg) || ...);
+    }
+
+    bool accepts(etl::message_id_t id) const override
+    {
+      return ((TMessages::ID == id) || ...);
+    }
+
+    bool is_null_router() const override
+    {
+      return false;
+    }
+
+    bool is_producer() const override
+    {
+      return true;
+    }
+
+    bool is_consumer() const override
+    {
+      return true;
+    }
+
+    size_t sum = 0U;
+
+  private:
+
+    template <typename TMessage>
+    bool receive_message_type(const etl::imessage& msg)
+    {
+      if (TMessage::ID == msg.get_message_id())
+      {
+        sum += static_cast<const TMessage&>(msg).get_message_id();
+        return true;
+      }
+
+      return false;
+    }
+  };
+
+  //***************************************************************************
+  template <template <typename...> class TRouter, size_t... Index>
+  void run(const char* name, std::index_sequence<Index...>)
+  {
+    const size_t Count = sizeof...(Index);
+
+    std::tuple<Message<Index>...> messages;
+    const etl::imessage* const all[] = { &std::get<Index>(messages)... };
+
+    std::mt19937 rng(12345);
+    std::vector<const etl::imessage*> sequence(Messages);
+
+    for (size_t i = 0UL; i < Messages; ++i)
+    {
+      sequence[i] = all[rng() % Count];
+    }
+
+    TRouter<Message<Index>...> router;
+
+    benchmark::timer timer;
+
+    for (size_t i = 0UL; i < Iterations; ++i)
+    {
+      for (size_t j = 0UL; j < Messages; ++j)
+      {
+        router.receive(*sequence[j]);
+      }
+    }
+
+    double ns = double(timer.elapsed_ns()) / double(Messages * Iterations);
+
+    benchmark::do_not_optimise(router.sum);
+
+    printf("%-16s %3zu types %8.2f ns/message\n", name, Count, ns);
+  }
+}
+
+//*****************************************************************************
+int main()
+{
+  run<Linear_Router>("linear", std::make_index_sequence<4>());
+  run<Router>("message_router", std::make_index_sequence<4>());
+
+  run<Linear_Router>("linear", std::make_index_sequence<16>());
+  run<Router>("message_router", std::make_index_sequence<16>());
+
+  run<Linear_Router>("linear", std::make_index_sequence<64>());
+  run<Router>("message_router", std::make_index_sequence<64>());
+
+  return 0;
+}
@@ -0,0 +1,129 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+// Compares per-frame scratch allocation from etl::monotonic_arena, freed by
+// a single reset, with malloc/free of each block.
+
+#include "benchmark.h"
+
+#include "etl/monotonic_arena.h"
+
+#include <stdlib.h>
+#include <vector>
+
+namespace
+{
+  const size_t Frames         = 200000UL;
+  const size_t Allocations    = 32U;
+  const size_t Max_Block_Size = 128U;
+
+  //***************************************************************************
+  size_t run_arena(etl::imonotonic_arena& arena, const std::vector<size_t>& sizes)
+  {
+    size_t failures = 0U;
+    size_t s        = 0U;
+
+    for (size_t f = 0U; f < Frames; ++f)
+    {
+      for (size_t a = 0U; a < Allocations; ++a)
+      {
+        char* p = static_cast<char*>(arena.allocate(sizes[s], 8U));
+        failures += (p == nullptr) ? 1U : 0U;
+        benchmark::do_not_optimise(p);
+        s = (s + 1U) & (sizes.size() - 1U);
+      }
+
+      arena.reset();
+    }
+
+    return failures;
+  }
+
+  //***************************************************************************
+  size_t run_malloc(const std::vector<size_t>& sizes)
+  {
+    void*  blocks[Allocations];
+    size_t failures = 0U;
+    size_t s        = 0U;
+
+    for (size_t f = 0U; f < Frames; ++f)
+    {
+      for (size_t a = 0U; a < Allocations; ++a)
+      {
+        blocks[a] = malloc(sizes[s]);
+        failures += (blocks[a] == nullptr) ? 1U : 0U;
+        benchmark::do_not_optimise(blocks[a]);
+        s = (s + 1U) & (sizes.size() - 1U);
+      }
+
+      for (size_t a = 0U; a < Allocations; ++a)
+      {
+        free(blocks[a]);
+      }
+    }
+
+    return failures;
+  }
+
+  //***************************************************************************
+  void report(const char* name, double ns, size_t failures)
+  {
+    printf("%-16s %8.2f ns/allocation (%zu failures)\n", name, ns / double(Frames * Allocations), failures);
+  }
+}
+
+//*****************************************************************************
+int main()
+{
+  // A power of 2 number of sizes, so that the index can be masked.
+  std::vector<size_t> sizes;
+
+  uint32_t seed = 1U;
+
+  for (size_t i = 0U; i < 4096U; ++i)
+  {
+    seed = (seed * 1103515245U) + 12345U;
+    sizes.push_back(1U + ((seed >> 16) % Max_Block_Size));
+  }
+
+  static etl::monotonic_arena<Allocations * (Max_Block_Size + 8U)> arena;
+
+  {
+    benchmark::timer timer;
+    size_t failures = run_malloc(sizes);
+    report("malloc/free", double(timer.elapsed_ns()), failures);
+  }
+
+  {
+    benchmark::timer timer;
+    size_t failures = run_arena(arena, sizes);
+    report("monotonic_arena", double(timer.elapsed_ns()), failures);
+  }
+
+  return 0;
+}
@@ -0,0 +1,155 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+// Compares the allocate/release throughput of an etl::pool guarded by a
+// std::mutex and etl::pool_atomic with 1, 2, 4 and 8 threads.
+// Each thread repeatedly takes a few items and gives them back.
+
+#include "benchmark.h"
+
+#include "etl/pool.h"
+#include "etl/pool_atomic.h"
+
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace
+{
+  const size_t Operations = 4000000UL;
+  const size_t Held       = 4U;
+  const size_t Pool_Size  = 256U;
+
+  struct Item
+  {
+    uint32_t data[4];
+  };
+
+  //***************************************************************************
+  /// etl::pool with every call made under a lock.
+  //***************************************************************************
+  class pool_mutex
+  {
+  public:
+
+    Item* allocate()
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      return pool.allocate();
+    }
+
+    void release(Item* p)
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      pool.release(p);
+    }
+
+  private:
+
+    std::mutex                  mutex;
+    etl::pool<Item, Pool_Size> pool;
+  };
+
+  //***************************************************************************
+  template <typename TPool>
+  void run(const char* name, size_t threads)
+  {
+    TPool pool;
+
+    std::atomic<bool>   start(false);
+    std::atomic<size_t> checksum(0U);
+
+    std::vector<std::thread> workers;
+
+    const size_t per_thread = Operations / threads / Held;
+    const size_t total      = per_thread * threads * Held;
+
+    for (size_t t = 0U; t < threads; ++t)
+    {
+      workers.emplace_back([&pool, &start, &checksum, per_thread]()
+      {
+        Item*  items[Held];
+        size_t sum = 0U;
+
+        while (!start.load())
+        {
+          std::this_thread::yield();
+        }
+
+        for (size_t i = 0U; i < per_thread; ++i)
+        {
+          for (size_t h = 0U; h < Held; ++h)
+          {
+            items[h] = pool.allocate();
+            items[h]->data[0] = uint32_t(i);
+          }
+
+          for (size_t h = 0U; h < Held; ++h)
+          {
+            sum += items[h]->data[0];
+            pool.release(items[h]);
+          }
+        }
+
+        checksum += sum;
+      });
+    }
+
+    benchmark::timer timer;
+
+    start.store(true);
+
+    for (auto& worker : workers)
+    {
+      worker.join();
+    }
+
+    double ns = double(timer.elapsed_ns());
+
+    benchmark::do_not_optimise(checksum.load());
+
+    printf("%-12s %2zu threads %8.2f Mops/s %8.2f ns/op\n", name, threads, (double(total) / ns) * 1000.0, ns / double(total));
+  }
+}
+
+//*****************************************************************************
+int main()
+{
+  printf("Hardware threads: %u\n\n", std::thread::hardware_concurrency());
+
+  const size_t thread_counts[] = { 1U, 2U, 4U, 8U };
+
+  for (size_t threads : thread_counts)
+  {
+    run<pool_mutex>("pool_mutex", threads);
+    run<etl::pool_atomic<Item, Pool_Size>>("pool_atomic", threads);
+  }
+
+  return 0;
+}
@@ -0,0 +1,140 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+// Compares the throughput of etl::queue_mpmc_mutex and etl::queue_mpmc_atomic
+// with 1, 2, 4 and 8 producer and consumer threads.
+
+#include "benchmark.h"
+
+#include "etl/queue_mpmc_mutex.h"
+#include "etl/queue_mpmc_atomic.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace
+{
+  const size_t Items = 2000000UL;
+
+  //***************************************************************************
+  template <typename TQueue>
+  void run(const char* name, size_t threads)
+  {
+    TQueue queue;
+
+    std::atomic<bool>   start(false);
+    std::atomic<size_t> consumed(0U);
+    std::atomic<size_t> checksum(0U);
+
+    std::vector<std::thread> workers;
+
+    const size_t per_producer = Items / threads;
+    const size_t total        = per_producer * threads;
+
+    for (size_t p = 0U; p < threads; ++p)
+    {
+      workers.emplace_back([&queue, &start, per_producer]()
+      {
+        while (!start.load())
+        {
+          std::this_thread::yield();
+        }
+
+        for (size_t i = 0U; i < per_producer; ++i)
+        {
+          while (!queue.push(uint32_t(i)))
+          {
+            std::this_thread::yield();
+          }
+        }
+      });
+    }
+
+    for (size_t c = 0U; c < threads; ++c)
+    {
+      workers.emplace_back([&queue, &start, &consumed, &checksum, total]()
+      {
+        size_t sum = 0U;
+
+        while (!start.load())
+        {
+          std::this_thread::yield();
+        }
+
+        while (consumed.load(std::memory_order_relaxed) < total)
+        {
+          uint32_t value;
+
+          if (queue.pop(value))
+          {
+            sum += value;
+            consumed.fetch_add(1U, std::memory_order_relaxed);
+          }
+          else
+          {
+            std::this_thread::yield();
+          }
+        }
+
+        checksum += sum;
+      });
+    }
+
+    benchmark::timer timer;
+
+    start.store(true);
+
+    for (auto& worker : workers)
+    {
+      worker.join();
+    }
+
+    double seconds = timer.elapsed_ns() / 1000000000.0;
+
+    benchmark::do_not_optimise(checksum.load());
+
+    printf("%-20s %2zu producers %2zu consumers %8.2f Mitems/s\n", name, threads, threads, (double(total) / seconds) / 1000000.0);
+  }
+}
+
+//*****************************************************************************
+int main()
+{
+  printf("Hardware threads: %u\n\n", std::thread::hardware_concurrency());
+
+  const size_t thread_counts[] = { 1U, 2U, 4U, 8U };
+
+  for (size_t threads : thread_counts)
+  {
+    run<etl::queue_mpmc_mutex<uint32_t, 1024>>("queue_mpmc_mutex", threads);
+    run<etl::queue_mpmc_atomic<uint32_t, 1024>>("queue_mpmc_atomic", threads);
+  }
+
+  return 0;
+}
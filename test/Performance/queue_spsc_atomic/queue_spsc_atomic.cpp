@@ -0,0 +1,216 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+// Measures the ping-pong latency and the streaming throughput of
+// etl::queue_spsc_atomic, one item at a time and in bursts.
+// Built twice: 'queue_spsc_atomic' with the default layout and
+// 'queue_spsc_atomic_padded' with ETL_QUEUE_SPSC_ATOMIC_USE_CACHE_LINE_PADDING.
+
+#include "benchmark.h"
+
+#include "etl/queue_spsc_atomic.h"
+
+#include <thread>
+
+namespace
+{
+  const size_t Round_Trips = 200000UL;
+  const size_t Items       = 20000000UL;
+  const size_t Burst       = 64UL;
+
+  typedef etl::queue_spsc_atomic<uint32_t, 1024> Queue;
+
+  Queue ping;
+  Queue pong;
+  Queue stream;
+
+  //***************************************************************************
+  // Spin, yielding to the other thread, until the operation succeeds.
+  //***************************************************************************
+  template <typename TOperation>
+  void retry(TOperation operation)
+  {
+    while (!operation())
+    {
+      std::this_thread::yield();
+    }
+  }
+
+  //***************************************************************************
+  void run_ping_pong()
+  {
+    std::thread echo([]()
+    {
+      uint32_t value;
+
+      for (size_t i = 0UL; i < Round_Trips; ++i)
+      {
+        retry([&value]() { return ping.pop(value); });
+        retry([&value]() { return pong.push(value); });
+      }
+    });
+
+    benchmark::timer timer;
+
+    uint32_t value = 0U;
+
+    for (size_t i = 0UL; i < Round_Trips; ++i)
+    {
+      retry([i]() { return ping.push(uint32_t(i)); });
+      retry([&value]() { return pong.pop(value); });
+    }
+
+    double ns = double(timer.elapsed_ns()) / double(Round_Trips);
+
+    echo.join();
+
+    benchmark::do_not_optimise(value);
+
+    printf("ping-pong  %10.1f ns/round trip\n", ns);
+  }
+
+  //***************************************************************************
+  void run_throughput()
+  {
+    std::thread producer([]()
+    {
+      for (size_t i = 0UL; i < Items; ++i)
+      {
+        while (!stream.push(uint32_t(i)))
+        {
+          std::this_thread::yield();
+        }
+      }
+    });
+
+    benchmark::timer timer;
+
+    uint32_t value = 0U;
+    uint32_t sum   = 0U;
+
+    for (size_t i = 0UL; i < Items; ++i)
+    {
+      while (!stream.pop(value))
+      {
+        std::this_thread::yield();
+      }
+
+      sum += value;
+    }
+
+    double seconds = timer.elapsed_ns() / 1000000000.0;
+
+    producer.join();
+
+    benchmark::do_not_optimise(sum);
+
+    printf("throughput %10.1f Mitems/s\n", (double(Items) / seconds) / 1000000.0);
+  }
+
+  //***************************************************************************
+  // Bursts of up to 'Burst' items with one index publish per burst.
+  // The producer uses push(span), the consumer uses read_peek/read_release.
+  //***************************************************************************
+  void run_burst_throughput()
+  {
+    std::thread producer([]()
+    {
+      uint32_t values[Burst];
+      size_t   i = 0UL;
+
+      while (i < Items)
+      {
+        size_t n = ((Items - i) < Burst) ? (Items - i) : Burst;
+
+        for (size_t j = 0UL; j < n; ++j)
+        {
+          values[j] = uint32_t(i + j);
+        }
+
+        size_t pushed = stream.push(etl::span<const uint32_t>(values, n));
+
+        while (pushed != n)
+        {
+          std::this_thread::yield();
+          pushed += stream.push(etl::span<const uint32_t>(values + pushed, n - pushed));
+        }
+
+        i += n;
+      }
+    });
+
+    benchmark::timer timer;
+
+    uint32_t sum = 0U;
+    size_t   i   = 0UL;
+
+    while (i < Items)
+    {
+      etl::span<uint32_t> values = stream.read_peek(Burst);
+
+      if (values.empty())
+      {
+        std::this_thread::yield();
+        continue;
+      }
+
+      for (size_t j = 0UL; j < values.size(); ++j)
+      {
+        sum += values[j];
+      }
+
+      stream.read_release(Queue::size_type(values.size()));
+      i += values.size();
+    }
+
+    double seconds = timer.elapsed_ns() / 1000000000.0;
+
+    producer.join();
+
+    benchmark::do_not_optimise(sum);
+
+    printf("burst      %10.1f Mitems/s\n", (double(Items) / seconds) / 1000000.0);
+  }
+}
+
+//*****************************************************************************
+int main()
+{
+#if defined(ETL_QUEUE_SPSC_ATOMIC_USE_CACHE_LINE_PADDING)
+  printf("Cache line padding: yes (sizeof = %zu)\n", sizeof(Queue));
+#else
+  printf("Cache line padding: no (sizeof = %zu)\n", sizeof(Queue));
+#endif
+  printf("Hardware threads: %u\n\n", std::thread::hardware_concurrency());
+
+  run_ping_pong();
+  run_throughput();
+  run_burst_throughput();
+
+  return 0;
+}
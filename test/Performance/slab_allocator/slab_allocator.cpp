@@ -0,0 +1,113 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+// Compares etl::slab_memory_block_allocator with a successor chain of
+// etl::fixed_sized_memory_block_allocator for mixed request sizes.
+
+#include "benchmark.h"
+
+#include "etl/slab_memory_block_allocator.h"
+#include "etl/fixed_sized_memory_block_allocator.h"
+
+#include <vector>
+
+namespace
+{
+  const size_t Iterations = 2000000UL;
+  const size_t Held       = 16U;
+
+  //***************************************************************************
+  size_t work(etl::imemory_block_allocator& allocator, const std::vector<size_t>& sizes)
+  {
+    void*  blocks[Held];
+    size_t failures = 0U;
+    size_t s        = 0U;
+
+    for (size_t i = 0U; i < (Iterations / Held); ++i)
+    {
+      for (size_t h = 0U; h < Held; ++h)
+      {
+        blocks[h] = allocator.allocate(sizes[s], 8U);
+        failures += (blocks[h] == nullptr) ? 1U : 0U;
+        s = (s + 1U) & (sizes.size() - 1U);
+      }
+
+      for (size_t h = 0U; h < Held; ++h)
+      {
+        allocator.release(blocks[h]);
+      }
+    }
+
+    return failures;
+  }
+
+  //***************************************************************************
+  void run(const char* name, etl::imemory_block_allocator& allocator, const std::vector<size_t>& sizes)
+  {
+    benchmark::timer timer;
+
+    size_t failures = work(allocator, sizes);
+
+    double ns = double(timer.elapsed_ns());
+
+    benchmark::do_not_optimise(failures);
+
+    printf("%-28s %8.2f ns/allocate+release (%zu failures)\n", name, ns / double(Iterations), failures);
+  }
+}
+
+//*****************************************************************************
+int main()
+{
+  // A power of 2 number of sizes, so that the index can be masked.
+  std::vector<size_t> sizes;
+
+  uint32_t seed = 1U;
+
+  for (size_t i = 0U; i < 4096U; ++i)
+  {
+    seed = (seed * 1103515245U) + 12345U;
+    sizes.push_back(1U + ((seed >> 16) % 128U));
+  }
+
+  etl::slab_memory_block_allocator<16U, 8U, 4U, Held> slab;
+
+  etl::fixed_sized_memory_block_allocator<16U,  8U, Held> fixed16;
+  etl::fixed_sized_memory_block_allocator<32U,  8U, Held> fixed32;
+  etl::fixed_sized_memory_block_allocator<64U,  8U, Held> fixed64;
+  etl::fixed_sized_memory_block_allocator<128U, 8U, Held> fixed128;
+
+  fixed16.set_successor(fixed32);
+  fixed32.set_successor(fixed64);
+  fixed64.set_successor(fixed128);
+
+  run("fixed_sized successor chain", fixed16, sizes);
+  run("slab", slab, sizes);
+
+  return 0;
+}
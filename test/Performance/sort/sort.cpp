@@ -0,0 +1,133 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+// Compares etl::intro_sort, etl::shell_sort and std::sort.
+// shell_sort is only timed once per pattern as it is very slow for large ranges.
+
+#include "benchmark.h"
+
+#include "etl/algorithm.h"
+#include "etl/vector.h"
+
+#include <algorithm>
+#include <numeric>
+#include <string>
+#include <random>
+#include <vector>
+
+namespace
+{
+  const size_t Max_Size = 100000UL;
+
+  typedef etl::vector<uint32_t, Max_Size> Data;
+
+  Data source;
+  Data work;
+
+  //***************************************************************************
+  void generate(const char* pattern, size_t size, std::mt19937& rng)
+  {
+    source.resize(size);
+
+    std::string name(pattern);
+
+    if (name == "random")
+    {
+      for (size_t i = 0UL; i < size; ++i)
+      {
+        source[i] = rng();
+      }
+    }
+    else if (name == "sorted")
+    {
+      std::iota(source.begin(), source.end(), 0U);
+    }
+    else if (name == "reversed")
+    {
+      std::iota(source.begin(), source.end(), 0U);
+      std::reverse(source.begin(), source.end());
+    }
+    else // few unique
+    {
+      for (size_t i = 0UL; i < size; ++i)
+      {
+        source[i] = rng() % 16U;
+      }
+    }
+  }
+
+  //***************************************************************************
+  template <typename TSort>
+  double run(TSort sort, size_t iterations)
+  {
+    double total = 0.0;
+
+    for (size_t i = 0UL; i < iterations; ++i)
+    {
+      work.assign(source.begin(), source.end());
+
+      benchmark::timer timer;
+      sort(work.begin(), work.end());
+      total += timer.elapsed_ms();
+
+      if (!std::is_sorted(work.begin(), work.end()))
+      {
+        printf("Sort failed!\n");
+      }
+    }
+
+    return total / iterations;
+  }
+}
+
+//*****************************************************************************
+int main()
+{
+  std::mt19937 rng(12345);
+
+  const char*  patterns[] = { "random", "sorted", "reversed", "few_unique" };
+  const size_t sizes[]    = { 10000UL, 100000UL };
+
+  printf("%-12s %8s %12s %12s %12s\n", "pattern", "size", "std::sort", "intro_sort", "shell_sort");
+
+  for (size_t s = 0UL; s < sizeof(sizes) / sizeof(sizes[0]); ++s)
+  {
+    for (size_t p = 0UL; p < sizeof(patterns) / sizeof(patterns[0]); ++p)
+    {
+      generate(patterns[p], sizes[s], rng);
+
+      double t_std   = run([](Data::iterator b, Data::iterator e) { std::sort(b, e); },        10);
+      double t_intro = run([](Data::iterator b, Data::iterator e) { etl::intro_sort(b, e); },  10);
+      double t_shell = run([](Data::iterator b, Data::iterator e) { etl::shell_sort(b, e); },  1);
+
+      printf("%-12s %8zu %10.3fms %10.3fms %10.3fms\n", patterns[p], sizes[s], t_std, t_intro, t_shell);
+    }
+  }
+
+  return 0;
+}
@@ -0,0 +1,114 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+// Measures etl::statistics for single values and span batches, with the
+// separate etl::variance and etl::rms calculations as a reference.
+
+#include "benchmark.h"
+
+#include "etl/statistics.h"
+#include "etl/variance.h"
+#include "etl/rms.h"
+
+#include <stdio.h>
+#include <vector>
+
+namespace
+{
+  const size_t Length     = 1000000UL;
+  const size_t Iterations = 20UL;
+
+  //***************************************************************************
+  void report(const char* name, benchmark::timer& timer)
+  {
+    double ns = double(timer.elapsed_ns());
+
+    printf("%-32s %8.3f ns/value\n", name, ns / double(Iterations * Length));
+  }
+}
+
+//*****************************************************************************
+int main()
+{
+  std::vector<float> values(Length);
+
+  uint32_t x = 0x9E3779B9UL;
+
+  for (size_t i = 0UL; i < Length; ++i)
+  {
+    x ^= x << 13; x ^= x >> 17; x ^= x << 5;
+    values[i] = 1000.0f + float(x % 1000U) * 0.001f;
+  }
+
+  {
+    double total = 0.0;
+    benchmark::timer timer;
+
+    for (size_t i = 0UL; i < Iterations; ++i)
+    {
+      etl::variance<etl::variance_type::Sample, float, double> variance(values.begin(), values.end());
+      etl::rms<float, double>                                  rms(values.begin(), values.end());
+      total += variance.get_variance() + rms.get_rms();
+    }
+
+    report("variance + rms", timer);
+    benchmark::do_not_optimise(total);
+  }
+
+  {
+    double total = 0.0;
+    benchmark::timer timer;
+
+    for (size_t i = 0UL; i < Iterations; ++i)
+    {
+      etl::statistics<etl::statistics_type::Sample, float, double> statistics(values.begin(), values.end());
+      total += statistics.get_variance() + statistics.get_rms();
+    }
+
+    report("statistics single values", timer);
+    benchmark::do_not_optimise(total);
+  }
+
+  {
+    double total = 0.0;
+    benchmark::timer timer;
+
+    for (size_t i = 0UL; i < Iterations; ++i)
+    {
+      etl::statistics<etl::statistics_type::Sample, float, double> statistics;
+      statistics.add(etl::span<const float>(values.data(), values.size()));
+      total += statistics.get_variance() + statistics.get_rms();
+    }
+
+    report("statistics span", timer);
+    benchmark::do_not_optimise(total);
+  }
+
+  return 0;
+}
@@ -0,0 +1,121 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+// Measures the etl::string and etl::string_view search functions on a long
+// text, with std::string as a reference.
+
+#include "benchmark.h"
+
+#include "etl/string.h"
+#include "etl/string_view.h"
+
+#include <stdio.h>
+#include <string>
+
+namespace
+{
+  const size_t Length     = 4000UL;
+  const size_t Iterations = 20000UL;
+
+  //***************************************************************************
+  void report(const char* name, benchmark::timer& timer)
+  {
+    double ns = double(timer.elapsed_ns());
+
+    printf("%-32s %8.2f ns/search\n", name, ns / double(Iterations));
+  }
+
+  //***************************************************************************
+  template <typename TText, typename TFunction>
+  void run(const char* name, const TText& text, TFunction function)
+  {
+    size_t total = 0UL;
+
+    benchmark::timer timer;
+
+    for (size_t i = 0UL; i < Iterations; ++i)
+    {
+      total += function(text);
+    }
+
+    report(name, timer);
+    benchmark::do_not_optimise(total);
+  }
+
+  struct find_char       { template <typename T> size_t operator()(const T& t) const { return t.find('#'); } };
+  struct rfind_char      { template <typename T> size_t operator()(const T& t) const { return t.rfind('!'); } };
+  struct find_text       { template <typename T> size_t operator()(const T& t) const { return t.find("Content-Length:"); } };
+  struct find_first_of   { template <typename T> size_t operator()(const T& t) const { return t.find_first_of("\r\n;#"); } };
+  struct find_first_not  { template <typename T> size_t operator()(const T& t) const { return t.find_first_not_of("abcdefghijklmnopqrstuvwxyz :"); } };
+}
+
+//*****************************************************************************
+int main()
+{
+  std::string std_text;
+
+  uint32_t x = 0x9E3779B9UL;
+
+  // Header like text, with the targets near the end.
+  while (std_text.size() < (Length - 32U))
+  {
+    x ^= x << 13; x ^= x >> 17; x ^= x << 5;
+    std_text += char('a' + (x % 26U));
+
+    if ((x % 7U) == 0U)
+    {
+      std_text += ' ';
+    }
+
+    if ((x % 53U) == 0U)
+    {
+      std_text += "Content-Type:";
+    }
+  }
+
+  std_text = "!" + std_text + "Content-Length: 42#;\r\n";
+
+  etl::string<Length + 64U> etl_text(std_text.c_str());
+  etl::string_view          etl_view(etl_text);
+
+  run("etl::string find char",           etl_text, find_char());
+  run("etl::string_view find char",      etl_view, find_char());
+  run("std::string find char",           std_text, find_char());
+  run("etl::string rfind char",          etl_text, rfind_char());
+  run("std::string rfind char",          std_text, rfind_char());
+  run("etl::string find text",           etl_text, find_text());
+  run("etl::string_view find text",      etl_view, find_text());
+  run("std::string find text",           std_text, find_text());
+  run("etl::string find_first_of",       etl_text, find_first_of());
+  run("std::string find_first_of",       std_text, find_first_of());
+  run("etl::string find_first_not_of",   etl_text, find_first_not());
+  run("std::string find_first_not_of",   std_text, find_first_not());
+
+  return 0;
+}
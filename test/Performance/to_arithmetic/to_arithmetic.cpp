@@ -0,0 +1,148 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+// Measures etl::to_arithmetic for decimal integers and floating point text,
+// with strtoll and strtod as a reference.
+
+#include "benchmark.h"
+
+#include "etl/to_arithmetic.h"
+#include "etl/string_view.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string>
+#include <vector>
+
+namespace
+{
+  const size_t Length     = 4096UL;
+  const size_t Iterations = 200UL;
+
+  //***************************************************************************
+  void report(const char* name, benchmark::timer& timer)
+  {
+    double ns = double(timer.elapsed_ns());
+
+    printf("%-32s %8.2f ns/value\n", name, ns / double(Iterations * Length));
+  }
+
+  //***************************************************************************
+  template <typename T>
+  void run_etl(const char* name, const std::vector<std::string>& texts)
+  {
+    T total = 0;
+
+    benchmark::timer timer;
+
+    for (size_t i = 0UL; i < Iterations; ++i)
+    {
+      for (size_t j = 0UL; j < Length; ++j)
+      {
+        etl::to_arithmetic_result<T> result = etl::to_arithmetic<T>(texts[j].data(), texts[j].size());
+        total += result.has_value() ? result.value() : T(0);
+      }
+    }
+
+    report(name, timer);
+    benchmark::do_not_optimise(total);
+  }
+
+  //***************************************************************************
+  void run_strtoll(const char* name, const std::vector<std::string>& texts)
+  {
+    long long total = 0;
+
+    benchmark::timer timer;
+
+    for (size_t i = 0UL; i < Iterations; ++i)
+    {
+      for (size_t j = 0UL; j < Length; ++j)
+      {
+        total += strtoll(texts[j].c_str(), NULL, 10);
+      }
+    }
+
+    report(name, timer);
+    benchmark::do_not_optimise(total);
+  }
+
+  //***************************************************************************
+  void run_strtod(const char* name, const std::vector<std::string>& texts)
+  {
+    double total = 0;
+
+    benchmark::timer timer;
+
+    for (size_t i = 0UL; i < Iterations; ++i)
+    {
+      for (size_t j = 0UL; j < Length; ++j)
+      {
+        total += strtod(texts[j].c_str(), NULL);
+      }
+    }
+
+    report(name, timer);
+    benchmark::do_not_optimise(total);
+  }
+}
+
+//*****************************************************************************
+int main()
+{
+  std::vector<std::string> i32(Length);
+  std::vector<std::string> i64(Length);
+  std::vector<std::string> f64(Length);
+
+  uint64_t x = 0x9E3779B97F4A7C15ULL;
+  char     text[64];
+
+  for (size_t i = 0UL; i < Length; ++i)
+  {
+    x ^= x << 13; x ^= x >> 7; x ^= x << 17;
+
+    snprintf(text, sizeof(text), "%d", int(int32_t(x) >> (x % 31U)));
+    i32[i] = text;
+
+    snprintf(text, sizeof(text), "%lld", (long long)(int64_t(x) >> (x % 63U)));
+    i64[i] = text;
+
+    snprintf(text, sizeof(text), "%.*f", int(x % 7U), double(int64_t(x >> 40)) / 1000.0);
+    f64[i] = text;
+  }
+
+  run_etl<int32_t>("int32_t decimal",  i32);
+  run_strtoll("int32_t strtoll",       i32);
+  run_etl<int64_t>("int64_t decimal",  i64);
+  run_strtoll("int64_t strtoll",       i64);
+  run_etl<double>("double fixed",      f64);
+  run_strtod("double strtod",          f64);
+
+  return 0;
+}
@@ -0,0 +1,129 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+// Measures etl::to_string for integers in several bases and for floating
+// point in fixed precision and shortest round trip formats, with snprintf
+// as a reference.
+
+#include "benchmark.h"
+
+#include "etl/to_string.h"
+#include "etl/string.h"
+#include "etl/format_spec.h"
+
+#include <vector>
+
+namespace
+{
+  const size_t Length     = 4096UL;
+  const size_t Iterations = 200UL;
+
+  //***************************************************************************
+  void report(const char* name, benchmark::timer& timer)
+  {
+    double ns = double(timer.elapsed_ns());
+
+    printf("%-32s %8.2f ns/value\n", name, ns / double(Iterations * Length));
+  }
+
+  //***************************************************************************
+  template <typename T>
+  void run_etl(const char* name, const std::vector<T>& values, const etl::format_spec& format)
+  {
+    etl::string<64> text;
+    size_t total = 0UL;
+
+    benchmark::timer timer;
+
+    for (size_t i = 0UL; i < Iterations; ++i)
+    {
+      for (size_t j = 0UL; j < Length; ++j)
+      {
+        etl::to_string(values[j], text, format);
+        total += text.size();
+      }
+    }
+
+    report(name, timer);
+    benchmark::do_not_optimise(total);
+  }
+
+  //***************************************************************************
+  template <typename T>
+  void run_snprintf(const char* name, const std::vector<T>& values, const char* printf_format)
+  {
+    char text[64];
+    size_t total = 0UL;
+
+    benchmark::timer timer;
+
+    for (size_t i = 0UL; i < Iterations; ++i)
+    {
+      for (size_t j = 0UL; j < Length; ++j)
+      {
+        total += size_t(snprintf(text, sizeof(text), printf_format, values[j]));
+      }
+    }
+
+    report(name, timer);
+    benchmark::do_not_optimise(total);
+  }
+}
+
+//*****************************************************************************
+int main()
+{
+  std::vector<int32_t>            i32(Length);
+  std::vector<unsigned long long> u64(Length);
+  std::vector<double>             f64(Length);
+
+  uint64_t x = 0x9E3779B97F4A7C15ULL;
+
+  for (size_t i = 0UL; i < Length; ++i)
+  {
+    x ^= x << 13; x ^= x >> 7; x ^= x << 17;
+
+    i32[i] = int32_t(x) >> (x % 31U);
+    u64[i] = x >> (x % 63U);
+    f64[i] = double(int64_t(x >> 20)) / double(1ULL << (x % 40U));
+  }
+
+  run_etl("int32_t decimal",        i32, etl::format_spec());
+  run_snprintf("int32_t %d",        i32, "%d");
+  run_etl("uint64_t decimal",       u64, etl::format_spec());
+  run_snprintf("uint64_t %llu",     u64, "%llu");
+  run_etl("uint64_t hex",           u64, etl::format_spec().hex());
+  run_snprintf("uint64_t %llx",     u64, "%llx");
+  run_etl("double precision 6",     f64, etl::format_spec().precision(6));
+  run_snprintf("double %.6f",       f64, "%.6f");
+  run_etl("double shortest",        f64, etl::format_spec().shortest(true));
+  run_snprintf("double %.17g",      f64, "%.17g");
+
+  return 0;
+}
@@ -0,0 +1,153 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+// Compares etl::unordered_flat_map, etl::unordered_map and std::unordered_map.
+// Each map is filled to 80% of its capacity with random keys, then timed for
+// insert, successful find, unsuccessful find and erase.
+
+#include "benchmark.h"
+
+#include "etl/unordered_flat_map.h"
+#include "etl/unordered_map.h"
+
+#include <unordered_map>
+#include <algorithm>
+#include <random>
+#include <vector>
+
+namespace
+{
+  const size_t Max_Size   = 65535UL;
+  const size_t Iterations = 20UL;
+
+  typedef etl::unordered_flat_map<uint32_t, uint32_t, Max_Size> FlatMap;
+  typedef etl::unordered_map<uint32_t, uint32_t, Max_Size>      EtlMap;
+  typedef std::unordered_map<uint32_t, uint32_t>                StdMap;
+
+  std::vector<uint32_t> keys;
+  std::vector<uint32_t> missing_keys;
+
+  struct results
+  {
+    double insert;
+    double find_hit;
+    double find_miss;
+    double erase;
+  };
+
+  //***************************************************************************
+  template <typename TMap>
+  results run(TMap& map)
+  {
+    results r = { 0.0, 0.0, 0.0, 0.0 };
+
+    for (size_t i = 0UL; i < Iterations; ++i)
+    {
+      map.clear();
+
+      benchmark::timer timer;
+      for (size_t k = 0UL; k < keys.size(); ++k)
+      {
+        map.insert(typename TMap::value_type(keys[k], uint32_t(k)));
+      }
+      r.insert += timer.elapsed_ns();
+
+      uint32_t sum = 0U;
+      timer.restart();
+      for (size_t k = 0UL; k < keys.size(); ++k)
+      {
+        sum += map.find(keys[k])->second;
+      }
+      r.find_hit += timer.elapsed_ns();
+      benchmark::do_not_optimise(sum);
+
+      size_t found = 0UL;
+      timer.restart();
+      for (size_t k = 0UL; k < missing_keys.size(); ++k)
+      {
+        found += (map.find(missing_keys[k]) != map.end()) ? 1UL : 0UL;
+      }
+      r.find_miss += timer.elapsed_ns();
+      benchmark::do_not_optimise(found);
+
+      timer.restart();
+      for (size_t k = 0UL; k < keys.size(); ++k)
+      {
+        map.erase(keys[k]);
+      }
+      r.erase += timer.elapsed_ns();
+    }
+
+    const double operations = double(Iterations * keys.size());
+
+    r.insert    /= operations;
+    r.find_hit  /= operations;
+    r.find_miss /= operations;
+    r.erase     /= operations;
+
+    return r;
+  }
+
+  //***************************************************************************
+  void print(const char* name, const results& r)
+  {
+    printf("%-24s %10.2fns %10.2fns %10.2fns %10.2fns\n", name, r.insert, r.find_hit, r.find_miss, r.erase);
+  }
+}
+
+//*****************************************************************************
+int main()
+{
+  std::mt19937 rng(12345);
+
+  // Even keys are present, odd keys are missing.
+  const size_t count = (Max_Size * 8UL) / 10UL;
+
+  for (size_t i = 0UL; i < count; ++i)
+  {
+    keys.push_back(rng() & ~1U);
+    missing_keys.push_back(rng() | 1U);
+  }
+
+  std::sort(keys.begin(), keys.end());
+  keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+  std::shuffle(keys.begin(), keys.end(), rng);
+
+  static FlatMap flat_map;
+  static EtlMap  etl_map;
+  StdMap std_map;
+  std_map.reserve(Max_Size);
+
+  printf("%-24s %12s %12s %12s %12s\n", "container", "insert", "find hit", "find miss", "erase");
+
+  print("etl::unordered_flat_map", run(flat_map));
+  print("etl::unordered_map",      run(etl_map));
+  print("std::unordered_map",      run(std_map));
+
+  return 0;
+}
@@ -0,0 +1,278 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+// Tests etl::queue_spsc_atomic built with ETL_QUEUE_SPSC_ATOMIC_USE_CACHE_LINE_PADDING.
+// The option changes the layout of the queue, so it is built as its own
+// executable rather than mixed with the default layout in the main tests.
+
+#include "etl/queue_spsc_atomic.h"
+
+#include <stdio.h>
+
+#if ETL_USING_CPP11
+  #include <thread>
+#endif
+
+#if !defined(ETL_QUEUE_SPSC_ATOMIC_USE_CACHE_LINE_PADDING)
+  #error ETL_QUEUE_SPSC_ATOMIC_USE_CACHE_LINE_PADDING must be defined for this test
+#endif
+
+namespace
+{
+  int failures = 0;
+
+  //***************************************************************************
+  void check(bool condition, int line)
+  {
+    if (!condition)
+    {
+      printf(">>>> Check failed at line %d <<<<\n", line);
+      ++failures;
+    }
+  }
+
+  #define CHECK(condition) check((condition), __LINE__)
+
+  //***************************************************************************
+  void test_layout()
+  {
+    // The write index, the read index and the data are on separate cache lines.
+    CHECK(sizeof(etl::queue_spsc_atomic<char, 1>) >= (3U * ETL_CACHE_LINE_SIZE));
+  }
+
+  //***************************************************************************
+  void test_size_push_pop()
+  {
+    etl::queue_spsc_atomic<int, 4> queue;
+
+    CHECK(queue.empty());
+    CHECK(!queue.full());
+    CHECK(queue.size() == 0U);
+    CHECK(queue.max_size() == 4U);
+
+    CHECK(queue.push(1));
+    CHECK(queue.push(2));
+    CHECK(queue.push(3));
+    CHECK(queue.size() == 3U);
+    CHECK(!queue.empty());
+
+    CHECK(queue.push(4));
+    CHECK(queue.full());
+    CHECK(!queue.push(5));
+    CHECK(queue.size() == 4U);
+
+    int value = 0;
+
+    CHECK(queue.front() == 1);
+    CHECK(queue.pop(value) && (value == 1));
+    CHECK(!queue.full());
+    CHECK(queue.pop(value) && (value == 2));
+    CHECK(queue.pop(value) && (value == 3));
+    CHECK(queue.pop(value) && (value == 4));
+    CHECK(queue.empty());
+    CHECK(!queue.pop(value));
+    CHECK(value == 4);
+  }
+
+  //***************************************************************************
+  void test_wrap_around()
+  {
+    etl::queue_spsc_atomic<int, 5> queue;
+
+    int next_push = 0;
+    int next_pop  = 0;
+
+    // The cached indexes must follow the real ones through many laps.
+    for (int lap = 0; lap < 100; ++lap)
+    {
+      while (queue.push(next_push))
+      {
+        ++next_push;
+      }
+
+      CHECK(queue.full());
+      CHECK(queue.size() == 5U);
+
+      for (int i = 0; i < 3; ++i)
+      {
+        int value = -1;
+        CHECK(queue.pop(value) && (value == next_pop));
+        ++next_pop;
+      }
+    }
+
+    int value = -1;
+
+    while (queue.pop(value))
+    {
+      CHECK(value == next_pop);
+      ++next_pop;
+    }
+
+    CHECK(next_push == next_pop);
+    CHECK(queue.empty());
+  }
+
+  //***************************************************************************
+  void test_clear()
+  {
+    etl::queue_spsc_atomic<int, 4> queue;
+
+    queue.push(1);
+    queue.push(2);
+    queue.pop();
+    queue.clear();
+
+    CHECK(queue.empty());
+    CHECK(queue.size() == 0U);
+
+    // The cached indexes are reset too.
+    for (int i = 0; i < 4; ++i)
+    {
+      CHECK(queue.push(i));
+    }
+
+    CHECK(queue.full());
+
+    int value = -1;
+    CHECK(queue.pop(value) && (value == 0));
+  }
+
+  //***************************************************************************
+  void test_span_and_reserve()
+  {
+    etl::queue_spsc_atomic<int, 5> queue;
+
+    int input[]  = { 1, 2, 3, 4, 5, 6 };
+    int output[] = { 0, 0, 0, 0, 0, 0 };
+
+    queue.push(0);
+    queue.push(0);
+    queue.pop();
+    queue.pop();
+
+    // Wraps around the end of the buffer.
+    CHECK(queue.push(etl::span<const int>(input, 6)) == 5U);
+    CHECK(queue.full());
+    CHECK(queue.push(etl::span<const int>(input, 1)) == 0U);
+    CHECK(queue.pop(etl::span<int>(output, 6)) == 5U);
+    CHECK(queue.empty());
+
+    for (int i = 0; i < 5; ++i)
+    {
+      CHECK(output[i] == input[i]);
+    }
+
+    // Both indexes are at slot 1, so the free area runs to the end of the buffer.
+    etl::span<int> reserved = queue.write_reserve();
+    CHECK(reserved.size() == 5U);
+    reserved[0] = 10;
+    queue.write_commit(1U);
+
+    // A push after the reserve/commit sees the updated cached index.
+    CHECK(queue.push(11));
+    CHECK(queue.size() == 2U);
+
+    etl::span<int> peeked = queue.read_peek();
+    CHECK((peeked.size() == 2U) && (peeked[0] == 10) && (peeked[1] == 11));
+    queue.read_release(1U);
+
+    int value = -1;
+    CHECK(queue.pop(value) && (value == 11));
+    CHECK(queue.empty());
+    CHECK(!queue.pop(value));
+  }
+
+#if ETL_USING_CPP11
+  //***************************************************************************
+  void test_threads()
+  {
+    const int Count = 100000;
+
+    etl::queue_spsc_atomic<int, 16> queue;
+
+    std::thread producer([&queue]()
+    {
+      for (int i = 0; i < Count; ++i)
+      {
+        while (!queue.push(i))
+        {
+          std::this_thread::yield();
+        }
+      }
+    });
+
+    int  expected = 0;
+    bool in_order = true;
+
+    while (expected < Count)
+    {
+      int value;
+
+      if (queue.pop(value))
+      {
+        in_order = in_order && (value == expected);
+        ++expected;
+      }
+      else
+      {
+        std::this_thread::yield();
+      }
+    }
+
+    producer.join();
+
+    CHECK(in_order);
+    CHECK(queue.empty());
+  }
+#endif
+}
+
+//*****************************************************************************
+int main()
+{
+  test_layout();
+  test_size_push_pop();
+  test_wrap_around();
+  test_clear();
+  test_span_and_reserve();
+#if ETL_USING_CPP11
+  test_threads();
+#endif
+
+  if (failures == 0)
+  {
+    printf("**** All tests passed ****\n");
+  }
+  else
+  {
+    printf(">>>> %d checks failed <<<<\n", failures);
+  }
+
+  return failures;
+}
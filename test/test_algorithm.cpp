@@ -2026,6 +2026,213 @@ namespace
       }
     }
 
+    //*************************************************************************
+    TEST(intro_sort_default)
+    {
+      std::vector<int> data(1000, 0);
+      std::iota(data.begin(), data.end(), 1);
+
+      for (int i = 0; i < 100; ++i)
+      {
+        std::shuffle(data.begin(), data.end(), urng);
+
+        std::vector<int> data1 = data;
+        std::vector<int> data2 = data;
+
+        std::sort(data1.begin(), data1.end());
+        etl::intro_sort(data2.begin(), data2.end());
+
+        bool is_same = std::equal(data1.begin(), data1.end(), data2.begin());
+        CHECK(is_same);
+      }
+    }
+
+    //*************************************************************************
+    TEST(intro_sort_greater)
+    {
+      std::vector<int> data(1000, 0);
+      std::iota(data.begin(), data.end(), 1);
+
+      for (int i = 0; i < 100; ++i)
+      {
+        std::shuffle(data.begin(), data.end(), urng);
+
+        std::vector<int> data1 = data;
+        std::vector<int> data2 = data;
+
+        std::sort(data1.begin(), data1.end(), std::greater<int>());
+        etl::intro_sort(data2.begin(), data2.end(), std::greater<int>());
+
+        bool is_same = std::equal(data1.begin(), data1.end(), data2.begin());
+        CHECK(is_same);
+      }
+    }
+
+    //*************************************************************************
+    TEST(intro_sort_patterns)
+    {
+      std::vector<std::vector<int>> patterns;
+
+      for (int length : { 0, 1, 2, 3, 16, 17, 129, 1000 })
+      {
+        std::vector<int> sorted(length);
+        std::iota(sorted.begin(), sorted.end(), 0);
+        patterns.push_back(sorted);
+
+        std::vector<int> reversed(sorted.rbegin(), sorted.rend());
+        patterns.push_back(reversed);
+
+        std::vector<int> few_unique(length);
+        std::generate(few_unique.begin(), few_unique.end(), []() { return int(urng() % 4U); });
+        patterns.push_back(few_unique);
+
+        std::vector<int> all_equal(length, 42);
+        patterns.push_back(all_equal);
+
+        std::vector<int> organ_pipe(sorted);
+        std::reverse(organ_pipe.begin() + (length / 2), organ_pipe.end());
+        patterns.push_back(organ_pipe);
+      }
+
+      for (size_t i = 0UL; i < patterns.size(); ++i)
+      {
+        std::vector<int> data1 = patterns[i];
+        std::vector<int> data2 = patterns[i];
+
+        std::sort(data1.begin(), data1.end());
+        etl::intro_sort(data2.begin(), data2.end());
+
+        bool is_same = std::equal(data1.begin(), data1.end(), data2.begin());
+        CHECK(is_same);
+      }
+    }
+
+    //*************************************************************************
+    TEST(intro_sort_movable)
+    {
+      std::vector<int> keys(200, 0);
+      std::iota(keys.begin(), keys.end(), 0);
+      std::shuffle(keys.begin(), keys.end(), urng);
+
+      std::vector<std::unique_ptr<int>> data;
+
+      for (size_t i = 0UL; i < keys.size(); ++i)
+      {
+        data.push_back(std::unique_ptr<int>(new int(keys[i])));
+      }
+
+      etl::intro_sort(data.begin(), data.end(), [](const std::unique_ptr<int>& lhs, const std::unique_ptr<int>& rhs) { return *lhs < *rhs; });
+
+      for (size_t i = 0UL; i < data.size(); ++i)
+      {
+        CHECK_EQUAL(int(i), *data[i]);
+      }
+    }
+
+    //*************************************************************************
+    TEST(merge_sort_default)
+    {
+      for (int length : { 0, 1, 2, 19, 20, 21, 41, 100, 1000 })
+      {
+        std::vector<NDC> initial_data;
+
+        for (int i = 0; i < length; ++i)
+        {
+          initial_data.push_back(NDC(int(urng() % 16U), i));
+        }
+
+        std::vector<NDC> data1(initial_data);
+        std::vector<NDC> data2(initial_data);
+
+        std::stable_sort(data1.begin(), data1.end());
+        etl::merge_sort(data2.begin(), data2.end());
+
+        bool is_same = std::equal(data1.begin(), data1.end(), data2.begin(), NDC::are_identical);
+        CHECK(is_same);
+      }
+    }
+
+    //*************************************************************************
+    TEST(merge_sort_greater)
+    {
+      for (int length : { 0, 1, 2, 19, 20, 21, 41, 100, 1000 })
+      {
+        std::vector<NDC> initial_data;
+
+        for (int i = 0; i < length; ++i)
+        {
+          initial_data.push_back(NDC(int(urng() % 16U), i));
+        }
+
+        std::vector<NDC> data1(initial_data);
+        std::vector<NDC> data2(initial_data);
+
+        std::stable_sort(data1.begin(), data1.end(), std::greater<NDC>());
+        etl::merge_sort(data2.begin(), data2.end(), std::greater<NDC>());
+
+        bool is_same = std::equal(data1.begin(), data1.end(), data2.begin(), NDC::are_identical);
+        CHECK(is_same);
+      }
+    }
+
+    //*************************************************************************
+    TEST(merge_sort_with_buffer)
+    {
+      typedef std::pair<int, int> Item;
+
+      struct CompareFirst
+      {
+        bool operator()(const Item& lhs, const Item& rhs) const
+        {
+          return lhs.first < rhs.first;
+        }
+      };
+
+      const size_t Length = 1000;
+
+      std::vector<Item> initial_data;
+
+      for (size_t i = 0UL; i < Length; ++i)
+      {
+        initial_data.push_back(Item(int(urng() % 32U), int(i)));
+      }
+
+      std::vector<Item> expected(initial_data);
+      std::stable_sort(expected.begin(), expected.end(), CompareFirst());
+
+      for (size_t buffer_size : { size_t(0), size_t(1), size_t(10), size_t(100), Length / 2, Length })
+      {
+        std::vector<Item> data(initial_data);
+        std::vector<Item> buffer(buffer_size);
+
+        etl::merge_sort(data.begin(), data.end(), buffer.begin(), buffer.end(), CompareFirst());
+
+        CHECK(expected == data);
+      }
+    }
+
+    //*************************************************************************
+    TEST(merge_sort_movable)
+    {
+      std::vector<int> keys(200, 0);
+      std::iota(keys.begin(), keys.end(), 0);
+      std::shuffle(keys.begin(), keys.end(), urng);
+
+      std::vector<std::unique_ptr<int>> data;
+
+      for (size_t i = 0UL; i < keys.size(); ++i)
+      {
+        data.push_back(std::unique_ptr<int>(new int(keys[i])));
+      }
+
+      etl::merge_sort(data.begin(), data.end(), [](const std::unique_ptr<int>& lhs, const std::unique_ptr<int>& rhs) { return *lhs < *rhs; });
+
+      for (size_t i = 0UL; i < data.size(); ++i)
+      {
+        CHECK_EQUAL(int(i), *data[i]);
+      }
+    }
+
     //*************************************************************************
     TEST(insertion_sort_default)
     {
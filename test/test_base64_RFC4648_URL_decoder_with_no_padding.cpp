@@ -714,6 +714,66 @@ namespace
       }
     }
 
+    //*************************************************************************
+    TEST(test_decode_span_single_pass_with_no_callback_and_full_size_buffer)
+    {
+      codec_full_buffer b64;
+
+      for (size_t i = 0; i < 256; ++i)
+      {
+        b64.restart();
+
+        b64.decode_final(etl::span<const char>(encoded[i].data(), encoded[i].size()));
+
+        std::vector<unsigned char> expected(input_data.begin(), input_data.begin() + i);
+        std::vector<unsigned char> actual(b64.begin(), b64.end());
+
+        CHECK_EQUAL(expected.size(), actual.size());
+        CHECK_TRUE(std::equal(expected.begin(), expected.end(), actual.begin()));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_decode_span_with_callback)
+    {
+      codec_larger_buffer b64(callback);
+
+      for (size_t i = 0; i < 256; ++i)
+      {
+        decoded_output.clear();
+        received_final_block = false;
+
+        b64.decode_final(etl::span<const char>(encoded[i].data(), encoded[i].size()));
+
+        std::vector<unsigned char> expected(input_data.begin(), input_data.begin() + i);
+        std::vector<unsigned char> actual(decoded_output);
+
+        CHECK_TRUE(received_final_block);
+        CHECK_EQUAL(expected.size(), actual.size());
+        CHECK_TRUE(std::equal(expected.begin(), expected.end(), actual.begin()));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_decode_invalid_character_in_long_input)
+    {
+      for (size_t position = 0; position < 100; position += 7)
+      {
+        codec_full_buffer b64;
+
+        std::string invalid_chararacter(encoded[255]);
+        invalid_chararacter[position] = '#';
+
+#if ETL_USING_EXCEPTIONS
+        CHECK_THROW((b64.decode(invalid_chararacter.data(), invalid_chararacter.size())), etl::base64_invalid_data);
+#else
+        CHECK_FALSE(b64.decode(invalid_chararacter.data(), invalid_chararacter.size()));
+#endif
+        CHECK_TRUE(b64.invalid_data());
+        CHECK_TRUE(b64.size() <= (((position / 4U) + 1U) * 3U));
+      }
+    }
+
     //*************************************************************************
 #if ETL_USING_CPP14
     template <size_t Size>
@@ -700,6 +700,74 @@ namespace
       }
     }
 
+    //*************************************************************************
+    TEST(test_encode_span_single_pass_with_no_callback_and_full_size_buffer)
+    {
+      codec_full_buffer b64;
+
+      for (size_t i = 0; i < 256; ++i)
+      {
+        b64.restart();
+
+        b64.encode_final(etl::span<const unsigned char>(input_data.data(), i));
+
+        std::string expected(encoded[i]);
+        std::string actual(b64.begin(), b64.end());
+
+        CHECK_EQUAL(expected, actual);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_encode_span_matches_encode_by_char_for_all_alignments)
+    {
+      codec_full_buffer b64_block;
+      codec_full_buffer b64_char;
+
+      for (size_t offset = 0; offset < 4; ++offset)
+      {
+        for (size_t i = 0; i < (256 - offset); ++i)
+        {
+          b64_block.restart();
+          b64_char.restart();
+
+          b64_block.encode_final(etl::span<const unsigned char>(input_data.data() + offset, i));
+
+          for (size_t j = 0; j < i; ++j)
+          {
+            b64_char.encode(input_data[offset + j]);
+          }
+
+          b64_char.flush();
+
+          std::string expected(b64_char.begin(), b64_char.end());
+          std::string actual(b64_block.begin(), b64_block.end());
+
+          CHECK_EQUAL(expected, actual);
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_encode_span_with_callback)
+    {
+      codec b64(callback);
+
+      for (size_t i = 0; i < 256; ++i)
+      {
+        encoded_output.clear();
+        received_final_block = false;
+
+        b64.encode_final(etl::span<const unsigned char>(input_data.data(), i));
+
+        std::string expected(encoded[i]);
+        std::string actual(encoded_output);
+
+        CHECK_TRUE(received_final_block);
+        CHECK_EQUAL(expected, actual);
+      }
+    }
+
     //*************************************************************************
 #if ETL_USING_CPP14
     template <size_t Size>
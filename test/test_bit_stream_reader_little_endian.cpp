@@ -1192,6 +1192,80 @@ namespace
       CHECK_EQUAL(object2.i, result2.i);
       CHECK_EQUAL(object2.c, result2.c);
     }
+
+    //*************************************************************************
+    TEST(test_read_range_matches_single_reads)
+    {
+      std::array<char, 200U> storage;
+
+      for (size_t i = 0U; i < storage.size(); ++i)
+      {
+        storage[i] = char(i * 37U + 11U);
+      }
+
+      const uint_least8_t widths[] = { 1U, 3U, 8U, 12U, 33U, 57U, 64U };
+
+      for (size_t w = 0U; w < (sizeof(widths) / sizeof(widths[0])); ++w)
+      {
+        etl::bit_stream_reader bit_stream1(storage.data(), storage.size(), etl::endian::little);
+        etl::bit_stream_reader bit_stream2(storage.data(), storage.size(), etl::endian::little);
+
+        // Start part way through a char.
+        CHECK_EQUAL(bit_stream1.read_unchecked<uint8_t>(3U), bit_stream2.read_unchecked<uint8_t>(3U));
+
+        std::array<int64_t, 23> expected;
+
+        for (size_t i = 0U; i < expected.size(); ++i)
+        {
+          expected[i] = bit_stream1.read_unchecked<int64_t>(widths[w]);
+        }
+
+        std::array<int64_t, 23> values;
+        etl::optional<etl::span<const int64_t> > result = bit_stream2.read(etl::span<int64_t>(values.data(), values.size()), widths[w]);
+
+        CHECK(result.has_value());
+        CHECK_EQUAL(values.size(), result.value().size());
+        CHECK_ARRAY_EQUAL(expected.data(), values.data(), expected.size());
+
+        // Both streams should be at the same position.
+        CHECK_EQUAL(int(bit_stream1.read_unchecked<uint8_t>(5U)), int(bit_stream2.read_unchecked<uint8_t>(5U)));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_read_range_signed)
+    {
+      std::array<int16_t, 6U> written = { -1, 0, 1, -2048, 2047, -1234 };
+
+      std::array<char, 10U> storage;
+      storage.fill(0);
+
+      etl::bit_stream_writer writer(storage.data(), storage.size(), etl::endian::little);
+      writer.write(etl::span<int16_t>(written.data(), written.size()), 12U);
+
+      etl::bit_stream_reader bit_stream(storage.data(), storage.size(), etl::endian::little);
+
+      std::array<int16_t, 6U> values;
+      etl::span<const int16_t> result = bit_stream.read_unchecked(etl::span<int16_t>(values.data(), values.size()), 12U);
+
+      CHECK_EQUAL(values.data(), result.data());
+      CHECK_ARRAY_EQUAL(written.data(), values.data(), written.size());
+    }
+
+    //*************************************************************************
+    TEST(test_read_range_not_enough_bits)
+    {
+      std::array<char, 4U> storage = { char(0x01), char(0x23), char(0x45), char(0x67) };
+
+      etl::bit_stream_reader bit_stream(storage.data(), storage.size(), etl::endian::little);
+
+      std::array<uint16_t, 3U> values;
+
+      CHECK(!bit_stream.read(etl::span<uint16_t>(values.data(), values.size()), 11U).has_value());
+      CHECK(bit_stream.read(etl::span<uint16_t>(values.data(), 2U), 11U).has_value());
+      CHECK(!bit_stream.read<uint16_t>(11U).has_value());
+      CHECK(bit_stream.read<uint16_t>(10U).has_value());
+    }
   };
 }
 
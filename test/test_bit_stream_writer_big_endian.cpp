@@ -814,6 +814,102 @@ namespace
       CHECK_EQUAL(bit_stream.empty(), false);
       CHECK_EQUAL(bit_stream.full(), true);
     }
+
+    //*************************************************************************
+    TEST(test_write_range_matches_single_writes)
+    {
+      std::array<int64_t, 23> values;
+
+      for (size_t i = 0U; i < values.size(); ++i)
+      {
+        values[i] = int64_t(0x0123456789ABCDEFULL * (i + 1U)) ^ int64_t(i << 60);
+      }
+
+      const uint_least8_t widths[] = { 1U, 3U, 8U, 12U, 33U, 57U, 64U };
+
+      for (size_t w = 0U; w < (sizeof(widths) / sizeof(widths[0])); ++w)
+      {
+        std::array<char, 200U> storage1;
+        std::array<char, 200U> storage2;
+        storage1.fill(0);
+        storage2.fill(0);
+
+        etl::bit_stream_writer bit_stream1(storage1.data(), storage1.size(), etl::endian::big);
+        etl::bit_stream_writer bit_stream2(storage2.data(), storage2.size(), etl::endian::big);
+
+        // Start part way through a char.
+        bit_stream1.write(uint8_t(5U), 3U);
+        bit_stream2.write(uint8_t(5U), 3U);
+
+        for (size_t i = 0U; i < values.size(); ++i)
+        {
+          bit_stream1.write(values[i], widths[w]);
+        }
+
+        CHECK(bit_stream2.write(etl::span<const int64_t>(values.data(), values.size()), widths[w]));
+
+        CHECK_EQUAL(bit_stream1.size_bits(), bit_stream2.size_bits());
+        CHECK_EQUAL(bit_stream1.size_bytes(), bit_stream2.size_bytes());
+        CHECK_ARRAY_EQUAL(storage1.data(), storage2.data(), bit_stream1.size_bytes());
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_write_range_not_enough_space)
+    {
+      std::array<char, 4U> storage;
+      storage.fill(0);
+
+      std::array<uint16_t, 3U> values = { 0x0123U, 0x0456U, 0x0789U };
+
+      etl::bit_stream_writer bit_stream(storage.data(), storage.size(), etl::endian::big);
+
+      CHECK(!bit_stream.write(etl::span<uint16_t>(values.data(), values.size()), 11U));
+      CHECK(bit_stream.empty());
+
+      CHECK(bit_stream.write(etl::span<uint16_t>(values.data(), 2U), 11U));
+      CHECK_EQUAL(22U, bit_stream.size_bits());
+    }
+
+    //*************************************************************************
+    TEST(test_write_range_with_callback)
+    {
+      Accumulator accumulator1;
+      Accumulator accumulator2;
+
+      std::array<char, 8U> storage1;
+      std::array<char, 8U> storage2;
+      storage1.fill(0);
+      storage2.fill(0);
+
+      std::array<uint32_t, 50U> values;
+
+      for (size_t i = 0U; i < values.size(); ++i)
+      {
+        values[i] = uint32_t(i * 2654435761U);
+      }
+
+      auto callback1 = etl::bit_stream_writer::callback_type::create<Accumulator, &Accumulator::Add>(accumulator1);
+      auto callback2 = etl::bit_stream_writer::callback_type::create<Accumulator, &Accumulator::Add>(accumulator2);
+
+      etl::bit_stream_writer bit_stream1(storage1.data(), storage1.size(), etl::endian::big, callback1);
+      etl::bit_stream_writer bit_stream2(storage2.data(), storage2.size(), etl::endian::big, callback2);
+
+      // The range is larger than the buffer, so it is written in several flushes.
+      for (size_t i = 0U; i < values.size(); ++i)
+      {
+        bit_stream1.write(values[i], 21U);
+      }
+
+      bit_stream2.write_unchecked(etl::span<uint32_t>(values.data(), values.size()), 21U);
+
+      bit_stream1.flush();
+      bit_stream2.flush();
+
+      CHECK_EQUAL((values.size() * 21U + 7U) / 8U, accumulator2.GetData().size());
+      CHECK_EQUAL(accumulator1.GetData().size(), accumulator2.GetData().size());
+      CHECK_ARRAY_EQUAL(accumulator1.GetData().data(), accumulator2.GetData().data(), accumulator1.GetData().size());
+    }
   };
 }
 
@@ -2073,6 +2073,219 @@ namespace
       CHECK_EQUAL(4U, bs4find_next_true1);
     }
 
+    //*************************************************************************
+    TEST(test_find_first_false_in_large_allocation_map)
+    {
+      etl::bitset<65536> allocated;
+      std::bitset<65536> compare;
+
+      allocated.set();
+      compare.set();
+
+      CHECK_EQUAL(etl::bitset<>::npos, allocated.find_first(false));
+
+      // Free a scattered set of positions, including each end and element boundaries.
+      const size_t free_positions[] = { 65535U, 40000U, 31U, 32U, 63U, 64U, 4095U, 4097U, 0U, 60001U };
+
+      for (size_t i = 0U; i < (sizeof(free_positions) / sizeof(free_positions[0])); ++i)
+      {
+        allocated.reset(free_positions[i]);
+        compare.reset(free_positions[i]);
+
+        size_t expected = 0U;
+
+        while ((expected < compare.size()) && compare.test(expected))
+        {
+          ++expected;
+        }
+
+        CHECK_EQUAL(expected, allocated.find_first(false));
+      }
+
+      // Walk all of the free positions.
+      size_t position = allocated.find_first(false);
+      size_t expected = 0U;
+
+      while (position != etl::bitset<>::npos)
+      {
+        while (compare.test(expected))
+        {
+          ++expected;
+        }
+
+        CHECK_EQUAL(expected, position);
+
+        position = allocated.find_next(false, position + 1U);
+        ++expected;
+      }
+
+      CHECK_EQUAL(65536U - 10U, allocated.count());
+    }
+
+    //*************************************************************************
+    TEST(test_find_next_large_bitset_matches_std_bitset)
+    {
+      etl::bitset<1000> data;
+      std::bitset<1000> compare;
+
+      uint32_t seed  = 0x12345678UL;
+      bool     value = false;
+
+      for (size_t i = 0U; i < data.size(); ++i)
+      {
+        seed = (seed * 1103515245UL) + 12345UL;
+
+        // Long runs of set and clear bits.
+        if (((seed >> 16) % 64U) == 0U)
+        {
+          value = !value;
+        }
+
+        data.set(i, value);
+        compare.set(i, value);
+      }
+
+      for (size_t start = 0U; start < (data.size() + 2U); ++start)
+      {
+        for (int state = 0; state < 2; ++state)
+        {
+          size_t expected = etl::bitset<>::npos;
+
+          for (size_t i = start; i < compare.size(); ++i)
+          {
+            if (compare.test(i) == (state == 1))
+            {
+              expected = i;
+              break;
+            }
+          }
+
+          CHECK_EQUAL(expected, data.find_next(state == 1, start));
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_count_any_none_all_large_bitset)
+    {
+      etl::bitset<1000> data;
+      std::bitset<1000> compare;
+
+      CHECK_EQUAL(0U, data.count());
+      CHECK(data.none());
+      CHECK(!data.any());
+      CHECK(!data.all());
+
+      data.set(999);
+      compare.set(999);
+      CHECK_EQUAL(1U, data.count());
+      CHECK(!data.none());
+      CHECK(data.any());
+
+      uint32_t seed = 0x87654321UL;
+
+      for (size_t i = 0U; i < data.size(); ++i)
+      {
+        seed = (seed * 1103515245UL) + 12345UL;
+        const bool value = ((seed >> 16) & 1U) != 0U;
+
+        data.set(i, value);
+        compare.set(i, value);
+      }
+
+      CHECK_EQUAL(compare.count(), data.count());
+
+      data.set();
+      CHECK_EQUAL(1000U, data.count());
+      CHECK(data.all());
+
+      data.reset(0);
+      CHECK(!data.all());
+      data.set(0);
+      data.reset(998);
+      CHECK(!data.all());
+    }
+
+    //*************************************************************************
+    TEST(test_bitwise_operators_large_bitset)
+    {
+      etl::bitset<1000> data1;
+      etl::bitset<1000> data2;
+      std::bitset<1000> compare1;
+      std::bitset<1000> compare2;
+
+      uint32_t seed = 0x13579BDFUL;
+
+      for (size_t i = 0U; i < data1.size(); ++i)
+      {
+        seed = (seed * 1103515245UL) + 12345UL;
+
+        data1.set(i, ((seed >> 16) & 1U) != 0U);
+        compare1.set(i, ((seed >> 16) & 1U) != 0U);
+        data2.set(i, ((seed >> 17) & 1U) != 0U);
+        compare2.set(i, ((seed >> 17) & 1U) != 0U);
+      }
+
+      CHECK_EQUAL(compare1.count(), data1.count());
+      CHECK_EQUAL(compare2.count(), data2.count());
+
+      etl::bitset<1000> result_and = data1 & data2;
+      etl::bitset<1000> result_or  = data1 | data2;
+      etl::bitset<1000> result_xor = data1 ^ data2;
+      etl::bitset<1000> result_not = ~data1;
+
+      std::bitset<1000> compare_and = compare1 & compare2;
+      std::bitset<1000> compare_or  = compare1 | compare2;
+      std::bitset<1000> compare_xor = compare1 ^ compare2;
+      std::bitset<1000> compare_not = ~compare1;
+
+      for (size_t i = 0U; i < data1.size(); ++i)
+      {
+        CHECK_EQUAL(compare_and.test(i), result_and.test(i));
+        CHECK_EQUAL(compare_or.test(i),  result_or.test(i));
+        CHECK_EQUAL(compare_xor.test(i), result_xor.test(i));
+        CHECK_EQUAL(compare_not.test(i), result_not.test(i));
+      }
+
+      CHECK_EQUAL(compare_and.count(), result_and.count());
+      CHECK_EQUAL(compare_or.count(),  result_or.count());
+      CHECK_EQUAL(compare_xor.count(), result_xor.count());
+    }
+
+    //*************************************************************************
+    ETL_CONSTEXPR14 etl::bitset<1000> test_large_constexpr_helper()
+    {
+      etl::bitset<1000> data;
+
+      data.set();
+      data.reset(777);
+      data ^= ~data;
+      data.reset(777);
+      data &= ~etl::bitset<1000>().set(3);
+
+      return data;
+    }
+
+    //*************************************************************************
+    TEST(test_find_and_count_large_bitset_constexpr)
+    {
+      ETL_CONSTEXPR14 etl::bitset<1000> data = test_large_constexpr_helper();
+
+      ETL_CONSTEXPR14 size_t first_false = data.find_first(false);
+      ETL_CONSTEXPR14 size_t next_false  = data.find_next(false, 4);
+      ETL_CONSTEXPR14 size_t next_true   = data.find_next(true, 777);
+      ETL_CONSTEXPR14 size_t count       = data.count();
+      ETL_CONSTEXPR14 bool   all         = data.all();
+      ETL_CONSTEXPR14 bool   any         = data.any();
+
+      CHECK_EQUAL(3U,   first_false);
+      CHECK_EQUAL(777U, next_false);
+      CHECK_EQUAL(778U, next_true);
+      CHECK_EQUAL(998U, count);
+      CHECK(!all);
+      CHECK(any);
+    }
+
     //*************************************************************************
     ETL_CONSTEXPR14 std::pair<etl::bitset<8>, etl::bitset<8>> test_swap_helper()
     {
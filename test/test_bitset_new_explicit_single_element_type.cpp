@@ -2196,6 +2196,28 @@ namespace
       CHECK_EQUAL(4U, bs4find_next_true1);
     }
 
+    //*************************************************************************
+    TEST(test_find_next_in_upper_bits)
+    {
+      ETL_CONSTEXPR14 etl::bitset<64, uint64_t> bs1(ull(0x4000000000000000));
+      ETL_CONSTEXPR14 size_t bs1find_first_true   = bs1.find_first(true);
+      ETL_CONSTEXPR14 size_t bs1find_next_true63  = bs1.find_next(true, 63);
+      ETL_CONSTEXPR14 size_t bs1find_next_false62 = bs1.find_next(false, 62);
+      CHECK_EQUAL(62U, bs1find_first_true);
+      CHECK_EQUAL(etl::bitset<>::npos, bs1find_next_true63);
+      CHECK_EQUAL(63U, bs1find_next_false62);
+
+      ETL_CONSTEXPR14 etl::bitset<40, uint64_t> bs2(ull(0x00000000FFFFFFFF));
+      ETL_CONSTEXPR14 size_t bs2find_first_false = bs2.find_first(false);
+      ETL_CONSTEXPR14 size_t bs2find_next_false39 = bs2.find_next(false, 39);
+      ETL_CONSTEXPR14 size_t bs2find_next_true32  = bs2.find_next(true, 32);
+      ETL_CONSTEXPR14 size_t bs2count             = bs2.count();
+      CHECK_EQUAL(32U, bs2find_first_false);
+      CHECK_EQUAL(39U, bs2find_next_false39);
+      CHECK_EQUAL(etl::bitset<>::npos, bs2find_next_true32);
+      CHECK_EQUAL(32U, bs2count);
+    }
+
     //*************************************************************************
     ETL_CONSTEXPR14 std::pair<etl::bitset<8, uint8_t>, etl::bitset<8, uint8_t>> test_swap_helper()
     {
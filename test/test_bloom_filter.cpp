@@ -37,6 +37,8 @@ SOFTWARE.
 #include "etl/crc16.h"
 #include "etl/crc16_ccitt.h"
 #include "etl/crc32.h"
+#include "etl/xxhash.h"
+#include "etl/span.h"
 
 #include "etl/char_traits.h"
 
@@ -70,6 +72,26 @@ struct hash3_t
   }
 };
 
+struct hash64_t
+{
+  typedef const char* argument_type;
+
+  uint64_t operator ()(argument_type text) const
+  {
+    return etl::xxhash64(text, text + etl::char_traits<char>::length(text));
+  }
+};
+
+struct hash_uint32_t
+{
+  typedef uint32_t argument_type;
+
+  uint64_t operator ()(argument_type value) const
+  {
+    return etl::xxhash64(reinterpret_cast<const uint8_t*>(&value), reinterpret_cast<const uint8_t*>(&value) + sizeof(value));
+  }
+};
+
 std::vector<const char*> exist_text     = { "The", "rain", "in", "Spain", "falls", "mainly", "on", "the", "plain" };
 std::vector<const char*> not_exist_text = { "My", "hovercraft", "is", "full", "of", "eels" };
 
@@ -260,6 +282,163 @@ namespace
 
       CHECK(!any_exist);
     }
+
+    //*************************************************************************
+    TEST(test_blocked_bloom_filter)
+    {
+      etl::blocked_bloom_filter<1024, hash64_t> bloom;
+
+      for (size_t i = 0UL; i < exist_text.size(); ++i)
+      {
+        bloom.add(exist_text[i]);
+      }
+
+      // Check for false negatives.
+      bool all_exist = true;
+
+      for (size_t i = 0UL; i < exist_text.size(); ++i)
+      {
+        all_exist = all_exist && bloom.exists(exist_text[i]);
+      }
+
+      CHECK(all_exist);
+
+      // Check for false positives. There should be none for this set.
+      bool any_exist = false;
+
+      for (size_t i = 0UL; i < not_exist_text.size(); ++i)
+      {
+        any_exist = any_exist || bloom.exists(not_exist_text[i]);
+      }
+
+      CHECK(!any_exist);
+
+      // Each key sets six bits, some of which may be shared.
+      size_t count = bloom.count();
+      CHECK(count > 6U);
+      CHECK(count <= (6U * exist_text.size()));
+    }
+
+    //*************************************************************************
+    TEST(test_blocked_bloom_filter_width)
+    {
+      typedef etl::blocked_bloom_filter<1000, hash64_t> Bloom;
+      typedef etl::blocked_bloom_filter<1, hash64_t, 3> Bloom_Small;
+
+      Bloom bloom;
+
+      CHECK_EQUAL(1024U, bloom.width());
+      CHECK_EQUAL(1024U, Bloom::WIDTH);
+      CHECK_EQUAL(2U,    Bloom::BLOCKS);
+      CHECK_EQUAL(6U,    Bloom::PROBES);
+
+      CHECK_EQUAL(512U, Bloom_Small::WIDTH);
+      CHECK_EQUAL(1U,   Bloom_Small::BLOCKS);
+      CHECK_EQUAL(3U,   Bloom_Small::PROBES);
+    }
+
+    //*************************************************************************
+    TEST(test_blocked_bloom_filter_probes_per_key)
+    {
+      etl::blocked_bloom_filter<512, hash64_t, 20> bloom;
+
+      bloom.add(exist_text[0]);
+
+      // The probes are all different bits in the same block.
+      CHECK_EQUAL(20U, bloom.count());
+    }
+
+    //*************************************************************************
+    TEST(test_blocked_bloom_filter_clear)
+    {
+      etl::blocked_bloom_filter<1024, hash64_t> bloom;
+
+      bloom.add(exist_text.begin(), exist_text.end());
+      CHECK(bloom.usage() > 0);
+
+      bloom.clear();
+
+      CHECK_EQUAL(0U, bloom.usage());
+      CHECK_EQUAL(0U, bloom.count());
+      CHECK(!bloom.exists(exist_text[0]));
+    }
+
+    //*************************************************************************
+    TEST(test_blocked_bloom_filter_add_exists_range)
+    {
+      etl::blocked_bloom_filter<1024, hash64_t> bloom1;
+      etl::blocked_bloom_filter<1024, hash64_t> bloom2;
+
+      bloom1.add(exist_text.begin(), exist_text.end());
+
+      for (size_t i = 0UL; i < exist_text.size(); ++i)
+      {
+        bloom2.add(exist_text[i]);
+      }
+
+      CHECK_EQUAL(bloom2.count(), bloom1.count());
+
+      std::vector<bool> results;
+      bloom1.exists(exist_text.begin(), exist_text.end(), std::back_inserter(results));
+
+      CHECK_EQUAL(exist_text.size(), results.size());
+      CHECK(std::find(results.begin(), results.end(), false) == results.end());
+
+      results.clear();
+      bloom1.exists(not_exist_text.begin(), not_exist_text.end(), std::back_inserter(results));
+
+      CHECK_EQUAL(not_exist_text.size(), results.size());
+      CHECK(std::find(results.begin(), results.end(), true) == results.end());
+    }
+
+    //*************************************************************************
+    TEST(test_blocked_bloom_filter_add_exists_span)
+    {
+      std::vector<uint32_t> keys(1000U);
+
+      for (size_t i = 0UL; i < keys.size(); ++i)
+      {
+        keys[i] = uint32_t(i * 7919U);
+      }
+
+      etl::blocked_bloom_filter<16384, hash_uint32_t> bloom;
+
+      bloom.add(etl::span<const uint32_t>(keys.data(), keys.size()));
+
+      bool results[1000];
+
+      size_t found = bloom.exists(etl::span<const uint32_t>(keys.data(), keys.size()), etl::span<bool>(results, 1000U));
+
+      CHECK_EQUAL(keys.size(), found);
+
+      // Only as many keys as there are results are tested.
+      found = bloom.exists(etl::span<const uint32_t>(keys.data(), keys.size()), etl::span<bool>(results, 10U));
+
+      CHECK_EQUAL(10U, found);
+    }
+
+    //*************************************************************************
+    TEST(test_blocked_bloom_filter_false_positive_rate)
+    {
+      // 16 bits per key with 6 probes. The expected rate is well under 1%.
+      etl::blocked_bloom_filter<16384, hash_uint32_t> bloom;
+
+      for (uint32_t i = 0UL; i < 1024U; ++i)
+      {
+        bloom.add(i);
+      }
+
+      size_t false_positives = 0U;
+
+      for (uint32_t i = 1024U; i < (1024U + 10000U); ++i)
+      {
+        if (bloom.exists(i))
+        {
+          ++false_positives;
+        }
+      }
+
+      CHECK(false_positives < 100U);
+    }
   };
 }
-
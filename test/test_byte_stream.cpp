@@ -1348,6 +1348,165 @@ namespace
       CHECK_FALSE(result.has_value());
       CHECK_TRUE(r.empty());
     }
+
+    //*************************************************************************
+    template <typename T>
+    void check_write_read_block(etl::endian endianness)
+    {
+      // Long enough to use any vector kernels, with a remainder.
+      const size_t Length = 37U;
+
+      std::array<T, Length> put_data;
+      std::array<T, Length> get_data;
+      std::array<char, (Length * sizeof(T)) + 1U> storage;
+
+      for (size_t i = 0U; i < Length; ++i)
+      {
+        uint64_t value = (0x0123456789ABCDEFULL * (i + 1U)) ^ (uint64_t(i) << 56U);
+        memcpy(&put_data[i], &value, sizeof(T));
+        get_data[i] = T(0);
+      }
+
+      etl::byte_stream_writer writer(storage.data(), storage.size(), endianness);
+      CHECK(writer.write(etl::span<T>(put_data.data(), put_data.size())));
+      CHECK(writer.write(uint8_t(0x5A)));  // Write an extra value.
+      CHECK(writer.full());
+
+      // Check the bytes against the single value writes.
+      std::array<char, sizeof(T)> expected;
+
+      for (size_t i = 0U; i < Length; ++i)
+      {
+        etl::byte_stream_writer single(expected.data(), expected.size(), endianness);
+        single.write(put_data[i]);
+
+        for (size_t j = 0U; j < sizeof(T); ++j)
+        {
+          CHECK_EQUAL(int(expected[j]), int(storage[(i * sizeof(T)) + j]));
+        }
+      }
+
+      etl::byte_stream_reader reader(storage.data(), storage.size(), endianness);
+
+      etl::optional<etl::span<const T> > result = reader.read<T>(etl::span<T>(get_data.data(), get_data.size()));
+      CHECK(result.has_value());
+      CHECK_EQUAL(Length, result.value().size());
+
+      for (size_t i = 0U; i < Length; ++i)
+      {
+        CHECK(memcmp(&put_data[i], &get_data[i], sizeof(T)) == 0);
+      }
+
+      etl::optional<uint8_t> extra = reader.read<uint8_t>();  // Read back the extra value to ensure that the current index is correct.
+      CHECK_EQUAL(0x5A, extra.value());
+    }
+
+    //*************************************************************************
+    TEST(write_read_block_all_types_and_endianness)
+    {
+      check_write_read_block<int8_t>(etl::endian::big);
+      check_write_read_block<int8_t>(etl::endian::little);
+      check_write_read_block<uint16_t>(etl::endian::big);
+      check_write_read_block<uint16_t>(etl::endian::little);
+      check_write_read_block<int32_t>(etl::endian::big);
+      check_write_read_block<int32_t>(etl::endian::little);
+      check_write_read_block<uint64_t>(etl::endian::big);
+      check_write_read_block<uint64_t>(etl::endian::little);
+      check_write_read_block<float>(etl::endian::big);
+      check_write_read_block<float>(etl::endian::little);
+      check_write_read_block<double>(etl::endian::big);
+      check_write_read_block<double>(etl::endian::little);
+    }
+
+    //*************************************************************************
+    TEST(read_block_bool)
+    {
+      std::array<char, 4> storage = { char(0), char(1), char(2), char(0xFF) };
+      std::array<bool, 4> get_data = { true, false, false, false };
+
+      etl::byte_stream_reader reader(storage.data(), storage.size(), etl::endian::big);
+
+      etl::optional<etl::span<const bool> > result = reader.read<bool>(get_data.data(), get_data.size());
+      CHECK(result.has_value());
+      CHECK_FALSE(get_data[0]);
+      CHECK_TRUE(get_data[1]);
+      CHECK_TRUE(get_data[2]);
+      CHECK_TRUE(get_data[3]);
+      CHECK_TRUE(reader.empty());
+    }
+
+    //*************************************************************************
+    TEST(write_block_callback)
+    {
+      std::array<char, 4 * sizeof(int32_t)> storage;
+      std::array<int32_t, 4> put_data = { int32_t(0x00000001), int32_t(0xA55AA55A), int32_t(0x5AA55AA5), int32_t(0xFFFFFFFF) };
+
+      size_t calls  = 0U;
+      size_t length = 0U;
+
+      auto lambda = [&](etl::byte_stream_writer::callback_parameter_type sp)
+        {
+          ++calls;
+          length += sp.size();
+        };
+
+      etl::byte_stream_writer::callback_type callback(lambda);
+
+      etl::byte_stream_writer writer(storage.data(), storage.size(), etl::endian::big, callback);
+      CHECK(writer.write(put_data.data(), put_data.size()));
+
+      CHECK_EQUAL(1U, calls);
+      CHECK_EQUAL(storage.size(), length);
+    }
+
+    //*************************************************************************
+    TEST(write_reserve_and_commit)
+    {
+      std::array<char, 8> storage;
+      storage.fill(0);
+
+      size_t calls = 0U;
+
+      auto lambda = [&](etl::byte_stream_writer::callback_parameter_type)
+        {
+          ++calls;
+        };
+
+      etl::byte_stream_writer::callback_type callback(lambda);
+
+      etl::byte_stream_writer writer(storage.data(), storage.size(), etl::endian::big, callback);
+      CHECK(writer.write(uint8_t(0x11)));
+      calls = 0U;
+
+      // Reserve a header, fill it directly and commit it.
+      etl::span<char> header = writer.reserve(4U);
+      CHECK_EQUAL(4U, header.size());
+      CHECK(header.data() == storage.data() + 1U);
+      CHECK_EQUAL(1U, writer.size_bytes());
+      CHECK_EQUAL(0U, calls);
+
+      header[0] = char(0x12);
+      header[1] = char(0x34);
+      header[2] = char(0x56);
+      header[3] = char(0x78);
+
+      CHECK(writer.commit(header.size()));
+      CHECK_EQUAL(5U, writer.size_bytes());
+      CHECK_EQUAL(1U, calls);
+
+      // Too large.
+      CHECK_EQUAL(0U, writer.reserve(4U).size());
+      CHECK_FALSE(writer.commit(4U));
+      CHECK_EQUAL(5U, writer.size_bytes());
+
+      CHECK_EQUAL(3U, writer.reserve(3U).size());
+      CHECK(writer.commit(3U));
+      CHECK(writer.full());
+
+      etl::byte_stream_reader reader(storage.data(), storage.size(), etl::endian::big);
+      CHECK_EQUAL(0x11U,       reader.read<uint8_t>().value());
+      CHECK_EQUAL(0x12345678U, reader.read<uint32_t>().value());
+    }
   };
 }
 
@@ -316,6 +316,252 @@ namespace
       uint64_t crc3 = etl::crc64_ecma_t4(data3.rbegin(), data3.rend());
       CHECK_EQUAL(crc1, crc3);
     }
+
+    //*************************************************************************
+    // Table size 2048, slice by 8
+    //*************************************************************************
+    TEST(test_crc64_ecma_2048)
+    {
+      std::string data("123456789");
+
+      uint64_t crc = etl::crc64_ecma_t2048(data.begin(), data.end());
+
+      CHECK_EQUAL(0x6C40DF5F0B497347ULL, crc);
+    }
+
+#if ETL_USING_CPP14
+    //*************************************************************************
+    TEST(test_crc64_ecma_2048_constexpr)
+    {
+      constexpr char data[] = "123456789";
+      constexpr uint64_t crc = etl::crc64_ecma_t2048(data, data + 9);
+
+      CHECK_EQUAL(0x6C40DF5F0B497347ULL, crc);
+    }
+#endif
+
+    //*************************************************************************
+    TEST(test_crc64_ecma_2048_add_values)
+    {
+      std::string data("123456789");
+
+      etl::crc64_ecma_t2048 crc_calculator;
+
+      for (size_t i = 0UL; i < data.size(); ++i)
+      {
+        crc_calculator.add(data[i]);
+      }
+
+      uint64_t crc = crc_calculator;
+
+      CHECK_EQUAL(0x6C40DF5F0B497347ULL, crc);
+    }
+
+    //*************************************************************************
+    TEST(test_crc64_ecma_2048_add_range)
+    {
+      std::string data("123456789");
+
+      etl::crc64_ecma_t2048 crc_calculator;
+
+      crc_calculator.add(data.begin(), data.end());
+
+      uint64_t crc = crc_calculator.value();
+
+      CHECK_EQUAL(0x6C40DF5F0B497347ULL, crc);
+    }
+
+    //*************************************************************************
+    TEST(test_crc64_ecma_2048_add_range_via_iterator)
+    {
+      std::string data("123456789");
+
+      etl::crc64_ecma_t2048 crc_calculator;
+
+      std::copy(data.begin(), data.end(), crc_calculator.input());
+
+      uint64_t crc = crc_calculator.value();
+
+      CHECK_EQUAL(0x6C40DF5F0B497347ULL, crc);
+    }
+
+    //*************************************************************************
+    TEST(test_crc64_ecma_2048_add_range_endian)
+    {
+      std::vector<uint8_t>  data1 = { 0x01U, 0x02U, 0x03U, 0x04U, 0x05U, 0x06U, 0x07U, 0x08U };
+      std::vector<uint32_t> data2;
+      if (etl::endianness::value() == etl::endian::little)
+      {
+        data2 = { 0x04030201UL, 0x08070605UL };
+      }
+      else
+      {
+        data2 = { 0x01020304UL, 0x05060708UL };
+      }
+      std::vector<uint8_t>  data3 = { 0x08U, 0x07U, 0x06U, 0x05U, 0x04U, 0x03U, 0x02U, 0x01U };
+
+      uint64_t crc1 = etl::crc64_ecma_t2048(data1.begin(), data1.end());
+      uint64_t crc2 = etl::crc64_ecma_t2048((uint8_t*)&data2[0], (uint8_t*)(&data2[0] + data2.size()));
+      CHECK_EQUAL(crc1, crc2);
+
+      uint64_t crc3 = etl::crc64_ecma_t2048(data3.rbegin(), data3.rend());
+      CHECK_EQUAL(crc1, crc3);
+    }
+
+    //*************************************************************************
+    TEST(test_crc64_ecma_2048_matches_256)
+    {
+      std::vector<uint8_t> data(1000U);
+
+      for (size_t i = 0UL; i < data.size(); ++i)
+      {
+        data[i] = uint8_t((i * 37U) ^ (i >> 3U));
+      }
+
+      for (size_t length = 0UL; length < data.size(); length += 13U)
+      {
+        uint64_t crc1 = etl::crc64_ecma_t256(data.begin(), data.begin() + length);
+        uint64_t crc2 = etl::crc64_ecma_t2048(data.begin(), data.begin() + length);
+        uint64_t crc3 = etl::crc64_ecma_t2048(data.data(), data.data() + length);
+
+        CHECK_EQUAL(crc1, crc2);
+        CHECK_EQUAL(crc1, crc3);
+      }
+
+      // Blocks following a single value.
+      etl::crc64_ecma_t256 crc_calculator1;
+      etl::crc64_ecma_t2048 crc_calculator2;
+
+      crc_calculator1.add(data[0]);
+      crc_calculator1.add(data.begin() + 1, data.end());
+      crc_calculator2.add(data[0]);
+      crc_calculator2.add(data.begin() + 1, data.end());
+
+      CHECK_EQUAL(crc_calculator1.value(), crc_calculator2.value());
+    }
+
+    //*************************************************************************
+    // Table size 4096, slice by 16
+    //*************************************************************************
+    TEST(test_crc64_ecma_4096)
+    {
+      std::string data("123456789");
+
+      uint64_t crc = etl::crc64_ecma_t4096(data.begin(), data.end());
+
+      CHECK_EQUAL(0x6C40DF5F0B497347ULL, crc);
+    }
+
+#if ETL_USING_CPP14
+    //*************************************************************************
+    TEST(test_crc64_ecma_4096_constexpr)
+    {
+      constexpr char data[] = "123456789";
+      constexpr uint64_t crc = etl::crc64_ecma_t4096(data, data + 9);
+
+      CHECK_EQUAL(0x6C40DF5F0B497347ULL, crc);
+    }
+#endif
+
+    //*************************************************************************
+    TEST(test_crc64_ecma_4096_add_values)
+    {
+      std::string data("123456789");
+
+      etl::crc64_ecma_t4096 crc_calculator;
+
+      for (size_t i = 0UL; i < data.size(); ++i)
+      {
+        crc_calculator.add(data[i]);
+      }
+
+      uint64_t crc = crc_calculator;
+
+      CHECK_EQUAL(0x6C40DF5F0B497347ULL, crc);
+    }
+
+    //*************************************************************************
+    TEST(test_crc64_ecma_4096_add_range)
+    {
+      std::string data("123456789");
+
+      etl::crc64_ecma_t4096 crc_calculator;
+
+      crc_calculator.add(data.begin(), data.end());
+
+      uint64_t crc = crc_calculator.value();
+
+      CHECK_EQUAL(0x6C40DF5F0B497347ULL, crc);
+    }
+
+    //*************************************************************************
+    TEST(test_crc64_ecma_4096_add_range_via_iterator)
+    {
+      std::string data("123456789");
+
+      etl::crc64_ecma_t4096 crc_calculator;
+
+      std::copy(data.begin(), data.end(), crc_calculator.input());
+
+      uint64_t crc = crc_calculator.value();
+
+      CHECK_EQUAL(0x6C40DF5F0B497347ULL, crc);
+    }
+
+    //*************************************************************************
+    TEST(test_crc64_ecma_4096_add_range_endian)
+    {
+      std::vector<uint8_t>  data1 = { 0x01U, 0x02U, 0x03U, 0x04U, 0x05U, 0x06U, 0x07U, 0x08U };
+      std::vector<uint32_t> data2;
+      if (etl::endianness::value() == etl::endian::little)
+      {
+        data2 = { 0x04030201UL, 0x08070605UL };
+      }
+      else
+      {
+        data2 = { 0x01020304UL, 0x05060708UL };
+      }
+      std::vector<uint8_t>  data3 = { 0x08U, 0x07U, 0x06U, 0x05U, 0x04U, 0x03U, 0x02U, 0x01U };
+
+      uint64_t crc1 = etl::crc64_ecma_t4096(data1.begin(), data1.end());
+      uint64_t crc2 = etl::crc64_ecma_t4096((uint8_t*)&data2[0], (uint8_t*)(&data2[0] + data2.size()));
+      CHECK_EQUAL(crc1, crc2);
+
+      uint64_t crc3 = etl::crc64_ecma_t4096(data3.rbegin(), data3.rend());
+      CHECK_EQUAL(crc1, crc3);
+    }
+
+    //*************************************************************************
+    TEST(test_crc64_ecma_4096_matches_256)
+    {
+      std::vector<uint8_t> data(1000U);
+
+      for (size_t i = 0UL; i < data.size(); ++i)
+      {
+        data[i] = uint8_t((i * 37U) ^ (i >> 3U));
+      }
+
+      for (size_t length = 0UL; length < data.size(); length += 13U)
+      {
+        uint64_t crc1 = etl::crc64_ecma_t256(data.begin(), data.begin() + length);
+        uint64_t crc2 = etl::crc64_ecma_t4096(data.begin(), data.begin() + length);
+        uint64_t crc3 = etl::crc64_ecma_t4096(data.data(), data.data() + length);
+
+        CHECK_EQUAL(crc1, crc2);
+        CHECK_EQUAL(crc1, crc3);
+      }
+
+      // Blocks following a single value.
+      etl::crc64_ecma_t256 crc_calculator1;
+      etl::crc64_ecma_t4096 crc_calculator2;
+
+      crc_calculator1.add(data[0]);
+      crc_calculator1.add(data.begin() + 1, data.end());
+      crc_calculator2.add(data[0]);
+      crc_calculator2.add(data.begin() + 1, data.end());
+
+      CHECK_EQUAL(crc_calculator1.value(), crc_calculator2.value());
+    }
   };
 }
 
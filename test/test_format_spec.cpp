@@ -55,6 +55,7 @@ namespace
       CHECK_EQUAL(true,  format.is_right());
       CHECK_EQUAL(false, format.is_show_base());
       CHECK_EQUAL(false, format.is_upper_case());
+      CHECK_EQUAL(false, format.is_shortest());
     }
 
     //*************************************************************************
@@ -78,7 +79,7 @@ namespace
     {
       etl::format_spec format;
 
-      format.base(16).boolalpha(true).fill('?').left().precision(6).show_base(true).upper_case(true).width(10);
+      format.base(16).boolalpha(true).fill('?').left().precision(6).show_base(true).upper_case(true).width(10).shortest(true);
 
       CHECK_EQUAL(16,    format.get_base());
       CHECK_EQUAL('?',   format.get_fill());
@@ -89,6 +90,8 @@ namespace
       CHECK_EQUAL(false, format.is_right());
       CHECK_EQUAL(true,  format.is_show_base());
       CHECK_EQUAL(true,  format.is_upper_case());
+      CHECK_EQUAL(true,  format.is_shortest());
+      CHECK(format != etl::format_spec(format).shortest(false));
     }
 
     //*************************************************************************
@@ -255,6 +255,30 @@ namespace
     }
   };
 
+  //***************************************************************************
+  // Router that counts the calls to 'accepts'.
+  //***************************************************************************
+  class RouterCounted : public RouterB
+  {
+  public:
+
+    RouterCounted(etl::message_router_id_t id)
+      : RouterB(id),
+        accepts_count(0)
+    {
+    }
+
+    using RouterB::accepts;
+
+    bool accepts(etl::message_id_t id) const ETL_OVERRIDE
+    {
+      ++accepts_count;
+      return RouterB::accepts(id);
+    }
+
+    mutable int accepts_count;
+  };
+
   //***************************************************************************
   template <size_t Size>
   class MessageBus : public etl::message_bus<Size>
@@ -1007,5 +1031,240 @@ namespace
       CHECK_TRUE(bus1.accepts(MESSAGE6));
       CHECK_FALSE(bus1.accepts(MESSAGE7));
     }
+
+    //*************************************************************************
+    TEST(message_bus_unindexed_footprint)
+    {
+      // An unindexed bus holds only its router list. The base holds a null index pointer.
+      CHECK_EQUAL(sizeof(etl::imessage_bus) + sizeof(etl::vector<etl::imessage_router*, 4>), sizeof(etl::message_bus<4>));
+      CHECK(sizeof(etl::message_bus<4>) < sizeof(etl::message_bus<4, 1>));
+    }
+
+    //*************************************************************************
+    TEST(message_bus_indexed_broadcast)
+    {
+      etl::message_bus<4, 8> bus1;
+      etl::message_bus<4>    bus2;
+
+      RouterCounted router1(ROUTER1);
+      RouterCounted router2(ROUTER2);
+      RouterA callback(ROUTER3);
+
+      bus1.subscribe(router1);
+      bus2.subscribe(router2);
+
+      CHECK_EQUAL(8U, bus1.indexed_message_ids());
+      CHECK_EQUAL(0U, bus2.indexed_message_ids());
+
+      router1.accepts_count = 0;
+      router2.accepts_count = 0;
+
+      Message1 message1(callback);
+      Message3 message3(callback);
+      Message6 message6;
+
+      bus1.receive(message1);
+      bus1.receive(message3);
+      bus1.receive(message6);
+      bus2.receive(message1);
+      bus2.receive(message3);
+      bus2.receive(message6);
+
+      // The indexed bus does not ask the router.
+      CHECK_EQUAL(0, router1.accepts_count);
+      CHECK_EQUAL(3, router2.accepts_count);
+
+      CHECK_EQUAL(1, router1.message1_count);
+      CHECK_EQUAL(0, router1.message_unknown_count);
+      CHECK_EQUAL(1, router2.message1_count);
+      CHECK_EQUAL(0, router2.message_unknown_count);
+      CHECK_EQUAL(2, callback.message5_count);
+
+      CHECK_TRUE(bus1.accepts(MESSAGE1));
+      CHECK_FALSE(bus1.accepts(MESSAGE3));
+      CHECK_EQUAL(0, router1.accepts_count);
+
+      // Unsubscribing rebuilds the index.
+      bus1.unsubscribe(router1);
+      router1.accepts_count = 0;
+
+      bus1.receive(message1);
+      CHECK_EQUAL(1, router1.message1_count);
+      CHECK_FALSE(bus1.accepts(MESSAGE1));
+    }
+
+    //*************************************************************************
+    TEST(message_bus_indexed_broadcast_order)
+    {
+      etl::message_bus<4, 8> bus1;
+      etl::message_bus<2, 8> bus2;
+      etl::message_bus<2>    bus3;
+
+      RouterA router1(ROUTER1);
+      RouterA router2(ROUTER2);
+      RouterA router3(ROUTER3);
+      RouterA router4a(ROUTER4);
+      RouterA router4b(ROUTER4);
+
+      RouterA callback(ROUTER5);
+
+      bus1.subscribe(router1);
+      bus1.subscribe(bus3);
+      bus1.subscribe(bus2);
+      bus1.subscribe(router2);
+
+      // Subscribe to the sub-buses after they have been subscribed to bus1.
+      bus2.subscribe(router3);
+      bus3.subscribe(router4b);
+      bus3.subscribe(router4a);
+
+      Message1 message1(callback);
+
+      call_order = 0;
+
+      bus1.receive(message1);
+
+      CHECK_EQUAL(0, router1.order);
+      CHECK_EQUAL(1, router2.order);
+      CHECK_EQUAL(2, router4b.order);
+      CHECK_EQUAL(3, router4a.order);
+      CHECK_EQUAL(4, router3.order);
+    }
+
+    //*************************************************************************
+    TEST(message_bus_indexed_sub_bus_accepts)
+    {
+      etl::message_bus<2, 8> bus1;
+      etl::message_bus<2, 8> bus2;
+
+      RouterA router1(ROUTER1);
+      RouterC router2(ROUTER2);
+
+      bus1.subscribe(router1);
+      bus1.subscribe(bus2);
+
+      CHECK_FALSE(bus1.accepts(MESSAGE6));
+
+      bus2.subscribe(router2);
+
+      CHECK_TRUE(bus1.accepts(MESSAGE1));
+      CHECK_TRUE(bus1.accepts(MESSAGE6));
+      CHECK_FALSE(bus1.accepts(MESSAGE7));
+    }
+
+    //*************************************************************************
+    TEST(message_bus_indexed_id_out_of_range)
+    {
+      etl::message_bus<2, 2> bus;
+
+      RouterCounted router(ROUTER1);
+      RouterA callback(ROUTER2);
+
+      bus.subscribe(router);
+      router.accepts_count = 0;
+
+      Message1 message1(callback);
+      Message4 message4(callback);
+
+      bus.receive(message1);
+      bus.receive(message4);
+
+      // Message4's id is not indexed.
+      CHECK_EQUAL(1, router.accepts_count);
+      CHECK_EQUAL(1, router.message1_count);
+      CHECK_EQUAL(1, router.message4_count);
+    }
+
+    //*************************************************************************
+    TEST(message_bus_indexed_rebuild_index)
+    {
+      etl::message_bus<2, 8> bus;
+
+      RouterB router1(ROUTER1);
+      RouterC router2(ROUTER2);
+
+      bus.subscribe(router1);
+
+      CHECK_FALSE(bus.accepts(MESSAGE6));
+
+      // Router1 now passes on message 6.
+      router1.set_successor(router2);
+      CHECK_FALSE(bus.accepts(MESSAGE6));
+
+      bus.rebuild_index();
+      CHECK_TRUE(bus.accepts(MESSAGE6));
+    }
+
+    //*************************************************************************
+    TEST(message_bus_indexed_many_routers)
+    {
+      etl::message_bus<40, 8> bus;
+
+      RouterCounted* routers[40];
+      RouterA callback(ROUTER1);
+
+      for (size_t i = 0U; i < 40U; ++i)
+      {
+        routers[i] = new RouterCounted(etl::message_router_id_t(i));
+        bus.subscribe(*routers[i]);
+      }
+
+      for (size_t i = 0U; i < 40U; ++i)
+      {
+        routers[i]->accepts_count = 0;
+      }
+
+      Message2 message2(callback);
+      bus.receive(message2);
+
+      for (size_t i = 0U; i < 40U; ++i)
+      {
+        CHECK_EQUAL(1, routers[i]->message2_count);
+        CHECK_EQUAL(0, routers[i]->accepts_count);
+        delete routers[i];
+      }
+
+      CHECK_EQUAL(40, callback.message5_count);
+    }
+
+    //*************************************************************************
+    TEST(message_bus_batch_broadcast)
+    {
+      etl::message_bus<2, 8> bus1;
+      MessageBus<2> bus2;
+
+      RouterA router1(ROUTER1);
+      RouterB router2(ROUTER2);
+      RouterC router3(ROUTER3);
+      RouterA callback(ROUTER4);
+
+      bus1.subscribe(router1);
+      bus1.subscribe(router2);
+      bus1.set_successor(bus2);
+      bus2.subscribe(router3);
+
+      Message1 message1(callback);
+      Message3 message3(callback);
+      Message6 message6;
+      Message7 message7;
+
+      const etl::imessage* messages[] = { &message1, &message3, &message6, &message7, &message1 };
+
+      bus1.receive(etl::span<const etl::imessage* const>(messages));
+
+      CHECK_EQUAL(2, router1.message1_count);
+      CHECK_EQUAL(1, router1.message3_count);
+      CHECK_EQUAL(0, router1.message_unknown_count);
+      CHECK_EQUAL(2, router2.message1_count);
+      CHECK_EQUAL(0, router2.message_unknown_count);
+      CHECK_EQUAL(5, callback.message5_count);
+
+      // Only message 6 is passed to the successor.
+      CHECK_EQUAL(1, bus2.message_count);
+
+      // Non-indexed bus.
+      bus2.receive(etl::span<const etl::imessage* const>(messages));
+      CHECK_EQUAL(1, bus2.message_count);
+    }
   };
 }
@@ -119,6 +119,22 @@ namespace
 
   Message5 message5;
 
+  //***********************************
+  // Messages with sparse ids.
+  //***********************************
+  template <etl::message_id_t Id>
+  struct SparseMessage : public etl::message<Id>
+  {
+  };
+
+  typedef SparseMessage<10>  Sparse10;
+  typedef SparseMessage<47>  Sparse47;
+  typedef SparseMessage<93>  Sparse93;
+  typedef SparseMessage<200> Sparse200;
+  typedef SparseMessage<9>   Sparse9;
+  typedef SparseMessage<11>  Sparse11;
+  typedef SparseMessage<201> Sparse201;
+
   //***************************************************************************
   // Router that handles messages 1, 2, 3, 4 and 5 and returns nothing.
   //***************************************************************************
@@ -253,6 +269,38 @@ namespace
     int sender_id;
   };
 
+  //***************************************************************************
+  // Router that handles messages with sparse ids.
+  //***************************************************************************
+  class SparseRouter : public etl::message_router<SparseRouter, Sparse200, Sparse10, Sparse93, Sparse47>
+  {
+  public:
+
+    SparseRouter()
+      : message_router(ROUTER1),
+        last_id(0),
+        message_count(0),
+        message_unknown_count(0)
+    {
+    }
+
+    template <etl::message_id_t Id>
+    void on_receive(const SparseMessage<Id>& msg)
+    {
+      last_id = msg.get_message_id();
+      ++message_count;
+    }
+
+    void on_receive_unknown(const etl::imessage&)
+    {
+      ++message_unknown_count;
+    }
+
+    etl::message_id_t last_id;
+    int message_count;
+    int message_unknown_count;
+  };
+
   //***************************************************************************
   // Router that handles messages 1, 2, 3.
   // 'receive' is overridden.
@@ -545,6 +593,46 @@ namespace
       CHECK(r2.accepts(message5.get_message_id()));
     }
 
+    //*************************************************************************
+    TEST(message_router_sparse_ids)
+    {
+      SparseRouter router;
+
+      Sparse10  message10;
+      Sparse47  message47;
+      Sparse93  message93;
+      Sparse200 message200;
+      Sparse9   message9;
+      Sparse11  message11;
+      Sparse201 message201;
+
+      const etl::imessage* known[]   = { &message10, &message47, &message93, &message200 };
+      const etl::imessage* unknown[] = { &message9, &message11, &message201 };
+
+      for (size_t i = 0U; i < ETL_ARRAY_SIZE(known); ++i)
+      {
+        router.receive(*known[i]);
+        CHECK_EQUAL(known[i]->get_message_id(), router.last_id);
+        CHECK_EQUAL(int(i + 1U), router.message_count);
+        CHECK(router.accepts(known[i]->get_message_id()));
+      }
+
+      for (size_t i = 0U; i < ETL_ARRAY_SIZE(unknown); ++i)
+      {
+        router.receive(*unknown[i]);
+        CHECK_EQUAL(int(i + 1U), router.message_unknown_count);
+        CHECK(!router.accepts(unknown[i]->get_message_id()));
+      }
+
+      CHECK_EQUAL(4, router.message_count);
+
+      for (int id = 0; id < 256; ++id)
+      {
+        const bool expected = (id == 10) || (id == 47) || (id == 93) || (id == 200);
+        CHECK_EQUAL(expected, router.accepts(etl::message_id_t(id)));
+      }
+    }
+
     //*************************************************************************
     TEST(message_router_accepts_successors)
     {
@@ -0,0 +1,327 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/monotonic_arena.h"
+#include "etl/vector.h"
+#include "etl/circular_buffer.h"
+#include "etl/pool.h"
+#include "etl/list.h"
+#include "etl/string.h"
+
+#include <stdint.h>
+
+namespace
+{
+  //***********************************
+  struct Counted
+  {
+    Counted(int a_, int b_)
+      : a(a_)
+      , b(b_)
+    {
+      ++instances;
+    }
+
+    ~Counted()
+    {
+      --instances;
+    }
+
+    int a;
+    int b;
+
+    static int instances;
+  };
+
+  int Counted::instances = 0;
+
+  bool is_aligned(const void* p, size_t alignment)
+  {
+    return (uintptr_t(p) % alignment) == 0U;
+  }
+
+  SUITE(test_monotonic_arena)
+  {
+    //*************************************************************************
+    TEST(test_default_state)
+    {
+      etl::monotonic_arena<256> arena;
+
+      CHECK_EQUAL(256U, arena.capacity());
+      CHECK_EQUAL(256U, arena.max_size());
+      CHECK_EQUAL(256U, arena.available());
+      CHECK_EQUAL(0U,   arena.size());
+      CHECK_EQUAL(0U,   arena.peak_size());
+      CHECK(arena.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_allocate_bytes_alignment)
+    {
+      etl::monotonic_arena<256, 16> arena;
+
+      void* p1 = arena.allocate(1U, 1U);
+      void* p2 = arena.allocate(8U, 8U);
+      void* p3 = arena.allocate(3U, 1U);
+      void* p4 = arena.allocate(16U, 16U);
+
+      CHECK(is_aligned(p1, 16U));
+      CHECK(is_aligned(p2, 8U));
+      CHECK(is_aligned(p4, 16U));
+
+      CHECK_EQUAL(static_cast<char*>(p1) + 8,  static_cast<char*>(p2));
+      CHECK_EQUAL(static_cast<char*>(p2) + 8,  static_cast<char*>(p3));
+      CHECK_EQUAL(static_cast<char*>(p1) + 32, static_cast<char*>(p4));
+      CHECK_EQUAL(48U, arena.size());
+      CHECK(arena.is_in_arena(p4));
+    }
+
+    //*************************************************************************
+    TEST(test_allocate_typed)
+    {
+      etl::monotonic_arena<256> arena;
+
+      char*     pc = arena.allocate<char>(3U);
+      uint32_t* pu = arena.allocate<uint32_t>(4U);
+      double*   pd = arena.allocate<double>();
+
+      CHECK(pc != ETL_NULLPTR);
+      CHECK(is_aligned(pu, etl::alignment_of<uint32_t>::value));
+      CHECK(is_aligned(pd, etl::alignment_of<double>::value));
+      CHECK(arena.is_in_arena(pd + 0));
+      CHECK(arena.size() >= (3U + (4U * sizeof(uint32_t)) + sizeof(double)));
+    }
+
+    //*************************************************************************
+    TEST(test_allocate_full)
+    {
+      etl::monotonic_arena<64> arena;
+
+      CHECK(arena.allocate(64U, 1U) != ETL_NULLPTR);
+      CHECK_EQUAL(0U, arena.available());
+
+      CHECK_THROW(arena.allocate(1U, 1U), etl::monotonic_arena_full);
+      CHECK_EQUAL(64U, arena.size());
+
+      arena.reset();
+
+      // Overflowing element counts and padding must not wrap.
+      CHECK_THROW(arena.allocate<uint32_t>(~size_t(0) / 2U), etl::monotonic_arena_full);
+      CHECK(arena.allocate(63U, 1U) != ETL_NULLPTR);
+      CHECK_THROW(arena.allocate(1U, 8U), etl::monotonic_arena_full);
+      CHECK_EQUAL(63U, arena.size());
+    }
+
+    //*************************************************************************
+    TEST(test_allocate_invalid_alignment)
+    {
+      etl::monotonic_arena<64> arena;
+
+      CHECK_THROW(arena.allocate(1U, 0U), etl::monotonic_arena_invalid_alignment);
+      CHECK_THROW(arena.allocate(1U, 3U), etl::monotonic_arena_invalid_alignment);
+      CHECK_THROW(arena.allocate(1U, 12U), etl::monotonic_arena_invalid_alignment);
+      CHECK_EQUAL(0U, arena.size());
+
+      CHECK(arena.allocate(1U, 1U) != ETL_NULLPTR);
+      CHECK(arena.allocate(1U, 16U) != ETL_NULLPTR);
+    }
+
+    //*************************************************************************
+    TEST(test_create_destroy)
+    {
+      etl::monotonic_arena<256> arena;
+
+      Counted::instances = 0;
+
+      Counted* p = arena.create<Counted>(1, 2);
+
+      CHECK_EQUAL(1, Counted::instances);
+      CHECK_EQUAL(1, p->a);
+      CHECK_EQUAL(2, p->b);
+      CHECK(arena.is_in_arena(p));
+
+      arena.destroy(p);
+      CHECK_EQUAL(0, Counted::instances);
+      CHECK_EQUAL(sizeof(Counted), arena.size());
+    }
+
+    //*************************************************************************
+    TEST(test_checkpoint_rewind)
+    {
+      etl::monotonic_arena<256> arena;
+
+      arena.allocate<int>(4U);
+      etl::imonotonic_arena::checkpoint_type mark = arena.checkpoint();
+      size_t used = arena.size();
+
+      void* p1 = arena.allocate<int>(8U);
+      arena.allocate<int>(8U);
+      CHECK_EQUAL(used + (16U * sizeof(int)), arena.size());
+
+      arena.rewind(mark);
+      CHECK_EQUAL(used, arena.size());
+      CHECK_EQUAL(used + (16U * sizeof(int)), arena.peak_size());
+
+      // The same memory is handed out again.
+      CHECK_EQUAL(p1, static_cast<void*>(arena.allocate<int>(8U)));
+
+      arena.reset();
+      CHECK(arena.empty());
+
+      // Cannot rewind forwards.
+      CHECK_THROW(arena.rewind(mark), etl::monotonic_arena_invalid_checkpoint);
+      CHECK(arena.empty());
+
+      arena.reset_peak_size();
+      CHECK_EQUAL(0U, arena.peak_size());
+    }
+
+    //*************************************************************************
+    TEST(test_scope)
+    {
+      etl::monotonic_arena<256> arena;
+
+      arena.allocate<char>(10U);
+
+      {
+        etl::imonotonic_arena::scope outer(arena);
+        arena.allocate<char>(20U);
+
+        {
+          etl::imonotonic_arena::scope inner(arena);
+          arena.allocate<char>(30U);
+          CHECK_EQUAL(60U, arena.size());
+        }
+
+        CHECK_EQUAL(30U, arena.size());
+      }
+
+      CHECK_EQUAL(10U, arena.size());
+      CHECK_EQUAL(60U, arena.peak_size());
+    }
+
+    //*************************************************************************
+    TEST(test_ext)
+    {
+      char buffer[100];
+
+      etl::monotonic_arena_ext arena(buffer, sizeof(buffer));
+
+      CHECK_EQUAL(100U, arena.capacity());
+
+      char* p = arena.allocate<char>(100U);
+      CHECK_EQUAL(&buffer[0], p);
+      CHECK_THROW(arena.allocate<char>(), etl::monotonic_arena_full);
+    }
+
+    //*************************************************************************
+    TEST(test_create_vector_and_circular_buffer_ext)
+    {
+      etl::monotonic_arena<1024> arena;
+
+      etl::vector_ext<int>* pv = arena.create_vector_ext<int>(10U);
+      CHECK(pv != ETL_NULLPTR);
+      CHECK_EQUAL(10U, pv->max_size());
+
+      for (int i = 0; i < 10; ++i)
+      {
+        pv->push_back(i);
+      }
+
+      CHECK(pv->full());
+      CHECK(arena.is_in_arena(&pv->front()));
+      CHECK_EQUAL(9, pv->back());
+
+      etl::circular_buffer_ext<int>* pc = arena.create_circular_buffer_ext<int>(4U);
+      CHECK(pc != ETL_NULLPTR);
+      CHECK_EQUAL(4U, pc->max_size());
+
+      for (int i = 0; i < 6; ++i)
+      {
+        pc->push(i);
+      }
+
+      CHECK_EQUAL(4U, pc->size());
+      CHECK_EQUAL(2, pc->front());
+      CHECK(arena.is_in_arena(&pc->front()));
+
+      // Everything, containers included, is released at once.
+      arena.destroy(pc);
+      arena.destroy(pv);
+      arena.reset();
+      CHECK(arena.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_create_pool_list_string_ext)
+    {
+      etl::monotonic_arena<2048> arena;
+
+      etl::pool_ext<Counted>* pp = arena.create_pool_ext<Counted>(3U);
+      CHECK(pp != ETL_NULLPTR);
+      CHECK_EQUAL(3U, pp->max_size());
+
+      Counted* pc = pp->create(3, 4);
+      CHECK(arena.is_in_arena(pc));
+      pp->destroy(pc);
+
+      etl::list_ext<int>* pl = arena.create_list_ext<int>(5U);
+      CHECK(pl != ETL_NULLPTR);
+      CHECK_EQUAL(5U, pl->max_size());
+
+      for (int i = 0; i < 5; ++i)
+      {
+        pl->push_back(i);
+      }
+
+      CHECK(pl->full());
+      CHECK(arena.is_in_arena(&pl->front()));
+
+      etl::string_ext* ps = arena.create_string_ext<etl::string_ext>(8U);
+      CHECK(ps != ETL_NULLPTR);
+      CHECK_EQUAL(8U, ps->max_size());
+      ps->assign("abcdefghij");
+      CHECK_EQUAL(std::string("abcdefgh"), std::string(ps->c_str()));
+      CHECK(arena.is_in_arena(ps->data()));
+
+      arena.destroy(ps);
+      arena.destroy(pl);
+      arena.destroy(pp);
+    }
+
+    //*************************************************************************
+    TEST(test_create_ext_full)
+    {
+      etl::monotonic_arena<64> arena;
+
+      CHECK_THROW(arena.create_vector_ext<int>(100U), etl::monotonic_arena_full);
+    }
+  }
+}
@@ -33,6 +33,7 @@ SOFTWARE.
 #include <iterator>
 #include <string>
 #include <vector>
+#include <list>
 #include <type_traits>
 #include <stdint.h>
 #include <string.h>
@@ -135,6 +136,57 @@ namespace
       MurmurHash3_x86_32((uint8_t*)&data2[0], data2.size() * sizeof(uint32_t), 0, &compare2);
       CHECK_EQUAL(compare2, hash2);
     }
+
+    //*************************************************************************
+    TEST(test_murmur3_32_add_range_blocks)
+    {
+      std::vector<uint8_t> data(100U);
+
+      for (size_t i = 0UL; i < data.size(); ++i)
+      {
+        data[i] = uint8_t(i * 37U);
+      }
+
+      for (size_t offset = 0UL; offset < 4UL; ++offset)
+      {
+        for (size_t length = 0UL; length <= (data.size() - offset); ++length)
+        {
+          const uint8_t* begin = data.data() + offset;
+          const uint8_t* split = begin + (length / 3U);
+
+          etl::murmur3<uint32_t> murmur3_32_calculator;
+          murmur3_32_calculator.add(begin, split);
+          murmur3_32_calculator.add(split, begin + length);
+
+          uint32_t hash = murmur3_32_calculator;
+
+          // The reference implementation reads blocks as uint32_t, so give it an aligned copy.
+          uint32_t aligned[25];
+          memcpy(aligned, begin, length);
+
+          uint32_t compare;
+          MurmurHash3_x86_32(aligned, int(length), 0, &compare);
+
+          CHECK_EQUAL(compare, hash);
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_murmur3_32_signed_char_range)
+    {
+      std::string data("\x80\x81\xFE\xFF\x7F\x00\x01\x02\x90", 9U);
+
+      std::list<char> data_list(data.begin(), data.end());
+
+      uint32_t hash1 = etl::murmur3<uint32_t>(data.begin(), data.end());
+      uint32_t hash2 = etl::murmur3<uint32_t>(data_list.begin(), data_list.end());
+
+      uint32_t compare;
+      MurmurHash3_x86_32(data.data(), int(data.size()), 0, &compare);
+
+      CHECK_EQUAL(compare, hash1);
+      CHECK_EQUAL(compare, hash2);
+    }
   };
 }
-
@@ -0,0 +1,375 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include <thread>
+#include <atomic>
+#include <vector>
+#include <set>
+#include <string>
+
+#include "etl/pool_atomic.h"
+#include "etl/largest.h"
+
+#if ETL_HAS_ATOMIC
+
+#define REALTIME_TEST 0
+
+namespace
+{
+  struct S
+  {
+    S()
+      : a(7), b(8)
+    {
+      ++instance_count;
+    }
+
+    S(int a_, double b_)
+      : a(a_), b(b_)
+    {
+      ++instance_count;
+    }
+
+    ~S()
+    {
+      --instance_count;
+    }
+
+    int    a;
+    double b;
+
+    static int instance_count;
+  };
+
+  int S::instance_count = 0;
+
+  struct D4
+  {
+    D4(const std::string& a_, const std::string& b_, const std::string& c_, const std::string& d_)
+      : a(a_), b(b_), c(c_), d(d_)
+    {
+    }
+
+    std::string a;
+    std::string b;
+    std::string c;
+    std::string d;
+  };
+
+  SUITE(test_pool_atomic)
+  {
+    //*************************************************************************
+    TEST(test_constructor)
+    {
+      etl::pool_atomic<S, 4> pool;
+
+      CHECK_EQUAL(4U, pool.max_size());
+      CHECK_EQUAL(4U, pool.capacity());
+      CHECK_EQUAL(4U, pool.available());
+      CHECK_EQUAL(0U, pool.size());
+      CHECK(pool.empty());
+      CHECK(!pool.full());
+      CHECK(pool.max_item_size() >= sizeof(S));
+    }
+
+    //*************************************************************************
+    TEST(test_allocate_release)
+    {
+      etl::pool_atomic<S, 4> pool;
+
+      std::set<S*> allocated;
+
+      for (size_t i = 0U; i < 4U; ++i)
+      {
+        S* p = pool.allocate();
+        CHECK(p != nullptr);
+        CHECK(pool.is_in_pool(p));
+        allocated.insert(p);
+        CHECK_EQUAL(i + 1U, pool.size());
+      }
+
+      // All distinct.
+      CHECK_EQUAL(4U, allocated.size());
+      CHECK(pool.full());
+      CHECK_THROW(pool.allocate(), etl::pool_no_allocation);
+
+      for (std::set<S*>::iterator itr = allocated.begin(); itr != allocated.end(); ++itr)
+      {
+        pool.release(*itr);
+      }
+
+      CHECK(pool.empty());
+      CHECK_EQUAL(4U, pool.available());
+
+      // The released items are reused.
+      S* p = pool.allocate();
+      CHECK(allocated.find(p) != allocated.end());
+    }
+
+    //*************************************************************************
+    TEST(test_create_destroy)
+    {
+      S::instance_count = 0;
+
+      etl::pool_atomic<S, 4> pool;
+
+      S* p1 = pool.create();
+      S* p2 = pool.create(1, 2.5);
+
+      CHECK_EQUAL(2, S::instance_count);
+      CHECK_EQUAL(7, p1->a);
+      CHECK_EQUAL(1, p2->a);
+      CHECK_EQUAL(2.5, p2->b);
+
+      pool.destroy(p1);
+      pool.destroy(p2);
+
+      CHECK_EQUAL(0, S::instance_count);
+      CHECK(pool.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_create_four_parameters)
+    {
+      etl::pool_atomic<D4, 2> pool;
+
+      D4* p = pool.create(std::string("1"), std::string("2"), std::string("3"), std::string("4"));
+
+      CHECK_EQUAL(std::string("1"), p->a);
+      CHECK_EQUAL(std::string("2"), p->b);
+      CHECK_EQUAL(std::string("3"), p->c);
+      CHECK_EQUAL(std::string("4"), p->d);
+
+      pool.destroy(p);
+      CHECK(pool.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_generic_pool_atomic)
+    {
+      typedef etl::largest<uint8_t, uint32_t, double, S> largest;
+
+      etl::generic_pool_atomic<largest::size, largest::alignment, 4> pool;
+
+      uint8_t*  p1 = pool.allocate<uint8_t>();
+      double*   p2 = pool.create<double>(1.5);
+      S*        p3 = pool.create<S>(3, 4.5);
+
+      CHECK_EQUAL(3U, pool.size());
+      CHECK_EQUAL(1.5, *p2);
+      CHECK_EQUAL(3, p3->a);
+      CHECK((uintptr_t(p2) % etl::alignment_of<double>::value) == 0U);
+
+      pool.release(p1);
+      pool.destroy(p2);
+      pool.destroy(p3);
+
+      CHECK(pool.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_release_not_in_pool)
+    {
+      etl::pool_atomic<S, 4> pool;
+      etl::pool_atomic<S, 4> other;
+
+      S* p = other.allocate();
+
+      CHECK(!pool.is_in_pool(p));
+      CHECK_THROW(pool.release(p), etl::pool_object_not_in_pool);
+    }
+
+    //*************************************************************************
+    TEST(test_release_all)
+    {
+      etl::pool_atomic<S, 4> pool;
+
+      pool.allocate();
+      pool.allocate();
+      pool.allocate();
+      pool.allocate();
+      CHECK(pool.full());
+
+      pool.release_all();
+
+      CHECK(pool.empty());
+
+      for (size_t i = 0U; i < 4U; ++i)
+      {
+        CHECK(pool.allocate() != nullptr);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_ipool_atomic_interface)
+    {
+      etl::pool_atomic<S, 4> pool;
+
+      etl::ipool_atomic& ipool = pool;
+
+      S* p = ipool.create<S>(5, 6.5);
+
+      CHECK_EQUAL(1U, ipool.size());
+      CHECK_EQUAL(5, p->a);
+
+      ipool.destroy(p);
+
+      CHECK(ipool.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_multiple_threads_bounded)
+    {
+      const int Threads    = 4;
+      const int Iterations = 20000;
+      const int Pool_Size  = 2 * Threads;
+
+      // Each thread holds two items at once, so the pool is often empty and
+      // the same items are popped and pushed again by different threads.
+      etl::pool_atomic<int, Pool_Size> pool;
+
+      std::atomic<bool> overlap(false);
+
+      std::vector<std::thread> threads;
+
+      for (int t = 0; t < Threads; ++t)
+      {
+        threads.emplace_back([&pool, &overlap, t]()
+        {
+          for (int i = 0; i < Iterations; ++i)
+          {
+            int* p1 = pool.allocate();
+            int* p2 = pool.allocate();
+
+            // Each item may only be held by one thread at a time.
+            *p1 = t;
+            *p2 = -t;
+            std::this_thread::yield();
+
+            if ((p1 == p2) || (*p1 != t) || (*p2 != -t))
+            {
+              overlap = true;
+            }
+
+            // Release in a different order to the allocation on every other pass.
+            if ((i % 2) == 0)
+            {
+              pool.release(p1);
+              pool.release(p2);
+            }
+            else
+            {
+              pool.release(p2);
+              pool.release(p1);
+            }
+          }
+        });
+      }
+
+      for (auto& thread : threads)
+      {
+        thread.join();
+      }
+
+      CHECK(!overlap.load());
+      CHECK(pool.empty());
+
+      // Every item is still in the free list exactly once.
+      std::set<int*> items;
+
+      for (int i = 0; i < Pool_Size; ++i)
+      {
+        items.insert(pool.allocate());
+      }
+
+      CHECK_EQUAL(size_t(Pool_Size), items.size());
+      CHECK(pool.full());
+    }
+
+    //*************************************************************************
+#if REALTIME_TEST
+    TEST(test_multiple_threads)
+    {
+      const int Threads    = 8;
+      const int Iterations = 100000;
+      const int Pool_Size  = 16;
+
+      etl::pool_atomic<int, Pool_Size> pool;
+
+      std::atomic<bool> overlap(false);
+
+      std::vector<std::thread> threads;
+
+      for (int t = 0; t < Threads; ++t)
+      {
+        threads.emplace_back([&pool, &overlap, t]()
+        {
+          for (int i = 0; i < Iterations; ++i)
+          {
+            int* p = pool.allocate();
+
+            // Each item may only be held by one thread at a time.
+            *p = t;
+            std::this_thread::yield();
+
+            if (*p != t)
+            {
+              overlap = true;
+            }
+
+            pool.release(p);
+          }
+        });
+      }
+
+      for (auto& thread : threads)
+      {
+        thread.join();
+      }
+
+      CHECK(!overlap.load());
+      CHECK(pool.empty());
+
+      // Every item is still in the free list exactly once.
+      std::set<int*> items;
+
+      for (int i = 0; i < Pool_Size; ++i)
+      {
+        items.insert(pool.allocate());
+      }
+
+      CHECK_EQUAL(size_t(Pool_Size), items.size());
+      CHECK(pool.full());
+    }
+#endif
+  };
+}
+
+#endif
@@ -0,0 +1,541 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include <thread>
+#include <atomic>
+#include <vector>
+
+#include "etl/queue_mpmc_atomic.h"
+
+#include "data.h"
+
+#if ETL_HAS_ATOMIC
+
+#define REALTIME_TEST 0
+
+namespace
+{
+  struct Data
+  {
+    Data(int a_, int b_ = 2, int c_ = 3, int d_ = 4)
+      : a(a_),
+      b(b_),
+      c(c_),
+      d(d_)
+    {
+    }
+
+    Data()
+      : a(0),
+      b(0),
+      c(0),
+      d(0)
+    {
+    }
+
+    int a;
+    int b;
+    int c;
+    int d;
+  };
+
+  bool operator ==(const Data& lhs, const Data& rhs)
+  {
+    return (lhs.a == rhs.a) && (lhs.b == rhs.b) && (lhs.c == rhs.c) && (lhs.d == rhs.d);
+  }
+
+  using ItemM = TestDataM<int>;
+
+  SUITE(test_queue_mpmc_atomic)
+  {
+    //*************************************************************************
+    TEST(test_constructor)
+    {
+      etl::queue_mpmc_atomic<int, 4> queue;
+
+      CHECK_EQUAL(4U, queue.max_size());
+      CHECK_EQUAL(4U, queue.capacity());
+    }
+
+    //*************************************************************************
+    TEST(test_size_push_pop)
+    {
+      etl::queue_mpmc_atomic<int, 4> queue;
+
+      CHECK_EQUAL(0U, queue.size());
+
+      CHECK_EQUAL(4U, queue.available());
+      CHECK_EQUAL(0U, queue.size());
+
+      queue.push(1);
+      CHECK_EQUAL(1U, queue.size());
+      CHECK_EQUAL(3U, queue.available());
+
+      queue.push(2);
+      CHECK_EQUAL(2U, queue.size());
+      CHECK_EQUAL(2U, queue.available());
+
+      queue.push(3);
+      CHECK_EQUAL(3U, queue.size());
+      CHECK_EQUAL(1U, queue.available());
+
+      queue.push(4);
+      CHECK_EQUAL(4U, queue.size());
+      CHECK_EQUAL(0U, queue.available());
+
+      // Queue full.
+      CHECK(!queue.push(5));
+
+      queue.pop();
+      // Queue not full (buffer rollover)
+      CHECK(queue.push(5));
+
+      // Queue full.
+      CHECK(!queue.push(6));
+
+      queue.pop();
+      // Queue not full (buffer rollover)
+      CHECK(queue.push(6));
+
+      int i;
+
+      CHECK(queue.pop(i));
+      CHECK_EQUAL(3, i);
+      CHECK_EQUAL(3U, queue.size());
+
+      CHECK(queue.pop(i));
+      CHECK_EQUAL(4, i);
+      CHECK_EQUAL(2U, queue.size());
+
+      CHECK(queue.pop(i));
+      CHECK_EQUAL(5, i);
+      CHECK_EQUAL(1U, queue.size());
+
+      CHECK(queue.pop(i));
+      CHECK_EQUAL(6, i);
+      CHECK_EQUAL(0U, queue.size());
+
+      CHECK(!queue.pop(i));
+      CHECK(!queue.pop(i));
+    }
+
+#if !defined(ETL_FORCE_TEST_CPP03_IMPLEMENTATION)
+    //*************************************************************************
+    TEST(test_move_push_pop)
+    {
+      etl::queue_mpmc_atomic<ItemM, 4, etl::memory_model::MEMORY_MODEL_SMALL> queue;
+
+      ItemM p1(1);
+      ItemM p2(2);
+      ItemM p3(3);
+      ItemM p4(4);
+
+      queue.push(std::move(p1));
+      queue.push(std::move(p2));
+      queue.push(std::move(p3));
+      queue.push(std::move(p4));
+
+      CHECK(!bool(p1));
+      CHECK(!bool(p2));
+      CHECK(!bool(p3));
+      CHECK(!bool(p4));
+
+      ItemM pr(0);
+
+      queue.pop(pr);
+      CHECK_EQUAL(1, pr.value);
+
+      queue.pop(pr);
+      CHECK_EQUAL(2, pr.value);
+
+      queue.pop(pr);
+      CHECK_EQUAL(3, pr.value);
+
+      queue.pop(pr);
+      CHECK_EQUAL(4, pr.value);
+    }
+#endif
+
+    //*************************************************************************
+    TEST(test_size_push_pop_iqueue)
+    {
+      etl::queue_mpmc_atomic<int, 4> queue;
+
+      etl::iqueue_mpmc_atomic<int>& iqueue = queue;
+
+      CHECK_EQUAL(0U, iqueue.size());
+
+      iqueue.push(1);
+      CHECK_EQUAL(1U, iqueue.size());
+
+      iqueue.push(2);
+      CHECK_EQUAL(2U, iqueue.size());
+
+      iqueue.push(3);
+      CHECK_EQUAL(3U, iqueue.size());
+
+      iqueue.push(4);
+      CHECK_EQUAL(4U, iqueue.size());
+
+      CHECK(!iqueue.push(5));
+      CHECK(!iqueue.push(5));
+
+      int i;
+
+      CHECK(iqueue.pop(i));
+      CHECK_EQUAL(1, i);
+      CHECK_EQUAL(3U, iqueue.size());
+
+      CHECK(iqueue.pop(i));
+      CHECK_EQUAL(2, i);
+      CHECK_EQUAL(2U, iqueue.size());
+
+      CHECK(iqueue.pop(i));
+      CHECK_EQUAL(3, i);
+      CHECK_EQUAL(1U, iqueue.size());
+
+      CHECK(iqueue.pop(i));
+      CHECK_EQUAL(4, i);
+      CHECK_EQUAL(0U, iqueue.size());
+
+      CHECK(!iqueue.pop(i));
+      CHECK(!iqueue.pop(i));
+    }
+
+    //*************************************************************************
+    TEST(test_size_push_front_pop)
+    {
+      etl::queue_mpmc_atomic<int, 4> queue;
+
+      CHECK_EQUAL(0U, queue.size());
+
+      int i = 0;
+      CHECK(!queue.front(i));
+
+      queue.push(1);
+      queue.push(2);
+      queue.push(3);
+      queue.push(4);
+      CHECK_EQUAL(4U, queue.size());
+
+      CHECK_EQUAL(1, queue.front());
+      CHECK_EQUAL(4U, queue.size());
+
+      CHECK(queue.front(i));
+      CHECK_EQUAL(1, i);
+      CHECK_EQUAL(4U, queue.size());
+
+      CHECK(queue.pop());
+      CHECK(queue.pop());
+      CHECK(queue.pop());
+      CHECK_EQUAL(1U, queue.size());
+
+      CHECK_EQUAL(4, queue.front());
+      CHECK_EQUAL(1U, queue.size());
+
+      CHECK(queue.pop());
+      CHECK_EQUAL(0U, queue.size());
+      CHECK(!queue.front(i));
+    }
+
+    //*************************************************************************
+    TEST(test_multiple_emplace)
+    {
+      etl::queue_mpmc_atomic<Data, 8> queue;
+
+      queue.emplace();
+      queue.emplace(1);
+      queue.emplace(1, 2);
+      queue.emplace(1, 2, 3);
+      queue.emplace(1, 2, 3, 4);
+
+      CHECK_EQUAL(5U, queue.size());
+
+      Data popped;
+
+      queue.pop(popped);
+      CHECK(popped == Data(0, 0, 0, 0));
+      queue.pop(popped);
+      CHECK(popped == Data(1, 2, 3, 4));
+      queue.pop(popped);
+      CHECK(popped == Data(1, 2, 3, 4));
+      queue.pop(popped);
+      CHECK(popped == Data(1, 2, 3, 4));
+      queue.pop(popped);
+      CHECK(popped == Data(1, 2, 3, 4));
+    }
+
+    //*************************************************************************
+    TEST(test_clear)
+    {
+      etl::queue_mpmc_atomic<int, 4> queue;
+
+      CHECK_EQUAL(0U, queue.size());
+
+      queue.push(1);
+      queue.push(2);
+      queue.clear();
+      CHECK_EQUAL(0U, queue.size());
+
+      // Do it again to check that clear() didn't screw up the internals.
+      queue.push(1);
+      queue.push(2);
+      CHECK_EQUAL(2U, queue.size());
+      queue.clear();
+      CHECK_EQUAL(0U, queue.size());
+    }
+
+    //*************************************************************************
+    TEST(test_empty_full)
+    {
+      etl::queue_mpmc_atomic<int, 4> queue;
+      CHECK(queue.empty());
+      CHECK(!queue.full());
+
+      queue.push(1);
+      CHECK(!queue.empty());
+      CHECK(!queue.full());
+
+      queue.push(2);
+      queue.push(3);
+      queue.push(4);
+      CHECK(!queue.empty());
+      CHECK(queue.full());
+
+      queue.clear();
+      CHECK(queue.empty());
+      CHECK(!queue.full());
+    }
+
+    //*************************************************************************
+    TEST(test_counter_wrap_around)
+    {
+      // The 8 bit counters wrap many times.
+      etl::queue_mpmc_atomic<int, 64, etl::memory_model::MEMORY_MODEL_SMALL> queue;
+
+      int next_push = 0;
+      int next_pop  = 0;
+
+      for (int lap = 0; lap < 100; ++lap)
+      {
+        while (queue.push(next_push))
+        {
+          ++next_push;
+        }
+
+        CHECK(queue.full());
+        CHECK_EQUAL(64U, queue.size());
+
+        for (int i = 0; i < 37; ++i)
+        {
+          int value;
+          CHECK(queue.pop(value));
+          CHECK_EQUAL(next_pop, value);
+          ++next_pop;
+        }
+      }
+
+      int value;
+
+      while (queue.pop(value))
+      {
+        CHECK_EQUAL(next_pop, value);
+        ++next_pop;
+      }
+
+      CHECK_EQUAL(next_push, next_pop);
+      CHECK(queue.empty());
+    }
+
+    //*************************************************************************
+    // A short run that is always built, with a small queue and 8 bit
+    // counters, so that producers and consumers keep meeting at full and
+    // empty and the counters wrap.
+    TEST(test_multiple_producers_multiple_consumers_bounded)
+    {
+      const int Producers    = 2;
+      const int Consumers    = 2;
+      const int Per_Producer = 5000;
+
+      etl::queue_mpmc_atomic<int, 8, etl::memory_model::MEMORY_MODEL_SMALL> queue;
+
+      std::vector<std::atomic<int>> seen(Producers * Per_Producer);
+      std::atomic<int> popped(0);
+      std::atomic<int> out_of_order(0);
+
+      for (auto& s : seen)
+      {
+        s = 0;
+      }
+
+      std::vector<std::thread> threads;
+
+      for (int p = 0; p < Producers; ++p)
+      {
+        threads.emplace_back([&queue, p]()
+        {
+          for (int i = 0; i < Per_Producer; ++i)
+          {
+            while (!queue.push((p * Per_Producer) + i))
+            {
+              std::this_thread::yield();
+            }
+          }
+        });
+      }
+
+      for (int c = 0; c < Consumers; ++c)
+      {
+        threads.emplace_back([&queue, &seen, &popped, &out_of_order]()
+        {
+          // Each consumer must see the values from a producer in order.
+          int last[Producers] = { -1, -1 };
+
+          while (popped.load() < (Producers * Per_Producer))
+          {
+            int value;
+
+            if (queue.pop(value))
+            {
+              const int producer = value / Per_Producer;
+
+              if (value <= last[producer])
+              {
+                ++out_of_order;
+              }
+
+              last[producer] = value;
+              ++seen[value];
+              ++popped;
+            }
+            else
+            {
+              std::this_thread::yield();
+            }
+          }
+        });
+      }
+
+      for (auto& t : threads)
+      {
+        t.join();
+      }
+
+      CHECK_EQUAL(Producers * Per_Producer, popped.load());
+      CHECK_EQUAL(0, out_of_order.load());
+      CHECK(queue.empty());
+
+      bool all_seen_once = true;
+
+      for (auto& s : seen)
+      {
+        all_seen_once = all_seen_once && (s.load() == 1);
+      }
+
+      CHECK(all_seen_once);
+    }
+
+    //*************************************************************************
+#if REALTIME_TEST
+    TEST(test_multiple_producers_multiple_consumers)
+    {
+      const int Producers    = 4;
+      const int Consumers    = 4;
+      const int Per_Producer = 20000;
+
+      etl::queue_mpmc_atomic<int, 64> queue;
+
+      std::vector<std::atomic<int>> seen(Producers * Per_Producer);
+      std::atomic<int> popped(0);
+
+      for (auto& s : seen)
+      {
+        s = 0;
+      }
+
+      std::vector<std::thread> threads;
+
+      for (int p = 0; p < Producers; ++p)
+      {
+        threads.emplace_back([&queue, p]()
+        {
+          for (int i = 0; i < Per_Producer; ++i)
+          {
+            while (!queue.push((p * Per_Producer) + i))
+            {
+              std::this_thread::yield();
+            }
+          }
+        });
+      }
+
+      for (int c = 0; c < Consumers; ++c)
+      {
+        threads.emplace_back([&queue, &seen, &popped]()
+        {
+          while (popped.load() < (Producers * Per_Producer))
+          {
+            int value;
+
+            if (queue.pop(value))
+            {
+              ++seen[value];
+              ++popped;
+            }
+            else
+            {
+              std::this_thread::yield();
+            }
+          }
+        });
+      }
+
+      for (auto& t : threads)
+      {
+        t.join();
+      }
+
+      CHECK_EQUAL(Producers * Per_Producer, popped.load());
+      CHECK(queue.empty());
+
+      bool all_seen_once = true;
+
+      for (auto& s : seen)
+      {
+        all_seen_once = all_seen_once && (s.load() == 1);
+      }
+
+      CHECK(all_seen_once);
+    }
+#endif
+  };
+}
+
+#endif
@@ -394,6 +394,96 @@ namespace
       CHECK(queue.full());
     }
 
+    //*************************************************************************
+    TEST(test_push_pop_span)
+    {
+      etl::queue_spsc_atomic<int, 5> queue;
+
+      int input[]  = { 1, 2, 3, 4, 5, 6 };
+      int output[] = { 0, 0, 0, 0, 0, 0 };
+
+      // Move the indexes part way round the buffer.
+      queue.push(0);
+      queue.push(0);
+      queue.pop();
+      queue.pop();
+
+      // Wraps around the end of the buffer.
+      CHECK_EQUAL(5U, queue.push(etl::span<const int>(input, 6)));
+      CHECK(queue.full());
+      CHECK_EQUAL(0U, queue.push(etl::span<const int>(input, 1)));
+
+      CHECK_EQUAL(3U, queue.pop(etl::span<int>(output, 3)));
+      CHECK_EQUAL(2U, queue.size());
+      CHECK_EQUAL(2U, queue.pop(etl::span<int>(output + 3, 3)));
+      CHECK(queue.empty());
+      CHECK_EQUAL(0U, queue.pop(etl::span<int>(output, 6)));
+
+      CHECK_ARRAY_EQUAL(input, output, 5);
+    }
+
+    //*************************************************************************
+    TEST(test_write_reserve_commit_read_peek_release)
+    {
+      etl::queue_spsc_atomic<int, 5> queue;
+
+      // Move the indexes part way round the buffer.
+      queue.push(0);
+      queue.push(0);
+      queue.push(0);
+      queue.pop();
+      queue.pop();
+      queue.pop();
+
+      // The contiguous area ends at the end of the buffer.
+      etl::span<int> reserved = queue.write_reserve();
+      CHECK_EQUAL(3U, reserved.size());
+      reserved[0] = 1;
+      reserved[1] = 2;
+      queue.write_commit(2U);
+      CHECK_EQUAL(2U, queue.size());
+
+      reserved = queue.write_reserve(10U);
+      CHECK_EQUAL(1U, reserved.size());
+      reserved[0] = 3;
+      queue.write_commit(1U);
+
+      // Wrapped to the start of the buffer.
+      reserved = queue.write_reserve(1U);
+      CHECK_EQUAL(1U, reserved.size());
+      reserved[0] = 4;
+      queue.write_commit(1U);
+      CHECK_EQUAL(4U, queue.size());
+
+      etl::span<int> peeked = queue.read_peek();
+      CHECK_EQUAL(3U, peeked.size());
+      CHECK_EQUAL(1, peeked[0]);
+      CHECK_EQUAL(2, peeked[1]);
+      CHECK_EQUAL(3, peeked[2]);
+      queue.read_release(3U);
+
+      peeked = queue.read_peek();
+      CHECK_EQUAL(1U, peeked.size());
+      CHECK_EQUAL(4, peeked[0]);
+      queue.read_release(1U);
+
+      CHECK(queue.empty());
+      CHECK_EQUAL(0U, queue.read_peek().size());
+    }
+
+    //*************************************************************************
+    TEST(test_write_commit_read_release_too_large)
+    {
+      etl::queue_spsc_atomic<int, 4> queue;
+
+      CHECK_THROW(queue.write_commit(5U), etl::queue_spsc_atomic_reserve_invalid);
+      CHECK(queue.empty());
+
+      queue.push(1);
+      CHECK_THROW(queue.read_release(2U), etl::queue_spsc_atomic_reserve_invalid);
+      CHECK_EQUAL(1U, queue.size());
+    }
+
     //*************************************************************************
 #if REALTIME_TEST && defined(ETL_COMPILER_MICROSOFT)
     #if defined(ETL_TARGET_OS_WINDOWS) // Only Windows priority is currently supported
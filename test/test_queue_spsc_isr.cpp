@@ -624,6 +624,106 @@ namespace
       CHECK(!Access::called_unlock);
     }
 
+    //*************************************************************************
+    TEST(test_push_pop_span)
+    {
+      etl::queue_spsc_isr<int, 4, Access> queue;
+
+      int input[]  = { 1, 2, 3, 4, 5 };
+      int output[] = { 0, 0, 0, 0, 0 };
+
+      // Move the indexes part way round the buffer.
+      queue.push(0);
+      queue.push(0);
+      queue.pop();
+      queue.pop();
+
+      Access::clear();
+
+      // Wraps around the end of the buffer.
+      CHECK_EQUAL(4U, queue.push(etl::span<const int>(input, 5)));
+      CHECK(Access::called_lock);
+      CHECK(Access::called_unlock);
+      CHECK(queue.full());
+
+      Access::clear();
+
+      CHECK_EQUAL(3U, queue.pop_from_isr(etl::span<int>(output, 3)));
+      CHECK(!Access::called_lock);
+      CHECK(!Access::called_unlock);
+      CHECK_EQUAL(1U, queue.pop(etl::span<int>(output + 3, 2)));
+      CHECK(queue.empty());
+
+      CHECK_ARRAY_EQUAL(input, output, 4);
+
+      CHECK_EQUAL(2U, queue.push_from_isr(etl::span<const int>(input, 2)));
+      CHECK_EQUAL(2U, queue.size());
+    }
+
+    //*************************************************************************
+    TEST(test_write_reserve_commit_read_peek_release)
+    {
+      etl::queue_spsc_isr<int, 4, Access> queue;
+
+      // Move the indexes part way round the buffer.
+      queue.push(0);
+      queue.push(0);
+      queue.push(0);
+      queue.pop();
+      queue.pop();
+      queue.pop();
+
+      Access::clear();
+
+      // The contiguous area ends at the end of the buffer.
+      etl::span<int> reserved = queue.write_reserve();
+      CHECK(Access::called_lock);
+      CHECK(Access::called_unlock);
+      CHECK_EQUAL(1U, reserved.size());
+      reserved[0] = 1;
+      queue.write_commit(1U);
+
+      // Wrapped to the start of the buffer.
+      reserved = queue.write_reserve_from_isr();
+      CHECK_EQUAL(3U, reserved.size());
+      reserved[0] = 2;
+      reserved[1] = 3;
+      reserved[2] = 4;
+      queue.write_commit_from_isr(3U);
+      CHECK(queue.full());
+      CHECK_EQUAL(0U, queue.write_reserve().size());
+
+      etl::span<int> peeked = queue.read_peek();
+      CHECK_EQUAL(1U, peeked.size());
+      CHECK_EQUAL(1, peeked[0]);
+      queue.read_release(1U);
+
+      peeked = queue.read_peek_from_isr(2U);
+      CHECK_EQUAL(2U, peeked.size());
+      CHECK_EQUAL(2, peeked[0]);
+      CHECK_EQUAL(3, peeked[1]);
+      queue.read_release_from_isr(2U);
+
+      CHECK_EQUAL(1U, queue.size());
+      CHECK_EQUAL(4, queue.front());
+    }
+
+    //*************************************************************************
+    TEST(test_write_commit_read_release_too_large)
+    {
+      etl::queue_spsc_isr<int, 4, Access> queue;
+
+      Access::clear();
+
+      CHECK_THROW(queue.write_commit(5U), etl::queue_spsc_isr_reserve_invalid);
+      CHECK(Access::called_unlock);
+      CHECK(queue.empty());
+
+      queue.push(1);
+      CHECK_THROW(queue.read_release(2U), etl::queue_spsc_isr_reserve_invalid);
+      CHECK_EQUAL(1U, queue.size());
+    }
+
     //*************************************************************************
 #if REALTIME_TEST
   #if defined(ETL_TARGET_OS_WINDOWS) // Only Windows priority is currently supported
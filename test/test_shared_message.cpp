@@ -35,6 +35,14 @@ SOFTWARE.
 #include "etl/queue.h"
 #include "etl/fixed_sized_memory_block_allocator.h"
 #include "etl/reference_counted_message_pool.h"
+#include "etl/queue_spsc_atomic.h"
+
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#define REALTIME_TEST 0
 
 namespace
 {
@@ -383,5 +391,284 @@ namespace
 
       CHECK_THROW(message_pool.release(temp), etl::reference_counted_message_pool_release_failure);
     }
+
+    //*************************************************************************
+    TEST(test_message_pool_cache_allocate_release)
+    {
+      etl::fixed_sized_memory_block_allocator<pool_message_parameters::max_size,
+                                              pool_message_parameters::max_alignment,
+                                              4U> memory_allocator;
+
+      etl::atomic_counted_message_pool message_pool(memory_allocator);
+
+      using cache_t = etl::atomic_counted_message_pool_cache<pool_message_parameters::max_size,
+                                                             pool_message_parameters::max_alignment,
+                                                             2U>;
+
+      {
+        cache_t cache(message_pool);
+
+        etl::reference_counted_message<Message1, etl::atomic_int>* prcm1 = cache.allocate<Message1>(1);
+        CHECK_EQUAL(1, prcm1->get_message().i);
+
+        // The cache has taken a batch of two from the pool.
+        etl::reference_counted_message<Message1, etl::atomic_int>* prcm2 = message_pool.allocate<Message1>(2);
+        etl::reference_counted_message<Message1, etl::atomic_int>* prcm3 = message_pool.allocate<Message1>(3);
+        CHECK_THROW(message_pool.allocate<Message1>(4), etl::reference_counted_message_pool_allocation_failure);
+
+        // The second block of the batch.
+        etl::reference_counted_message<Message2, etl::atomic_int>* prcm4 = cache.allocate<Message2>();
+        CHECK_THROW(cache.allocate<Message1>(5), etl::reference_counted_message_pool_allocation_failure);
+
+        // Released blocks are reused by the cache.
+        prcm1->release();
+        etl::reference_counted_message<Message1, etl::atomic_int>* prcm5 = cache.allocate<Message1>(Message1(5));
+        CHECK(static_cast<void*>(prcm5) == static_cast<void*>(prcm1));
+
+        prcm4->release();
+        prcm5->release();
+        message_pool.release(*prcm2);
+        message_pool.release(*prcm3);
+
+        // flush returns the cached blocks to the pool.
+        cache.flush();
+        prcm1 = message_pool.allocate<Message1>(1);
+        prcm2 = message_pool.allocate<Message1>(2);
+        prcm3 = message_pool.allocate<Message1>(3);
+        etl::reference_counted_message<Message1, etl::atomic_int>* prcm6 = message_pool.allocate<Message1>(6);
+
+        message_pool.release(*prcm1);
+        message_pool.release(*prcm2);
+        message_pool.release(*prcm3);
+        message_pool.release(*prcm6);
+
+        // Leave a released block in the cache for the destructor.
+        cache.allocate<Message2>()->release();
+      }
+
+      // The destructor returns the cached blocks to the pool.
+      for (int i = 0; i < 4; ++i)
+      {
+        CHECK_NO_THROW(message_pool.allocate<Message1>(i));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_message_pool_cache_returns_a_burst_of_releases)
+    {
+      etl::fixed_sized_memory_block_allocator<pool_message_parameters::max_size,
+                                              pool_message_parameters::max_alignment,
+                                              8U> memory_allocator;
+
+      etl::atomic_counted_message_pool message_pool(memory_allocator);
+
+      using cache_t = etl::atomic_counted_message_pool_cache<pool_message_parameters::max_size,
+                                                             pool_message_parameters::max_alignment,
+                                                             2U>;
+
+      cache_t cache1(message_pool);
+      cache_t cache2(message_pool);
+
+      std::vector<etl::ireference_counted_message*> messages;
+
+      // The first cache takes every block in the pool.
+      for (int i = 0; i < 8; ++i)
+      {
+        messages.push_back(cache1.allocate<Message1>(i));
+      }
+
+      CHECK_THROW(cache2.allocate<Message1>(8), etl::reference_counted_message_pool_allocation_failure);
+
+      for (size_t i = 0U; i < messages.size(); ++i)
+      {
+        messages[i]->release();
+      }
+
+      messages.clear();
+
+      // The first cache keeps no more than twice its batch size, so the second can allocate the rest.
+      for (int i = 0; i < 4; ++i)
+      {
+        etl::ireference_counted_message* prcm = ETL_NULLPTR;
+        CHECK_NO_THROW(prcm = cache2.allocate<Message1>(i));
+        messages.push_back(prcm);
+      }
+
+      CHECK_THROW(cache2.allocate<Message1>(4), etl::reference_counted_message_pool_allocation_failure);
+
+      // The blocks kept by the first cache are still reused by it.
+      for (int i = 0; i < 4; ++i)
+      {
+        etl::ireference_counted_message* prcm = ETL_NULLPTR;
+        CHECK_NO_THROW(prcm = cache1.allocate<Message1>(i));
+        messages.push_back(prcm);
+      }
+
+      for (size_t i = 0U; i < messages.size(); ++i)
+      {
+        messages[i]->release();
+      }
+
+      cache1.flush();
+      cache2.flush();
+
+      for (int i = 0; i < 8; ++i)
+      {
+        CHECK_NO_THROW(message_pool.allocate<Message1>(i));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_message_pool_cache_shared_message)
+    {
+      bus.clear();
+      bus.subscribe(router1);
+      bus.subscribe(router2);
+      router1.clear();
+      router2.clear();
+
+      etl::fixed_sized_memory_block_allocator<pool_message_parameters::max_size,
+                                              pool_message_parameters::max_alignment,
+                                              4U> memory_allocator;
+
+      etl::atomic_counted_message_pool message_pool(memory_allocator);
+
+      etl::atomic_counted_message_pool_cache<pool_message_parameters::max_size,
+                                             pool_message_parameters::max_alignment> cache(message_pool);
+
+      {
+        etl::shared_message sm1 = etl::shared_message::create<Message1>(cache, 1);
+        etl::shared_message sm2(cache, Message2());
+
+        bus.receive(sm1);
+        bus.receive(sm2);
+
+        CHECK_EQUAL(1, sm1.get_reference_count());
+        CHECK_EQUAL(1, router1.count_message1);
+        CHECK_EQUAL(1, router1.count_message2);
+        CHECK_EQUAL(1, router2.count_message1);
+      }
+
+      cache.flush();
+
+      for (int i = 0; i < 4; ++i)
+      {
+        CHECK_NO_THROW(message_pool.allocate<Message1>(i));
+      }
+    }
+
+#if REALTIME_TEST
+    //*************************************************************************
+    class locked_message_pool : public etl::atomic_counted_message_pool
+    {
+    public:
+
+      locked_message_pool(etl::imemory_block_allocator& memory_block_allocator_)
+        : etl::atomic_counted_message_pool(memory_block_allocator_)
+      {
+      }
+
+    protected:
+
+      void lock() override
+      {
+        mutex.lock();
+      }
+
+      void unlock() override
+      {
+        mutex.unlock();
+      }
+
+    private:
+
+      std::mutex mutex;
+    };
+
+    //*************************************************************************
+    TEST(test_message_pool_cache_multiple_threads)
+    {
+      const int Producers    = 4;
+      const int Per_Producer = 20000;
+
+      etl::fixed_sized_memory_block_allocator<pool_message_parameters::max_size,
+                                              pool_message_parameters::max_alignment,
+                                              64U> memory_allocator;
+
+      locked_message_pool message_pool(memory_allocator);
+
+      using cache_t = etl::atomic_counted_message_pool_cache<pool_message_parameters::max_size,
+                                                             pool_message_parameters::max_alignment,
+                                                             4U>;
+
+      std::atomic<int> received(0);
+
+      std::vector<std::thread> threads;
+
+      // Each producer hands its messages to a consumer thread, which drops the last reference.
+      for (int p = 0; p < Producers; ++p)
+      {
+        threads.emplace_back([&message_pool, &received]()
+        {
+          cache_t cache(message_pool);
+
+          etl::queue_spsc_atomic<etl::ireference_counted_message*, 8> queue;
+
+          std::thread consumer([&queue, &received]()
+          {
+            int count  = 0;
+            int popped = 0;
+
+            while (popped < Per_Producer)
+            {
+              etl::ireference_counted_message* prcm;
+
+              if (queue.pop(prcm))
+              {
+                if (prcm->get_message().get_message_id() == MessageId2)
+                {
+                  ++count;
+                }
+
+                prcm->release();
+                ++popped;
+              }
+              else
+              {
+                std::this_thread::yield();
+              }
+            }
+
+            received += count;
+          });
+
+          for (int i = 0; i < Per_Producer; ++i)
+          {
+            etl::ireference_counted_message* prcm = cache.allocate<Message2>();
+
+            while (!queue.push(prcm))
+            {
+              std::this_thread::yield();
+            }
+          }
+
+          consumer.join();
+        });
+      }
+
+      for (auto& thread : threads)
+      {
+        thread.join();
+      }
+
+      CHECK_EQUAL(Producers * Per_Producer, received.load());
+
+      // Every cache has returned its blocks.
+      for (int i = 0; i < 64; ++i)
+      {
+        CHECK_NO_THROW(message_pool.allocate<Message1>(i));
+      }
+    }
+#endif
   }
-}
\ No newline at end of file
+}
@@ -0,0 +1,315 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/slab_memory_block_allocator.h"
+#include "etl/fixed_sized_memory_block_allocator.h"
+#include "etl/reference_counted_message_pool.h"
+#include "etl/message.h"
+
+#include <set>
+#include <vector>
+#include <cstdlib>
+
+namespace
+{
+  // Classes of 16, 32, 64 and 128 bytes, 4 blocks each.
+  using Allocator = etl::slab_memory_block_allocator<16U, 8U, 4U, 4U>;
+
+  //*************************************************************************
+  struct Message1 : public etl::message<1>
+  {
+    char data[10];
+  };
+
+  struct Message2 : public etl::message<2>
+  {
+    char data[64];
+  };
+
+  SUITE(test_slab_memory_block_allocator)
+  {
+    //*************************************************************************
+    TEST(test_constants)
+    {
+      CHECK_EQUAL(16U,  Allocator::Min_Block_Size);
+      CHECK_EQUAL(128U, Allocator::Max_Block_Size);
+      CHECK_EQUAL(8U,   Allocator::Alignment);
+      CHECK_EQUAL(4U,   Allocator::Number_Of_Classes);
+      CHECK_EQUAL(4U,   Allocator::Blocks_Per_Class);
+
+      Allocator allocator;
+
+      CHECK_EQUAL(4U,  allocator.number_of_classes());
+      CHECK_EQUAL(16U, allocator.max_size());
+      CHECK_EQUAL(0U,  allocator.size());
+      CHECK(allocator.empty());
+
+      CHECK_EQUAL(16U,  allocator.block_size(0));
+      CHECK_EQUAL(32U,  allocator.block_size(1));
+      CHECK_EQUAL(64U,  allocator.block_size(2));
+      CHECK_EQUAL(128U, allocator.block_size(3));
+    }
+
+    //*************************************************************************
+    TEST(test_class_index)
+    {
+      Allocator allocator;
+
+      CHECK_EQUAL(0U, allocator.class_index(0U));
+      CHECK_EQUAL(0U, allocator.class_index(1U));
+      CHECK_EQUAL(0U, allocator.class_index(16U));
+      CHECK_EQUAL(1U, allocator.class_index(17U));
+      CHECK_EQUAL(1U, allocator.class_index(32U));
+      CHECK_EQUAL(2U, allocator.class_index(33U));
+      CHECK_EQUAL(2U, allocator.class_index(64U));
+      CHECK_EQUAL(3U, allocator.class_index(65U));
+      CHECK_EQUAL(3U, allocator.class_index(128U));
+      CHECK_EQUAL(4U, allocator.class_index(129U));
+      CHECK_EQUAL(4U, allocator.class_index(100000U));
+    }
+
+    //*************************************************************************
+    TEST(test_allocate_from_size_class)
+    {
+      Allocator allocator;
+
+      void* p1 = allocator.allocate(10U,  8U);
+      void* p2 = allocator.allocate(20U,  8U);
+      void* p3 = allocator.allocate(60U,  4U);
+      void* p4 = allocator.allocate(128U, 8U);
+
+      CHECK(p1 != nullptr);
+      CHECK(p2 != nullptr);
+      CHECK(p3 != nullptr);
+      CHECK(p4 != nullptr);
+
+      CHECK_EQUAL(1U, allocator.size(0));
+      CHECK_EQUAL(1U, allocator.size(1));
+      CHECK_EQUAL(1U, allocator.size(2));
+      CHECK_EQUAL(1U, allocator.size(3));
+      CHECK_EQUAL(4U, allocator.size());
+
+      CHECK((reinterpret_cast<uintptr_t>(p1) % 8U) == 0U);
+      CHECK((reinterpret_cast<uintptr_t>(p2) % 8U) == 0U);
+      CHECK((reinterpret_cast<uintptr_t>(p3) % 8U) == 0U);
+      CHECK((reinterpret_cast<uintptr_t>(p4) % 8U) == 0U);
+
+      // Too large or too strictly aligned.
+      CHECK(allocator.allocate(129U, 8U)  == nullptr);
+      CHECK(allocator.allocate(8U,   16U) == nullptr);
+
+      CHECK(allocator.release(p1));
+      CHECK(allocator.release(p2));
+      CHECK(allocator.release(p3));
+      CHECK(allocator.release(p4));
+
+      CHECK(allocator.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_full_class_uses_next_larger_class)
+    {
+      Allocator allocator;
+
+      std::vector<void*> blocks;
+
+      // Fill every class with small requests, smallest class first.
+      for (size_t i = 0U; i < 16U; ++i)
+      {
+        blocks.push_back(allocator.allocate(8U, 8U));
+        CHECK(blocks.back() != nullptr);
+        CHECK_EQUAL((i % 4U) + 1U, allocator.size(i / 4U));
+      }
+
+      CHECK(allocator.allocate(8U, 8U) == nullptr);
+      CHECK_EQUAL(0U, allocator.available(3));
+
+      // Releasing returns the block to its own class.
+      CHECK(allocator.release(blocks[13]));
+      CHECK_EQUAL(3U, allocator.size(3));
+      CHECK(allocator.allocate(100U, 8U) == blocks[13]);
+    }
+
+    //*************************************************************************
+    TEST(test_blocks_are_distinct_and_in_range)
+    {
+      Allocator allocator;
+
+      std::set<char*> blocks;
+
+      for (size_t c = 0U; c < allocator.number_of_classes(); ++c)
+      {
+        for (size_t i = 0U; i < allocator.max_size(c); ++i)
+        {
+          char* p = static_cast<char*>(allocator.allocate(allocator.block_size(c), 8U));
+          CHECK(p != nullptr);
+          CHECK(allocator.is_owner_of(p));
+
+          // The block must not overlap any other.
+          std::set<char*>::iterator itr = blocks.lower_bound(p);
+
+          if (itr != blocks.end())
+          {
+            CHECK(p + allocator.block_size(c) <= *itr);
+          }
+
+          blocks.insert(p);
+        }
+      }
+
+      CHECK_EQUAL(16U, blocks.size());
+      CHECK_EQUAL(16U, allocator.size());
+    }
+
+    //*************************************************************************
+    TEST(test_release_not_owned)
+    {
+      Allocator allocator;
+      Allocator other;
+
+      void* p = other.allocate(8U, 8U);
+      int   i = 0;
+
+      CHECK(!allocator.is_owner_of(p));
+      CHECK(!allocator.is_owner_of(&i));
+      CHECK(!allocator.release(p));
+      CHECK(!allocator.release(&i));
+
+      // Nothing allocated in that class.
+      void* q = allocator.allocate(8U, 8U);
+      CHECK(allocator.release(q));
+      CHECK(!allocator.release(q));
+    }
+
+    //*************************************************************************
+    TEST(test_peak_size)
+    {
+      Allocator allocator;
+
+      void* p1 = allocator.allocate(40U, 8U);
+      void* p2 = allocator.allocate(40U, 8U);
+      void* p3 = allocator.allocate(40U, 8U);
+
+      allocator.release(p1);
+      allocator.release(p2);
+
+      CHECK_EQUAL(1U, allocator.size(2));
+      CHECK_EQUAL(3U, allocator.peak_size(2));
+      CHECK_EQUAL(0U, allocator.peak_size(0));
+
+      allocator.reset_peak_size();
+      CHECK_EQUAL(1U, allocator.peak_size(2));
+
+      allocator.release(p3);
+      CHECK_EQUAL(1U, allocator.peak_size(2));
+    }
+
+    //*************************************************************************
+    TEST(test_successor)
+    {
+      Allocator allocator;
+      etl::fixed_sized_memory_block_allocator<256U, 8U, 2U> large;
+
+      allocator.set_successor(large);
+
+      void* p = allocator.allocate(200U, 8U);
+
+      CHECK(p != nullptr);
+      CHECK(allocator.empty()); // Served by the successor.
+      CHECK(allocator.is_owner_of(p));
+      CHECK(allocator.release(p));
+    }
+
+    //*************************************************************************
+    TEST(test_random_allocate_release)
+    {
+      Allocator allocator;
+
+      std::vector<std::pair<char*, size_t> > blocks;
+
+      srand(1234);
+
+      for (int i = 0; i < 10000; ++i)
+      {
+        if (((rand() % 2) == 0) && !blocks.empty())
+        {
+          size_t index = size_t(rand()) % blocks.size();
+          char*  p     = blocks[index].first;
+
+          // The contents must be intact.
+          for (size_t j = 0U; j < blocks[index].second; ++j)
+          {
+            CHECK_EQUAL(char(blocks[index].second), p[j]);
+          }
+
+          CHECK(allocator.release(p));
+          blocks.erase(blocks.begin() + index);
+        }
+        else
+        {
+          size_t size = 1U + (size_t(rand()) % 128U);
+          char*  p    = static_cast<char*>(allocator.allocate(size, 8U));
+
+          if (p != nullptr)
+          {
+            for (size_t j = 0U; j < size; ++j)
+            {
+              p[j] = char(size);
+            }
+
+            blocks.push_back(std::make_pair(p, size));
+          }
+        }
+
+        CHECK_EQUAL(blocks.size(), allocator.size());
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_with_reference_counted_message_pool)
+    {
+      Allocator allocator;
+
+      etl::reference_counted_message_pool<int> pool(allocator);
+
+      etl::reference_counted_message<Message1, int>* p1 = pool.allocate<Message1>();
+      etl::reference_counted_message<Message2, int>* p2 = pool.allocate<Message2>();
+
+      CHECK_EQUAL(1U, allocator.size(allocator.class_index(sizeof(*p1))));
+      CHECK_EQUAL(1U, allocator.size(allocator.class_index(sizeof(*p2))));
+      CHECK(allocator.class_index(sizeof(*p1)) != allocator.class_index(sizeof(*p2)));
+
+      pool.release(*p1);
+      pool.release(*p2);
+
+      CHECK(allocator.empty());
+    }
+  };
+}
@@ -1538,6 +1538,37 @@ namespace
       CHECK_THROW({const uint8_t& data5 = data0.take<const uint8_t>(); (void) data5;}, etl::span_size_mismatch);
     }
 
+    //*************************************************************************
+    TEST(test_stable_sort_with_span_buffer)
+    {
+      typedef std::pair<int, int> Item;
+
+      struct Compare
+      {
+        bool operator()(const Item& lhs, const Item& rhs) const
+        {
+          return lhs.first < rhs.first;
+        }
+      };
+
+      std::vector<Item> data;
+
+      for (int i = 0; i < 100; ++i)
+      {
+        data.push_back(Item((i * 7) % 5, i));
+      }
+
+      std::vector<Item> expected(data);
+      std::stable_sort(expected.begin(), expected.end(), Compare());
+
+      Item buffer[50];
+      etl::span<Item> scratch(buffer);
+
+      etl::stable_sort(data.begin(), data.end(), scratch, Compare());
+
+      CHECK(expected == data);
+    }
+
 #include "etl/private/diagnostic_pop.h"
   };
 }
@@ -229,6 +229,86 @@ namespace
     MotorControl::state(StateId::WINDING_DOWN, &MotorControl::OnEnterWindingDown, &MotorControl::OnExitWindingDown)
   };
 
+  //***********************************
+  // A chart with duplicate, guarded and 'any state' transitions that records
+  // each action, used to compare linear and indexed searches.
+  //***********************************
+  class Recorder : public etl::state_chart<Recorder>
+  {
+  public:
+
+    Recorder()
+      : etl::state_chart<Recorder>(*this, transitionTable.begin(), transitionTable.end(), stateTable.begin(), stateTable.end(), 0)
+      , log(0U)
+      , toggle(false)
+    {
+    }
+
+    void Record(uint32_t value)
+    {
+      log = (log * 31U) + value;
+    }
+
+    void Action1() { Record(1U); }
+    void Action2() { Record(2U); }
+    void Action3() { Record(3U); }
+    void Action4() { Record(4U); }
+    void Action5() { Record(5U); }
+    void Action6() { Record(6U); }
+    void Action7() { Record(7U); }
+    void Action8() { Record(8U); }
+
+    void Enter0() { Record(100U); }
+    void Enter1() { Record(101U); }
+    void Enter2() { Record(102U); }
+    void Enter3() { Record(103U); }
+    void Exit1()  { Record(201U); }
+    void Exit3()  { Record(203U); }
+
+    bool Pass()   { return true; }
+    bool Fail()   { return false; }
+    bool Toggle() { toggle = !toggle; return toggle; }
+
+    uint32_t log;
+    bool     toggle;
+
+    static const etl::array<Recorder::transition, 18> transitionTable;
+    static const etl::array<Recorder::state, 5>       stateTable;
+  };
+
+  //***************************************************************************
+  const etl::array<Recorder::transition, 18> Recorder::transitionTable =
+  {
+    Recorder::transition(3, 1, 0, &Recorder::Action1),
+    Recorder::transition(0, 0, 1, &Recorder::Action2, &Recorder::Toggle),
+    Recorder::transition(   2, 4, &Recorder::Action3, &Recorder::Toggle),
+    Recorder::transition(0, 0, 2, &Recorder::Action4),
+    Recorder::transition(1, 1, 2, &Recorder::Action5, &Recorder::Fail),
+    Recorder::transition(1, 1, 3, &Recorder::Action6, &Recorder::Toggle),
+    Recorder::transition(   1, 0, &Recorder::Action7),
+    Recorder::transition(2, 2, 3, &Recorder::Action8),
+    Recorder::transition(1, 2, 1, &Recorder::Action1, &Recorder::Pass),
+    Recorder::transition(4, 0, 0, &Recorder::Action2),
+    Recorder::transition(   3, 3, &Recorder::Action3, &Recorder::Toggle),
+    Recorder::transition(2, 0, 0, &Recorder::Action4),
+    Recorder::transition(1, 1, 0, &Recorder::Action5),
+    Recorder::transition(3, 3, 1, &Recorder::Action6),
+    Recorder::transition(   0, 3, &Recorder::Action7, &Recorder::Toggle),
+    Recorder::transition(4, 3, 2, &Recorder::Action8),
+    Recorder::transition(2, 1, 4),
+    Recorder::transition(   3, 0, &Recorder::Action1)
+  };
+
+  //***************************************************************************
+  const etl::array<Recorder::state, 5> Recorder::stateTable =
+  {
+    Recorder::state(3, &Recorder::Enter3, &Recorder::Exit3),
+    Recorder::state(1, &Recorder::Enter1, &Recorder::Exit1),
+    Recorder::state(0, &Recorder::Enter0, nullptr),
+    Recorder::state(2, &Recorder::Enter2, nullptr),
+    Recorder::state(1, nullptr,           nullptr)
+  };
+
   MotorControl motorControl;
 
   SUITE(test_state_chart_class)
@@ -599,5 +679,54 @@ namespace
       motorControl.process_event(EventId::ABORT);
       CHECK_EQUAL(StateId::IDLE, int(motorControl.get_state_id()));
     }
+    //*************************************************************************
+    TEST(test_state_chart_indexed_matches_linear)
+    {
+      Recorder linear;
+      Recorder indexed;
+
+      etl::state_chart_traits::index_t index[Recorder::transitionTable.SIZE + Recorder::stateTable.SIZE];
+      indexed.set_index(index, index + ETL_ARRAY_SIZE(index));
+
+      CHECK(!linear.has_index());
+      CHECK(indexed.has_index());
+
+      linear.start();
+      indexed.start();
+
+      uint32_t seed = 12345U;
+
+      for (int i = 0; i < 1000; ++i)
+      {
+        seed = (seed * 1103515245U) + 12345U;
+        const etl::state_chart_traits::event_id_t event_id = etl::state_chart_traits::event_id_t((seed >> 16) % 5U);
+
+        linear.process_event(event_id);
+        indexed.process_event(event_id);
+
+        CHECK_EQUAL(int(linear.get_state_id()), int(indexed.get_state_id()));
+        CHECK_EQUAL(linear.log, indexed.log);
+      }
+
+      CHECK(linear.log != 0U);
+    }
+
+    //*************************************************************************
+    TEST(test_state_chart_index_too_small)
+    {
+      Recorder recorder;
+
+      etl::state_chart_traits::index_t index[Recorder::transitionTable.SIZE + Recorder::stateTable.SIZE - 1];
+
+      CHECK_THROW(recorder.set_index(index, index + ETL_ARRAY_SIZE(index)), etl::state_chart_index_size);
+      CHECK(!recorder.has_index());
+
+      recorder.set_state_table(Recorder::stateTable.begin(), Recorder::stateTable.end() - 1);
+      recorder.set_index(index, index + ETL_ARRAY_SIZE(index));
+      CHECK(recorder.has_index());
+
+      CHECK_THROW(recorder.set_state_table(Recorder::stateTable.begin(), Recorder::stateTable.end()), etl::state_chart_index_size);
+      CHECK(!recorder.has_index());
+    }
   };
 }
@@ -0,0 +1,234 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/statistics.h"
+#include "etl/variance.h"
+#include "etl/correlation.h"
+#include "etl/rms.h"
+
+#include <array>
+#include <vector>
+#include <math.h>
+
+namespace
+{
+  std::array<char, 10> input_c
+  {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9
+  };
+
+  //*********************************
+  std::array<double, 10> input_d
+  {
+    0.0, 1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0
+  };
+
+  //*********************************
+  std::array<double, 10> input_d_flip
+  {
+    9.0, 8.0, 7.0, 6.0, 5.0, 4.0, 3.0, 2.0, 1.0, 0.0
+  };
+
+  //*********************************
+  std::vector<double> make_signal(size_t n, double offset)
+  {
+    std::vector<double> values(n);
+
+    for (size_t i = 0U; i < n; ++i)
+    {
+      values[i] = offset + sin(double(i) * 0.1) + (double(i % 7U) * 0.01);
+    }
+
+    return values;
+  }
+
+  SUITE(test_statistics)
+  {
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      etl::statistics<etl::statistics_type::Population, double> statistics;
+
+      CHECK_EQUAL(0U, statistics.count());
+      CHECK_EQUAL(0.0, statistics.get_mean());
+      CHECK_EQUAL(0.0, statistics.get_variance());
+      CHECK_EQUAL(0.0, statistics.get_standard_deviation());
+      CHECK_EQUAL(0.0, statistics.get_rms());
+    }
+
+    //*************************************************************************
+    TEST(test_char_statistics_population)
+    {
+      etl::statistics<etl::statistics_type::Population, char> statistics(input_c.begin(), input_c.end());
+
+      CHECK_EQUAL(10U, statistics.count());
+      CHECK_CLOSE(4.5,    statistics.get_mean(),               1e-12);
+      CHECK_CLOSE(8.25,   statistics.get_variance(),           1e-12);
+      CHECK_CLOSE(2.8723, statistics.get_standard_deviation(), 1e-4);
+      CHECK_CLOSE(5.3385, statistics.get_rms(),                1e-4);
+    }
+
+    //*************************************************************************
+    TEST(test_double_statistics_sample)
+    {
+      etl::statistics<etl::statistics_type::Sample, double> statistics(input_d.begin(), input_d.end());
+
+      CHECK_CLOSE(4.5,    statistics.get_mean(),               1e-12);
+      CHECK_CLOSE(9.1667, statistics.get_variance(),           1e-4);
+      CHECK_CLOSE(3.0277, statistics.get_standard_deviation(), 1e-4);
+    }
+
+    //*************************************************************************
+    TEST(test_matches_existing_calculations)
+    {
+      std::vector<double> values = make_signal(1000U, 10.0);
+
+      etl::statistics<etl::statistics_type::Sample, double> statistics(values.begin(), values.end());
+      etl::variance<etl::variance_type::Sample, double>     variance(values.begin(), values.end());
+      etl::rms<double>                                      rms(values.begin(), values.end());
+
+      CHECK_CLOSE(variance.get_variance(), statistics.get_variance(), 1e-9);
+      CHECK_CLOSE(rms.get_rms(),           statistics.get_rms(),      1e-9);
+    }
+
+    //*************************************************************************
+    TEST(test_span_matches_single_values)
+    {
+      // Not a multiple of the block size.
+      std::vector<double> values = make_signal(1000U, 10.0);
+
+      etl::statistics<etl::statistics_type::Sample, double> single(values.begin(), values.end());
+      etl::statistics<etl::statistics_type::Sample, double> batch;
+
+      batch.add(etl::span<const double>(values.data(), values.size()));
+
+      CHECK_EQUAL(single.count(), batch.count());
+      CHECK_CLOSE(single.get_mean(),     batch.get_mean(),     1e-12);
+      CHECK_CLOSE(single.get_variance(), batch.get_variance(), 1e-12);
+      CHECK_CLOSE(single.get_rms(),      batch.get_rms(),      1e-12);
+    }
+
+    //*************************************************************************
+    TEST(test_combine)
+    {
+      std::vector<double> values = make_signal(1000U, 10.0);
+
+      etl::statistics<etl::statistics_type::Sample, double> whole(values.begin(), values.end());
+      etl::statistics<etl::statistics_type::Sample, double> part1(values.begin(), values.begin() + 300);
+      etl::statistics<etl::statistics_type::Sample, double> part2(values.begin() + 300, values.end());
+      etl::statistics<etl::statistics_type::Sample, double> empty;
+
+      part1.combine(part2);
+      part1.combine(empty);
+
+      CHECK_EQUAL(whole.count(), part1.count());
+      CHECK_CLOSE(whole.get_mean(),     part1.get_mean(),     1e-12);
+      CHECK_CLOSE(whole.get_variance(), part1.get_variance(), 1e-12);
+
+      empty.combine(whole);
+
+      CHECK_EQUAL(whole.count(), empty.count());
+      CHECK_CLOSE(whole.get_variance(), empty.get_variance(), 1e-12);
+    }
+
+    //*************************************************************************
+    TEST(test_no_drift_with_large_offset)
+    {
+      // The variance of the signal does not depend on the offset.
+      // Summing squares loses it entirely at this offset.
+      std::vector<double> small_offset = make_signal(100000U, 0.0);
+      std::vector<double> large_offset = make_signal(100000U, 1.0e9);
+
+      etl::statistics<etl::statistics_type::Population, double> reference(small_offset.begin(), small_offset.end());
+      etl::statistics<etl::statistics_type::Population, double> single(large_offset.begin(), large_offset.end());
+      etl::statistics<etl::statistics_type::Population, double> batch;
+
+      batch.add(etl::span<const double>(large_offset.data(), large_offset.size()));
+
+      CHECK_CLOSE(reference.get_variance(), single.get_variance(), 1e-6);
+      CHECK_CLOSE(reference.get_variance(), batch.get_variance(),  1e-6);
+    }
+
+    //*************************************************************************
+    TEST(test_clear)
+    {
+      etl::statistics<etl::statistics_type::Population, double> statistics(input_d.begin(), input_d.end());
+
+      statistics.clear();
+
+      CHECK_EQUAL(0U, statistics.count());
+      CHECK_EQUAL(0.0, statistics.get_variance());
+    }
+
+    //*************************************************************************
+    TEST(test_bivariate_matches_correlation)
+    {
+      etl::bivariate_statistics<etl::statistics_type::Sample, double> statistics(input_d.begin(), input_d.end(), input_d_flip.begin());
+      etl::correlation<etl::correlation_type::Sample, double>         correlation(input_d.begin(), input_d.end(), input_d_flip.begin());
+
+      CHECK_EQUAL(10U, statistics.count());
+      CHECK_CLOSE(4.5,                              statistics.get_mean1(),       1e-12);
+      CHECK_CLOSE(4.5,                              statistics.get_mean2(),       1e-12);
+      CHECK_CLOSE(9.1667,                           statistics.get_variance1(),   1e-4);
+      CHECK_CLOSE(9.1667,                           statistics.get_variance2(),   1e-4);
+      CHECK_CLOSE(correlation.get_covariance(),     statistics.get_covariance(),  1e-12);
+      CHECK_CLOSE(correlation.get_correlation(),    statistics.get_correlation(), 1e-12);
+      CHECK_CLOSE(-1.0,                             double(statistics),           1e-12);
+    }
+
+    //*************************************************************************
+    TEST(test_bivariate_span_and_combine)
+    {
+      std::vector<double> values1 = make_signal(1000U, 10.0);
+      std::vector<double> values2 = make_signal(1000U, -3.0);
+
+      for (size_t i = 0U; i < values2.size(); ++i)
+      {
+        values2[i] = (values2[i] * 2.0) + cos(double(i));
+      }
+
+      etl::bivariate_statistics<etl::statistics_type::Population, double> single(values1.begin(), values1.end(), values2.begin());
+      etl::bivariate_statistics<etl::statistics_type::Population, double> batch;
+      etl::bivariate_statistics<etl::statistics_type::Population, double> part;
+
+      batch.add(etl::span<const double>(values1.data(), 500U), etl::span<const double>(values2.data(), 500U));
+      part.add(etl::span<const double>(values1.data() + 500U, 500U), etl::span<const double>(values2.data() + 500U, 500U));
+      batch.combine(part);
+
+      CHECK_EQUAL(single.count(), batch.count());
+      CHECK_CLOSE(single.get_mean1(),       batch.get_mean1(),       1e-12);
+      CHECK_CLOSE(single.get_mean2(),       batch.get_mean2(),       1e-12);
+      CHECK_CLOSE(single.get_variance1(),   batch.get_variance1(),   1e-12);
+      CHECK_CLOSE(single.get_variance2(),   batch.get_variance2(),   1e-12);
+      CHECK_CLOSE(single.get_covariance(),  batch.get_covariance(),  1e-12);
+      CHECK_CLOSE(single.get_correlation(), batch.get_correlation(), 1e-12);
+    }
+  };
+}
@@ -5149,6 +5149,89 @@ namespace
 #include "etl/private/diagnostic_pop.h"
     }
 
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_find_long_text_matches_std)
+    {
+      // Text long enough for the block search, from a small alphabet so that
+      // there are many partial matches.
+      const value_t alphabet[] = { STR('a'), STR('b'), STR('c'), value_t(0xE9) };
+
+      uint32_t seed = 12345U;
+
+      auto next = [&seed](uint32_t range)
+      {
+        seed ^= seed << 13;
+        seed ^= seed >> 17;
+        seed ^= seed << 5;
+        return seed % range;
+      };
+
+      for (int i = 0; i < 1000; ++i)
+      {
+        TextSTD compare_text;
+        TextSTD needle;
+
+        const uint32_t length = next(101U);
+
+        for (uint32_t j = 0U; j < length; ++j)
+        {
+          compare_text += alphabet[next(4U)];
+        }
+
+        const uint32_t needle_length = 1U + next(5U);
+
+        for (uint32_t j = 0U; j < needle_length; ++j)
+        {
+          needle += alphabet[next(4U)];
+        }
+
+        etl::u8string<100> text(compare_text.data(), compare_text.size());
+
+        const size_t  position = next(length + 1U);
+        const value_t c        = needle[0];
+
+        CHECK_EQUAL(compare_text.find(needle, position),              text.find(needle.c_str(), position));
+        CHECK_EQUAL(compare_text.find(c, position),                   text.find(c, position));
+        CHECK_EQUAL(compare_text.rfind(needle),                       text.rfind(needle.c_str()));
+        CHECK_EQUAL(compare_text.rfind(c),                            text.rfind(c));
+        CHECK_EQUAL(compare_text.find_first_of(needle, position),     text.find_first_of(needle.c_str(), position));
+        CHECK_EQUAL(compare_text.find_first_of(c, position),          text.find_first_of(c, position));
+        CHECK_EQUAL(compare_text.find_first_not_of(needle, position), text.find_first_not_of(needle.c_str(), position));
+        CHECK_EQUAL(compare_text.find_first_not_of(c, position),      text.find_first_not_of(c, position));
+        CHECK_EQUAL(compare_text.find_last_of(needle, position),      text.find_last_of(needle.c_str(), position));
+        CHECK_EQUAL(compare_text.find_last_of(c, position),           text.find_last_of(c, position));
+        CHECK_EQUAL(compare_text.find_last_not_of(needle, position),  text.find_last_not_of(needle.c_str(), position));
+        CHECK_EQUAL(compare_text.find_last_not_of(c, position),       text.find_last_not_of(c, position));
+
+        // rfind with a position finds matches that end before it.
+        const size_t rposition = (position >= needle_length) ? compare_text.rfind(needle, position - needle_length) : TextSTD::npos;
+
+        CHECK_EQUAL(rposition, text.rfind(needle.c_str(), position));
+      }
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_find_position_out_of_range)
+    {
+      const TextSTD compare_text(STR("abcabc"));
+      const Text    text(STR("abcabc"));
+
+      const value_t* needle = STR("bc");
+      const value_t* empty  = STR("");
+
+      const size_t positions[] = { 4U, 5U, 6U, 7U, Text::npos - 1U, Text::npos };
+
+      for (size_t position : positions)
+      {
+        CHECK_EQUAL(compare_text.find(needle, position),          text.find(needle, position));
+        CHECK_EQUAL(compare_text.find(needle, position, 2U),      text.find(needle, position, 2U));
+        CHECK_EQUAL(compare_text.find(empty, position),           text.find(empty, position));
+        CHECK_EQUAL(compare_text.find(TextSTD(needle), position), text.find(Text(needle), position));
+        CHECK_EQUAL(compare_text.find(TextSTD(needle), position), text.find(View(needle), position));
+        CHECK_EQUAL(compare_text.find(STR('c'), position),        text.find(STR('c'), position));
+      }
+    }
+
     //*************************************************************************
     TEST_FIXTURE(SetupFixture, test_hash)
     {
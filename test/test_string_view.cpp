@@ -97,6 +97,20 @@ namespace
       CHECK_ARRAY_EQUAL(text, str3, 5U);
       CHECK_ARRAY_EQUAL(text, str4, 5U);
     }
+
+    //*************************************************************************
+    TEST(test_constexpr_find)
+    {
+      constexpr etl::string_view view("Hello World");
+
+      constexpr size_t find          = view.find(etl::string_view("World"));
+      constexpr size_t rfind         = view.rfind(etl::string_view("o"));
+      constexpr size_t find_first_of = view.find_first_of(etl::string_view("Wo"));
+
+      CHECK_EQUAL(6U, find);
+      CHECK_EQUAL(7U, rfind);
+      CHECK_EQUAL(4U, find_first_of);
+    }
 #endif
 
     //*************************************************************************
@@ -1071,6 +1085,81 @@ namespace
       CHECK(View::npos == view.find_last_not_of(s6, 10, 8));
     }
 
+    //*************************************************************************
+    TEST(test_find_position_out_of_range)
+    {
+      const std::string compare_text("abcabc");
+      const View        view(compare_text.data(), compare_text.size());
+
+      const size_t positions[] = { 4U, 5U, 6U, 7U, View::npos - 1U, View::npos };
+
+      for (size_t position : positions)
+      {
+        CHECK_EQUAL(compare_text.find("bc", position), view.find(View("bc"), position));
+        CHECK_EQUAL(compare_text.find("", position),   view.find(View(""), position));
+        CHECK_EQUAL(compare_text.find('c', position),  view.find('c', position));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_find_long_text_matches_std)
+    {
+      // Text long enough for the block search, from a small alphabet so that
+      // there are many partial matches.
+      const char alphabet[] = { 'a', 'b', 'c', char(0xE9) };
+
+      uint32_t seed = 54321U;
+
+      auto next = [&seed](uint32_t range)
+      {
+        seed ^= seed << 13;
+        seed ^= seed >> 17;
+        seed ^= seed << 5;
+        return seed % range;
+      };
+
+      for (int i = 0; i < 1000; ++i)
+      {
+        std::string compare_text;
+        std::string needle;
+
+        const uint32_t length = next(101U);
+
+        for (uint32_t j = 0U; j < length; ++j)
+        {
+          compare_text += alphabet[next(4U)];
+        }
+
+        const uint32_t needle_length = 1U + next(5U);
+
+        for (uint32_t j = 0U; j < needle_length; ++j)
+        {
+          needle += alphabet[next(4U)];
+        }
+
+        View view(compare_text.data(), compare_text.size());
+        View needle_view(needle.data(), needle.size());
+
+        const size_t position = next(length + 1U);
+
+        CHECK_EQUAL(compare_text.find(needle, position),              view.find(needle_view, position));
+        CHECK_EQUAL(compare_text.find(needle[0], position),           view.find(needle[0], position));
+        CHECK_EQUAL(compare_text.rfind(needle),                       view.rfind(needle_view));
+        CHECK_EQUAL(compare_text.find_first_of(needle, position),     view.find_first_of(needle_view, position));
+        CHECK_EQUAL(compare_text.find_first_not_of(needle, position), view.find_first_not_of(needle_view, position));
+        CHECK_EQUAL(compare_text.find_last_of(needle, position),      view.find_last_of(needle_view, position));
+        CHECK_EQUAL(compare_text.find_last_not_of(needle, position),  view.find_last_not_of(needle_view, position));
+
+        // rfind with a position finds matches that end before it.
+        const size_t rposition = (position >= needle_length) ? compare_text.rfind(needle, position - needle_length) : std::string::npos;
+
+        CHECK_EQUAL(rposition, view.rfind(needle_view, position));
+      }
+
+      // Not found before the position.
+      CHECK_EQUAL(View::npos, View("abcdabcd").rfind(View("xy"), 4U));
+    }
+
     //*************************************************************************
     TEST(test_hash)
     {
@@ -0,0 +1,428 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/callback_timer_wheel.h"
+#include "etl/callback_timer_wheel_atomic.h"
+#include "etl/callback_timer_wheel_interrupt.h"
+#include "etl/callback_timer_wheel_locked.h"
+#include "etl/message_timer_wheel.h"
+#include "etl/message_timer_wheel_atomic.h"
+#include "etl/message_timer_wheel_interrupt.h"
+#include "etl/message_timer_wheel_locked.h"
+
+#include <vector>
+#include <atomic>
+
+//*****************************************************************************
+// The wheel specific tests, run against every '_wheel' timer variant.
+//*****************************************************************************
+namespace
+{
+  uint32_t ticks = 0U;
+
+  std::vector<uint32_t> expiries[3];
+
+  void clear_expiries()
+  {
+    expiries[0].clear();
+    expiries[1].clear();
+    expiries[2].clear();
+  }
+
+  // Called by timer 2 on expiry, if set.
+  void (*p_on_expiry2)() = nullptr;
+
+  void expired0()
+  {
+    expiries[0].push_back(ticks);
+  }
+
+  void expired1()
+  {
+    expiries[1].push_back(ticks);
+  }
+
+  void expired2()
+  {
+    expiries[2].push_back(ticks);
+
+    if (p_on_expiry2 != nullptr)
+    {
+      p_on_expiry2();
+    }
+  }
+
+  //***************************************************************************
+  struct Message0 : public etl::message<0>
+  {
+  };
+
+  struct Message1 : public etl::message<1>
+  {
+  };
+
+  struct Message2 : public etl::message<2>
+  {
+  };
+
+  Message0 message0;
+  Message1 message1;
+  Message2 message2;
+
+  //***************************************************************************
+  class Router : public etl::message_router<Router, Message0, Message1, Message2>
+  {
+  public:
+
+    Router()
+      : message_router(1)
+    {
+    }
+
+    void on_receive(const Message0&)
+    {
+      expired0();
+    }
+
+    void on_receive(const Message1&)
+    {
+      expired1();
+    }
+
+    void on_receive(const Message2&)
+    {
+      expired2();
+    }
+
+    void on_receive_unknown(const etl::imessage&)
+    {
+    }
+  };
+
+  Router router;
+
+  //***************************************************************************
+  struct InterruptGuard
+  {
+  };
+
+  struct Locks
+  {
+    static bool try_lock()
+    {
+      return true;
+    }
+
+    static void lock()
+    {
+    }
+
+    static void unlock()
+    {
+    }
+  };
+
+  //***************************************************************************
+  // Adapters that give every variant the same way of registering timer
+  // 'index', which records its expiries in 'expiries[index]'.
+  //***************************************************************************
+  template <typename TTimer>
+  class FunctionAdapter : public TTimer
+  {
+  public:
+
+    etl::timer::id::type register_expiry(size_t index, uint32_t period, bool repeating)
+    {
+      static void (* const functions[])() = { expired0, expired1, expired2 };
+
+      return this->register_timer(functions[index], period, repeating);
+    }
+  };
+
+  //*************************************
+  template <typename TTimer>
+  class DelegateAdapter : public TTimer
+  {
+  public:
+
+    etl::timer::id::type register_expiry(size_t index, uint32_t period, bool repeating)
+    {
+      typedef typename TTimer::callback_type delegate_type;
+
+      static const delegate_type callbacks[] = { delegate_type::template create<expired0>(),
+                                                 delegate_type::template create<expired1>(),
+                                                 delegate_type::template create<expired2>() };
+
+      return this->register_timer(callbacks[index], period, repeating);
+    }
+  };
+
+  //*************************************
+  template <typename TTimer>
+  class MessageAdapter : public TTimer
+  {
+  public:
+
+    etl::timer::id::type register_expiry(size_t index, uint32_t period, bool repeating)
+    {
+      static const etl::imessage* const messages[] = { &message0, &message1, &message2 };
+
+      return this->register_timer(*messages[index], router, period, repeating);
+    }
+  };
+
+  //*************************************
+  template <typename TTimer>
+  class LockedAdapter : public TTimer
+  {
+  public:
+
+    LockedAdapter()
+    {
+      this->set_locks(etl::private_timer::timer_wheel_delegate_lock::try_lock_type::create<Locks::try_lock>(),
+                      etl::private_timer::timer_wheel_delegate_lock::lock_type::create<Locks::lock>(),
+                      etl::private_timer::timer_wheel_delegate_lock::unlock_type::create<Locks::unlock>());
+    }
+  };
+
+  typedef FunctionAdapter<etl::callback_timer_wheel<3> >                                     CallbackTimer;
+  typedef DelegateAdapter<etl::callback_timer_wheel_atomic<3, std::atomic_uint32_t> >        CallbackTimerAtomic;
+  typedef DelegateAdapter<etl::callback_timer_wheel_interrupt<3, InterruptGuard> >           CallbackTimerInterrupt;
+  typedef LockedAdapter<DelegateAdapter<etl::callback_timer_wheel_locked<3> > >              CallbackTimerLocked;
+  typedef MessageAdapter<etl::message_timer_wheel<3> >                                       MessageTimer;
+  typedef MessageAdapter<etl::message_timer_wheel_atomic<3, std::atomic_uint32_t> >          MessageTimerAtomic;
+  typedef MessageAdapter<etl::message_timer_wheel_interrupt<3, InterruptGuard> >             MessageTimerInterrupt;
+  typedef LockedAdapter<MessageAdapter<etl::message_timer_wheel_locked<3> > >                MessageTimerLocked;
+
+  //***************************************************************************
+  // Timers that cascade down through several levels of the wheel, ticked one
+  // tick at a time.
+  //***************************************************************************
+  template <typename TTimer>
+  void check_periods_across_levels()
+  {
+    TTimer timer_controller;
+
+    etl::timer::id::type id0 = timer_controller.register_expiry(0U, 1000003U, etl::timer::mode::Single_Shot);
+    etl::timer::id::type id1 = timer_controller.register_expiry(1U,    4100U, etl::timer::mode::Repeating);
+    etl::timer::id::type id2 = timer_controller.register_expiry(2U,       7U, etl::timer::mode::Repeating);
+
+    clear_expiries();
+
+    timer_controller.start(id0);
+    timer_controller.start(id1);
+    timer_controller.start(id2);
+
+    timer_controller.enable(true);
+
+    CHECK_EQUAL(7U, timer_controller.time_to_next());
+
+    ticks = 0U;
+
+    while (ticks < 1000010U)
+    {
+      ++ticks;
+      timer_controller.tick(1U);
+    }
+
+    CHECK_EQUAL(1U, expiries[0].size());
+    CHECK_EQUAL(1000003U, expiries[0].front());
+
+    CHECK_EQUAL(1000010U / 4100U, expiries[1].size());
+    CHECK_EQUAL(1000010U / 7U, expiries[2].size());
+
+    bool all_on_time = true;
+
+    for (size_t i = 0U; i < expiries[1].size(); ++i)
+    {
+      all_on_time = all_on_time && (expiries[1][i] == ((i + 1U) * 4100U));
+    }
+
+    for (size_t i = 0U; i < expiries[2].size(); ++i)
+    {
+      all_on_time = all_on_time && (expiries[2][i] == ((i + 1U) * 7U));
+    }
+
+    CHECK(all_on_time);
+    CHECK(!timer_controller.is_active(id0));
+    CHECK(timer_controller.is_active(id1));
+    CHECK_EQUAL(3U, timer_controller.time_to_next());
+  }
+
+  //***************************************************************************
+  // A period close to 2^32, started away from time zero, so that its expiry
+  // wraps, reached with large ticks.
+  //***************************************************************************
+  template <typename TTimer>
+  void check_long_period_big_steps()
+  {
+    TTimer timer_controller;
+
+    etl::timer::id::type id0 = timer_controller.register_expiry(0U, 0xFFFFFFF0UL, etl::timer::mode::Single_Shot);
+    etl::timer::id::type id1 = timer_controller.register_expiry(1U, 1000003UL,    etl::timer::mode::Single_Shot);
+
+    clear_expiries();
+
+    timer_controller.enable(true);
+
+    // Move away from time zero.
+    timer_controller.tick(123456789UL);
+
+    timer_controller.start(id0);
+    timer_controller.start(id1);
+
+    CHECK_EQUAL(1000003UL, timer_controller.time_to_next());
+
+    timer_controller.tick(1000002UL);
+    CHECK(expiries[1].empty());
+    CHECK_EQUAL(1UL, timer_controller.time_to_next());
+
+    timer_controller.tick(1UL);
+    CHECK_EQUAL(1U, expiries[1].size());
+    CHECK_EQUAL(0xFFFFFFF0UL - 1000003UL, timer_controller.time_to_next());
+
+    timer_controller.tick(0xFFFFFFF0UL - 1000004UL);
+    CHECK(expiries[0].empty());
+    CHECK_EQUAL(1UL, timer_controller.time_to_next());
+
+    timer_controller.tick(1UL);
+    CHECK_EQUAL(1U, expiries[0].size());
+    CHECK(!timer_controller.has_active_timer());
+    CHECK_EQUAL(etl::timer::interval::No_Active_Interval, timer_controller.time_to_next());
+  }
+
+  //***************************************************************************
+  // A repeating timer is restarted before its callback is called, so the
+  // callback can stop it.
+  //***************************************************************************
+  void* p_stop_controller = nullptr;
+  etl::timer::id::type stop_id = etl::timer::id::NO_TIMER;
+
+  template <typename TTimer>
+  void stop_timer()
+  {
+    static_cast<TTimer*>(p_stop_controller)->stop(stop_id);
+  }
+
+  template <typename TTimer>
+  void check_repeating_timer_stopped_by_its_callback()
+  {
+    TTimer timer_controller;
+
+    etl::timer::id::type id0 = timer_controller.register_expiry(0U, 100U, etl::timer::mode::Repeating);
+    etl::timer::id::type id2 = timer_controller.register_expiry(2U, 30U,  etl::timer::mode::Repeating);
+
+    clear_expiries();
+
+    p_stop_controller = &timer_controller;
+    stop_id           = id2;
+    p_on_expiry2      = stop_timer<TTimer>;
+
+    timer_controller.start(id0);
+    timer_controller.start(id2);
+    timer_controller.enable(true);
+
+    ticks = 0U;
+
+    while (ticks < 250U)
+    {
+      ticks += 10U;
+      timer_controller.tick(10U);
+    }
+
+    p_on_expiry2 = nullptr;
+
+    CHECK_EQUAL(2U, expiries[0].size());
+    CHECK_EQUAL(1U, expiries[2].size());
+    CHECK(timer_controller.is_active(id0));
+    CHECK(!timer_controller.is_active(id2));
+    CHECK_EQUAL(50U, timer_controller.time_to_next());
+  }
+
+  //***************************************************************************
+  template <typename TTimer>
+  void check_wheel()
+  {
+    check_periods_across_levels<TTimer>();
+    check_long_period_big_steps<TTimer>();
+    check_repeating_timer_stopped_by_its_callback<TTimer>();
+  }
+
+  SUITE(test_timer_wheel)
+  {
+    //*************************************************************************
+    TEST(callback_timer_wheel)
+    {
+      check_wheel<CallbackTimer>();
+    }
+
+    //*************************************************************************
+    TEST(callback_timer_wheel_atomic)
+    {
+      check_wheel<CallbackTimerAtomic>();
+    }
+
+    //*************************************************************************
+    TEST(callback_timer_wheel_interrupt)
+    {
+      check_wheel<CallbackTimerInterrupt>();
+    }
+
+    //*************************************************************************
+    TEST(callback_timer_wheel_locked)
+    {
+      check_wheel<CallbackTimerLocked>();
+    }
+
+    //*************************************************************************
+    TEST(message_timer_wheel)
+    {
+      check_wheel<MessageTimer>();
+    }
+
+    //*************************************************************************
+    TEST(message_timer_wheel_atomic)
+    {
+      check_wheel<MessageTimerAtomic>();
+    }
+
+    //*************************************************************************
+    TEST(message_timer_wheel_interrupt)
+    {
+      check_wheel<MessageTimerInterrupt>();
+    }
+
+    //*************************************************************************
+    TEST(message_timer_wheel_locked)
+    {
+      check_wheel<MessageTimerLocked>();
+    }
+  }
+}
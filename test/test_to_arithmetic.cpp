@@ -32,6 +32,10 @@ SOFTWARE.
 #include <sstream>
 #include <iomanip>
 #include <limits>
+#include <random>
+#include <string>
+#include <stdlib.h>
+#include <cmath>
 
 #include "etl/to_arithmetic.h"
 #include "etl/string.h"
@@ -61,6 +65,43 @@ namespace
 
   typedef etl::format_spec Format;
 
+  //*************************************************************************
+  // Random text from a set of characters.
+  // The wchar_t conversions do not use the char fast paths, so they are the
+  // reference for the char results.
+  //*************************************************************************
+  std::string random_text(std::mt19937& rng, const std::string& chars, size_t max_length)
+  {
+    std::uniform_int_distribution<size_t> length_distribution(1U, max_length);
+    std::uniform_int_distribution<size_t> char_distribution(0U, chars.size() - 1U);
+
+    std::string text(length_distribution(rng), ' ');
+
+    for (size_t i = 0U; i < text.size(); ++i)
+    {
+      text[i] = chars[char_distribution(rng)];
+    }
+
+    return text;
+  }
+
+  //*************************************************************************
+  template <typename T>
+  bool is_same_integral_result(const std::string& text)
+  {
+    const std::wstring wtext(text.begin(), text.end());
+
+    const etl::to_arithmetic_result<T> result    = etl::to_arithmetic<T>(text.c_str(), text.size());
+    const etl::to_arithmetic_result<T> reference = etl::to_arithmetic<T>(wtext.c_str(), wtext.size());
+
+    if (result.has_value() != reference.has_value())
+    {
+      return false;
+    }
+
+    return result.has_value() ? (result.value() == reference.value()) : (result.error() == reference.error());
+  }
+
   SUITE(test_to_arithmetic)
   {
     //*************************************************************************
@@ -1027,6 +1068,112 @@ namespace
       CHECK_EQUAL(83, int(etl::to_arithmetic<int8_t>(ETLText(text.c_str(), text.size()), etl::radix::decimal).value()));
     }
 
+    //*************************************************************************
+    TEST(test_decimal_fast_path_matches_scalar)
+    {
+      std::mt19937 rng(12345);
+
+      for (int i = 0; i < 20000; ++i)
+      {
+        // Mostly digits, so that long runs reach the eight digit blocks.
+        const std::string text = random_text(rng, (i % 4) == 0 ? "0123456789+-x " : "0123456789", 24U);
+
+        CHECK(is_same_integral_result<int8_t>(text));
+        CHECK(is_same_integral_result<uint8_t>(text));
+        CHECK(is_same_integral_result<int16_t>(text));
+        CHECK(is_same_integral_result<uint16_t>(text));
+        CHECK(is_same_integral_result<int32_t>(text));
+        CHECK(is_same_integral_result<uint32_t>(text));
+        CHECK(is_same_integral_result<int64_t>(text));
+        CHECK(is_same_integral_result<uint64_t>(text));
+      }
+
+      // Boundaries.
+      CHECK_EQUAL(std::numeric_limits<uint64_t>::max(), etl::to_arithmetic<uint64_t>(etl::string_view(STR("18446744073709551615"))).value());
+      CHECK_EQUAL(etl::to_arithmetic_status::Overflow, etl::to_arithmetic<uint64_t>(etl::string_view(STR("18446744073709551616"))).error());
+      CHECK_EQUAL(std::numeric_limits<int64_t>::min(), etl::to_arithmetic<int64_t>(etl::string_view(STR("-9223372036854775808"))).value());
+      CHECK_EQUAL(etl::to_arithmetic_status::Overflow, etl::to_arithmetic<int64_t>(etl::string_view(STR("9223372036854775808"))).error());
+      CHECK_EQUAL(std::numeric_limits<uint32_t>::max(), etl::to_arithmetic<uint32_t>(etl::string_view(STR("0000000004294967295"))).value());
+      CHECK_EQUAL(etl::to_arithmetic_status::Overflow, etl::to_arithmetic<uint32_t>(etl::string_view(STR("4294967296"))).error());
+      CHECK_EQUAL(etl::to_arithmetic_status::Invalid_Format, etl::to_arithmetic<uint32_t>(etl::string_view(STR("12345678a"))).error());
+    }
+
+    //*************************************************************************
+    TEST(test_floating_point_fast_path_is_exact)
+    {
+      std::mt19937 rng(54321);
+      std::uniform_int_distribution<int> exponent_distribution(-15, 15);
+
+      for (int i = 0; i < 20000; ++i)
+      {
+        // At most 15 significant digits and a small exponent.
+        std::string text = random_text(rng, "0123456789", 8U);
+        text += ".";
+        text += random_text(rng, "0123456789", 7U);
+        text += "e";
+        text += std::to_string(exponent_distribution(rng));
+
+        if ((i % 2) == 0)
+        {
+          text.insert(text.begin(), '-');
+        }
+
+        const etl::to_arithmetic_result<double> result = etl::to_arithmetic<double>(text.c_str(), text.size());
+
+        CHECK(result.has_value());
+        CHECK_EQUAL(strtod(text.c_str(), nullptr), result.value());
+      }
+
+      CHECK_EQUAL(0.1,    etl::to_arithmetic<double>(etl::string_view(STR("0.1"))).value());
+      CHECK_EQUAL(1e22,   etl::to_arithmetic<double>(etl::string_view(STR("1e22"))).value());
+      CHECK_EQUAL(1e-22,  etl::to_arithmetic<double>(etl::string_view(STR("1e-22"))).value());
+      CHECK_EQUAL(0.1f,   etl::to_arithmetic<float>(etl::string_view(STR("0.1"))).value());
+      CHECK_EQUAL(3.125f, etl::to_arithmetic<float>(etl::string_view(STR("3,125"))).value());
+    }
+
+    //*************************************************************************
+    TEST(test_floating_point_fast_path_matches_scalar)
+    {
+      std::mt19937 rng(13579);
+
+      for (int i = 0; i < 20000; ++i)
+      {
+        const std::string  text = random_text(rng, (i % 2) == 0 ? "0123456789.e-" : "0123456789+-.,eEx", 12U);
+        const std::wstring wtext(text.begin(), text.end());
+
+        const etl::to_arithmetic_result<double> result    = etl::to_arithmetic<double>(text.c_str(), text.size());
+        const etl::to_arithmetic_result<double> reference = etl::to_arithmetic<double>(wtext.c_str(), wtext.size());
+
+        CHECK_EQUAL(reference.has_value(), result.has_value());
+
+        if (result.has_value() && reference.has_value())
+        {
+          CHECK_CLOSE(reference.value(), result.value(), fabs(reference.value()) * 1e-14);
+        }
+        else if (!result.has_value() && !reference.has_value())
+        {
+          CHECK_EQUAL(reference.error(), result.error());
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_floating_point_negative_zero_and_long_exponents)
+    {
+      // "-0" is -0.0 with and without the fast path.
+      CHECK(std::signbit(etl::to_arithmetic<double>("-0", 2U).value()));
+      CHECK(std::signbit(etl::to_arithmetic<double>(L"-0", 2U).value()));
+      CHECK(std::signbit(etl::to_arithmetic<double>("-0.0e1", 6U).value()));
+      CHECK(std::signbit(etl::to_arithmetic<double>(L"-0.0e1", 6U).value()));
+      CHECK(!std::signbit(etl::to_arithmetic<double>(L"0", 1U).value()));
+
+      // Exponents too long for an int saturate.
+      CHECK_EQUAL(etl::to_arithmetic_status::Overflow, etl::to_arithmetic<double>("1e99999999999999999999", 22U).error());
+      CHECK_EQUAL(etl::to_arithmetic_status::Overflow, etl::to_arithmetic<double>(L"1e99999999999999999999", 22U).error());
+      CHECK_EQUAL(0.0, etl::to_arithmetic<double>("1e-99999999999999999999", 23U).value());
+      CHECK_EQUAL(0.0, etl::to_arithmetic<double>(L"1e-99999999999999999999", 23U).value());
+    }
+
     //*************************************************************************
 #if ETL_USING_CPP14
     TEST(test_constexpr_integral)
@@ -309,6 +309,75 @@ namespace
       CHECK(etl::string<20>(STR("Result -0.123456 ")) == etl::to_string(-0.123456, str, Format().precision(6).width(10).left(), true));
     }
 
+    //*************************************************************************
+    TEST(test_64bit_integers)
+    {
+      etl::string<70> str;
+
+      CHECK(etl::string<70>(STR("-9223372036854775808")) == etl::to_string(etl::integral_limits<int64_t>::min, str));
+      CHECK(etl::string<70>(STR("9223372036854775807"))  == etl::to_string(etl::integral_limits<int64_t>::max, str));
+      CHECK(etl::string<70>(STR("18446744073709551615")) == etl::to_string(etl::integral_limits<uint64_t>::max, str));
+      CHECK(etl::string<70>(STR("100000000"))            == etl::to_string(uint64_t(100000000U), str));
+      CHECK(etl::string<70>(STR("4294967296"))           == etl::to_string(uint64_t(4294967296ULL), str));
+      CHECK(etl::string<70>(STR("-12345678901234"))      == etl::to_string(-12345678901234LL, str));
+      CHECK(etl::string<70>(STR("0XFFFFFFFFFFFFFFFF"))   == etl::to_string(etl::integral_limits<uint64_t>::max, str, Format().hex().upper_case(true).show_base(true)));
+      CHECK(etl::string<70>(STR("1777777777777777777777")) == etl::to_string(etl::integral_limits<uint64_t>::max, str, Format().octal()));
+      CHECK(etl::string<70>(STR("0b1000000000000000000000000000000000000000000000000000000000000000")) == etl::to_string(uint64_t(1) << 63, str, Format().binary().show_base(true)));
+    }
+
+    //*************************************************************************
+    TEST(test_floating_point_shortest)
+    {
+      etl::string<30> str;
+
+      CHECK(etl::string<30>(STR("0"))                       == etl::to_string(0.0, str, Format().shortest(true)));
+      CHECK(etl::string<30>(STR("-0"))                      == etl::to_string(-0.0, str, Format().shortest(true)));
+      CHECK(etl::string<30>(STR("0.1"))                     == etl::to_string(0.1, str, Format().shortest(true)));
+      CHECK(etl::string<30>(STR("0.1"))                     == etl::to_string(0.1f, str, Format().shortest(true)));
+      CHECK(etl::string<30>(STR("0.3333333333333333"))      == etl::to_string(1.0 / 3.0, str, Format().shortest(true)));
+      CHECK(etl::string<30>(STR("-123.456"))                == etl::to_string(-123.456, str, Format().shortest(true)));
+      CHECK(etl::string<30>(STR("100"))                     == etl::to_string(100.0, str, Format().shortest(true)));
+      CHECK(etl::string<30>(STR("0.000001"))                == etl::to_string(0.000001, str, Format().shortest(true)));
+      CHECK(etl::string<30>(STR("1e-07"))                   == etl::to_string(0.0000001, str, Format().shortest(true)));
+      CHECK(etl::string<30>(STR("100000000000000000000"))   == etl::to_string(1e20, str, Format().shortest(true)));
+      CHECK(etl::string<30>(STR("1e+21"))                   == etl::to_string(1e21, str, Format().shortest(true)));
+      CHECK(etl::string<30>(STR("1.7976931348623157e+308")) == etl::to_string(1.7976931348623157e308, str, Format().shortest(true)));
+      CHECK(etl::string<30>(STR("5E-324"))                  == etl::to_string(4.9406564584124654e-324, str, Format().shortest(true).upper_case(true)));
+      CHECK(etl::string<30>(STR("16777216"))                == etl::to_string(16777216.0f, str, Format().shortest(true)));
+      CHECK(etl::string<30>(STR("inf"))                     == etl::to_string(etl::numeric_limits<double>::infinity(), str, Format().shortest(true)));
+    }
+
+    //*************************************************************************
+    TEST(test_floating_point_shortest_long_double)
+    {
+      etl::string<30> str;
+
+      CHECK(etl::string<30>(STR("-123.456"))   == etl::to_string(-123.456L, str, Format().shortest(true)));
+      CHECK(etl::string<30>(STR("1e+300"))     == etl::to_string(1e300L, str, Format().shortest(true)));
+
+      if (etl::numeric_limits<long double>::max_exponent > etl::numeric_limits<double>::max_exponent)
+      {
+        // Outside of the range of double.
+        CHECK(etl::string<30>(STR("1e+400"))     == etl::to_string(1e400L, str, Format().shortest(true)));
+        CHECK(etl::string<30>(STR("-2.5e+1000")) == etl::to_string(-2.5e1000L, str, Format().shortest(true)));
+        CHECK(etl::string<30>(STR("1e-330"))     == etl::to_string(1e-330L, str, Format().shortest(true)));
+        CHECK(etl::string<30>(STR("-7.5e-4000")) == etl::to_string(-7.5e-4000L, str, Format().shortest(true)));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_floating_point_shortest_format)
+    {
+      etl::string<30> str;
+
+      CHECK(etl::string<30>(STR("     1.500")) == etl::to_string(1.5, str, Format().shortest(true).precision(3).width(10)));
+      CHECK(etl::string<30>(STR("100.00****")) == etl::to_string(100.0, str, Format().shortest(true).precision(2).width(10).left().fill(STR('*'))));
+      CHECK(etl::string<30>(STR("1.25"))       == etl::to_string(1.25, str, Format().shortest(true).precision(1)));
+
+      str.assign(STR("Result "));
+      CHECK(etl::string<30>(STR("Result   -2.5e-10")) == etl::to_string(-2.5e-10, str, Format().shortest(true).width(10), true));
+    }
+
     //*************************************************************************
     TEST(test_floating_point_rounding)
     {
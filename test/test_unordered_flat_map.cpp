@@ -0,0 +1,892 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include <map>
+#include <string>
+#include <vector>
+#include <memory>
+#include <numeric>
+#include <random>
+
+#include "etl/unordered_flat_map.h"
+#include "etl/hash.h"
+
+namespace
+{
+  //*************************************************************************
+  // Sends every key to one of a few home slots, to create long probe runs.
+  struct colliding_hash
+  {
+    size_t operator ()(int key) const
+    {
+      return size_t(key % 3);
+    }
+  };
+
+  //*************************************************************************
+  // Sends every key to the same home slot.
+  struct same_hash
+  {
+    size_t operator ()(int) const
+    {
+      return 12345U;
+    }
+  };
+
+  //*************************************************************************
+  // A hash that the map mixes to all ones, so its home is the last slot.
+  size_t last_slot_hash()
+  {
+    const size_t golden = (sizeof(size_t) >= sizeof(uint64_t)) ? static_cast<size_t>(0x9E3779B97F4A7C15ULL)
+                                                               : static_cast<size_t>(0x9E3779B9UL);
+
+    // Newton's method for the inverse of the odd multiplier.
+    size_t inverse = golden;
+
+    for (int i = 0; i < 5; ++i)
+    {
+      inverse *= 2U - (golden * inverse);
+    }
+
+    return size_t(0U) - inverse;
+  }
+
+  //*************************************************************************
+  // Sends keys below 100 to the last slot, so that their probes wrap around.
+  struct wrapping_hash
+  {
+    size_t operator ()(int key) const
+    {
+      return (key < 100) ? last_slot_hash() : size_t(key);
+    }
+  };
+
+  //*************************************************************************
+  struct string_hash
+  {
+    typedef int is_transparent;
+
+    size_t operator ()(const char* s) const
+    {
+      size_t sum = 0U;
+      size_t length = etl::strlen(s);
+
+      return std::accumulate(s, s + length, sum);
+    }
+
+    size_t operator ()(const std::string& text) const
+    {
+      size_t sum = 0U;
+
+      return std::accumulate(text.begin(), text.end(), sum);
+    }
+  };
+
+  //*************************************************************************
+  template <typename TMap, typename TCompare>
+  bool Check_Equal(const TMap& map, const TCompare& compare)
+  {
+    if (map.size() != compare.size())
+    {
+      return false;
+    }
+
+    size_t n = 0U;
+
+    for (typename TMap::const_iterator itr = map.begin(); itr != map.end(); ++itr)
+    {
+      typename TCompare::const_iterator citr = compare.find(itr->first);
+
+      if ((citr == compare.end()) || (citr->second != itr->second))
+      {
+        return false;
+      }
+
+      ++n;
+    }
+
+    return n == compare.size();
+  }
+
+  SUITE(test_unordered_flat_map)
+  {
+    static const size_t SIZE = 10;
+
+    using Data             = etl::unordered_flat_map<int, int, SIZE>;
+    using IData            = etl::iunordered_flat_map<int, int>;
+    using DataColliding    = etl::unordered_flat_map<int, int, SIZE, colliding_hash>;
+    using DataString       = etl::unordered_flat_map<std::string, int, SIZE, string_hash>;
+    using DataTransparent  = etl::unordered_flat_map<std::string, int, SIZE, string_hash, etl::equal_to<>>;
+    using DataMovable      = etl::unordered_flat_map<int, std::unique_ptr<int>, SIZE>;
+    using DataExt          = etl::unordered_flat_map_ext<int, int>;
+
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      Data data;
+
+      CHECK(data.empty());
+      CHECK(!data.full());
+      CHECK_EQUAL(0U, data.size());
+      CHECK_EQUAL(SIZE, data.max_size());
+      CHECK_EQUAL(SIZE, data.capacity());
+      CHECK_EQUAL(SIZE, data.available());
+      CHECK_EQUAL(16U, data.bucket_count());
+      CHECK_EQUAL(16U, data.max_bucket_count());
+      CHECK(data.begin() == data.end());
+      CHECK(data.cbegin() == data.cend());
+    }
+
+    //*************************************************************************
+    TEST(test_dimensions)
+    {
+      CHECK_EQUAL(2U,   (etl::unordered_flat_map_dimensions<0>::Buckets));
+      CHECK_EQUAL(2U,   (etl::unordered_flat_map_dimensions<0>::Slots));
+      CHECK_EQUAL(2U,   (etl::unordered_flat_map_dimensions<1>::Buckets));
+      CHECK_EQUAL(2U,   (etl::unordered_flat_map_dimensions<1>::Slots));
+      CHECK_EQUAL(16U,  (etl::unordered_flat_map_dimensions<10>::Buckets));
+      CHECK_EQUAL(16U,  (etl::unordered_flat_map_dimensions<10>::Slots));
+      CHECK_EQUAL(1024U, (etl::unordered_flat_map_dimensions<800>::Buckets));
+      CHECK_EQUAL(1024U, (etl::unordered_flat_map_dimensions<800>::Slots));
+
+      CHECK_EQUAL((etl::unordered_flat_map_dimensions<0>::Slots),   IData::required_slots(0));
+
+      CHECK_EQUAL((etl::unordered_flat_map_dimensions<1>::Slots),   IData::required_slots(1));
+      CHECK_EQUAL((etl::unordered_flat_map_dimensions<10>::Slots),  IData::required_slots(10));
+      CHECK_EQUAL((etl::unordered_flat_map_dimensions<800>::Slots), IData::required_slots(800));
+    }
+
+    //*************************************************************************
+    TEST(test_insert_and_find)
+    {
+      Data data;
+
+      for (int i = 0; i < int(SIZE); ++i)
+      {
+        ETL_OR_STD::pair<Data::iterator, bool> result = data.insert(Data::value_type(i, i * 10));
+
+        CHECK(result.second);
+        CHECK_EQUAL(i,      result.first->first);
+        CHECK_EQUAL(i * 10, result.first->second);
+      }
+
+      CHECK(data.full());
+      CHECK_EQUAL(SIZE, data.size());
+
+      for (int i = 0; i < int(SIZE); ++i)
+      {
+        Data::iterator itr = data.find(i);
+
+        CHECK(itr != data.end());
+        CHECK_EQUAL(i * 10, itr->second);
+        CHECK_EQUAL(1U, data.count(i));
+        CHECK(data.contains(i));
+      }
+
+      CHECK(data.find(int(SIZE)) == data.end());
+      CHECK_EQUAL(0U, data.count(int(SIZE)));
+      CHECK(!data.contains(int(SIZE)));
+    }
+
+    //*************************************************************************
+    TEST(test_insert_existing_key)
+    {
+      Data data;
+
+      data.insert(Data::value_type(1, 10));
+      ETL_OR_STD::pair<Data::iterator, bool> result = data.insert(Data::value_type(1, 20));
+
+      CHECK(!result.second);
+      CHECK_EQUAL(10, result.first->second);
+      CHECK_EQUAL(1U, data.size());
+    }
+
+    //*************************************************************************
+    TEST(test_insert_when_full)
+    {
+      Data data;
+
+      for (int i = 0; i < int(SIZE); ++i)
+      {
+        data.insert(Data::value_type(i, i));
+      }
+
+      CHECK_THROW(data.insert(Data::value_type(int(SIZE), 0)), etl::unordered_flat_map_full);
+      CHECK_THROW(data[int(SIZE)], etl::unordered_flat_map_full);
+
+      // An existing key is still found.
+      CHECK_EQUAL(3, data.insert(Data::value_type(3, 0)).first->second);
+    }
+
+    //*************************************************************************
+    TEST(test_index_operator_when_full_does_not_change_the_map)
+    {
+      Data data;
+      std::map<int, int> compare;
+
+      for (int i = 0; i < int(SIZE); ++i)
+      {
+        data[i]    = i;
+        compare[i] = i;
+      }
+
+      CHECK_THROW(data[int(SIZE)] = 99, etl::unordered_flat_map_full);
+      CHECK_THROW(data[int(SIZE) + 1] = 99, etl::unordered_flat_map_full);
+
+      CHECK(Check_Equal(data, compare));
+      CHECK(!data.contains(int(SIZE)));
+
+      // Another map is unaffected.
+      Data other;
+      CHECK_EQUAL(0, other[int(SIZE)]);
+    }
+
+    //*************************************************************************
+    TEST(test_zero_size)
+    {
+      etl::unordered_flat_map<int, int, 0> data;
+
+      CHECK(data.empty());
+      CHECK(data.full());
+      CHECK_EQUAL(0U, data.max_size());
+      CHECK(data.begin() == data.end());
+      CHECK(data.find(1) == data.end());
+      CHECK_EQUAL(0U, data.erase(1));
+      CHECK_THROW(data.insert(ETL_OR_STD::make_pair(1, 1)), etl::unordered_flat_map_full);
+      CHECK_THROW(data[1], etl::unordered_flat_map_full);
+      CHECK(data.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_index_operator)
+    {
+      Data data;
+
+      data[1] = 10;
+      data[2] = 20;
+      data[1] += 1;
+
+      CHECK_EQUAL(2U, data.size());
+      CHECK_EQUAL(11, data[1]);
+      CHECK_EQUAL(20, data[2]);
+      CHECK_EQUAL(0,  data[3]);
+      CHECK_EQUAL(3U, data.size());
+    }
+
+    //*************************************************************************
+    TEST(test_at)
+    {
+      Data data;
+      const Data& cdata = data;
+
+      data[1] = 10;
+
+      CHECK_EQUAL(10, data.at(1));
+      CHECK_EQUAL(10, cdata.at(1));
+      CHECK_THROW(data.at(2), etl::unordered_flat_map_out_of_range);
+      CHECK_THROW(cdata.at(2), etl::unordered_flat_map_out_of_range);
+    }
+
+    //*************************************************************************
+    TEST(test_erase_key)
+    {
+      Data data;
+
+      for (int i = 0; i < int(SIZE); ++i)
+      {
+        data[i] = i;
+      }
+
+      CHECK_EQUAL(1U, data.erase(4));
+      CHECK_EQUAL(0U, data.erase(4));
+      CHECK_EQUAL(SIZE - 1U, data.size());
+      CHECK(data.find(4) == data.end());
+
+      for (int i = 0; i < int(SIZE); ++i)
+      {
+        if (i != 4)
+        {
+          CHECK_EQUAL(i, data.at(i));
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_erase_iterator)
+    {
+      DataColliding data;
+      std::map<int, int> compare;
+
+      for (int i = 0; i < int(SIZE); ++i)
+      {
+        data[i]    = i;
+        compare[i] = i;
+      }
+
+      // Erase every element through the returned iterators.
+      DataColliding::iterator itr = data.begin();
+      size_t erased = 0U;
+
+      while (itr != data.end())
+      {
+        compare.erase(itr->first);
+        itr = data.erase(itr);
+        ++erased;
+
+        CHECK(Check_Equal(data, compare));
+      }
+
+      CHECK_EQUAL(SIZE, erased);
+      CHECK(data.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_erase_iterator_selective)
+    {
+      DataColliding data;
+      std::map<int, int> compare;
+
+      for (int i = 0; i < int(SIZE); ++i)
+      {
+        data[i]    = i;
+        compare[i] = i;
+      }
+
+      // Erase the even keys while iterating.
+      DataColliding::iterator itr = data.begin();
+      size_t visited = 0U;
+
+      while (itr != data.end())
+      {
+        ++visited;
+
+        if ((itr->first % 2) == 0)
+        {
+          compare.erase(itr->first);
+          itr = data.erase(itr);
+        }
+        else
+        {
+          ++itr;
+        }
+      }
+
+      CHECK_EQUAL(SIZE, visited);
+      CHECK(Check_Equal(data, compare));
+    }
+
+    //*************************************************************************
+    TEST(test_erase_range)
+    {
+      DataColliding data;
+
+      for (int i = 0; i < int(SIZE); ++i)
+      {
+        data[i] = i;
+      }
+
+      DataColliding::iterator first = data.begin();
+      DataColliding::iterator last  = data.begin();
+      std::advance(first, 2);
+      std::advance(last,  7);
+
+      std::map<int, int> compare;
+      std::map<int, int> erased;
+      DataColliding::iterator itr = data.begin();
+
+      for (int i = 0; itr != data.end(); ++itr, ++i)
+      {
+        if ((i >= 2) && (i < 7))
+        {
+          erased[itr->first] = itr->second;
+        }
+        else
+        {
+          compare[itr->first] = itr->second;
+        }
+      }
+
+      int last_key = last->first;
+
+      DataColliding::iterator result = data.erase(first, last);
+
+      CHECK_EQUAL(last_key, result->first);
+      CHECK(Check_Equal(data, compare));
+
+      data.erase(data.begin(), data.end());
+      CHECK(data.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_clear)
+    {
+      Data data;
+
+      for (int i = 0; i < int(SIZE); ++i)
+      {
+        data[i] = i;
+      }
+
+      data.clear();
+
+      CHECK(data.empty());
+      CHECK(data.begin() == data.end());
+
+      data[1] = 1;
+      CHECK_EQUAL(1U, data.size());
+    }
+
+    //*************************************************************************
+    TEST(test_iteration)
+    {
+      Data data;
+      std::map<int, int> compare;
+
+      for (int i = 0; i < int(SIZE); ++i)
+      {
+        data[i * 7]    = i;
+        compare[i * 7] = i;
+      }
+
+      CHECK_EQUAL(SIZE, size_t(std::distance(data.begin(), data.end())));
+      CHECK_EQUAL(SIZE, size_t(std::distance(data.cbegin(), data.cend())));
+      CHECK(Check_Equal(data, compare));
+    }
+
+    //*************************************************************************
+    TEST(test_colliding_hashes)
+    {
+      DataColliding data;
+      std::map<int, int> compare;
+
+      for (int i = 0; i < int(SIZE); ++i)
+      {
+        data[i * 3]    = i;
+        compare[i * 3] = i;
+      }
+
+      CHECK(Check_Equal(data, compare));
+
+      for (int i = 0; i < int(SIZE); ++i)
+      {
+        CHECK(!data.contains((i * 3) + 1));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_colliding_hashes_beyond_255)
+    {
+      // Probe distances beyond 255 must not reduce the capacity.
+      static const size_t Large_Size = 300;
+
+      etl::unordered_flat_map<int, int, Large_Size, same_hash> data;
+      std::map<int, int> compare;
+
+      for (int i = 0; i < int(Large_Size); ++i)
+      {
+        CHECK(!data.full());
+        data[i]    = i;
+        compare[i] = i;
+      }
+
+      CHECK(data.full());
+      CHECK_EQUAL(Large_Size, data.size());
+      CHECK(Check_Equal(data, compare));
+      CHECK_THROW(data[int(Large_Size)], etl::unordered_flat_map_full);
+      CHECK_EQUAL(Large_Size, data.size());
+
+      data.erase(0);
+      compare.erase(0);
+      CHECK(Check_Equal(data, compare));
+      CHECK(data.insert(ETL_OR_STD::make_pair(int(Large_Size), 1)).second);
+      CHECK(data.full());
+    }
+
+    //*************************************************************************
+    TEST(test_wrap_around)
+    {
+      etl::unordered_flat_map<int, int, SIZE, wrapping_hash> data;
+
+      // Key 0 is in the last slot. The rest wrap around to the first slots.
+      for (int i = 0; i < 5; ++i)
+      {
+        data[i] = i * 10;
+      }
+
+      CHECK_EQUAL(5U, data.size());
+
+      for (int i = 0; i < 5; ++i)
+      {
+        CHECK_EQUAL(i * 10, data.at(i));
+      }
+
+      std::vector<int> keys;
+
+      for (auto itr = data.begin(); itr != data.end(); ++itr)
+      {
+        keys.push_back(itr->first);
+      }
+
+      std::vector<int> expected = { 1, 2, 3, 4, 0 };
+      CHECK(keys == expected);
+
+      // Erasing the last slot shifts the wrapped elements back across the end.
+      CHECK_EQUAL(1U, data.erase(0));
+      CHECK(!data.contains(0));
+
+      keys.clear();
+
+      for (auto itr = data.begin(); itr != data.end(); ++itr)
+      {
+        keys.push_back(itr->first);
+      }
+
+      expected = { 2, 3, 4, 1 };
+      CHECK(keys == expected);
+
+      for (int i = 1; i < 5; ++i)
+      {
+        CHECK_EQUAL(i * 10, data.at(i));
+      }
+
+      // A key that is not present is not found, after probing across the end.
+      CHECK(data.find(5) == data.end());
+      CHECK(data.find(105) == data.end());
+    }
+
+    //*************************************************************************
+    TEST(test_erase_range_to_end_across_the_wrap)
+    {
+      etl::unordered_flat_map<int, int, SIZE, wrapping_hash> data;
+
+      for (int i = 0; i < 5; ++i)
+      {
+        data[i] = i;
+      }
+
+      // Only key 0, in the last slot, is in the range.
+      // The element shifted from the first slot must not be erased.
+      auto itr = data.erase(data.find(0), data.end());
+
+      CHECK(itr == data.end());
+      CHECK_EQUAL(4U, data.size());
+      CHECK(!data.contains(0));
+
+      for (int i = 1; i < 5; ++i)
+      {
+        CHECK(data.contains(i));
+      }
+
+      // Key 1 was shifted in to the last slot.
+      // Erasing the last slot by iterator returns end().
+      itr = data.erase(data.find(1));
+      CHECK(itr == data.end());
+      CHECK_EQUAL(3U, data.size());
+
+      for (itr = data.begin(); itr != data.end();)
+      {
+        itr = data.erase(itr);
+      }
+
+      CHECK(data.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_random_operations_across_the_wrap)
+    {
+      using DataWrapping = etl::unordered_flat_map<int, int, 30, wrapping_hash>;
+
+      DataWrapping data;
+      std::map<int, int> compare;
+      std::mt19937 generator(54321);
+      std::uniform_int_distribution<int> key_distribution(0, 40);
+
+      for (int i = 0; i < 20000; ++i)
+      {
+        // Half of the keys share the last slot, so runs wrap around.
+        int key = key_distribution(generator);
+        key = ((key % 2) == 0) ? key : key + 100;
+
+        switch (generator() % 5)
+        {
+          case 0:
+          {
+            CHECK_EQUAL(compare.erase(key), data.erase(key));
+            break;
+          }
+
+          case 1:
+          {
+            DataWrapping::iterator itr = data.find(key);
+
+            if (itr != data.end())
+            {
+              data.erase(itr);
+              compare.erase(key);
+            }
+            break;
+          }
+
+          case 2:
+          {
+            // Erase a short range, from a key up to at most 3 elements after it.
+            DataWrapping::iterator first = data.find(key);
+            DataWrapping::iterator last  = first;
+
+            for (int n = 0; (n < 3) && (last != data.end()); ++n)
+            {
+              compare.erase(last->first);
+              ++last;
+            }
+
+            data.erase(first, last);
+            break;
+          }
+
+          default:
+          {
+            if (!data.full() || data.contains(key))
+            {
+              data[key]    = i;
+              compare[key] = i;
+            }
+            break;
+          }
+        }
+
+        if ((i % 64) == 0)
+        {
+          CHECK(Check_Equal(data, compare));
+        }
+      }
+
+      CHECK(Check_Equal(data, compare));
+
+      // Erase selectively while iterating.
+      for (DataWrapping::iterator itr = data.begin(); itr != data.end();)
+      {
+        if ((itr->second % 2) == 0)
+        {
+          compare.erase(itr->first);
+          itr = data.erase(itr);
+        }
+        else
+        {
+          ++itr;
+        }
+      }
+
+      CHECK(Check_Equal(data, compare));
+    }
+
+    //*************************************************************************
+    TEST(test_random_operations)
+    {
+      using DataLarge = etl::unordered_flat_map<int, int, 200>;
+
+      DataLarge data;
+      std::map<int, int> compare;
+      std::mt19937 generator(12345);
+      std::uniform_int_distribution<int> key_distribution(0, 400);
+
+      for (int i = 0; i < 20000; ++i)
+      {
+        int key = key_distribution(generator);
+
+        if ((generator() % 3) == 0)
+        {
+          CHECK_EQUAL(compare.erase(key), data.erase(key));
+        }
+        else if (!data.full())
+        {
+          data[key]    = i;
+          compare[key] = i;
+        }
+        else
+        {
+          CHECK_EQUAL(compare.count(key), data.count(key));
+        }
+      }
+
+      CHECK(Check_Equal(data, compare));
+    }
+
+    //*************************************************************************
+    TEST(test_equal_range)
+    {
+      Data data;
+
+      data[1] = 1;
+
+      ETL_OR_STD::pair<Data::iterator, Data::iterator> range = data.equal_range(1);
+      CHECK_EQUAL(1, std::distance(range.first, range.second));
+      CHECK_EQUAL(1, range.first->first);
+
+      range = data.equal_range(2);
+      CHECK(range.first  == data.end());
+      CHECK(range.second == data.end());
+    }
+
+    //*************************************************************************
+    TEST(test_copy_construct_and_assign)
+    {
+      Data data;
+
+      for (int i = 0; i < int(SIZE); ++i)
+      {
+        data[i] = i;
+      }
+
+      Data copy(data);
+      CHECK(copy == data);
+
+      Data other;
+      other[100] = 100;
+      other = data;
+      CHECK(other == data);
+
+      other[1] = 2;
+      CHECK(other != data);
+
+      IData& idata = other;
+      idata = data;
+      CHECK(other == data);
+    }
+
+    //*************************************************************************
+    TEST(test_move_construct_and_assign)
+    {
+      DataMovable data;
+
+      data[1] = std::unique_ptr<int>(new int(1));
+      data[2] = std::unique_ptr<int>(new int(2));
+
+      DataMovable moved(std::move(data));
+      CHECK_EQUAL(2U, moved.size());
+      CHECK_EQUAL(1, *moved[1]);
+      CHECK_EQUAL(2, *moved[2]);
+
+      DataMovable other;
+      other = std::move(moved);
+      CHECK_EQUAL(2U, other.size());
+      CHECK_EQUAL(1, *other[1]);
+      CHECK_EQUAL(2, *other[2]);
+
+      other.insert(DataMovable::value_type(3, std::unique_ptr<int>(new int(3))));
+      CHECK_EQUAL(3, *other.at(3));
+    }
+
+    //*************************************************************************
+    TEST(test_initializer_list_and_iterator_constructors)
+    {
+      Data data = { Data::value_type(1, 10), Data::value_type(2, 20), Data::value_type(3, 30) };
+
+      CHECK_EQUAL(3U, data.size());
+      CHECK_EQUAL(20, data.at(2));
+
+      std::vector<Data::value_type> values = { Data::value_type(4, 40), Data::value_type(5, 50) };
+      Data data2(values.begin(), values.end());
+
+      CHECK_EQUAL(2U, data2.size());
+      CHECK_EQUAL(50, data2.at(5));
+    }
+
+    //*************************************************************************
+    TEST(test_string_keys)
+    {
+      DataString data;
+
+      data["one"]   = 1;
+      data["two"]   = 2;
+      data["three"] = 3;
+
+      CHECK_EQUAL(1, data.at("one"));
+      CHECK_EQUAL(2, data.at("two"));
+      CHECK_EQUAL(3, data.at("three"));
+      CHECK(!data.contains("four"));
+    }
+
+    //*************************************************************************
+    TEST(test_transparent_comparator)
+    {
+      DataTransparent data;
+
+      data[std::string("one")] = 1;
+      data[std::string("two")] = 2;
+
+      CHECK(data.contains("one"));
+      CHECK(!data.contains("three"));
+      CHECK_EQUAL(1U, data.count("two"));
+      CHECK_EQUAL(2, data.find("two")->second);
+      CHECK_EQUAL(1, data.at("one"));
+
+      data["three"] = 3;
+      CHECK_EQUAL(3, data.at(std::string("three")));
+
+      CHECK_EQUAL(1U, data.erase("one"));
+      CHECK(!data.contains(std::string("one")));
+    }
+
+    //*************************************************************************
+    TEST(test_ext)
+    {
+      static const size_t Ext_Size  = 20;
+      static const size_t Ext_Slots = etl::unordered_flat_map_dimensions<Ext_Size>::Slots;
+
+      etl::uninitialized_buffer_of<DataExt::value_type, Ext_Slots> value_buffer;
+      DataExt::distance_type distance_buffer[Ext_Slots];
+
+      DataExt data(value_buffer, distance_buffer, Ext_Size);
+      std::map<int, int> compare;
+
+      CHECK_EQUAL(Ext_Size, data.max_size());
+
+      for (int i = 0; i < int(Ext_Size); ++i)
+      {
+        data[i * 5]    = i;
+        compare[i * 5] = i;
+      }
+
+      CHECK(data.full());
+      CHECK(Check_Equal(data, compare));
+      CHECK_THROW(data[1000], etl::unordered_flat_map_full);
+
+      data.erase(10);
+      compare.erase(10);
+      CHECK(Check_Equal(data, compare));
+
+      etl::uninitialized_buffer_of<DataExt::value_type, Ext_Slots> value_buffer2;
+      DataExt::distance_type distance_buffer2[Ext_Slots];
+
+      DataExt copy(data, value_buffer2, distance_buffer2, Ext_Size);
+      CHECK(copy == data);
+    }
+  };
+}
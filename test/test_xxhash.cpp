@@ -0,0 +1,209 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include <iterator>
+#include <string>
+#include <vector>
+#include <list>
+#include <stdint.h>
+
+#include "etl/xxhash.h"
+
+namespace
+{
+  const std::string text("Nobody inspects the spammish repetition");
+
+  std::vector<uint8_t> make_data(size_t length)
+  {
+    std::vector<uint8_t> data(length);
+
+    for (size_t i = 0UL; i < length; ++i)
+    {
+      data[i] = uint8_t((i * 37U) + 11U);
+    }
+
+    return data;
+  }
+
+  SUITE(test_xxhash)
+  {
+    //*************************************************************************
+    TEST(test_xxhash32_known_values)
+    {
+      std::string empty;
+      std::string a("a");
+      std::string abc("abc");
+
+      CHECK_EQUAL(0x02CC5D05UL, etl::xxhash32(empty.begin(), empty.end()).value());
+      CHECK_EQUAL(0x550D7456UL, etl::xxhash32(a.begin(), a.end()).value());
+      CHECK_EQUAL(0x32D153FFUL, etl::xxhash32(abc.begin(), abc.end()).value());
+      CHECK_EQUAL(0xE2293B2FUL, etl::xxhash32(text.begin(), text.end()).value());
+    }
+
+    //*************************************************************************
+    TEST(test_xxhash32_add_values)
+    {
+      etl::xxhash32 xxhash32_calculator;
+
+      for (size_t i = 0UL; i < text.size(); ++i)
+      {
+        xxhash32_calculator.add(text[i]);
+      }
+
+      uint32_t hash = xxhash32_calculator;
+
+      CHECK_EQUAL(0xE2293B2FUL, hash);
+    }
+
+    //*************************************************************************
+    TEST(test_xxhash32_add_range_via_iterator)
+    {
+      etl::xxhash32 xxhash32_calculator;
+
+      std::copy(text.begin(), text.end(), xxhash32_calculator.input());
+
+      CHECK_EQUAL(0xE2293B2FUL, xxhash32_calculator.value());
+    }
+
+    //*************************************************************************
+    TEST(test_xxhash32_seed)
+    {
+      etl::xxhash32 xxhash32_calculator(0x12345678UL);
+      xxhash32_calculator.add(text.begin(), text.end());
+
+      uint32_t hash1 = xxhash32_calculator.value();
+      uint32_t hash2 = etl::xxhash32(text.begin(), text.end(), 0x12345678UL);
+      uint32_t hash3 = etl::xxhash32(text.begin(), text.end());
+
+      CHECK_EQUAL(hash1, hash2);
+      CHECK(hash1 != hash3);
+
+      xxhash32_calculator.reset();
+      xxhash32_calculator.add(text.begin(), text.end());
+
+      CHECK_EQUAL(hash1, xxhash32_calculator.value());
+    }
+
+    //*************************************************************************
+    TEST(test_xxhash32_add_range_blocks)
+    {
+      std::vector<uint8_t> data = make_data(200U);
+      std::list<uint8_t>   data_list(data.begin(), data.end());
+
+      for (size_t length = 0UL; length <= data.size(); ++length)
+      {
+        const uint8_t* begin = data.data();
+        const uint8_t* split = begin + (length / 3U);
+
+        etl::xxhash32 by_range;
+        by_range.add(begin, split);
+        by_range.add(split, begin + length);
+
+        std::list<uint8_t>::const_iterator end_list = data_list.begin();
+        std::advance(end_list, length);
+
+        etl::xxhash32 by_value(data_list.cbegin(), end_list);
+
+        CHECK_EQUAL(by_value.value(), by_range.value());
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_xxhash64_known_values)
+    {
+      std::string empty;
+      std::string a("a");
+      std::string abc("abc");
+
+      CHECK_EQUAL(0xEF46DB3751D8E999ULL, etl::xxhash64(empty.begin(), empty.end()).value());
+      CHECK_EQUAL(0xD24EC4F1A98C6E5BULL, etl::xxhash64(a.begin(), a.end()).value());
+      CHECK_EQUAL(0x44BC2CF5AD770999ULL, etl::xxhash64(abc.begin(), abc.end()).value());
+      CHECK_EQUAL(0xFBCEA83C8A378BF1ULL, etl::xxhash64(text.begin(), text.end()).value());
+    }
+
+    //*************************************************************************
+    TEST(test_xxhash64_add_values)
+    {
+      etl::xxhash64 xxhash64_calculator;
+
+      for (size_t i = 0UL; i < text.size(); ++i)
+      {
+        xxhash64_calculator.add(text[i]);
+      }
+
+      uint64_t hash = xxhash64_calculator;
+
+      CHECK_EQUAL(0xFBCEA83C8A378BF1ULL, hash);
+    }
+
+    //*************************************************************************
+    TEST(test_xxhash64_seed)
+    {
+      etl::xxhash64 xxhash64_calculator(0x0123456789ABCDEFULL);
+      xxhash64_calculator.add(text.begin(), text.end());
+
+      uint64_t hash1 = xxhash64_calculator.value();
+      uint64_t hash2 = etl::xxhash64(text.begin(), text.end(), 0x0123456789ABCDEFULL);
+      uint64_t hash3 = etl::xxhash64(text.begin(), text.end());
+
+      CHECK_EQUAL(hash1, hash2);
+      CHECK(hash1 != hash3);
+
+      xxhash64_calculator.reset();
+      xxhash64_calculator.add(text.begin(), text.end());
+
+      CHECK_EQUAL(hash1, xxhash64_calculator.value());
+    }
+
+    //*************************************************************************
+    TEST(test_xxhash64_add_range_blocks)
+    {
+      std::vector<uint8_t> data = make_data(200U);
+      std::list<uint8_t>   data_list(data.begin(), data.end());
+
+      for (size_t length = 0UL; length <= data.size(); ++length)
+      {
+        const uint8_t* begin = data.data();
+        const uint8_t* split = begin + (length / 3U);
+
+        etl::xxhash64 by_range;
+        by_range.add(begin, split);
+        by_range.add(split, begin + length);
+
+        std::list<uint8_t>::const_iterator end_list = data_list.begin();
+        std::advance(end_list, length);
+
+        etl::xxhash64 by_value(data_list.cbegin(), end_list);
+
+        CHECK_EQUAL(by_value.value(), by_range.value());
+      }
+    }
+  };
+}